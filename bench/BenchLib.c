@@ -0,0 +1,478 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//----------------------------------------------------------------------------
+
+
+//----------------------------------------------------------------------------
+// BenchLib.c
+//   Implementation of the harness used by all benchmarks. Each case is first
+// calibrated to find a number of iterations that takes at least the minimum
+// sample time; a number of samples are then taken and the median, fastest and
+// slowest times per operation are reported, along with the throughput and the
+// number of memory allocations per operation.
+//----------------------------------------------------------------------------
+
+#define DPI_BENCH_NO_REDIRECT
+#include "BenchLib.h"
+
+#define DPI_BENCH_MAX_CASES             64
+#define DPI_BENCH_MAX_SAMPLES           101
+#define DPI_BENCH_DEFAULT_SAMPLES       7
+#define DPI_BENCH_DEFAULT_MIN_TIME_MS   50
+
+// global state for the benchmark suite
+static struct {
+    const char *name;
+    const char *filter;
+    int jsonOutput;
+    uint32_t numSamples;
+    uint64_t minSampleNs;
+    uint32_t numCases;
+    dpiBenchCase cases[DPI_BENCH_MAX_CASES];
+} gBenchSuite;
+
+// number of allocations performed by the library (benchmarks are single
+// threaded so no synchronization is required)
+static uint64_t gNumAllocs = 0;
+
+// sink used to prevent results from being optimized away
+static volatile uint64_t gSink = 0;
+
+// error buffer passed to internal functions
+static dpiErrorBuffer gErrorBuffer;
+static dpiError gError;
+
+
+//-----------------------------------------------------------------------------
+// dpiBench__compareDoubles() [INTERNAL]
+//   Compare two doubles for sorting.
+//-----------------------------------------------------------------------------
+static int dpiBench__compareDoubles(const void *value1, const void *value2)
+{
+    double d1 = *(const double*) value1, d2 = *(const double*) value2;
+
+    return (d1 < d2) ? -1 : (d1 > d2) ? 1 : 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBench__runSample() [INTERNAL]
+//   Run a single sample of the case and return the elapsed time.
+//-----------------------------------------------------------------------------
+static int dpiBench__runSample(dpiBenchCase *benchCase, uint64_t numIters,
+        uint64_t *elapsedNs)
+{
+    uint64_t startNs;
+
+    startNs = dpiBench_getTimeNs();
+    if ((*benchCase->func)(benchCase, numIters) < 0 || benchCase->skipped)
+        return -1;
+    *elapsedNs = dpiBench_getTimeNs() - startNs;
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBench__runCase() [INTERNAL]
+//   Calibrate and then run the samples for the case.
+//-----------------------------------------------------------------------------
+static int dpiBench__runCase(dpiBenchCase *benchCase)
+{
+    double samples[DPI_BENCH_MAX_SAMPLES], factor;
+    uint64_t elapsedNs, numIters, startAllocs;
+    uint32_t i;
+
+    // one shot results have already been measured
+    if (benchCase->isOneShot)
+        return 0;
+
+    // warm up caches and perform any lazy initialization
+    if (dpiBench__runSample(benchCase, 1, &elapsedNs) < 0)
+        return -1;
+
+    // determine the number of iterations required to reach the minimum
+    // sample time
+    numIters = 1;
+    while (1) {
+        if (dpiBench__runSample(benchCase, numIters, &elapsedNs) < 0)
+            return -1;
+        if (elapsedNs >= gBenchSuite.minSampleNs)
+            break;
+        factor = (elapsedNs == 0) ? 100 :
+                1.2 * (double) gBenchSuite.minSampleNs / (double) elapsedNs;
+        if (factor < 2)
+            factor = 2;
+        else if (factor > 100)
+            factor = 100;
+        numIters = (uint64_t) ((double) numIters * factor);
+    }
+    benchCase->numIters = numIters;
+
+    // take the samples
+    startAllocs = gNumAllocs;
+    for (i = 0; i < gBenchSuite.numSamples; i++) {
+        if (dpiBench__runSample(benchCase, numIters, &elapsedNs) < 0)
+            return -1;
+        samples[i] = (double) elapsedNs / (double) numIters;
+    }
+    benchCase->numAllocs = gNumAllocs - startAllocs;
+
+    // calculate results
+    qsort(samples, gBenchSuite.numSamples, sizeof(double),
+            dpiBench__compareDoubles);
+    benchCase->nsPerOp = samples[gBenchSuite.numSamples / 2];
+    benchCase->minNsPerOp = samples[0];
+    benchCase->maxNsPerOp = samples[gBenchSuite.numSamples - 1];
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBench__getNumOps() [INTERNAL]
+//   Return the total number of operations measured for the case.
+//-----------------------------------------------------------------------------
+static uint64_t dpiBench__getNumOps(dpiBenchCase *benchCase)
+{
+    if (benchCase->isOneShot)
+        return 1;
+    return benchCase->numIters * gBenchSuite.numSamples;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBench__printJson() [INTERNAL]
+//   Print the results of the suite in JSON format.
+//-----------------------------------------------------------------------------
+static void dpiBench__printJson(void)
+{
+    dpiBenchCase *benchCase;
+    uint64_t numOps;
+    int needComma;
+    uint32_t i;
+
+    printf("{\n");
+    printf("  \"suite\": \"%s\",\n", gBenchSuite.name);
+    printf("  \"version\": \"%s\",\n", DPI_VERSION_STRING);
+    printf("  \"samples\": %u,\n", gBenchSuite.numSamples);
+    printf("  \"cases\": [");
+    needComma = 0;
+    for (i = 0; i < gBenchSuite.numCases; i++) {
+        benchCase = &gBenchSuite.cases[i];
+        if (!benchCase->numIters && !benchCase->failed &&
+                !benchCase->skipped)
+            continue;
+        printf("%s\n    {\n", (needComma) ? "," : "");
+        needComma = 1;
+        printf("      \"name\": \"%s\",\n", benchCase->name);
+        if (benchCase->skipped || benchCase->failed) {
+            printf("      \"%s\": true\n    }",
+                    (benchCase->skipped) ? "skipped" : "failed");
+            continue;
+        }
+        numOps = dpiBench__getNumOps(benchCase);
+        printf("      \"iterations\": %" PRIu64 ",\n", benchCase->numIters);
+        printf("      \"nsPerOp\": %.3f,\n", benchCase->nsPerOp);
+        printf("      \"minNsPerOp\": %.3f,\n", benchCase->minNsPerOp);
+        printf("      \"maxNsPerOp\": %.3f,\n", benchCase->maxNsPerOp);
+        printf("      \"opsPerSec\": %.1f,\n", 1e9 / benchCase->nsPerOp);
+        printf("      \"bytesPerSec\": %.1f,\n",
+                1e9 * (double) benchCase->bytesPerOp / benchCase->nsPerOp);
+        printf("      \"allocsPerOp\": %.3f\n    }",
+                (double) benchCase->numAllocs / (double) numOps);
+    }
+    printf("\n  ]\n}\n");
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBench__printText() [INTERNAL]
+//   Print the results of a single case in text format.
+//-----------------------------------------------------------------------------
+static void dpiBench__printText(dpiBenchCase *benchCase)
+{
+    uint64_t numOps;
+
+    if (benchCase->skipped || benchCase->failed) {
+        printf("%-44s %s\n", benchCase->name,
+                (benchCase->skipped) ? "SKIPPED" : "FAILED");
+        return;
+    }
+    numOps = dpiBench__getNumOps(benchCase);
+    printf("%-44s %12.2f %12.2f %14.0f %10.2f", benchCase->name,
+            benchCase->nsPerOp, benchCase->minNsPerOp,
+            1e9 / benchCase->nsPerOp,
+            (double) benchCase->numAllocs / (double) numOps);
+    if (benchCase->bytesPerOp > 0)
+        printf(" %10.1f MB/s", 1e3 * (double) benchCase->bytesPerOp /
+                benchCase->nsPerOp);
+    printf("\n");
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBench__usage() [INTERNAL]
+//   Print usage information and exit.
+//-----------------------------------------------------------------------------
+static void dpiBench__usage(const char *programName)
+{
+    fprintf(stderr, "Usage: %s [--json] [--samples N] [--min-time-ms N] "
+            "[--filter TEXT]\n", programName);
+    exit(1);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBench_calloc()
+//   Counting version of calloc().
+//-----------------------------------------------------------------------------
+void *dpiBench_calloc(size_t numMembers, size_t memberSize)
+{
+    gNumAllocs++;
+    return calloc(numMembers, memberSize);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBench_consume()
+//   Prevent the compiler from optimizing away the result of an operation.
+//-----------------------------------------------------------------------------
+void dpiBench_consume(uint64_t value)
+{
+    gSink += value;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBench_getError()
+//   Return an error structure that can be passed to internal functions.
+//-----------------------------------------------------------------------------
+dpiError *dpiBench_getError(void)
+{
+    gError.buffer = &gErrorBuffer;
+    gError.handle = NULL;
+    gError.env = NULL;
+    return &gError;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBench_getNumAllocs()
+//   Return the number of allocations performed so far.
+//-----------------------------------------------------------------------------
+uint64_t dpiBench_getNumAllocs(void)
+{
+    return gNumAllocs;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBench_getTimeNs()
+//   Return a monotonic time in nanoseconds.
+//-----------------------------------------------------------------------------
+uint64_t dpiBench_getTimeNs(void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+
+    if (frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (uint64_t) ((double) counter.QuadPart * 1e9 /
+            (double) frequency.QuadPart);
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+#endif
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBench_malloc()
+//   Counting version of malloc().
+//-----------------------------------------------------------------------------
+void *dpiBench_malloc(size_t size)
+{
+    gNumAllocs++;
+    return malloc(size);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBench_realloc()
+//   Counting version of realloc().
+//-----------------------------------------------------------------------------
+void *dpiBench_realloc(void *ptr, size_t size)
+{
+    gNumAllocs++;
+    return realloc(ptr, size);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBenchCase_setFailed()
+//   Set the case as failed and print the message (and any error in the error
+// buffer) to stderr.
+//-----------------------------------------------------------------------------
+int dpiBenchCase_setFailed(dpiBenchCase *benchCase, const char *message)
+{
+    benchCase->failed = 1;
+    fprintf(stderr, "%s: %s\n", benchCase->name, message);
+    if (gErrorBuffer.messageLength > 0)
+        fprintf(stderr, "    %.*s\n", gErrorBuffer.messageLength,
+                gErrorBuffer.message);
+    return -1;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBenchCase_setSkipped()
+//   Set the case as skipped and print the reason to stderr.
+//-----------------------------------------------------------------------------
+int dpiBenchCase_setSkipped(dpiBenchCase *benchCase, const char *message)
+{
+    benchCase->skipped = 1;
+    fprintf(stderr, "%s: skipped: %s\n", benchCase->name, message);
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBenchSuite_addCase()
+//   Add a case to the benchmark suite.
+//-----------------------------------------------------------------------------
+void dpiBenchSuite_addCase(dpiBenchCaseFunction func, const char *name,
+        uint64_t bytesPerOp)
+{
+    dpiBenchCase *benchCase;
+
+    if (gBenchSuite.numCases == DPI_BENCH_MAX_CASES) {
+        fprintf(stderr, "too many benchmark cases\n");
+        exit(1);
+    }
+    benchCase = &gBenchSuite.cases[gBenchSuite.numCases++];
+    memset(benchCase, 0, sizeof(dpiBenchCase));
+    benchCase->name = name;
+    benchCase->func = func;
+    benchCase->bytesPerOp = bytesPerOp;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBenchSuite_addOneShotResult()
+//   Add the result of an operation that can only be measured once per
+// process.
+//-----------------------------------------------------------------------------
+void dpiBenchSuite_addOneShotResult(const char *name, uint64_t elapsedNs,
+        uint64_t numAllocs, const char *skipMessage)
+{
+    dpiBenchCase *benchCase;
+
+    dpiBenchSuite_addCase(NULL, name, 0);
+    benchCase = &gBenchSuite.cases[gBenchSuite.numCases - 1];
+    benchCase->isOneShot = 1;
+    if (skipMessage) {
+        dpiBenchCase_setSkipped(benchCase, skipMessage);
+        return;
+    }
+    benchCase->numIters = 1;
+    benchCase->numAllocs = numAllocs;
+    benchCase->nsPerOp = (double) elapsedNs;
+    benchCase->minNsPerOp = (double) elapsedNs;
+    benchCase->maxNsPerOp = (double) elapsedNs;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBenchSuite_initialize()
+//   Initialize the benchmark suite and process the command line arguments.
+// The environment variable DPI_BENCH_FORMAT can also be set to the value
+// "json" in order to request JSON output.
+//-----------------------------------------------------------------------------
+void dpiBenchSuite_initialize(const char *suiteName, int argc, char **argv)
+{
+    const char *envValue;
+    int i;
+
+    memset(&gBenchSuite, 0, sizeof(gBenchSuite));
+    gBenchSuite.name = suiteName;
+    gBenchSuite.numSamples = DPI_BENCH_DEFAULT_SAMPLES;
+    gBenchSuite.minSampleNs = (uint64_t) DPI_BENCH_DEFAULT_MIN_TIME_MS *
+            1000000;
+    envValue = getenv("DPI_BENCH_FORMAT");
+    if (envValue && strcmp(envValue, "json") == 0)
+        gBenchSuite.jsonOutput = 1;
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--json") == 0) {
+            gBenchSuite.jsonOutput = 1;
+        } else if (strcmp(argv[i], "--samples") == 0 && i + 1 < argc) {
+            gBenchSuite.numSamples = (uint32_t) atoi(argv[++i]);
+            if (gBenchSuite.numSamples < 1 ||
+                    gBenchSuite.numSamples > DPI_BENCH_MAX_SAMPLES)
+                dpiBench__usage(argv[0]);
+        } else if (strcmp(argv[i], "--min-time-ms") == 0 && i + 1 < argc) {
+            gBenchSuite.minSampleNs = (uint64_t) atoi(argv[++i]) * 1000000;
+        } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            gBenchSuite.filter = argv[++i];
+        } else dpiBench__usage(argv[0]);
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiBenchSuite_run()
+//   Run all of the cases in the suite and report the results. The value 0 is
+// returned if all cases completed successfully.
+//-----------------------------------------------------------------------------
+int dpiBenchSuite_run(void)
+{
+    dpiBenchCase *benchCase;
+    int numFailed = 0;
+    uint32_t i;
+
+    if (!gBenchSuite.jsonOutput) {
+        printf("ODPI-C %s benchmark suite: %s\n", DPI_VERSION_STRING,
+                gBenchSuite.name);
+        printf("%-44s %12s %12s %14s %10s\n", "case", "ns/op", "min ns/op",
+                "ops/sec", "allocs/op");
+    }
+    for (i = 0; i < gBenchSuite.numCases; i++) {
+        benchCase = &gBenchSuite.cases[i];
+        if (gBenchSuite.filter &&
+                !strstr(benchCase->name, gBenchSuite.filter))
+            continue;
+        if (dpiBench__runCase(benchCase) < 0 && !benchCase->skipped) {
+            benchCase->failed = 1;
+            numFailed++;
+        }
+        if (!gBenchSuite.jsonOutput) {
+            dpiBench__printText(benchCase);
+            fflush(stdout);
+        }
+    }
+    if (gBenchSuite.jsonOutput)
+        dpiBench__printJson();
+    return (numFailed == 0) ? 0 : 1;
+}
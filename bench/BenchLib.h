@@ -0,0 +1,110 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//----------------------------------------------------------------------------
+
+
+//----------------------------------------------------------------------------
+// BenchLib.h
+//   Header used for all benchmarks. The library sources are compiled directly
+// into each benchmark (via embed/dpi.c) so that internal functions can be
+// measured without requiring an Oracle Client library or a database.
+//----------------------------------------------------------------------------
+
+#ifndef DPI_BENCH_LIB
+#define DPI_BENCH_LIB
+
+#include "../src/dpiImpl.h"
+
+// forward declarations
+typedef struct dpiBenchCase dpiBenchCase;
+
+// function prototype for each benchmark case; the function must perform the
+// operation being measured the specified number of times
+typedef int (*dpiBenchCaseFunction)(dpiBenchCase *benchCase,
+        uint64_t numIters);
+
+// structure used for each benchmark case
+struct dpiBenchCase {
+    const char *name;                   // name of case
+    dpiBenchCaseFunction func;          // function to call
+    uint64_t bytesPerOp;                // bytes processed per op (or 0)
+    uint64_t numIters;                  // iterations per sample
+    uint64_t numAllocs;                 // allocations over all samples
+    double nsPerOp;                     // median ns/op over all samples
+    double minNsPerOp;                  // fastest sample (ns/op)
+    double maxNsPerOp;                  // slowest sample (ns/op)
+    int failed;                         // did the case fail?
+    int skipped;                        // was the case skipped?
+    int isOneShot;                      // single measurement only?
+};
+
+// return a monotonic time in nanoseconds
+uint64_t dpiBench_getTimeNs(void);
+
+// prevent the compiler from optimizing away the result of an operation
+void dpiBench_consume(uint64_t value);
+
+// return an error buffer that can be passed to internal functions
+dpiError *dpiBench_getError(void);
+
+// set case as failed and print the error that caused the failure
+int dpiBenchCase_setFailed(dpiBenchCase *benchCase, const char *message);
+
+// set case as skipped and print the reason
+int dpiBenchCase_setSkipped(dpiBenchCase *benchCase, const char *message);
+
+// add case to benchmark suite
+void dpiBenchSuite_addCase(dpiBenchCaseFunction func, const char *name,
+        uint64_t bytesPerOp);
+
+// add the result of an operation that can only be measured once per process
+// (such as loading the Oracle Client library); a NULL message indicates
+// success, otherwise the result is reported as skipped with that message
+void dpiBenchSuite_addOneShotResult(const char *name, uint64_t elapsedNs,
+        uint64_t numAllocs, const char *skipMessage);
+
+// return the number of allocations performed so far
+uint64_t dpiBench_getNumAllocs(void);
+
+// initialize benchmark suite and process command line arguments
+void dpiBenchSuite_initialize(const char *suiteName, int argc, char **argv);
+
+// run benchmark suite and report the results
+int dpiBenchSuite_run(void);
+
+// counting versions of the memory allocation routines
+void *dpiBench_calloc(size_t numMembers, size_t memberSize);
+void *dpiBench_malloc(size_t size);
+void *dpiBench_realloc(void *ptr, size_t size);
+
+// the memory allocation routines used by the library sources are redirected
+// so that the number of allocations per operation can be reported; the system
+// headers have already been included by dpiImpl.h at this point
+#ifndef DPI_BENCH_NO_REDIRECT
+#define calloc(numMembers, memberSize) \
+    dpiBench_calloc(numMembers, memberSize)
+#define malloc(size)                    dpiBench_malloc(size)
+#define realloc(ptr, size)              dpiBench_realloc(ptr, size)
+#endif
+
+#endif
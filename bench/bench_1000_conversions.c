@@ -0,0 +1,209 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// bench_1000_conversions.c
+//   Benchmarks for the conversion routines used when transferring numbers and
+// dates to and from Oracle formats.
+//-----------------------------------------------------------------------------
+
+#include "BenchLib.h"
+#include "../embed/dpi.c"
+
+#define NUM_DATES                       1024
+
+// numbers in text form
+static const char *gShortNumber = "12345";
+static const char *gLongNumber = "-1234567890.0123456789012345678";
+static const char *gExponentNumber = "1.23456789e-100";
+
+// numbers in Oracle form: 1234.5678, -1234.5678 and a number with the
+// maximum number of mantissa bytes (40 digits)
+static uint8_t gPositiveOracleNumber[DPI_OCI_NUMBER_SIZE] =
+        { 5, 0xC2, 13, 35, 57, 79 };
+static uint8_t gNegativeOracleNumber[DPI_OCI_NUMBER_SIZE] =
+        { 6, 0x3D, 89, 67, 45, 23, 102 };
+static uint8_t gLargeOracleNumber[DPI_OCI_NUMBER_SIZE] =
+        { 21, 0xC5, 13, 35, 57, 79, 91, 13, 35, 57, 79, 91, 13, 35, 57, 79,
+          91, 13, 35, 57, 79, 91 };
+
+// dates in Oracle form
+static dpiOciDate gDates[NUM_DATES];
+
+
+//-----------------------------------------------------------------------------
+// benchParseNumberString()
+//   Parse the given number in text form the specified number of times.
+//-----------------------------------------------------------------------------
+static int benchParseNumberString(dpiBenchCase *benchCase, uint64_t numIters,
+        const char *value)
+{
+    uint8_t digits[DPI_NUMBER_MAX_DIGITS], numDigits;
+    uint32_t valueLength = (uint32_t) strlen(value);
+    dpiError *error = dpiBench_getError();
+    int16_t decimalPointIndex;
+    int isNegative;
+    uint64_t i;
+
+    for (i = 0; i < numIters; i++) {
+        if (dpiUtils__parseNumberString(value, valueLength,
+                DPI_CHARSET_ID_UTF8, &isNegative, &decimalPointIndex,
+                &numDigits, digits, error) < 0)
+            return dpiBenchCase_setFailed(benchCase, "parse failed");
+        dpiBench_consume(numDigits + digits[0]);
+    }
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// benchParseOracleNumber()
+//   Parse the given number in Oracle form the specified number of times.
+//-----------------------------------------------------------------------------
+static int benchParseOracleNumber(dpiBenchCase *benchCase, uint64_t numIters,
+        uint8_t *value)
+{
+    uint8_t digits[DPI_NUMBER_MAX_DIGITS], numDigits;
+    dpiError *error = dpiBench_getError();
+    int16_t decimalPointIndex;
+    int isNegative;
+    uint64_t i;
+
+    for (i = 0; i < numIters; i++) {
+        if (dpiUtils__parseOracleNumber(value, &isNegative,
+                &decimalPointIndex, &numDigits, digits, error) < 0)
+            return dpiBenchCase_setFailed(benchCase, "parse failed");
+        dpiBench_consume(numDigits + digits[0]);
+    }
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1000()
+//   dpiUtils__parseNumberString() with a short integer.
+//-----------------------------------------------------------------------------
+int bench_1000(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchParseNumberString(benchCase, numIters, gShortNumber);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1001()
+//   dpiUtils__parseNumberString() with a long negative decimal.
+//-----------------------------------------------------------------------------
+int bench_1001(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchParseNumberString(benchCase, numIters, gLongNumber);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1002()
+//   dpiUtils__parseNumberString() with an exponent.
+//-----------------------------------------------------------------------------
+int bench_1002(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchParseNumberString(benchCase, numIters, gExponentNumber);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1003()
+//   dpiUtils__parseOracleNumber() with a positive number.
+//-----------------------------------------------------------------------------
+int bench_1003(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchParseOracleNumber(benchCase, numIters, gPositiveOracleNumber);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1004()
+//   dpiUtils__parseOracleNumber() with a negative number.
+//-----------------------------------------------------------------------------
+int bench_1004(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchParseOracleNumber(benchCase, numIters, gNegativeOracleNumber);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1005()
+//   dpiUtils__parseOracleNumber() with the maximum number of digits.
+//-----------------------------------------------------------------------------
+int bench_1005(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchParseOracleNumber(benchCase, numIters, gLargeOracleNumber);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1006()
+//   dpiDataBuffer__fromOracleDate() over an array of dates.
+//-----------------------------------------------------------------------------
+int bench_1006(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    dpiDataBuffer data;
+    uint64_t i;
+
+    for (i = 0; i < numIters; i++) {
+        dpiDataBuffer__fromOracleDate(&data, &gDates[i % NUM_DATES]);
+        dpiBench_consume((uint64_t) data.asTimestamp.day);
+    }
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// main()
+//-----------------------------------------------------------------------------
+int main(int argc, char **argv)
+{
+    uint32_t i;
+
+    for (i = 0; i < NUM_DATES; i++) {
+        gDates[i].year = (int16_t) (1970 + i % 100);
+        gDates[i].month = (uint8_t) (1 + i % 12);
+        gDates[i].day = (uint8_t) (1 + i % 28);
+        gDates[i].hour = (uint8_t) (i % 24);
+        gDates[i].minute = (uint8_t) (i % 60);
+        gDates[i].second = (uint8_t) ((i * 7) % 60);
+    }
+
+    dpiBenchSuite_initialize("conversions", argc, argv);
+    dpiBenchSuite_addCase(bench_1000, "parseNumberString (short integer)",
+            strlen(gShortNumber));
+    dpiBenchSuite_addCase(bench_1001, "parseNumberString (long decimal)",
+            strlen(gLongNumber));
+    dpiBenchSuite_addCase(bench_1002, "parseNumberString (exponent)",
+            strlen(gExponentNumber));
+    dpiBenchSuite_addCase(bench_1003, "parseOracleNumber (positive)", 0);
+    dpiBenchSuite_addCase(bench_1004, "parseOracleNumber (negative)", 0);
+    dpiBenchSuite_addCase(bench_1005, "parseOracleNumber (40 digits)", 0);
+    dpiBenchSuite_addCase(bench_1006, "fromOracleDate", sizeof(dpiOciDate));
+    return dpiBenchSuite_run();
+}
@@ -0,0 +1,404 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// bench_1100_json.c
+//   Benchmarks for building JSON node trees. A minimal in-memory
+// implementation of the OCI JSON DOM methods is used so that the node
+// builders in dpiJson.c can be measured without an Oracle Client library.
+//-----------------------------------------------------------------------------
+
+#include "BenchLib.h"
+#include "../embed/dpi.c"
+
+#define NUM_DOC_FIELDS                  16
+#define NUM_SMALL_ARRAY_ELEMENTS        32
+#define NUM_LARGE_ARRAY_ELEMENTS        1000
+
+// node used by the in-memory DOM
+typedef struct benchDomNode benchDomNode;
+struct benchDomNode {
+    int nodeType;
+    int scalarType;
+    char *strValue;
+    uint32_t strValueLength;
+    double doubleValue;
+    uint32_t numChildren;
+    benchDomNode **children;
+    char **names;
+};
+
+// in-memory DOM documents used by the benchmarks
+static dpiJznDomMethods gDomMethods;
+static dpiJznDomDoc gDomDoc;
+static benchDomNode *gDocument;
+static benchDomNode *gLargeArray;
+static char gFieldNames[NUM_DOC_FIELDS][16];
+static char *gStringValue = "the quick brown fox jumps over the lazy dog";
+
+// dummy node returned when building Oracle nodes from native nodes
+static benchDomNode gDummyNode;
+
+
+//-----------------------------------------------------------------------------
+// benchDom_appendItem()
+//   Append an item to an array (no-op).
+//-----------------------------------------------------------------------------
+static int benchDom_appendItem(dpiJznDomDoc *doc, void *arr, void *node)
+{
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// benchDom_freeNode()
+//   Free a node (no-op).
+//-----------------------------------------------------------------------------
+static int benchDom_freeNode(dpiJznDomDoc *doc, void *node)
+{
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// benchDom_getArrayElemBatch()
+//   Return a batch of elements from an array node.
+//-----------------------------------------------------------------------------
+static uint32_t benchDom_getArrayElemBatch(dpiJznDomDoc *doc, void *ary,
+        uint32_t startPos, uint32_t fetchSz, void **ndary)
+{
+    benchDomNode *node = (benchDomNode*) ary;
+    uint32_t i;
+
+    for (i = 0; i < fetchSz && startPos + i < node->numChildren; i++)
+        ndary[i] = node->children[startPos + i];
+    return i;
+}
+
+
+//-----------------------------------------------------------------------------
+// benchDom_getArraySize()
+//   Return the number of elements in an array node.
+//-----------------------------------------------------------------------------
+static uint32_t benchDom_getArraySize(dpiJznDomDoc *doc, void *ary)
+{
+    return ((benchDomNode*) ary)->numChildren;
+}
+
+
+//-----------------------------------------------------------------------------
+// benchDom_getFieldNamesAndValsBatch()
+//   Return a batch of fields from an object node.
+//-----------------------------------------------------------------------------
+static uint32_t benchDom_getFieldNamesAndValsBatch(dpiJznDomDoc *doc,
+        void *obj, uint32_t startPos, uint32_t fetchSz,
+        dpiJznDomNameValuePair *nvps)
+{
+    benchDomNode *node = (benchDomNode*) obj;
+    uint32_t i;
+
+    for (i = 0; i < fetchSz && startPos + i < node->numChildren; i++) {
+        nvps[i].name.ptr = node->names[startPos + i];
+        nvps[i].name.length = (uint32_t) strlen(node->names[startPos + i]);
+        nvps[i].value = node->children[startPos + i];
+    }
+    return i;
+}
+
+
+//-----------------------------------------------------------------------------
+// benchDom_getNodeType()
+//   Return the type of node.
+//-----------------------------------------------------------------------------
+static int benchDom_getNodeType(dpiJznDomDoc *doc, void *node)
+{
+    return ((benchDomNode*) node)->nodeType;
+}
+
+
+//-----------------------------------------------------------------------------
+// benchDom_getNumObjField()
+//   Return the number of fields in an object node.
+//-----------------------------------------------------------------------------
+static uint32_t benchDom_getNumObjField(dpiJznDomDoc *doc, void *obj)
+{
+    return ((benchDomNode*) obj)->numChildren;
+}
+
+
+//-----------------------------------------------------------------------------
+// benchDom_getScalarInfoOci()
+//   Return information about a scalar node.
+//-----------------------------------------------------------------------------
+static void benchDom_getScalarInfoOci(dpiJznDomDoc *doc, void *nd,
+        dpiJznDomScalar *val, dpiJsonOciVal *aux)
+{
+    benchDomNode *node = (benchDomNode*) nd;
+
+    val->valueType = node->scalarType;
+    if (node->scalarType == DPI_JZNVAL_STRING) {
+        val->value.asBytes.value = node->strValue;
+        val->value.asBytes.valueLength = node->strValueLength;
+    } else if (node->scalarType == DPI_JZNVAL_DOUBLE) {
+        val->value.asDouble.value = node->doubleValue;
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// benchDom_newNode()
+//   Create a new node (returns a dummy node).
+//-----------------------------------------------------------------------------
+static void *benchDom_newNode(dpiJznDomDoc *doc, uint32_t sz)
+{
+    return &gDummyNode;
+}
+
+
+//-----------------------------------------------------------------------------
+// benchDom_newScalarVal()
+//   Create a new scalar node (returns a dummy node).
+//-----------------------------------------------------------------------------
+static void *benchDom_newScalarVal(dpiJznDomDoc *doc, int typ, ...)
+{
+    return &gDummyNode;
+}
+
+
+//-----------------------------------------------------------------------------
+// benchDom_putFieldValue()
+//   Put a field in an object (no-op).
+//-----------------------------------------------------------------------------
+static void benchDom_putFieldValue(dpiJznDomDoc *doc, void *obj,
+        const char *name, uint16_t namelen, void *node)
+{
+}
+
+
+//-----------------------------------------------------------------------------
+// benchDom_createNode()
+//   Create a node for the in-memory DOM.
+//-----------------------------------------------------------------------------
+static benchDomNode *benchDom_createNode(int nodeType, int scalarType,
+        uint32_t numChildren)
+{
+    benchDomNode *node;
+
+    node = calloc(1, sizeof(benchDomNode));
+    node->nodeType = nodeType;
+    node->scalarType = scalarType;
+    node->numChildren = numChildren;
+    if (numChildren > 0) {
+        node->children = calloc(numChildren, sizeof(benchDomNode*));
+        node->names = calloc(numChildren, sizeof(char*));
+    }
+    return node;
+}
+
+
+//-----------------------------------------------------------------------------
+// benchDom_createDoubleArray()
+//   Create an array node containing the given number of doubles.
+//-----------------------------------------------------------------------------
+static benchDomNode *benchDom_createDoubleArray(uint32_t numElements)
+{
+    benchDomNode *node;
+    uint32_t i;
+
+    node = benchDom_createNode(DPI_JZNDOM_ARRAY, 0, numElements);
+    for (i = 0; i < numElements; i++) {
+        node->children[i] = benchDom_createNode(DPI_JZNDOM_SCALAR,
+                DPI_JZNVAL_DOUBLE, 0);
+        node->children[i]->doubleValue = i * 1.25;
+    }
+    return node;
+}
+
+
+//-----------------------------------------------------------------------------
+// benchDom_initialize()
+//   Create the in-memory DOM documents: an object with a mixture of strings,
+// doubles, booleans and a nested array and a large array of doubles.
+//-----------------------------------------------------------------------------
+static void benchDom_initialize(void)
+{
+    benchDomNode *child;
+    uint32_t i;
+
+    gDomMethods.fnGetNodeType = benchDom_getNodeType;
+    gDomMethods.fnGetArraySize = benchDom_getArraySize;
+    gDomMethods.fnGetArrayElemBatch = benchDom_getArrayElemBatch;
+    gDomMethods.fnGetNumObjField = benchDom_getNumObjField;
+    gDomMethods.fnGetFieldNamesAndValsBatch =
+            benchDom_getFieldNamesAndValsBatch;
+    gDomMethods.fnGetScalarInfoOci = benchDom_getScalarInfoOci;
+    gDomMethods.fnNewArray = benchDom_newNode;
+    gDomMethods.fnNewObject = benchDom_newNode;
+    gDomMethods.fnNewScalarVal = benchDom_newScalarVal;
+    gDomMethods.fnAppendItem = benchDom_appendItem;
+    gDomMethods.fnPutFieldValue = benchDom_putFieldValue;
+    gDomMethods.fnFreeNode = benchDom_freeNode;
+    gDomDoc.methods = &gDomMethods;
+
+    gDocument = benchDom_createNode(DPI_JZNDOM_OBJECT, 0, NUM_DOC_FIELDS);
+    for (i = 0; i < NUM_DOC_FIELDS; i++) {
+        sprintf(gFieldNames[i], "field_%u", i);
+        gDocument->names[i] = gFieldNames[i];
+        if (i < 8) {
+            child = benchDom_createNode(DPI_JZNDOM_SCALAR, DPI_JZNVAL_STRING,
+                    0);
+            child->strValue = gStringValue;
+            child->strValueLength = (uint32_t) strlen(gStringValue) - i;
+        } else if (i < 12) {
+            child = benchDom_createNode(DPI_JZNDOM_SCALAR, DPI_JZNVAL_DOUBLE,
+                    0);
+            child->doubleValue = i * 3.5;
+        } else if (i < 15) {
+            child = benchDom_createNode(DPI_JZNDOM_SCALAR,
+                    (i % 2) ? DPI_JZNVAL_TRUE : DPI_JZNVAL_FALSE, 0);
+        } else {
+            child = benchDom_createDoubleArray(NUM_SMALL_ARRAY_ELEMENTS);
+        }
+        gDocument->children[i] = child;
+    }
+    gLargeArray = benchDom_createDoubleArray(NUM_LARGE_ARRAY_ELEMENTS);
+}
+
+
+//-----------------------------------------------------------------------------
+// benchFromOracle()
+//   Build a native node tree from the given DOM node the specified number of
+// times, freeing it after each iteration.
+//-----------------------------------------------------------------------------
+static int benchFromOracle(dpiBenchCase *benchCase, uint64_t numIters,
+        benchDomNode *domNode)
+{
+    dpiError *error = dpiBench_getError();
+    dpiDataBuffer topNodeBuffer;
+    dpiJsonNode topNode;
+    dpiJson json;
+    uint64_t i;
+
+    memset(&json, 0, sizeof(json));
+    for (i = 0; i < numIters; i++) {
+        memset(&topNodeBuffer, 0, sizeof(topNodeBuffer));
+        topNode.value = &topNodeBuffer;
+        if (dpiJsonNode__fromOracleToNative(&json, &topNode, &gDomDoc,
+                domNode, 0, error) < 0)
+            return dpiBenchCase_setFailed(benchCase, "build failed");
+        dpiBench_consume(topNode.nativeTypeNum);
+        dpiJsonNode__free(&topNode);
+    }
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// benchFixNumberTypes()
+//   Native double values are returned with an Oracle type of NUMBER; convert
+// these to NATIVE_DOUBLE so that building Oracle nodes does not require the
+// OCI number conversion routines.
+//-----------------------------------------------------------------------------
+static void benchFixNumberTypes(dpiJsonNode *node)
+{
+    uint32_t i;
+
+    if (node->nativeTypeNum == DPI_NATIVE_TYPE_JSON_OBJECT) {
+        for (i = 0; i < node->value->asJsonObject.numFields; i++)
+            benchFixNumberTypes(&node->value->asJsonObject.fields[i]);
+    } else if (node->nativeTypeNum == DPI_NATIVE_TYPE_JSON_ARRAY) {
+        for (i = 0; i < node->value->asJsonArray.numElements; i++)
+            benchFixNumberTypes(&node->value->asJsonArray.elements[i]);
+    } else if (node->oracleTypeNum == DPI_ORACLE_TYPE_NUMBER) {
+        node->oracleTypeNum = DPI_ORACLE_TYPE_NATIVE_DOUBLE;
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1100()
+//   dpiJsonNode__fromOracleToNative() with an object containing mixed types.
+//-----------------------------------------------------------------------------
+int bench_1100(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchFromOracle(benchCase, numIters, gDocument);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1101()
+//   dpiJsonNode__fromOracleToNative() with a large array of doubles.
+//-----------------------------------------------------------------------------
+int bench_1101(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchFromOracle(benchCase, numIters, gLargeArray);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1102()
+//   dpiJsonNode__toOracleFromNative() with an object containing mixed types.
+//-----------------------------------------------------------------------------
+int bench_1102(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    dpiError *error = dpiBench_getError();
+    dpiDataBuffer topNodeBuffer;
+    dpiJsonNode topNode;
+    void *oracleNode;
+    dpiJson json;
+    uint64_t i;
+
+    memset(&json, 0, sizeof(json));
+    memset(&topNodeBuffer, 0, sizeof(topNodeBuffer));
+    topNode.value = &topNodeBuffer;
+    if (dpiJsonNode__fromOracleToNative(&json, &topNode, &gDomDoc,
+            gDocument, 0, error) < 0)
+        return dpiBenchCase_setFailed(benchCase, "build failed");
+    benchFixNumberTypes(&topNode);
+    for (i = 0; i < numIters; i++) {
+        if (dpiJsonNode__toOracleFromNative(&json, &topNode, &gDomDoc,
+                &oracleNode, error) < 0) {
+            dpiJsonNode__free(&topNode);
+            return dpiBenchCase_setFailed(benchCase, "build failed");
+        }
+        dpiBench_consume((uint64_t) (uintptr_t) oracleNode);
+    }
+    dpiJsonNode__free(&topNode);
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// main()
+//-----------------------------------------------------------------------------
+int main(int argc, char **argv)
+{
+    benchDom_initialize();
+    dpiBenchSuite_initialize("json", argc, argv);
+    dpiBenchSuite_addCase(bench_1100, "fromOracleToNative (object)", 0);
+    dpiBenchSuite_addCase(bench_1101, "fromOracleToNative (1000 doubles)", 0);
+    dpiBenchSuite_addCase(bench_1102, "toOracleFromNative (object)", 0);
+    return dpiBenchSuite_run();
+}
@@ -0,0 +1,135 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// bench_1200_handles.c
+//   Benchmarks for the handle lists used to track open statements and LOBs
+// and the handle pools used to cache OCI error handles.
+//-----------------------------------------------------------------------------
+
+#include "BenchLib.h"
+#include "../embed/dpi.c"
+
+#define NUM_OPEN_HANDLES                256
+
+// handle list and pool used by the benchmarks
+static dpiHandleList *gList;
+static dpiHandlePool *gPool;
+static uint32_t gSlotNums[NUM_OPEN_HANDLES];
+
+
+//-----------------------------------------------------------------------------
+// bench_1200()
+//   dpiHandleList__addHandle() followed by dpiHandleList__removeHandle() with
+// an empty list.
+//-----------------------------------------------------------------------------
+int bench_1200(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    dpiError *error = dpiBench_getError();
+    uint32_t slotNum;
+    uint64_t i;
+
+    for (i = 0; i < numIters; i++) {
+        if (dpiHandleList__addHandle(gList, benchCase, &slotNum, error) < 0)
+            return dpiBenchCase_setFailed(benchCase, "add failed");
+        dpiHandleList__removeHandle(gList, slotNum);
+    }
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1201()
+//   dpiHandleList__addHandle() followed by dpiHandleList__removeHandle() with
+// a list that already contains a large number of handles, removing a handle
+// from the middle of the list each time so that the add has to scan.
+//-----------------------------------------------------------------------------
+int bench_1201(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    dpiError *error = dpiBench_getError();
+    uint32_t i, pos;
+    uint64_t iter;
+
+    for (i = 0; i < NUM_OPEN_HANDLES; i++) {
+        if (dpiHandleList__addHandle(gList, benchCase, &gSlotNums[i],
+                error) < 0)
+            return dpiBenchCase_setFailed(benchCase, "add failed");
+    }
+    for (iter = 0; iter < numIters; iter++) {
+        pos = (uint32_t) ((iter * 37) % NUM_OPEN_HANDLES);
+        dpiHandleList__removeHandle(gList, gSlotNums[pos]);
+        if (dpiHandleList__addHandle(gList, benchCase, &gSlotNums[pos],
+                error) < 0)
+            return dpiBenchCase_setFailed(benchCase, "add failed");
+    }
+    for (i = 0; i < NUM_OPEN_HANDLES; i++)
+        dpiHandleList__removeHandle(gList, gSlotNums[i]);
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1202()
+//   dpiHandlePool__acquire() followed by dpiHandlePool__release().
+//-----------------------------------------------------------------------------
+int bench_1202(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    dpiError *error = dpiBench_getError();
+    void *handle;
+    uint64_t i;
+
+    for (i = 0; i < numIters; i++) {
+        if (dpiHandlePool__acquire(gPool, &handle, error) < 0)
+            return dpiBenchCase_setFailed(benchCase, "acquire failed");
+        if (!handle)
+            handle = benchCase;
+        dpiHandlePool__release(gPool, &handle);
+    }
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// main()
+//-----------------------------------------------------------------------------
+int main(int argc, char **argv)
+{
+    dpiError *error = dpiBench_getError();
+    int status;
+
+    if (dpiHandleList__create(&gList, error) < 0 ||
+            dpiHandlePool__create(&gPool, error) < 0) {
+        fprintf(stderr, "unable to create handle list and pool\n");
+        return 1;
+    }
+    dpiBenchSuite_initialize("handles", argc, argv);
+    dpiBenchSuite_addCase(bench_1200, "handleList add/remove (empty)", 0);
+    dpiBenchSuite_addCase(bench_1201, "handleList add/remove (256 open)", 0);
+    dpiBenchSuite_addCase(bench_1202, "handlePool acquire/release", 0);
+    status = dpiBenchSuite_run();
+    dpiHandleList__free(gList);
+    dpiHandlePool__free(gPool);
+    return status;
+}
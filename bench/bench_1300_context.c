@@ -0,0 +1,202 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//----------------------------------------------------------------------------
+
+
+
+//-----------------------------------------------------------------------------
+// bench_1300_context.c
+//   Benchmarks for context creation and the latency of the first query. The
+// first context created in a process loads the Oracle Client library and is
+// measured once; set DPI_BENCH_LOAD_ALL_SYMBOLS=1 to have all OCI symbols
+// resolved at that point instead of on first use, and compare the two runs.
+// The first query is only measured when ODPIC_BENCH_USER,
+// ODPIC_BENCH_PASSWORD and ODPIC_BENCH_CONNECT_STRING are set.
+//-----------------------------------------------------------------------------
+
+#include "BenchLib.h"
+#include "../embed/dpi.c"
+
+#define BENCH_SQL                       "select 1 from dual"
+
+// context and connection used by the benchmarks
+static dpiContext *gContext;
+static dpiConn *gConn;
+
+
+//-----------------------------------------------------------------------------
+// bench__query()
+//   Prepare, execute and fetch the single row returned by a simple query.
+//-----------------------------------------------------------------------------
+static int bench__query(dpiConn *conn)
+{
+    uint32_t numQueryColumns, bufferRowIndex;
+    dpiStmt *stmt;
+    int found;
+
+    if (dpiConn_prepareStmt(conn, 0, BENCH_SQL, strlen(BENCH_SQL), NULL, 0,
+            &stmt) < 0)
+        return -1;
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, &numQueryColumns) < 0 ||
+            dpiStmt_fetch(stmt, &found, &bufferRowIndex) < 0) {
+        dpiStmt_release(stmt);
+        return -1;
+    }
+    dpiStmt_release(stmt);
+    return (found) ? 0 : -1;
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1300()
+//   dpiContext_createWithParams() followed by dpiContext_destroy() once the
+// Oracle Client library has been loaded.
+//-----------------------------------------------------------------------------
+int bench_1300(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    dpiContextCreateParams params;
+    dpiErrorInfo errorInfo;
+    dpiContext *context;
+    uint64_t i;
+
+    if (!gContext)
+        return dpiBenchCase_setSkipped(benchCase, "no context");
+    memset(&params, 0, sizeof(params));
+    params.loadAllSymbols = (getenv("DPI_BENCH_LOAD_ALL_SYMBOLS") != NULL);
+    for (i = 0; i < numIters; i++) {
+        if (dpiContext_createWithParams(DPI_MAJOR_VERSION, DPI_MINOR_VERSION,
+                &params, &context, &errorInfo) < 0)
+            return dpiBenchCase_setFailed(benchCase, errorInfo.message);
+        dpiContext_destroy(context);
+    }
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1301()
+//   dpiOci__loadAllSymbols() starting with no symbols resolved.
+//-----------------------------------------------------------------------------
+int bench_1301(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    dpiError *error = dpiBench_getError();
+    uint64_t i;
+
+    if (!gContext)
+        return dpiBenchCase_setSkipped(benchCase, "no context");
+    for (i = 0; i < numIters; i++) {
+        memset(&dpiOciSymbols, 0, sizeof(dpiOciSymbols));
+        if (dpiOci__loadAllSymbols(NULL, error) < 0)
+            return dpiBenchCase_setFailed(benchCase, "load failed");
+    }
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1302()
+//   Prepare, execute and fetch a simple query on an established connection.
+//-----------------------------------------------------------------------------
+int bench_1302(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    uint64_t i;
+
+    if (!gConn)
+        return dpiBenchCase_setSkipped(benchCase, "no connection");
+    for (i = 0; i < numIters; i++) {
+        if (bench__query(gConn) < 0)
+            return dpiBenchCase_setFailed(benchCase, "query failed");
+    }
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// main()
+//-----------------------------------------------------------------------------
+int main(int argc, char **argv)
+{
+    const char *userName, *password, *connectString, *skipMessage;
+    uint64_t startNs, elapsedNs, startAllocs;
+    dpiContextCreateParams params;
+    dpiErrorInfo errorInfo;
+    int status;
+
+    dpiBenchSuite_initialize("context", argc, argv);
+
+    // measure the creation of the first context, which loads the library
+    memset(&params, 0, sizeof(params));
+    params.loadAllSymbols = (getenv("DPI_BENCH_LOAD_ALL_SYMBOLS") != NULL);
+    startAllocs = dpiBench_getNumAllocs();
+    startNs = dpiBench_getTimeNs();
+    skipMessage = NULL;
+    if (dpiContext_createWithParams(DPI_MAJOR_VERSION, DPI_MINOR_VERSION,
+            &params, &gContext, &errorInfo) < 0) {
+        gContext = NULL;
+        skipMessage = errorInfo.message;
+    }
+    elapsedNs = dpiBench_getTimeNs() - startNs;
+    dpiBenchSuite_addOneShotResult((params.loadAllSymbols) ?
+            "first context create (eager symbols)" :
+            "first context create (lazy symbols)", elapsedNs,
+            dpiBench_getNumAllocs() - startAllocs, skipMessage);
+
+    // measure the first connection and the first query on it
+    userName = getenv("ODPIC_BENCH_USER");
+    password = getenv("ODPIC_BENCH_PASSWORD");
+    connectString = getenv("ODPIC_BENCH_CONNECT_STRING");
+    skipMessage = "no context";
+    if (gContext && (!userName || !password || !connectString))
+        skipMessage = "ODPIC_BENCH_USER, ODPIC_BENCH_PASSWORD and "
+                "ODPIC_BENCH_CONNECT_STRING not set";
+    else if (gContext) {
+        startNs = dpiBench_getTimeNs();
+        if (dpiConn_create(gContext, userName, strlen(userName), password,
+                strlen(password), connectString, strlen(connectString), NULL,
+                NULL, &gConn) < 0) {
+            dpiContext_getError(gContext, &errorInfo);
+            skipMessage = errorInfo.message;
+            gConn = NULL;
+        } else skipMessage = NULL;
+        elapsedNs = dpiBench_getTimeNs() - startNs;
+    }
+    dpiBenchSuite_addOneShotResult("first connection", elapsedNs, 0,
+            skipMessage);
+    if (gConn) {
+        startNs = dpiBench_getTimeNs();
+        if (bench__query(gConn) < 0)
+            skipMessage = "first query failed";
+        elapsedNs = dpiBench_getTimeNs() - startNs;
+    }
+    dpiBenchSuite_addOneShotResult("first query", elapsedNs, 0, skipMessage);
+
+    dpiBenchSuite_addCase(bench_1300, "context create/destroy (loaded)", 0);
+    dpiBenchSuite_addCase(bench_1301, "resolve all OCI symbols", 0);
+    dpiBenchSuite_addCase(bench_1302, "query (warm connection)", 0);
+    status = dpiBenchSuite_run();
+    if (gConn)
+        dpiConn_release(gConn);
+    if (gContext)
+        dpiContext_destroy(gContext);
+    return status;
+}
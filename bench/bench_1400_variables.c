@@ -0,0 +1,387 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//----------------------------------------------------------------------------
+
+
+
+//-----------------------------------------------------------------------------
+// bench_1400_variables.c
+//   Benchmarks for the converters used to transfer fetched values from the
+// Oracle buffers of a variable to the external data buffers, comparing the
+// transfer of one value at a time with the transfer of a column at a time.
+// The variables are created directly so that no database is required; the
+// conversion of Oracle numbers to integers and doubles is performed by the
+// Oracle Client library, so those cases are skipped if it cannot be loaded.
+//-----------------------------------------------------------------------------
+
+#include "BenchLib.h"
+#include "../embed/dpi.c"
+
+#define NUM_ROWS                        1024
+#define NULL_FREQUENCY                  8
+
+// structure used for each of the pairs of types benchmarked
+typedef struct {
+    dpiOracleTypeNum oracleTypeNum;
+    dpiNativeTypeNum nativeTypeNum;
+    uint32_t sizeInBytes;
+    int requiresClient;
+    dpiVar *var;
+} benchVarInfo;
+
+// environment used by the variables (no OCI environment is needed)
+static dpiEnv gEnv;
+
+// variables for each of the pairs of types
+static benchVarInfo gVars[] = {
+    { DPI_ORACLE_TYPE_NATIVE_INT, DPI_NATIVE_TYPE_INT64, 0, 0, NULL },
+    { DPI_ORACLE_TYPE_NATIVE_DOUBLE, DPI_NATIVE_TYPE_DOUBLE, 0, 0, NULL },
+    { DPI_ORACLE_TYPE_NUMBER, DPI_NATIVE_TYPE_INT64, 0, 1, NULL },
+    { DPI_ORACLE_TYPE_NUMBER, DPI_NATIVE_TYPE_DOUBLE, 0, 1, NULL },
+    { DPI_ORACLE_TYPE_NUMBER, DPI_NATIVE_TYPE_BYTES, 0, 0, NULL },
+    { DPI_ORACLE_TYPE_VARCHAR, DPI_NATIVE_TYPE_BYTES, 32, 0, NULL },
+    { DPI_ORACLE_TYPE_DATE, DPI_NATIVE_TYPE_TIMESTAMP, 0, 0, NULL }
+};
+#define NUM_VARS                        (sizeof(gVars) / sizeof(gVars[0]))
+
+// numbers in Oracle form: 12345 and 1234.5678
+static uint8_t gIntegerOracleNumber[DPI_OCI_NUMBER_SIZE] =
+        { 4, 0xC3, 2, 24, 46 };
+static uint8_t gDecimalOracleNumber[DPI_OCI_NUMBER_SIZE] =
+        { 5, 0xC2, 13, 35, 57, 79 };
+
+// is the Oracle Client library available?
+static int gClientAvailable;
+
+
+//-----------------------------------------------------------------------------
+// benchCreateVar()
+//   Create a variable for the given pair of types and populate it with
+// fetched data. The variable is created without a connection so that no
+// Oracle Client library is required.
+//-----------------------------------------------------------------------------
+static int benchCreateVar(benchVarInfo *info, dpiError *error)
+{
+    dpiVarBuffer *buffer;
+    dpiVar *var;
+    uint32_t i;
+
+    if (dpiUtils__allocateMemory(1, sizeof(dpiVar), 1, "allocate var",
+            (void**) &var, error) < 0)
+        return DPI_FAILURE;
+    info->var = var;
+    var->env = &gEnv;
+    var->type = dpiOracleType__getFromNum(info->oracleTypeNum, error);
+    var->nativeTypeNum = info->nativeTypeNum;
+    var->sizeInBytes = (var->type->sizeInBytes) ? var->type->sizeInBytes :
+            info->sizeInBytes;
+    buffer = &var->buffer;
+    buffer->maxArraySize = NUM_ROWS;
+    buffer->actualArraySize = NUM_ROWS;
+    if (dpiVar__initBuffer(var, buffer, error) < 0)
+        return DPI_FAILURE;
+    dpiVar__updateConverters(var);
+
+    // populate the buffers as a fetch would
+    for (i = 0; i < NUM_ROWS; i++) {
+        buffer->indicator[i] = (i % NULL_FREQUENCY == 0) ?
+                DPI_OCI_IND_NULL : DPI_OCI_IND_NOTNULL;
+        switch (info->oracleTypeNum) {
+            case DPI_ORACLE_TYPE_NATIVE_INT:
+                buffer->data.asInt64[i] = (int64_t) i * 1000;
+                break;
+            case DPI_ORACLE_TYPE_NATIVE_DOUBLE:
+                buffer->data.asDouble[i] = (double) i * 1.25;
+                break;
+            case DPI_ORACLE_TYPE_NUMBER:
+                memcpy(&buffer->data.asNumber[i],
+                        (info->nativeTypeNum == DPI_NATIVE_TYPE_INT64) ?
+                        gIntegerOracleNumber : gDecimalOracleNumber,
+                        DPI_OCI_NUMBER_SIZE);
+                break;
+            case DPI_ORACLE_TYPE_VARCHAR:
+                buffer->actualLength[i] = (uint32_t) sprintf(
+                        buffer->data.asBytes + i * var->sizeInBytes,
+                        "row %u", i);
+                buffer->returnCode[i] = 0;
+                break;
+            case DPI_ORACLE_TYPE_DATE:
+                buffer->data.asDate[i].year = (int16_t) (1970 + i % 100);
+                buffer->data.asDate[i].month = (uint8_t) (1 + i % 12);
+                buffer->data.asDate[i].day = (uint8_t) (1 + i % 28);
+                break;
+            default:
+                break;
+        }
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// benchFreeVar()
+//   Free the variable created by benchCreateVar().
+//-----------------------------------------------------------------------------
+static void benchFreeVar(benchVarInfo *info, dpiError *error)
+{
+    if (info->var) {
+        dpiVar__finalizeBuffer(info->var, &info->var->buffer, error);
+        dpiUtils__freeMemory(info->var);
+        info->var = NULL;
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// benchGetByColumn()
+//   Transfer the values of the variable a column at a time, as is done after
+// each fetch. Each iteration transfers one row.
+//-----------------------------------------------------------------------------
+static int benchGetByColumn(dpiBenchCase *benchCase, uint64_t numIters,
+        benchVarInfo *info)
+{
+    dpiError *error = dpiBench_getError();
+    uint32_t numRows;
+    uint64_t iter;
+
+    if (info->requiresClient && !gClientAvailable)
+        return dpiBenchCase_setSkipped(benchCase,
+                "Oracle Client library not available");
+    for (iter = 0; iter < numIters; iter += numRows) {
+        numRows = (numIters - iter < NUM_ROWS) ?
+                (uint32_t) (numIters - iter) : NUM_ROWS;
+        if (dpiVar__getColumnValues(info->var, numRows, error) < 0)
+            return dpiBenchCase_setFailed(benchCase, "get column failed");
+        dpiBench_consume(info->var->buffer.externalData[numRows - 1].isNull);
+    }
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// benchGetByValue()
+//   Transfer the values of the variable one at a time. Each iteration
+// transfers one row.
+//-----------------------------------------------------------------------------
+static int benchGetByValue(dpiBenchCase *benchCase, uint64_t numIters,
+        benchVarInfo *info)
+{
+    dpiError *error = dpiBench_getError();
+    dpiVar *var = info->var;
+    uint64_t iter;
+    uint32_t pos;
+
+    if (info->requiresClient && !gClientAvailable)
+        return dpiBenchCase_setSkipped(benchCase,
+                "Oracle Client library not available");
+    for (iter = 0; iter < numIters; iter++) {
+        pos = (uint32_t) (iter % NUM_ROWS);
+        if (dpiVar__getValue(var, &var->buffer, pos, 1, error) < 0)
+            return dpiBenchCase_setFailed(benchCase, "get value failed");
+        dpiBench_consume(var->buffer.externalData[pos].isNull);
+    }
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1400()
+//   Native integer to int64, one value at a time.
+//-----------------------------------------------------------------------------
+int bench_1400(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchGetByValue(benchCase, numIters, &gVars[0]);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1401()
+//   Native integer to int64, a column at a time.
+//-----------------------------------------------------------------------------
+int bench_1401(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchGetByColumn(benchCase, numIters, &gVars[0]);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1402()
+//   Native double to double, one value at a time.
+//-----------------------------------------------------------------------------
+int bench_1402(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchGetByValue(benchCase, numIters, &gVars[1]);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1403()
+//   Native double to double, a column at a time.
+//-----------------------------------------------------------------------------
+int bench_1403(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchGetByColumn(benchCase, numIters, &gVars[1]);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1404()
+//   Oracle number to int64, one value at a time.
+//-----------------------------------------------------------------------------
+int bench_1404(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchGetByValue(benchCase, numIters, &gVars[2]);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1405()
+//   Oracle number to int64, a column at a time.
+//-----------------------------------------------------------------------------
+int bench_1405(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchGetByColumn(benchCase, numIters, &gVars[2]);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1406()
+//   Oracle number to double, one value at a time.
+//-----------------------------------------------------------------------------
+int bench_1406(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchGetByValue(benchCase, numIters, &gVars[3]);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1407()
+//   Oracle number to double, a column at a time.
+//-----------------------------------------------------------------------------
+int bench_1407(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchGetByColumn(benchCase, numIters, &gVars[3]);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1408()
+//   Oracle number to text, one value at a time.
+//-----------------------------------------------------------------------------
+int bench_1408(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchGetByValue(benchCase, numIters, &gVars[4]);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1409()
+//   Oracle number to text, a column at a time.
+//-----------------------------------------------------------------------------
+int bench_1409(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchGetByColumn(benchCase, numIters, &gVars[4]);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1410()
+//   VARCHAR to bytes, one value at a time.
+//-----------------------------------------------------------------------------
+int bench_1410(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchGetByValue(benchCase, numIters, &gVars[5]);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1411()
+//   VARCHAR to bytes, a column at a time.
+//-----------------------------------------------------------------------------
+int bench_1411(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchGetByColumn(benchCase, numIters, &gVars[5]);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1412()
+//   Oracle date to timestamp, one value at a time.
+//-----------------------------------------------------------------------------
+int bench_1412(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchGetByValue(benchCase, numIters, &gVars[6]);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1413()
+//   Oracle date to timestamp, a column at a time.
+//-----------------------------------------------------------------------------
+int bench_1413(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchGetByColumn(benchCase, numIters, &gVars[6]);
+}
+
+
+//-----------------------------------------------------------------------------
+// main()
+//-----------------------------------------------------------------------------
+int main(int argc, char **argv)
+{
+    dpiError *error = dpiBench_getError();
+    dpiDataBuffer value;
+    int status = 1;
+    uint32_t i;
+
+    gClientAvailable = (dpiDataBuffer__fromOracleNumberAsInteger(&value,
+            error, gIntegerOracleNumber) == DPI_SUCCESS);
+    for (i = 0; i < NUM_VARS; i++) {
+        if (benchCreateVar(&gVars[i], error) < 0) {
+            fprintf(stderr, "unable to create variables\n");
+            goto cleanup;
+        }
+    }
+    dpiBenchSuite_initialize("variables", argc, argv);
+    dpiBenchSuite_addCase(bench_1400, "native int -> int64 (value)", 0);
+    dpiBenchSuite_addCase(bench_1401, "native int -> int64 (column)", 0);
+    dpiBenchSuite_addCase(bench_1402, "native double -> double (value)", 0);
+    dpiBenchSuite_addCase(bench_1403, "native double -> double (column)", 0);
+    dpiBenchSuite_addCase(bench_1404, "number -> int64 (value)", 0);
+    dpiBenchSuite_addCase(bench_1405, "number -> int64 (column)", 0);
+    dpiBenchSuite_addCase(bench_1406, "number -> double (value)", 0);
+    dpiBenchSuite_addCase(bench_1407, "number -> double (column)", 0);
+    dpiBenchSuite_addCase(bench_1408, "number -> bytes (value)", 0);
+    dpiBenchSuite_addCase(bench_1409, "number -> bytes (column)", 0);
+    dpiBenchSuite_addCase(bench_1410, "varchar -> bytes (value)", 0);
+    dpiBenchSuite_addCase(bench_1411, "varchar -> bytes (column)", 0);
+    dpiBenchSuite_addCase(bench_1412, "date -> timestamp (value)", 0);
+    dpiBenchSuite_addCase(bench_1413, "date -> timestamp (column)", 0);
+    status = dpiBenchSuite_run();
+
+cleanup:
+    for (i = 0; i < NUM_VARS; i++)
+        benchFreeVar(&gVars[i], error);
+    return status;
+}
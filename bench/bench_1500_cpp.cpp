@@ -0,0 +1,352 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//----------------------------------------------------------------------------
+
+
+
+//-----------------------------------------------------------------------------
+// bench_1500_cpp.cpp
+//   Benchmarks for the header-only C++ layer (include/dpi.hpp) which compare
+// reading fetched values through the typed column views and rows of the C++
+// layer with reading the same values directly through the C API. The column
+// view cases operate on data buffers populated in memory and do not require
+// an Oracle Client library or a database; the fetch cases are only run when
+// ODPIC_BENCH_USER, ODPIC_BENCH_PASSWORD and ODPIC_BENCH_CONNECT_STRING are
+// set.
+//-----------------------------------------------------------------------------
+
+// the library is compiled separately (BenchEmbed.c) so the memory allocation
+// routines must not be redirected in this file
+#define DPI_BENCH_NO_REDIRECT
+extern "C" {
+#include "BenchLib.h"
+}
+#include "dpi.hpp"
+
+#include <cstdlib>
+#include <memory>
+
+#define NUM_ROWS                        1024
+#define NULL_FREQUENCY                  8
+
+// query used by the fetch cases
+#define FETCH_SQL   "select level, to_char(level), level / 7 from dual " \
+                    "connect by level <= 100000"
+
+// data buffers for each of the column types
+static dpiData gIntegerData[NUM_ROWS];
+static dpiData gDoubleData[NUM_ROWS];
+static dpiData gBytesData[NUM_ROWS];
+static char gBytesBuffer[NUM_ROWS][16];
+
+// state used by the fetch cases
+static std::unique_ptr<dpi::Context> gContext;
+static dpi::Connection gConn;
+static const char *gSkipMessage;
+
+
+//-----------------------------------------------------------------------------
+// benchInitData()
+//   Populate the data buffers as a fetch would.
+//-----------------------------------------------------------------------------
+static void benchInitData()
+{
+    uint32_t i;
+
+    for (i = 0; i < NUM_ROWS; i++) {
+        gIntegerData[i].isNull = gDoubleData[i].isNull =
+                gBytesData[i].isNull = (i % NULL_FREQUENCY == 0);
+        gIntegerData[i].value.asInt64 = (int64_t) i * 1000;
+        gDoubleData[i].value.asDouble = (double) i * 1.25;
+        gBytesData[i].value.asBytes.ptr = gBytesBuffer[i];
+        gBytesData[i].value.asBytes.length = (uint32_t) snprintf(
+                gBytesBuffer[i], sizeof(gBytesBuffer[i]), "row %u", i);
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// benchInitConnection()
+//   Create the context and connection used by the fetch cases, if the
+// environment variables are set.
+//-----------------------------------------------------------------------------
+static void benchInitConnection()
+{
+    const char *userName, *password, *connectString;
+
+    userName = getenv("ODPIC_BENCH_USER");
+    password = getenv("ODPIC_BENCH_PASSWORD");
+    connectString = getenv("ODPIC_BENCH_CONNECT_STRING");
+    if (!userName || !password || !connectString) {
+        gSkipMessage = "ODPIC_BENCH_USER, ODPIC_BENCH_PASSWORD and "
+                "ODPIC_BENCH_CONNECT_STRING not set";
+        return;
+    }
+    try {
+        gContext = std::make_unique<dpi::Context>();
+        gConn = gContext->connect(userName, password, connectString);
+    } catch (const dpi::Error &e) {
+        fprintf(stderr, "%s\n", e.what());
+        gSkipMessage = "unable to connect";
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1500()
+//   Sum a column of integers through the C API, reading null values as zero
+// as the column view does.
+//-----------------------------------------------------------------------------
+static int bench_1500(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    int64_t sum = 0;
+    uint64_t iter;
+    uint32_t i;
+
+    for (iter = 0; iter < numIters; iter++) {
+        for (i = 0; i < NUM_ROWS; i++) {
+            sum += gIntegerData[i].isNull ? 0 :
+                    gIntegerData[i].value.asInt64;
+        }
+    }
+    dpiBench_consume((uint64_t) sum);
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1501()
+//   Sum a column of integers through a column view.
+//-----------------------------------------------------------------------------
+static int bench_1501(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    dpi::ColumnView<int64_t> column(gIntegerData, NUM_ROWS);
+    int64_t sum = 0;
+    uint64_t iter;
+
+    for (iter = 0; iter < numIters; iter++) {
+        for (int64_t value : column)
+            sum += value;
+    }
+    dpiBench_consume((uint64_t) sum);
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1502()
+//   Sum a column of doubles through the C API, reading null values as zero as
+// the column view does.
+//-----------------------------------------------------------------------------
+static int bench_1502(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    double sum = 0.0;
+    uint64_t iter;
+    uint32_t i;
+
+    for (iter = 0; iter < numIters; iter++) {
+        for (i = 0; i < NUM_ROWS; i++) {
+            sum += gDoubleData[i].isNull ? 0.0 :
+                    gDoubleData[i].value.asDouble;
+        }
+    }
+    dpiBench_consume((uint64_t) sum);
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1503()
+//   Sum a column of doubles through a column view.
+//-----------------------------------------------------------------------------
+static int bench_1503(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    dpi::ColumnView<double> column(gDoubleData, NUM_ROWS);
+    double sum = 0.0;
+    uint64_t iter;
+    uint32_t i;
+
+    for (iter = 0; iter < numIters; iter++) {
+        for (i = 0; i < column.size(); i++)
+            sum += column[i];
+    }
+    dpiBench_consume((uint64_t) sum);
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1504()
+//   Sum the lengths of a column of strings through the C API.
+//-----------------------------------------------------------------------------
+static int bench_1504(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    uint64_t iter, sum = 0;
+    uint32_t i;
+
+    for (iter = 0; iter < numIters; iter++) {
+        for (i = 0; i < NUM_ROWS; i++) {
+            if (!gBytesData[i].isNull)
+                sum += gBytesData[i].value.asBytes.length +
+                        (uint8_t) gBytesData[i].value.asBytes.ptr[0];
+        }
+    }
+    dpiBench_consume(sum);
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1505()
+//   Sum the lengths of a column of strings through a column view of optional
+// string views.
+//-----------------------------------------------------------------------------
+static int bench_1505(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    dpi::ColumnView<std::optional<std::string_view>> column(gBytesData,
+            NUM_ROWS);
+    uint64_t iter, sum = 0;
+
+    for (iter = 0; iter < numIters; iter++) {
+        for (const auto &value : column) {
+            if (value)
+                sum += value->size() + (uint8_t) value->front();
+        }
+    }
+    dpiBench_consume(sum);
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1506()
+//   Fetch rows through the C API, re-executing the query when all of the rows
+// have been fetched.
+//-----------------------------------------------------------------------------
+static int bench_1506(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    dpiData *intValue, *strValue, *dblValue;
+    dpiNativeTypeNum nativeTypeNum;
+    uint32_t bufferRowIndex;
+    dpiStmt *stmt = NULL;
+    uint64_t iter, sum;
+    int found;
+
+    if (gSkipMessage)
+        return dpiBenchCase_setSkipped(benchCase, gSkipMessage);
+    sum = 0;
+    for (iter = 0; iter < numIters; iter++) {
+        if (!stmt) {
+            if (dpiConn_prepareStmt(gConn.handle(), 0, FETCH_SQL,
+                    strlen(FETCH_SQL), NULL, 0, &stmt) < 0 ||
+                    dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, NULL) < 0)
+                return dpiBenchCase_setFailed(benchCase, "execute failed");
+        }
+        if (dpiStmt_fetch(stmt, &found, &bufferRowIndex) < 0)
+            return dpiBenchCase_setFailed(benchCase, "fetch failed");
+        if (!found) {
+            dpiStmt_release(stmt);
+            stmt = NULL;
+            continue;
+        }
+        if (dpiStmt_getQueryValue(stmt, 1, &nativeTypeNum, &intValue) < 0 ||
+                dpiStmt_getQueryValue(stmt, 2, &nativeTypeNum,
+                        &strValue) < 0 ||
+                dpiStmt_getQueryValue(stmt, 3, &nativeTypeNum, &dblValue) < 0)
+            return dpiBenchCase_setFailed(benchCase, "get value failed");
+        sum += (uint64_t) intValue->value.asInt64 +
+                strValue->value.asBytes.length +
+                (uint64_t) dblValue->value.asDouble;
+    }
+    if (stmt)
+        dpiStmt_release(stmt);
+    dpiBench_consume(sum);
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1507()
+//   Fetch rows as tuples through the C++ layer, re-executing the query when
+// all of the rows have been fetched.
+//-----------------------------------------------------------------------------
+static int bench_1507(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    using Row = std::tuple<int64_t, std::string_view, double>;
+    std::optional<dpi::Statement> stmt;
+    uint64_t iter, sum;
+
+    if (gSkipMessage)
+        return dpiBenchCase_setSkipped(benchCase, gSkipMessage);
+    sum = 0;
+    try {
+        for (iter = 0; iter < numIters; iter++) {
+            if (!stmt) {
+                stmt = gConn.prepare(FETCH_SQL);
+                stmt->execute();
+            }
+            std::optional<Row> row = stmt->fetch<Row>();
+            if (!row) {
+                stmt.reset();
+                continue;
+            }
+            sum += (uint64_t) std::get<0>(*row) + std::get<1>(*row).size() +
+                    (uint64_t) std::get<2>(*row);
+        }
+    } catch (const dpi::Error &e) {
+        return dpiBenchCase_setFailed(benchCase, "fetch failed");
+    }
+    dpiBench_consume(sum);
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// main()
+//-----------------------------------------------------------------------------
+int main(int argc, char **argv)
+{
+    int status;
+
+    benchInitData();
+    benchInitConnection();
+    dpiBenchSuite_initialize("cpp", argc, argv);
+    dpiBenchSuite_addCase(bench_1500, "int64 column sum (C API)",
+            NUM_ROWS * sizeof(dpiData));
+    dpiBenchSuite_addCase(bench_1501, "int64 column sum (C++ view)",
+            NUM_ROWS * sizeof(dpiData));
+    dpiBenchSuite_addCase(bench_1502, "double column sum (C API)",
+            NUM_ROWS * sizeof(dpiData));
+    dpiBenchSuite_addCase(bench_1503, "double column sum (C++ view)",
+            NUM_ROWS * sizeof(dpiData));
+    dpiBenchSuite_addCase(bench_1504, "string column scan (C API)",
+            NUM_ROWS * sizeof(dpiData));
+    dpiBenchSuite_addCase(bench_1505, "string column scan (C++ view)",
+            NUM_ROWS * sizeof(dpiData));
+    dpiBenchSuite_addCase(bench_1506, "fetch row (C API)", 0);
+    dpiBenchSuite_addCase(bench_1507, "fetch row (C++ tuple)", 0);
+    status = dpiBenchSuite_run();
+    gConn = dpi::Connection();
+    gContext.reset();
+    return status;
+}
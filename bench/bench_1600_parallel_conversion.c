@@ -0,0 +1,234 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//----------------------------------------------------------------------------
+
+
+
+//-----------------------------------------------------------------------------
+// bench_1600_parallel_conversion.c
+//   Benchmarks for the conversion of a fetched batch of rows, comparing the
+// conversion of all columns on the calling thread with the conversion of the
+// columns split between the threads of a context's conversion pool. The
+// statement and its variables are created directly so that no database is
+// required; only conversions that do not need the Oracle Client library are
+// used.
+//-----------------------------------------------------------------------------
+
+#include "BenchLib.h"
+#include "../embed/dpi.c"
+
+#define NUM_ROWS                        256
+#define NUM_COLUMNS                     48
+#define NULL_FREQUENCY                  8
+
+// environment, context and statement used by the variables (no OCI
+// environment is needed)
+static dpiContext gContext;
+static dpiEnv gEnv;
+static dpiStmt gStmt;
+static dpiVar *gVars[NUM_COLUMNS];
+
+// number in Oracle form: 1234.5678
+static uint8_t gDecimalOracleNumber[DPI_OCI_NUMBER_SIZE] =
+        { 5, 0xC2, 13, 35, 57, 79 };
+
+
+//-----------------------------------------------------------------------------
+// benchCreateVar()
+//   Create a variable for the given column and populate it with fetched data.
+// The columns cycle through numbers fetched as text, dates fetched as
+// timestamps and strings.
+//-----------------------------------------------------------------------------
+static int benchCreateVar(uint32_t columnNum, dpiError *error)
+{
+    dpiOracleTypeNum oracleTypeNum;
+    dpiNativeTypeNum nativeTypeNum;
+    dpiVarBuffer *buffer;
+    dpiVar *var;
+    uint32_t i;
+
+    switch (columnNum % 3) {
+        case 0:
+            oracleTypeNum = DPI_ORACLE_TYPE_NUMBER;
+            nativeTypeNum = DPI_NATIVE_TYPE_BYTES;
+            break;
+        case 1:
+            oracleTypeNum = DPI_ORACLE_TYPE_DATE;
+            nativeTypeNum = DPI_NATIVE_TYPE_TIMESTAMP;
+            break;
+        default:
+            oracleTypeNum = DPI_ORACLE_TYPE_VARCHAR;
+            nativeTypeNum = DPI_NATIVE_TYPE_BYTES;
+            break;
+    }
+    if (dpiUtils__allocateMemory(1, sizeof(dpiVar), 1, "allocate var",
+            (void**) &var, error) < 0)
+        return DPI_FAILURE;
+    gVars[columnNum] = var;
+    var->env = &gEnv;
+    var->type = dpiOracleType__getFromNum(oracleTypeNum, error);
+    var->nativeTypeNum = nativeTypeNum;
+    var->sizeInBytes = (var->type->sizeInBytes) ? var->type->sizeInBytes : 32;
+    buffer = &var->buffer;
+    buffer->maxArraySize = NUM_ROWS;
+    buffer->actualArraySize = NUM_ROWS;
+    if (dpiVar__initBuffer(var, buffer, error) < 0)
+        return DPI_FAILURE;
+    dpiVar__updateConverters(var);
+
+    // populate the buffers as a fetch would
+    for (i = 0; i < NUM_ROWS; i++) {
+        buffer->indicator[i] = (i % NULL_FREQUENCY == 0) ?
+                DPI_OCI_IND_NULL : DPI_OCI_IND_NOTNULL;
+        switch (oracleTypeNum) {
+            case DPI_ORACLE_TYPE_NUMBER:
+                memcpy(&buffer->data.asNumber[i], gDecimalOracleNumber,
+                        DPI_OCI_NUMBER_SIZE);
+                break;
+            case DPI_ORACLE_TYPE_DATE:
+                buffer->data.asDate[i].year = (int16_t) (1970 + i % 100);
+                buffer->data.asDate[i].month = (uint8_t) (1 + i % 12);
+                buffer->data.asDate[i].day = (uint8_t) (1 + i % 28);
+                break;
+            default:
+                buffer->actualLength[i] = (uint32_t) sprintf(
+                        buffer->data.asBytes + i * var->sizeInBytes,
+                        "row %u of column %u", i, columnNum);
+                buffer->returnCode[i] = 0;
+                break;
+        }
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// benchPostFetch()
+//   Convert the fetched batch using a conversion pool with the given number
+// of threads (or none). Each iteration converts one row of all columns.
+//-----------------------------------------------------------------------------
+static int benchPostFetch(dpiBenchCase *benchCase, uint64_t numIters,
+        uint32_t numThreads)
+{
+    dpiError *error = dpiBench_getError();
+    int status = 0;
+    uint64_t iter;
+
+    if (numThreads > 0 && dpiWorkerPool__create(&gContext.conversionPool,
+            numThreads, error) < 0)
+        return dpiBenchCase_setFailed(benchCase, "unable to create pool");
+    for (iter = 0; iter < numIters; iter += NUM_ROWS) {
+        gStmt.bufferRowCount = (numIters - iter < NUM_ROWS) ?
+                (uint32_t) (numIters - iter) : NUM_ROWS;
+        if (dpiStmt__postFetch(&gStmt, error) < 0) {
+            status = dpiBenchCase_setFailed(benchCase, "post fetch failed");
+            break;
+        }
+        dpiBench_consume(gVars[NUM_COLUMNS - 1]->buffer.externalData[
+                gStmt.bufferRowCount - 1].isNull);
+    }
+    if (gContext.conversionPool) {
+        dpiWorkerPool__free(gContext.conversionPool);
+        gContext.conversionPool = NULL;
+    }
+    return status;
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1600()
+//   Convert all columns on the calling thread.
+//-----------------------------------------------------------------------------
+int bench_1600(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchPostFetch(benchCase, numIters, 0);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1601()
+//   Convert the columns using a pool of one thread.
+//-----------------------------------------------------------------------------
+int bench_1601(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchPostFetch(benchCase, numIters, 1);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1602()
+//   Convert the columns using a pool of three threads.
+//-----------------------------------------------------------------------------
+int bench_1602(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchPostFetch(benchCase, numIters, 3);
+}
+
+
+//-----------------------------------------------------------------------------
+// bench_1603()
+//   Convert the columns using a pool of seven threads.
+//-----------------------------------------------------------------------------
+int bench_1603(dpiBenchCase *benchCase, uint64_t numIters)
+{
+    return benchPostFetch(benchCase, numIters, 7);
+}
+
+
+//-----------------------------------------------------------------------------
+// main()
+//-----------------------------------------------------------------------------
+int main(int argc, char **argv)
+{
+    dpiError *error = dpiBench_getError();
+    int status = 1;
+    uint32_t i;
+
+    gEnv.context = &gContext;
+    gEnv.threaded = 1;
+    gStmt.env = &gEnv;
+    gStmt.queryVars = gVars;
+    gStmt.numQueryVars = NUM_COLUMNS;
+    for (i = 0; i < NUM_COLUMNS; i++) {
+        if (benchCreateVar(i, error) < 0) {
+            fprintf(stderr, "unable to create variables\n");
+            goto cleanup;
+        }
+    }
+    dpiBenchSuite_initialize("parallel conversion", argc, argv);
+    dpiBenchSuite_addCase(bench_1600, "convert batch (serial)", 0);
+    dpiBenchSuite_addCase(bench_1601, "convert batch (2 threads)", 0);
+    dpiBenchSuite_addCase(bench_1602, "convert batch (4 threads)", 0);
+    dpiBenchSuite_addCase(bench_1603, "convert batch (8 threads)", 0);
+    status = dpiBenchSuite_run();
+
+cleanup:
+    for (i = 0; i < NUM_COLUMNS; i++) {
+        if (gVars[i]) {
+            dpiVar__finalizeBuffer(gVars[i], &gVars[i]->buffer, error);
+            dpiUtils__freeMemory(gVars[i]);
+        }
+    }
+    return status;
+}
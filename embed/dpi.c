@@ -42,9 +42,11 @@
 #include "../src/dpiGlobal.c"
 #include "../src/dpiHandleList.c"
 #include "../src/dpiHandlePool.c"
+#include "../src/dpiHandleRegistry.c"
 #include "../src/dpiJson.c"
 #include "../src/dpiLob.c"
 #include "../src/dpiMsgProps.c"
+#include "../src/dpiMutex.c"
 #include "../src/dpiObjectAttr.c"
 #include "../src/dpiObject.c"
 #include "../src/dpiObjectType.c"
@@ -52,15 +54,28 @@
 #include "../src/dpiOracleType.c"
 #include "../src/dpiPool.c"
 #include "../src/dpiQueue.c"
+#include "../src/dpiResultSet.c"
+#include "../src/dpiRowBlock.c"
 #include "../src/dpiRowid.c"
+#include "../src/dpiScan.c"
+#include "../src/dpiScrollCache.c"
+#include "../src/dpiSessionState.c"
+#include "../src/dpiShardingKeyCache.c"
+#include "../src/dpiSnapshot.c"
 #include "../src/dpiSodaColl.c"
 #include "../src/dpiSodaCollCursor.c"
 #include "../src/dpiSodaDb.c"
 #include "../src/dpiSodaDoc.c"
 #include "../src/dpiSodaDocCursor.c"
+#include "../src/dpiSqlLexer.c"
+#include "../src/dpiSqlNormalizer.c"
+#include "../src/dpiSqlProfile.c"
 #include "../src/dpiStmt.c"
+#include "../src/dpiStmtBatch.c"
 #include "../src/dpiStringList.c"
+#include "../src/dpiStructMap.c"
 #include "../src/dpiSubscr.c"
 #include "../src/dpiUtils.c"
 #include "../src/dpiVar.c"
 #include "../src/dpiVector.c"
+#include "../src/dpiWorkerPool.c"
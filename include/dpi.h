@@ -338,6 +338,12 @@ typedef uint32_t dpiStartupMode;
 #define DPI_MODE_STARTUP_FORCE                      1
 #define DPI_MODE_STARTUP_RESTRICT                   2
 
+// methods used to split a table into chunks for a parallel scan
+typedef uint8_t dpiScanSplitMode;
+#define DPI_SCAN_SPLIT_ROWID                        1
+#define DPI_SCAN_SPLIT_PARTITION                    2
+#define DPI_SCAN_SPLIT_KEY_RANGE                    3
+
 // server types
 typedef uint8_t dpiServerType;
 #define DPI_SERVER_TYPE_UNKNOWN                     0
@@ -437,6 +443,9 @@ typedef struct dpiObjectAttr dpiObjectAttr;
 typedef struct dpiObjectType dpiObjectType;
 typedef struct dpiPool dpiPool;
 typedef struct dpiQueue dpiQueue;
+typedef struct dpiResultSet dpiResultSet;
+typedef struct dpiRowBlock dpiRowBlock;
+typedef struct dpiScan dpiScan;
 typedef struct dpiRowid dpiRowid;
 typedef struct dpiSodaColl dpiSodaColl;
 typedef struct dpiSodaCollCursor dpiSodaCollCursor;
@@ -453,6 +462,7 @@ typedef struct dpiVector dpiVector;
 // Forward Declarations of Other Types
 //-----------------------------------------------------------------------------
 typedef struct dpiAccessToken dpiAccessToken;
+typedef struct dpiAdaptiveExecParams dpiAdaptiveExecParams;
 typedef struct dpiAnnotation dpiAnnotation;
 typedef struct dpiAppContext dpiAppContext;
 typedef struct dpiCommonCreateParams dpiCommonCreateParams;
@@ -464,22 +474,35 @@ typedef union dpiDataBuffer dpiDataBuffer;
 typedef struct dpiDataTypeInfo dpiDataTypeInfo;
 typedef struct dpiEncodingInfo dpiEncodingInfo;
 typedef struct dpiErrorInfo dpiErrorInfo;
+typedef struct dpiHandleTypeCount dpiHandleTypeCount;
 typedef struct dpiJsonNode dpiJsonNode;
+typedef struct dpiLiveHandleInfo dpiLiveHandleInfo;
 typedef struct dpiMsgRecipient dpiMsgRecipient;
+typedef struct dpiMutexStats dpiMutexStats;
 typedef struct dpiObjectAttrInfo dpiObjectAttrInfo;
 typedef struct dpiObjectTypeInfo dpiObjectTypeInfo;
 typedef struct dpiPoolCreateParams dpiPoolCreateParams;
 typedef struct dpiQueryInfo dpiQueryInfo;
+typedef struct dpiScanCreateParams dpiScanCreateParams;
+typedef struct dpiSessionParam dpiSessionParam;
+typedef struct dpiSessionState dpiSessionState;
 typedef struct dpiSessionlessTransactionId dpiSessionlessTransactionId;
 typedef struct dpiShardingKeyColumn dpiShardingKeyColumn;
+typedef struct dpiSnapshot dpiSnapshot;
 typedef struct dpiSodaOperOptions dpiSodaOperOptions;
+typedef struct dpiSqlNormalizerInfo dpiSqlNormalizerInfo;
+typedef struct dpiSqlProfileInfo dpiSqlProfileInfo;
 typedef struct dpiStmtInfo dpiStmtInfo;
 typedef struct dpiStringList dpiStringList;
+typedef struct dpiStructField dpiStructField;
+typedef struct dpiStructLayout dpiStructLayout;
 typedef struct dpiSubscrCreateParams dpiSubscrCreateParams;
 typedef struct dpiSubscrMessage dpiSubscrMessage;
 typedef struct dpiSubscrMessageQuery dpiSubscrMessageQuery;
 typedef struct dpiSubscrMessageRow dpiSubscrMessageRow;
 typedef struct dpiSubscrMessageTable dpiSubscrMessageTable;
+typedef struct dpiUnitOfWork dpiUnitOfWork;
+typedef struct dpiUnitOfWorkBind dpiUnitOfWorkBind;
 typedef struct dpiVectorInfo dpiVectorInfo;
 typedef union dpiVectorDimensionBuffer dpiVectorDimensionBuffer;
 typedef struct dpiVersionInfo dpiVersionInfo;
@@ -491,6 +514,8 @@ typedef struct dpiXid dpiXid;
 //-----------------------------------------------------------------------------
 typedef int (*dpiAccessTokenCallback)(void *context,
         dpiAccessToken *accessToken);
+typedef int (*dpiReadCallback)(void *context, char *buffer,
+        uint32_t bufferLength, uint32_t *bytesRead);
 
 
 //-----------------------------------------------------------------------------
@@ -643,6 +668,7 @@ struct dpiConnCreateParams {
     dpiShardingKeyColumn *superShardingKeyColumns;
     uint8_t numSuperShardingKeyColumns;
     int outNewSession;
+    const dpiSessionState *sessionState;
 };
 
 // structure used for transferring connection information from ODPI-C
@@ -660,6 +686,24 @@ struct dpiConnInfo {
     uint8_t serverType;
 };
 
+// structure used for creating a parallel scan
+struct dpiScanCreateParams {
+    const char *tableName;
+    uint32_t tableNameLength;
+    const char *columns;
+    uint32_t columnsLength;
+    const char *whereClause;
+    uint32_t whereClauseLength;
+    dpiScanSplitMode splitMode;
+    const char *keyColumn;
+    uint32_t keyColumnLength;
+    uint32_t numChunks;
+    uint32_t numConnections;
+    uint32_t fetchArraySize;
+    uint32_t maxPendingBlocks;
+    int ordered;
+};
+
 // structure used for creating a context
 struct dpiContextCreateParams {
     const char *defaultDriverName;
@@ -669,6 +713,11 @@ struct dpiContextCreateParams {
     const char *oracleClientConfigDir;
     int sodaUseJsonDesc;
     int useJsonId;
+    int loadAllSymbols;
+    int enableSqlProfiler;
+    int enableHandleTracking;
+    uint32_t numConversionThreads;
+    int enableSqlNormalizer;
 };
 
 // structure used for transferring data to/from ODPI-C
@@ -710,6 +759,14 @@ struct dpiAccessToken {
     uint32_t privateKeyLength;
 };
 
+// structure used for controlling the adaptive execution of DML statements
+struct dpiAdaptiveExecParams {
+    uint32_t initialBatchSize;
+    uint32_t maxBatchSize;
+    uint32_t targetBatchTimeMs;
+    uint32_t maxRetries;
+};
+
 // structure used for transferring encoding information from ODPI-C
 struct dpiEncodingInfo {
     const char *encoding;
@@ -783,12 +840,42 @@ struct dpiQueryInfo {
     int nullOk;
 };
 
+// structure used for transferring the number of handles of one type
+struct dpiHandleTypeCount {
+    const char *typeName;
+    uint64_t numLive;
+    uint64_t numCreated;
+};
+
+// structure used for transferring information about a live handle
+struct dpiLiveHandleInfo {
+    const void *handle;
+    const char *typeName;
+    const char *fnName;
+    uint32_t refCount;
+    uint64_t ageMs;
+};
+
 // structure used for recipients list
 struct dpiMsgRecipient {
     const char *name;
     uint32_t nameLength;
 };
 
+// structure used for transferring mutex contention statistics from ODPI-C
+struct dpiMutexStats {
+    const char *fileName;
+    uint32_t lineNum;
+    const char *mutexName;
+    uint64_t numAcquisitions;
+    uint64_t numContended;
+    uint64_t totalWaitNs;
+    uint64_t maxWaitNs;
+    uint64_t p50WaitNs;
+    uint64_t p90WaitNs;
+    uint64_t p99WaitNs;
+};
+
 // structure used for storing sessionless transaction ids
 struct dpiSessionlessTransactionId {
     char value[64];
@@ -802,6 +889,11 @@ struct dpiShardingKeyColumn {
     dpiDataBuffer value;
 };
 
+// structure used for sharing a read consistency snapshot between connections
+struct dpiSnapshot {
+    uint64_t scn;
+};
+
 // structure used for getting an array of strings from the database
 struct dpiStringList {
     uint32_t numStrings;
@@ -828,6 +920,59 @@ struct dpiSodaOperOptions {
     int lock;
 };
 
+// structure used for transferring SQL normalizer statistics
+struct dpiSqlNormalizerInfo {
+    uint64_t numPrepares;
+    uint64_t numNormalized;
+    uint64_t numLiterals;
+    uint64_t numCacheHits;
+    uint64_t numCacheMisses;
+};
+
+// structure used for transferring SQL profiler statistics for one statement
+struct dpiSqlProfileInfo {
+    const char *sql;
+    uint32_t sqlLength;
+    char sqlId[13];
+    uint32_t sqlIdLength;
+    uint64_t numPrepares;
+    uint64_t numExecutions;
+    uint64_t numRows;
+    uint64_t prepareTimeNs;
+    uint64_t executeTimeNs;
+    uint64_t fetchTimeNs;
+    uint64_t numFetches;
+    double avgFetchArraySize;
+    uint32_t prefetchRows;
+    uint64_t numBytesFetched;
+};
+
+// structure used for specifying a session parameter (ALTER SESSION)
+struct dpiSessionParam {
+    const char *name;
+    uint32_t nameLength;
+    const char *value;
+    uint32_t valueLength;
+};
+
+// structure used for specifying the desired state of a session
+struct dpiSessionState {
+    const char *module;
+    uint32_t moduleLength;
+    const char *action;
+    uint32_t actionLength;
+    const char *clientIdentifier;
+    uint32_t clientIdentifierLength;
+    const char *clientInfo;
+    uint32_t clientInfoLength;
+    const char *currentSchema;
+    uint32_t currentSchemaLength;
+    dpiSessionParam *params;
+    uint32_t numParams;
+    dpiAppContext *appContext;
+    uint32_t numAppContext;
+};
+
 // structure used for transferring statement information from ODPI-C
 struct dpiStmtInfo {
     int isQuery;
@@ -840,6 +985,25 @@ struct dpiStmtInfo {
     uint32_t sqlIdLength;
 };
 
+// structure used for describing one field of a caller-owned struct that is
+// bound or defined directly; negative offsets indicate the field is absent
+struct dpiStructField {
+    uint32_t pos;
+    dpiNativeTypeNum nativeTypeNum;
+    uint32_t valueOffset;
+    uint32_t valueSize;
+    int32_t indicatorOffset;
+    int32_t lengthOffset;
+};
+
+// structure used for describing the layout of a caller-owned struct that is
+// bound or defined directly
+struct dpiStructLayout {
+    uint32_t structSize;
+    uint32_t numFields;
+    const dpiStructField *fields;
+};
+
 // callback for subscriptions
 typedef void (*dpiSubscrCallback)(void* context, dpiSubscrMessage *message);
 
@@ -914,6 +1078,23 @@ struct dpiSubscrMessageTable {
     uint32_t numRows;
 };
 
+// structure used for describing the statement executed by a unit of work
+struct dpiUnitOfWork {
+    const char *sql;
+    uint32_t sqlLength;
+    const char *tag;
+    uint32_t tagLength;
+    dpiUnitOfWorkBind *binds;
+    uint32_t numBinds;
+};
+
+// structure used for transferring the value bound to a position in the
+// statement executed by a unit of work
+struct dpiUnitOfWorkBind {
+    dpiNativeTypeNum nativeTypeNum;
+    dpiData value;
+};
+
 // structure used for transferring version information
 struct dpiVersionInfo {
     int versionNum;
@@ -983,6 +1164,30 @@ DPI_EXPORT int dpiContext_getClientVersion(const dpiContext *context,
 DPI_EXPORT void dpiContext_getError(const dpiContext *context,
         dpiErrorInfo *errorInfo);
 
+// return the number of live handles of each type (handle tracking only)
+DPI_EXPORT int dpiContext_getHandleCounts(const dpiContext *context,
+        dpiHandleTypeCount *counts, uint32_t *numCounts);
+
+// return the live handles, oldest first (handle tracking only)
+DPI_EXPORT int dpiContext_getLiveHandles(const dpiContext *context,
+        dpiLiveHandleInfo *info, uint32_t *numInfo);
+
+// return the names of OCI symbols not found in the Oracle Client library
+DPI_EXPORT int dpiContext_getMissingSymbols(const dpiContext *context,
+        dpiStringList *list);
+
+// return lock contention statistics for the mutexes used internally
+DPI_EXPORT int dpiContext_getMutexStats(const dpiContext *context,
+        dpiMutexStats *stats, uint32_t *numStats);
+
+// return SQL normalizer statistics
+DPI_EXPORT int dpiContext_getSqlNormalizerInfo(const dpiContext *context,
+        dpiSqlNormalizerInfo *info);
+
+// return SQL profiler statistics for each statement executed
+DPI_EXPORT int dpiContext_getSqlProfile(const dpiContext *context,
+        dpiSqlProfileInfo *info, uint32_t *numInfo);
+
 // initialize context parameters to default values
 DPI_EXPORT int dpiContext_initCommonCreateParams(const dpiContext *context,
         dpiCommonCreateParams *params);
@@ -995,6 +1200,10 @@ DPI_EXPORT int dpiContext_initConnCreateParams(const dpiContext *context,
 DPI_EXPORT int dpiContext_initPoolCreateParams(const dpiContext *context,
         dpiPoolCreateParams *params);
 
+// initialize parallel scan create parameters to default values
+DPI_EXPORT int dpiContext_initScanCreateParams(const dpiContext *context,
+        dpiScanCreateParams *params);
+
 // initialize SODA operation options to default values
 DPI_EXPORT int dpiContext_initSodaOperOptions(const dpiContext *context,
         dpiSodaOperOptions *options);
@@ -1003,6 +1212,12 @@ DPI_EXPORT int dpiContext_initSodaOperOptions(const dpiContext *context,
 DPI_EXPORT int dpiContext_initSubscrCreateParams(const dpiContext *context,
         dpiSubscrCreateParams *params);
 
+// reset lock contention statistics for the mutexes used internally
+DPI_EXPORT int dpiContext_resetMutexStats(const dpiContext *context);
+
+// reset SQL profiler statistics for all statements
+DPI_EXPORT int dpiContext_resetSqlProfile(const dpiContext *context);
+
 
 //-----------------------------------------------------------------------------
 // Connection Methods (dpiConn)
@@ -1048,6 +1263,11 @@ DPI_EXPORT int dpiConn_enqObject(dpiConn *conn, const char *queueName,
         uint32_t queueNameLength, dpiEnqOptions *options, dpiMsgProps *props,
         dpiObject *payload, const char **msgId, uint32_t *msgIdLength);
 
+// execute multiple statements with a single round-trip
+DPI_EXPORT int dpiConn_executeBatch(dpiConn *conn, uint32_t numStmts,
+        dpiStmt **stmts, dpiExecMode mode, uint64_t *rowCounts,
+        dpiStmt **queryResults);
+
 // get call timeout in place for round-trips with this connection
 DPI_EXPORT int dpiConn_getCallTimeout(dpiConn *conn, uint32_t *value);
 
@@ -1121,6 +1341,9 @@ DPI_EXPORT int dpiConn_getServerVersion(dpiConn *conn,
 DPI_EXPORT int dpiConn_getServiceName(dpiConn *conn, const char **value,
         uint32_t *valueLength);
 
+// capture a snapshot of the current SCN of the database
+DPI_EXPORT int dpiConn_getSnapshot(dpiConn *conn, dpiSnapshot *snapshot);
+
 // get SODA interface object
 DPI_EXPORT int dpiConn_getSodaDb(dpiConn *conn, dpiSodaDb **db);
 
@@ -1227,6 +1450,11 @@ DPI_EXPORT int dpiConn_setModule(dpiConn *conn, const char *value,
 DPI_EXPORT int dpiConn_setOciAttr(dpiConn *conn, uint32_t handleType,
         uint32_t attribute, void *value, uint32_t valueLength);
 
+// set the snapshot seen by queries executed on the connection (or NULL to
+// clear it); it is applied when the next statement is prepared
+DPI_EXPORT int dpiConn_setSnapshot(dpiConn *conn,
+        const dpiSnapshot *snapshot);
+
 // set the statement cache size
 DPI_EXPORT int dpiConn_setStmtCacheSize(dpiConn *conn, uint32_t cacheSize);
 
@@ -1271,6 +1499,11 @@ DPI_EXPORT int dpiConn_tpcRollback(dpiConn *conn, dpiXid *xid);
 // unsubscribe from events in the database
 DPI_EXPORT int dpiConn_unsubscribe(dpiConn *conn, dpiSubscr *subscr);
 
+// write to multiple LOBs in a single round trip
+DPI_EXPORT int dpiConn_writeLobs(dpiConn *conn, uint32_t numLobs,
+        dpiLob **lobs, const uint64_t *offsets, const char **values,
+        const uint64_t *valueLengths, uint64_t *bytesWritten);
+
 // start a sessionless transaction
 DPI_EXPORT int dpiConn_beginSessionlessTransaction(dpiConn *conn,
         dpiSessionlessTransactionId* transactionId, uint32_t timeout,
@@ -1804,6 +2037,16 @@ DPI_EXPORT int dpiPool_create(const dpiContext *context, const char *userName,
         const dpiCommonCreateParams *commonParams,
         dpiPoolCreateParams *createParams, dpiPool **pool);
 
+// create a scan of a table which is fetched in parallel using connections
+// acquired from the pool
+DPI_EXPORT int dpiPool_createScan(dpiPool *pool,
+        const dpiScanCreateParams *params, dpiScan **scan);
+
+// acquire a connection from the pool, execute a single statement on it,
+// commit if successful and release the connection back to the pool
+DPI_EXPORT int dpiPool_executeUnitOfWork(dpiPool *pool,
+        const dpiUnitOfWork *unit, uint64_t *rowCount);
+
 // get the pool's busy count
 DPI_EXPORT int dpiPool_getBusyCount(dpiPool *pool, uint32_t *value);
 
@@ -2136,6 +2379,10 @@ DPI_EXPORT int dpiStmt_bindValueByName(dpiStmt *stmt, const char *name,
 DPI_EXPORT int dpiStmt_bindValueByPos(dpiStmt *stmt, uint32_t pos,
         dpiNativeTypeNum nativeTypeNum, dpiData *data);
 
+// bind the rows of a caller-owned array of structs to the statement
+DPI_EXPORT int dpiStmt_bindStruct(dpiStmt *stmt,
+        const dpiStructLayout *layout, void *rows, uint32_t numRows);
+
 // close the statement now, not when its reference count reaches zero
 DPI_EXPORT int dpiStmt_close(dpiStmt *stmt, const char *tag,
         uint32_t tagLength);
@@ -2148,6 +2395,14 @@ DPI_EXPORT int dpiStmt_defineValue(dpiStmt *stmt, uint32_t pos,
         dpiOracleTypeNum oracleTypeNum, dpiNativeTypeNum nativeTypeNum,
         uint32_t size, int sizeIsBytes, dpiObjectType *objType);
 
+// define a caller-owned array of structs to accept fetched rows
+DPI_EXPORT int dpiStmt_defineStruct(dpiStmt *stmt,
+        const dpiStructLayout *layout, void *rows, uint32_t maxRows);
+
+// detach the rows in the fetch buffers as a row block; new buffers are used
+// for subsequent fetches
+DPI_EXPORT int dpiStmt_detachRowBlock(dpiStmt *stmt, dpiRowBlock **block);
+
 // execute the statement and return the number of query columns
 // zero implies the statement is not a query
 DPI_EXPORT int dpiStmt_execute(dpiStmt *stmt, dpiExecMode mode,
@@ -2157,6 +2412,10 @@ DPI_EXPORT int dpiStmt_execute(dpiStmt *stmt, dpiExecMode mode,
 DPI_EXPORT int dpiStmt_executeMany(dpiStmt *stmt, dpiExecMode mode,
         uint32_t numIters);
 
+// execute a DML statement multiple times in adaptively sized batches
+DPI_EXPORT int dpiStmt_executeManyAdaptive(dpiStmt *stmt, dpiExecMode mode,
+        uint32_t numIters, const dpiAdaptiveExecParams *params);
+
 // fetch a single row and return the index into the defined variables
 // this will internally perform any execute and array fetch as needed
 DPI_EXPORT int dpiStmt_fetch(dpiStmt *stmt, int *found,
@@ -2169,6 +2428,11 @@ DPI_EXPORT int dpiStmt_fetch(dpiStmt *stmt, int *found,
 DPI_EXPORT int dpiStmt_fetchRows(dpiStmt *stmt, uint32_t maxRows,
         uint32_t *bufferRowIndex, uint32_t *numRowsFetched, int *moreRows);
 
+// fetch rows directly into the array of structs defined with
+// dpiStmt_defineStruct(), starting with the first element of the array
+DPI_EXPORT int dpiStmt_fetchStruct(dpiStmt *stmt, uint32_t *numRowsFetched,
+        int *moreRows);
+
 // get the number of batch errors that took place in the previous execution
 DPI_EXPORT int dpiStmt_getBatchErrorCount(dpiStmt *stmt, uint32_t *count);
 
@@ -2193,6 +2457,15 @@ DPI_EXPORT int dpiStmt_getHandle(dpiStmt *stmt, void **handle);
 DPI_EXPORT int dpiStmt_getImplicitResult(dpiStmt *stmt,
         dpiStmt **implicitResult);
 
+// get the number of implicit results from previous execution that have not
+// yet been returned; all of them are collected from the database
+DPI_EXPORT int dpiStmt_getImplicitResultCount(dpiStmt *stmt, uint32_t *count);
+
+// get all implicit results from previous execution that have not yet been
+// returned, ready to be fetched in any order
+DPI_EXPORT int dpiStmt_getImplicitResults(dpiStmt *stmt, uint32_t numResults,
+        dpiStmt **results);
+
 // return information about the statement
 DPI_EXPORT int dpiStmt_getInfo(dpiStmt *stmt, dpiStmtInfo *info);
 
@@ -2232,6 +2505,11 @@ DPI_EXPORT int dpiStmt_getRowCounts(dpiStmt *stmt, uint32_t *numRowCounts,
 // get subscription query id for continuous query notification
 DPI_EXPORT int dpiStmt_getSubscrQueryId(dpiStmt *stmt, uint64_t *queryId);
 
+// fetch all of the remaining rows of the query into a result set which is
+// held in memory up to the specified size and in a temporary file beyond it
+DPI_EXPORT int dpiStmt_materialize(dpiStmt *stmt, uint64_t maxMemory,
+        dpiResultSet **resultSet);
+
 // release a reference to the statement
 DPI_EXPORT int dpiStmt_release(dpiStmt *stmt);
 
@@ -2252,11 +2530,78 @@ DPI_EXPORT int dpiStmt_setOciAttr(dpiStmt *stmt, uint32_t attribute,
 DPI_EXPORT int dpiStmt_setPrefetchRows(dpiStmt *stmt,
         uint32_t numRows);
 
+// set the number of fetched row blocks cached by a scrollable statement
+DPI_EXPORT int dpiStmt_setScrollCache(dpiStmt *stmt, uint32_t numBlocks,
+        int readAhead);
+
 // set the flag to exclude the current SQL statement from the statement
 // cache
 DPI_EXPORT int dpiStmt_deleteFromCache(dpiStmt *stmt);
 
 
+//-----------------------------------------------------------------------------
+// Result Set Methods (dpiResultSet)
+//-----------------------------------------------------------------------------
+
+// add a reference to the result set
+DPI_EXPORT int dpiResultSet_addRef(dpiResultSet *resultSet);
+
+// return the number of columns in the result set
+DPI_EXPORT int dpiResultSet_getNumColumns(dpiResultSet *resultSet,
+        uint32_t *numColumns);
+
+// return the number of rows in the result set
+DPI_EXPORT int dpiResultSet_getNumRows(dpiResultSet *resultSet,
+        uint64_t *numRows);
+
+// return the value of the column at the specified position (1 based) in the
+// row at the specified index (0 based)
+DPI_EXPORT int dpiResultSet_getValue(dpiResultSet *resultSet,
+        uint64_t rowIndex, uint32_t pos, dpiNativeTypeNum *nativeTypeNum,
+        dpiData *data);
+
+// release a reference to the result set
+DPI_EXPORT int dpiResultSet_release(dpiResultSet *resultSet);
+
+
+//-----------------------------------------------------------------------------
+// Row Block Methods (dpiRowBlock)
+//-----------------------------------------------------------------------------
+
+// add a reference to the row block
+DPI_EXPORT int dpiRowBlock_addRef(dpiRowBlock *block);
+
+// return the data for the column at the specified position (1 based); the
+// array contains one element for each row in the block
+DPI_EXPORT int dpiRowBlock_getColumnData(dpiRowBlock *block, uint32_t pos,
+        dpiNativeTypeNum *nativeTypeNum, dpiData **data);
+
+// return the number of rows in the row block
+DPI_EXPORT int dpiRowBlock_getNumRows(dpiRowBlock *block, uint32_t *numRows);
+
+// release a reference to the row block
+DPI_EXPORT int dpiRowBlock_release(dpiRowBlock *block);
+
+
+//-----------------------------------------------------------------------------
+// Scan Methods (dpiScan)
+//-----------------------------------------------------------------------------
+
+// add a reference to the scan
+DPI_EXPORT int dpiScan_addRef(dpiScan *scan);
+
+// cancel the scan, interrupting any statements that are being executed
+DPI_EXPORT int dpiScan_cancel(dpiScan *scan);
+
+// return the next block of rows produced by the scan (or NULL if no more rows
+// are available)
+DPI_EXPORT int dpiScan_getNext(dpiScan *scan, dpiRowBlock **block,
+        uint32_t *chunkNum);
+
+// release a reference to the scan
+DPI_EXPORT int dpiScan_release(dpiScan *scan);
+
+
 //-----------------------------------------------------------------------------
 // Rowid Methods (dpiRowid)
 //-----------------------------------------------------------------------------
@@ -2317,6 +2662,10 @@ DPI_EXPORT int dpiVar_release(dpiVar *var);
 DPI_EXPORT int dpiVar_setFromBytes(dpiVar *var, uint32_t pos,
         const char *value, uint32_t valueLength);
 
+// set the value of the variable to be streamed from a callback during execute
+DPI_EXPORT int dpiVar_setFromCallback(dpiVar *var, uint32_t pos,
+        dpiReadCallback callback, void *context);
+
 // set the value of the variable from a JSON handle
 DPI_EXPORT int dpiVar_setFromJson(dpiVar *var, uint32_t pos, dpiJson *json);
 
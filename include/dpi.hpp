@@ -0,0 +1,607 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// dpi.hpp
+//   Optional header-only C++17 layer for users of the ODPI-C library. It
+// provides RAII wrappers for the reference counted handles, a compile-time
+// mapping of C++ types to ODPI-C native types and typed access to fetched
+// rows and columns without copying data out of the variable buffers. Only the
+// public API found in dpi.h is used.
+//-----------------------------------------------------------------------------
+
+#ifndef DPI_PUBLIC_HPP
+#define DPI_PUBLIC_HPP
+
+#include "dpi.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __cplusplus >= 202002L && defined(__has_include)
+#if __has_include(<span>)
+#include <span>
+#define DPI_HPP_HAS_SPAN
+#endif
+#endif
+
+namespace dpi {
+
+//-----------------------------------------------------------------------------
+// Error
+//   Exception raised when an ODPI-C function returns DPI_FAILURE. The
+// information is copied from the dpiErrorInfo structure since the pointers it
+// contains are only valid until the next call on the same thread.
+//-----------------------------------------------------------------------------
+class Error : public std::runtime_error {
+public:
+    explicit Error(const dpiErrorInfo &info)
+        : std::runtime_error(std::string(info.message, info.messageLength)),
+          code_(info.code), offset_(info.offset),
+          isRecoverable_(info.isRecoverable != 0),
+          fnName_(info.fnName ? info.fnName : ""),
+          action_(info.action ? info.action : ""),
+          sqlState_(info.sqlState ? info.sqlState : "") {}
+
+    int32_t code() const noexcept { return code_; }
+    uint32_t offset() const noexcept { return offset_; }
+    bool isRecoverable() const noexcept { return isRecoverable_; }
+    const std::string &fnName() const noexcept { return fnName_; }
+    const std::string &action() const noexcept { return action_; }
+    const std::string &sqlState() const noexcept { return sqlState_; }
+
+private:
+    int32_t code_;
+    uint32_t offset_;
+    bool isRecoverable_;
+    std::string fnName_;
+    std::string action_;
+    std::string sqlState_;
+};
+
+
+//-----------------------------------------------------------------------------
+// check()
+//   Raise an exception if the status returned by an ODPI-C function indicates
+// failure.
+//-----------------------------------------------------------------------------
+inline void check(const dpiContext *context, int status)
+{
+    dpiErrorInfo info;
+
+    if (status < 0) {
+        dpiContext_getError(context, &info);
+        throw Error(info);
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// HandleTraits
+//   Functions used to manage the reference count of each type of handle.
+//-----------------------------------------------------------------------------
+template <typename T> struct HandleTraits;
+
+template <> struct HandleTraits<dpiConn> {
+    static int addRef(dpiConn *h) noexcept { return dpiConn_addRef(h); }
+    static int release(dpiConn *h) noexcept { return dpiConn_release(h); }
+};
+
+template <> struct HandleTraits<dpiPool> {
+    static int addRef(dpiPool *h) noexcept { return dpiPool_addRef(h); }
+    static int release(dpiPool *h) noexcept { return dpiPool_release(h); }
+};
+
+template <> struct HandleTraits<dpiStmt> {
+    static int addRef(dpiStmt *h) noexcept { return dpiStmt_addRef(h); }
+    static int release(dpiStmt *h) noexcept { return dpiStmt_release(h); }
+};
+
+template <> struct HandleTraits<dpiVar> {
+    static int addRef(dpiVar *h) noexcept { return dpiVar_addRef(h); }
+    static int release(dpiVar *h) noexcept { return dpiVar_release(h); }
+};
+
+template <> struct HandleTraits<dpiLob> {
+    static int addRef(dpiLob *h) noexcept { return dpiLob_addRef(h); }
+    static int release(dpiLob *h) noexcept { return dpiLob_release(h); }
+};
+
+
+//-----------------------------------------------------------------------------
+// Handle
+//   Owns one reference to an ODPI-C handle. Copying adds a reference and
+// destruction releases it.
+//-----------------------------------------------------------------------------
+template <typename T>
+class Handle {
+public:
+    Handle() noexcept = default;
+    Handle(const dpiContext *context, T *handle) noexcept
+        : context_(context), handle_(handle) {}
+    Handle(const Handle &other) noexcept
+        : context_(other.context_), handle_(other.handle_)
+    {
+        if (handle_)
+            HandleTraits<T>::addRef(handle_);
+    }
+    Handle(Handle &&other) noexcept
+        : context_(other.context_), handle_(other.handle_)
+    {
+        other.handle_ = nullptr;
+    }
+    ~Handle() { reset(); }
+
+    Handle &operator=(Handle other) noexcept
+    {
+        std::swap(context_, other.context_);
+        std::swap(handle_, other.handle_);
+        return *this;
+    }
+
+    void reset() noexcept
+    {
+        if (handle_) {
+            HandleTraits<T>::release(handle_);
+            handle_ = nullptr;
+        }
+    }
+
+    T *get() const noexcept { return handle_; }
+    const dpiContext *context() const noexcept { return context_; }
+    explicit operator bool() const noexcept { return handle_ != nullptr; }
+
+private:
+    const dpiContext *context_ = nullptr;
+    T *handle_ = nullptr;
+};
+
+
+//-----------------------------------------------------------------------------
+// TypeMap
+//   Compile-time mapping of a C++ type to the ODPI-C native type used to
+// transfer it and the Oracle type used when binding it. Reading a null value
+// into a type that is not wrapped in std::optional yields a value initialized
+// result. The getValue() method reads a value which is known not to be null
+// without checking it again.
+//-----------------------------------------------------------------------------
+template <typename T> struct TypeMap;
+
+template <> struct TypeMap<int64_t> {
+    static constexpr dpiOracleTypeNum oracleTypeNum = DPI_ORACLE_TYPE_NUMBER;
+    static constexpr dpiNativeTypeNum nativeTypeNum = DPI_NATIVE_TYPE_INT64;
+    static int64_t get(const dpiData &data) noexcept
+        { return data.isNull ? 0 : getValue(data); }
+    static int64_t getValue(const dpiData &data) noexcept
+        { return data.value.asInt64; }
+    static void set(dpiData &data, int64_t value) noexcept
+        { data.isNull = 0; data.value.asInt64 = value; }
+};
+
+template <> struct TypeMap<uint64_t> {
+    static constexpr dpiOracleTypeNum oracleTypeNum = DPI_ORACLE_TYPE_NUMBER;
+    static constexpr dpiNativeTypeNum nativeTypeNum = DPI_NATIVE_TYPE_UINT64;
+    static uint64_t get(const dpiData &data) noexcept
+        { return data.isNull ? 0 : getValue(data); }
+    static uint64_t getValue(const dpiData &data) noexcept
+        { return data.value.asUint64; }
+    static void set(dpiData &data, uint64_t value) noexcept
+        { data.isNull = 0; data.value.asUint64 = value; }
+};
+
+template <> struct TypeMap<double> {
+    static constexpr dpiOracleTypeNum oracleTypeNum = DPI_ORACLE_TYPE_NUMBER;
+    static constexpr dpiNativeTypeNum nativeTypeNum = DPI_NATIVE_TYPE_DOUBLE;
+    static double get(const dpiData &data) noexcept
+        { return data.isNull ? 0.0 : getValue(data); }
+    static double getValue(const dpiData &data) noexcept
+        { return data.value.asDouble; }
+    static void set(dpiData &data, double value) noexcept
+        { data.isNull = 0; data.value.asDouble = value; }
+};
+
+template <> struct TypeMap<float> {
+    static constexpr dpiOracleTypeNum oracleTypeNum =
+            DPI_ORACLE_TYPE_NATIVE_FLOAT;
+    static constexpr dpiNativeTypeNum nativeTypeNum = DPI_NATIVE_TYPE_FLOAT;
+    static float get(const dpiData &data) noexcept
+        { return data.isNull ? 0.0f : getValue(data); }
+    static float getValue(const dpiData &data) noexcept
+        { return data.value.asFloat; }
+    static void set(dpiData &data, float value) noexcept
+        { data.isNull = 0; data.value.asFloat = value; }
+};
+
+template <> struct TypeMap<bool> {
+    static constexpr dpiOracleTypeNum oracleTypeNum = DPI_ORACLE_TYPE_BOOLEAN;
+    static constexpr dpiNativeTypeNum nativeTypeNum = DPI_NATIVE_TYPE_BOOLEAN;
+    static bool get(const dpiData &data) noexcept
+        { return !data.isNull && getValue(data); }
+    static bool getValue(const dpiData &data) noexcept
+        { return data.value.asBoolean != 0; }
+    static void set(dpiData &data, bool value) noexcept
+        { data.isNull = 0; data.value.asBoolean = value; }
+};
+
+// the string view refers directly to the variable buffer and is only valid
+// until the next fetch
+template <> struct TypeMap<std::string_view> {
+    static constexpr dpiOracleTypeNum oracleTypeNum = DPI_ORACLE_TYPE_VARCHAR;
+    static constexpr dpiNativeTypeNum nativeTypeNum = DPI_NATIVE_TYPE_BYTES;
+    static std::string_view get(const dpiData &data) noexcept
+        { return data.isNull ? std::string_view() : getValue(data); }
+    static std::string_view getValue(const dpiData &data) noexcept
+    {
+        return std::string_view(data.value.asBytes.ptr,
+                data.value.asBytes.length);
+    }
+    static void set(dpiData &data, std::string_view value) noexcept
+    {
+        data.isNull = 0;
+        data.value.asBytes.ptr = const_cast<char*>(value.data());
+        data.value.asBytes.length = static_cast<uint32_t>(value.size());
+        data.value.asBytes.encoding = nullptr;
+    }
+};
+
+template <> struct TypeMap<dpiTimestamp> {
+    static constexpr dpiOracleTypeNum oracleTypeNum =
+            DPI_ORACLE_TYPE_TIMESTAMP;
+    static constexpr dpiNativeTypeNum nativeTypeNum =
+            DPI_NATIVE_TYPE_TIMESTAMP;
+    static dpiTimestamp get(const dpiData &data) noexcept
+        { return data.isNull ? dpiTimestamp() : getValue(data); }
+    static dpiTimestamp getValue(const dpiData &data) noexcept
+        { return data.value.asTimestamp; }
+    static void set(dpiData &data, const dpiTimestamp &value) noexcept
+        { data.isNull = 0; data.value.asTimestamp = value; }
+};
+
+template <typename T> struct TypeMap<std::optional<T>> {
+    static constexpr dpiOracleTypeNum oracleTypeNum = TypeMap<T>::oracleTypeNum;
+    static constexpr dpiNativeTypeNum nativeTypeNum = TypeMap<T>::nativeTypeNum;
+    static std::optional<T> get(const dpiData &data) noexcept
+    {
+        if (data.isNull)
+            return std::nullopt;
+        return TypeMap<T>::getValue(data);
+    }
+    static void set(dpiData &data, const std::optional<T> &value) noexcept
+    {
+        if (value)
+            TypeMap<T>::set(data, *value);
+        else data.isNull = 1;
+    }
+};
+
+
+//-----------------------------------------------------------------------------
+// ColumnView
+//   Read-only view of a slice of the data buffers of a variable, interpreted
+// as the given C++ type. No data is copied; the view is only valid until the
+// next fetch.
+//-----------------------------------------------------------------------------
+template <typename T>
+class ColumnView {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = T;
+
+        explicit iterator(const dpiData *data) noexcept : data_(data) {}
+        T operator*() const noexcept { return TypeMap<T>::get(*data_); }
+        iterator &operator++() noexcept { ++data_; return *this; }
+        iterator operator++(int) noexcept
+            { iterator temp = *this; ++data_; return temp; }
+        bool operator==(const iterator &other) const noexcept
+            { return data_ == other.data_; }
+        bool operator!=(const iterator &other) const noexcept
+            { return data_ != other.data_; }
+
+    private:
+        const dpiData *data_;
+    };
+
+    ColumnView() noexcept = default;
+    ColumnView(const dpiData *data, uint32_t size) noexcept
+        : data_(data), size_(size) {}
+
+    T operator[](uint32_t index) const noexcept
+        { return TypeMap<T>::get(data_[index]); }
+    bool isNull(uint32_t index) const noexcept
+        { return data_[index].isNull != 0; }
+    uint32_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    const dpiData *data() const noexcept { return data_; }
+    iterator begin() const noexcept { return iterator(data_); }
+    iterator end() const noexcept { return iterator(data_ + size_); }
+#ifdef DPI_HPP_HAS_SPAN
+    std::span<const dpiData> span() const noexcept
+        { return std::span<const dpiData>(data_, size_); }
+#endif
+
+private:
+    const dpiData *data_ = nullptr;
+    uint32_t size_ = 0;
+};
+
+
+//-----------------------------------------------------------------------------
+// Rows
+//   The rows returned by Statement::fetchRows(), exposed as one column view
+// for each of the requested types.
+//-----------------------------------------------------------------------------
+template <typename... Ts>
+class Rows {
+public:
+    Rows() noexcept = default;
+    Rows(std::tuple<ColumnView<Ts>...> columns, uint32_t numRows,
+            bool moreRows) noexcept
+        : columns_(columns), numRows_(numRows), moreRows_(moreRows) {}
+
+    template <std::size_t I>
+    const auto &column() const noexcept { return std::get<I>(columns_); }
+    uint32_t size() const noexcept { return numRows_; }
+    bool moreRows() const noexcept { return moreRows_; }
+
+private:
+    std::tuple<ColumnView<Ts>...> columns_;
+    uint32_t numRows_ = 0;
+    bool moreRows_ = false;
+};
+
+
+//-----------------------------------------------------------------------------
+// Statement
+//   Wrapper for a statement handle. Rows are fetched into variables that are
+// created when a fetch is first performed with a particular set of types;
+// fetched values are read directly from the variable buffers.
+//-----------------------------------------------------------------------------
+class Statement {
+public:
+    Statement() noexcept = default;
+    Statement(Handle<dpiConn> conn, Handle<dpiStmt> stmt) noexcept
+        : conn_(std::move(conn)), stmt_(std::move(stmt)) {}
+
+    dpiStmt *handle() const noexcept { return stmt_.get(); }
+
+    // bind a value by position (positions start at 1)
+    template <typename T>
+    void bind(uint32_t pos, const T &value)
+    {
+        dpiData data;
+
+        TypeMap<T>::set(data, value);
+        check(stmt_.context(), dpiStmt_bindValueByPos(stmt_.get(), pos,
+                TypeMap<T>::nativeTypeNum, &data));
+    }
+
+    // execute the statement and return the number of query columns
+    uint32_t execute(dpiExecMode mode = DPI_MODE_EXEC_DEFAULT)
+    {
+        uint32_t numQueryColumns;
+
+        check(stmt_.context(), dpiStmt_execute(stmt_.get(), mode,
+                &numQueryColumns));
+        return numQueryColumns;
+    }
+
+    // set the number of rows fetched from the database at one time
+    void setFetchArraySize(uint32_t arraySize)
+    {
+        check(stmt_.context(), dpiStmt_setFetchArraySize(stmt_.get(),
+                arraySize));
+        defineTag_ = nullptr;
+    }
+
+    // fetch the next row as a tuple; an empty optional is returned when no
+    // more rows are available
+    template <typename Row>
+    std::optional<Row> fetch()
+    {
+        uint32_t bufferRowIndex;
+        int found;
+
+        defineColumns<Row>(
+                std::make_index_sequence<std::tuple_size_v<Row>>());
+        check(stmt_.context(), dpiStmt_fetch(stmt_.get(), &found,
+                &bufferRowIndex));
+        if (!found)
+            return std::nullopt;
+        return makeRow<Row>(bufferRowIndex,
+                std::make_index_sequence<std::tuple_size_v<Row>>());
+    }
+
+    // fetch up to the given number of rows and return a view of each column
+    template <typename... Ts>
+    Rows<Ts...> fetchRows(uint32_t maxRows)
+    {
+        uint32_t bufferRowIndex, numRowsFetched;
+        int moreRows;
+
+        defineColumns<std::tuple<Ts...>>(
+                std::index_sequence_for<Ts...>());
+        check(stmt_.context(), dpiStmt_fetchRows(stmt_.get(), maxRows,
+                &bufferRowIndex, &numRowsFetched, &moreRows));
+        return Rows<Ts...>(makeColumns<Ts...>(bufferRowIndex, numRowsFetched,
+                std::index_sequence_for<Ts...>()), numRowsFetched,
+                moreRows != 0);
+    }
+
+private:
+    template <typename Row>
+    static const void *tagFor() noexcept
+    {
+        static const char tag = 0;
+        return &tag;
+    }
+
+    // create and define a variable for each column unless that has already
+    // been done for the same set of types
+    template <typename Row, std::size_t... I>
+    void defineColumns(std::index_sequence<I...>)
+    {
+        if (defineTag_ == tagFor<Row>())
+            return;
+        vars_.clear();
+        data_.clear();
+        (defineColumn<std::tuple_element_t<I, Row>>(I + 1), ...);
+        defineTag_ = tagFor<Row>();
+    }
+
+    // create and define a variable for the given column; the Oracle type of
+    // the column is used so that no conversion is performed by OCI
+    template <typename T>
+    void defineColumn(uint32_t pos)
+    {
+        const dpiContext *context = stmt_.context();
+        dpiQueryInfo info;
+        uint32_t arraySize;
+        dpiData *data;
+        dpiVar *var;
+
+        check(context, dpiStmt_getQueryInfo(stmt_.get(), pos, &info));
+        check(context, dpiStmt_getFetchArraySize(stmt_.get(), &arraySize));
+        check(context, dpiConn_newVar(conn_.get(), info.typeInfo.oracleTypeNum,
+                TypeMap<T>::nativeTypeNum, arraySize,
+                info.typeInfo.clientSizeInBytes, 1, 0, nullptr, &var, &data));
+        vars_.emplace_back(context, var);
+        data_.push_back(data);
+        check(context, dpiStmt_define(stmt_.get(), pos, var));
+    }
+
+    template <typename Row, std::size_t... I>
+    Row makeRow(uint32_t index, std::index_sequence<I...>) const noexcept
+    {
+        return Row(TypeMap<std::tuple_element_t<I, Row>>::get(
+                data_[I][index])...);
+    }
+
+    template <typename... Ts, std::size_t... I>
+    std::tuple<ColumnView<Ts>...> makeColumns(uint32_t index,
+            uint32_t numRows, std::index_sequence<I...>) const noexcept
+    {
+        return std::tuple<ColumnView<Ts>...>(
+                ColumnView<Ts>(data_[I] + index, numRows)...);
+    }
+
+    Handle<dpiConn> conn_;
+    Handle<dpiStmt> stmt_;
+    std::vector<Handle<dpiVar>> vars_;
+    std::vector<dpiData*> data_;
+    const void *defineTag_ = nullptr;
+};
+
+
+//-----------------------------------------------------------------------------
+// Connection
+//   Wrapper for a connection handle.
+//-----------------------------------------------------------------------------
+class Connection {
+public:
+    Connection() noexcept = default;
+    explicit Connection(Handle<dpiConn> conn) noexcept
+        : conn_(std::move(conn)) {}
+
+    dpiConn *handle() const noexcept { return conn_.get(); }
+
+    // prepare a statement for execution
+    Statement prepare(std::string_view sql, bool scrollable = false)
+    {
+        dpiStmt *stmt;
+
+        check(conn_.context(), dpiConn_prepareStmt(conn_.get(), scrollable,
+                sql.data(), static_cast<uint32_t>(sql.size()), nullptr, 0,
+                &stmt));
+        return Statement(conn_, Handle<dpiStmt>(conn_.context(), stmt));
+    }
+
+    void commit() { check(conn_.context(), dpiConn_commit(conn_.get())); }
+    void rollback()
+        { check(conn_.context(), dpiConn_rollback(conn_.get())); }
+
+private:
+    Handle<dpiConn> conn_;
+};
+
+
+//-----------------------------------------------------------------------------
+// Context
+//   Owns an ODPI-C context, which must outlive all of the handles created
+// with it.
+//-----------------------------------------------------------------------------
+class Context {
+public:
+    explicit Context(dpiContextCreateParams *params = nullptr)
+    {
+        dpiErrorInfo info;
+
+        if (dpiContext_createWithParams(DPI_MAJOR_VERSION, DPI_MINOR_VERSION,
+                params, &context_, &info) < 0)
+            throw Error(info);
+    }
+    Context(const Context&) = delete;
+    Context &operator=(const Context&) = delete;
+    ~Context()
+    {
+        if (context_)
+            dpiContext_destroy(context_);
+    }
+
+    dpiContext *handle() const noexcept { return context_; }
+
+    // create a standalone connection
+    Connection connect(std::string_view userName, std::string_view password,
+            std::string_view connectString)
+    {
+        dpiConn *conn;
+
+        check(context_, dpiConn_create(context_, userName.data(),
+                static_cast<uint32_t>(userName.size()), password.data(),
+                static_cast<uint32_t>(password.size()), connectString.data(),
+                static_cast<uint32_t>(connectString.size()), nullptr, nullptr,
+                &conn));
+        return Connection(Handle<dpiConn>(context_, conn));
+    }
+
+private:
+    dpiContext *context_ = nullptr;
+};
+
+} // namespace dpi
+
+#endif
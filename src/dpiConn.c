@@ -48,6 +48,7 @@ static int dpiConn__getServerCharset(dpiConn *conn, dpiError *error);
 static int dpiConn__getSession(dpiConn *conn, uint32_t mode,
         const char *connectString, uint32_t connectStringLength,
         dpiConnCreateParams *params, void *authInfo, dpiError *error);
+static int dpiConn__isTransactionPossible(dpiConn *conn);
 static int dpiConn__setAttributesFromCreateParams(dpiConn *conn, void *handle,
         uint32_t handleType, const char *userName, uint32_t userNameLength,
         const char *password, uint32_t passwordLength,
@@ -141,11 +142,14 @@ static int dpiConn__close(dpiConn *conn, uint32_t mode, const char *tag,
     dpiLob *lob;
 
     // rollback any outstanding transaction, if one is in progress; drop the
-    // session if any errors take place
+    // session if any errors take place; the server is only asked if a
+    // transaction is in progress when the state is not known to the client
     txnInProgress = 0;
-    if (!conn->deadSession && !conn->externalHandle && conn->sessionHandle) {
+    if (!conn->deadSession && !conn->externalHandle && conn->sessionHandle &&
+            dpiConn__isTransactionPossible(conn)) {
         txnInProgress = 1;
-        if (conn->env->versionInfo->versionNum >= 12)
+        if (conn->transactionState != DPI_TXN_STATE_ACTIVE &&
+                conn->env->versionInfo->versionNum >= 12)
             dpiOci__attrGet(conn->sessionHandle, DPI_OCI_HTYPE_SESSION,
                     &txnInProgress, NULL, DPI_OCI_ATTR_TRANSACTION_IN_PROGRESS,
                     NULL, error);
@@ -154,6 +158,12 @@ static int dpiConn__close(dpiConn *conn, uint32_t mode, const char *tag,
             dpiOci__transRollback(conn, propagateErrors, error) < 0)
         conn->deadSession = 1;
 
+    // disable flashback mode if a snapshot was set on a pooled connection so
+    // that the session is returned to the pool in its normal state
+    if (!conn->deadSession && !conn->externalHandle && !conn->standalone &&
+            conn->sessionHandle)
+        dpiSnapshot__release(conn, error);
+
     // Unset the tranasaction handle if one exists currently
     // (Required for tpc and sessionless transactions when the active
     // transaction is released to a pool without suspending)
@@ -318,6 +328,11 @@ static int dpiConn__close(dpiConn *conn, uint32_t mode, const char *tag,
             if (lastTimeUsed)
                 *lastTimeUsed = time(NULL);
 
+            // if session is going to be dropped, free the session state
+            // retained on it as well
+            if (conn->deadSession)
+                dpiSessionState__forget(conn, error);
+
         }
 
         // release session
@@ -355,15 +370,19 @@ static int dpiConn__close(dpiConn *conn, uint32_t mode, const char *tag,
 // dpiConn__commit() [PRIVATE]
 //   Internal method used to commit the transaction associated with the
 // connection. Once the commit has taken place, the transaction handle
-// associated with the connection is cleared.
+// associated with the connection is cleared. If the client knows that no
+// transaction is in progress, the round trip is skipped.
 //-----------------------------------------------------------------------------
 int dpiConn__commit(dpiConn *conn, dpiError *error)
 {
+    if (!dpiConn__isTransactionPossible(conn))
+        return DPI_SUCCESS;
     if (dpiOci__transCommit(conn, conn->commitMode, error) < 0)
         return DPI_FAILURE;
     if (dpiConn__clearTransaction(conn, error) < 0)
         return DPI_FAILURE;
     conn->commitMode = DPI_OCI_DEFAULT;
+    conn->transactionState = DPI_TXN_STATE_NONE;
     return DPI_SUCCESS;
 }
 
@@ -444,6 +463,16 @@ int dpiConn__create(dpiConn *conn, const dpiContext *context,
     // that are raised do perform dead connection detection
     conn->creating = 0;
 
+    // apply the desired session state, if one was specified
+    if (status == DPI_SUCCESS && createParams->sessionState)
+        status = dpiSessionState__apply(conn, createParams->sessionState,
+                error);
+
+    // a newly created or acquired session has no transaction in progress
+    // (sessions are rolled back before being released to the pool)
+    if (status == DPI_SUCCESS)
+        conn->transactionState = DPI_TXN_STATE_NONE;
+
     return status;
 }
 
@@ -597,7 +626,7 @@ void dpiConn__free(dpiConn *conn, dpiError *error)
         dpiUtils__freeMemory(conn->info);
         conn->info = NULL;
     }
-    dpiUtils__freeMemory(conn);
+    dpiGen__free(conn);
 }
 
 
@@ -1093,6 +1122,23 @@ static int dpiConn__getSession(dpiConn *conn, uint32_t mode,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiConn__isTransactionPossible() [INTERNAL]
+//   Return whether a transaction may be in progress on the connection. Only
+// when the client has tracked the transaction state since the session was
+// acquired and nothing could have started a transaction (and no two-phase
+// commit is pending) is it known that there is no transaction. Once the OCI
+// service context handle has been acquired by the caller, the state can no
+// longer be tracked.
+//-----------------------------------------------------------------------------
+static int dpiConn__isTransactionPossible(dpiConn *conn)
+{
+    return (conn->externalHandle || conn->handleAcquired ||
+            conn->transactionState != DPI_TXN_STATE_NONE ||
+            conn->commitMode != DPI_OCI_DEFAULT);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiConn__newVector() [INTERNAL]
 //   Internal method for creating a vector. If vector information is supplied
@@ -1121,14 +1167,18 @@ int dpiConn__newVector(dpiConn *conn, dpiVectorInfo *info, dpiVector **vector,
 // dpiConn__rollback() [PUBLIC]
 //   Internal method for rolling back the transaction associated with the
 // connection. Once the rollback has taken place, the transaction handle
-// associated with the connection is cleared.
+// associated with the connection is cleared. If the client knows that no
+// transaction is in progress, the round trip is skipped.
 //-----------------------------------------------------------------------------
 int dpiConn__rollback(dpiConn *conn, dpiError *error)
 {
+    if (!dpiConn__isTransactionPossible(conn))
+        return DPI_SUCCESS;
     if (dpiOci__transRollback(conn, 1, error) < 0)
         return DPI_FAILURE;
     if (dpiConn__clearTransaction(conn, error) < 0)
         return DPI_FAILURE;
+    conn->transactionState = DPI_TXN_STATE_NONE;
     return DPI_SUCCESS;
 }
 
@@ -1294,6 +1344,7 @@ static int dpiConn__setAttributeText(dpiConn *conn, uint32_t attribute,
         case DPI_OCI_ATTR_EDITION:
         case DPI_OCI_ATTR_MODULE:
         case DPI_OCI_ATTR_DBOP:
+            dpiSessionState__forget(conn, &error);
             status = dpiOci__attrSet(conn->sessionHandle,
                     DPI_OCI_HTYPE_SESSION, (void*) value, valueLength,
                     attribute, "set session value", &error);
@@ -1317,13 +1368,19 @@ static int dpiConn__setAttributeText(dpiConn *conn, uint32_t attribute,
 //-----------------------------------------------------------------------------
 // dpiConn__setShardingKey() [INTERNAL]
 //   Using the specified columns, create a sharding key and set it on the given
-// handle.
+// handle. When acquiring from a pool, the descriptor built earlier for the
+// same column values is used, if one is cached by the pool; otherwise, the
+// descriptor that is built is added to the cache. Descriptors owned by the
+// cache are not retained by the connection since they are freed with the
+// pool.
 //-----------------------------------------------------------------------------
 static int dpiConn__setShardingKey(dpiConn *conn, void **shardingKey,
         void *handle, uint32_t handleType, uint32_t attribute,
         const char *action, dpiShardingKeyColumn *columns, uint8_t numColumns,
         dpiError *error)
 {
+    dpiShardingKeyCache *cache = NULL;
+    void *cachedShardingKey;
     uint8_t i;
 
     // this is only supported on 12.2 and higher clients
@@ -1331,6 +1388,18 @@ static int dpiConn__setShardingKey(dpiConn *conn, void **shardingKey,
             error) < 0)
         return DPI_FAILURE;
 
+    // use the descriptor cached by the pool, if one is available
+    if (conn->pool)
+        cache = conn->pool->shardingKeys;
+    if (cache) {
+        if (dpiShardingKeyCache__lookup(cache, columns, numColumns,
+                &cachedShardingKey, error) < 0)
+            return DPI_FAILURE;
+        if (cachedShardingKey)
+            return dpiOci__attrSet(handle, handleType, cachedShardingKey, 0,
+                    attribute, action, error);
+    }
+
     // create sharding key descriptor, if necessary
     if (dpiOci__descriptorAlloc(conn->env->handle, shardingKey,
             DPI_OCI_DTYPE_SHARDING_KEY, "allocate sharding key", error) < 0)
@@ -1348,6 +1417,11 @@ static int dpiConn__setShardingKey(dpiConn *conn, void **shardingKey,
             error) < 0)
         return DPI_FAILURE;
 
+    // add the descriptor to the cache, if applicable
+    if (cache && dpiShardingKeyCache__add(cache, columns, numColumns,
+            shardingKey, error) < 0)
+        return DPI_FAILURE;
+
     return DPI_SUCCESS;
 }
 
@@ -1999,6 +2073,84 @@ int dpiConn_enqObject(dpiConn *conn, const char *queueName,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiConn_executeBatch() [PUBLIC]
+//   Execute the statements, which must all have been prepared by this
+// connection, with a single round trip. DML statements, queries and PL/SQL
+// blocks are supported; the row counts of the DML statements and cursors for
+// the results of the queries are returned in the supplied arrays.
+//-----------------------------------------------------------------------------
+int dpiConn_executeBatch(dpiConn *conn, uint32_t numStmts, dpiStmt **stmts,
+        dpiExecMode mode, uint64_t *rowCounts, dpiStmt **queryResults)
+{
+    dpiError error;
+    dpiStmt *stmt;
+    int isSupported;
+    uint32_t i;
+
+    // validate parameters
+    if (dpiConn__check(conn, __func__, &error) < 0)
+        return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
+    if (mode & (DPI_MODE_EXEC_BATCH_ERRORS |
+            DPI_MODE_EXEC_ARRAY_DML_ROWCOUNTS)) {
+        dpiError__set(&error, "check mode", DPI_ERR_NOT_SUPPORTED);
+        return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
+    }
+    if (numStmts == 0)
+        return dpiGen__endPublicFn(conn, DPI_SUCCESS, &error);
+    DPI_CHECK_PTR_NOT_NULL(conn, stmts)
+    for (i = 0; i < numStmts; i++) {
+        stmt = stmts[i];
+        if (dpiGen__checkHandle(stmt, DPI_HTYPE_STMT, "check statement",
+                &error) < 0)
+            return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
+        if (!stmt->handle || (stmt->parentStmt && !stmt->parentStmt->handle)) {
+            dpiError__set(&error, "check closed", DPI_ERR_STMT_CLOSED);
+            return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
+        }
+        if (stmt->conn != conn) {
+            dpiError__set(&error, "check connection", DPI_ERR_STMT_WRONG_CONN,
+                    i);
+            return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
+        }
+        if (stmt->statementType == 0 && dpiStmt__init(stmt, &error) < 0)
+            return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
+
+        // only queries, DML statements without a RETURNING clause and PL/SQL
+        // blocks can be placed in an anonymous PL/SQL block
+        switch (stmt->statementType) {
+            case DPI_STMT_TYPE_SELECT:
+                isSupported = !stmt->scrollable && !stmt->parentStmt;
+                break;
+            case DPI_STMT_TYPE_INSERT:
+            case DPI_STMT_TYPE_UPDATE:
+            case DPI_STMT_TYPE_DELETE:
+            case DPI_STMT_TYPE_MERGE:
+                isSupported = !stmt->isReturning;
+                break;
+            case DPI_STMT_TYPE_BEGIN:
+            case DPI_STMT_TYPE_DECLARE:
+                isSupported = 1;
+                break;
+            default:
+                isSupported = 0;
+        }
+        if (!isSupported || stmt->structBind) {
+            dpiError__set(&error, "check statement type",
+                    DPI_ERR_BATCH_STMT_NOT_SUPPORTED, i);
+            return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
+        }
+
+    }
+
+    // execute the statements
+    if (dpiStmtBatch__execute(conn, numStmts, stmts, mode, rowCounts,
+            queryResults, &error) < 0)
+        return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
+    return dpiGen__endPublicFn(conn, DPI_SUCCESS, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiConn_getCallTimeout() [PUBLIC]
 //   Return the call timeout (in milliseconds) used for round-trips to the
@@ -2114,6 +2266,7 @@ int dpiConn_getHandle(dpiConn *conn, void **handle)
         return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
     DPI_CHECK_PTR_NOT_NULL(conn, handle)
     *handle = conn->handle;
+    conn->handleAcquired = 1;
     return dpiGen__endPublicFn(conn, DPI_SUCCESS, &error);
 }
 
@@ -2377,6 +2530,24 @@ int dpiConn_getServiceName(dpiConn *conn, const char **value,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiConn_getSnapshot() [PUBLIC]
+//   Capture a snapshot of the current SCN of the database which can be set on
+// other connections to the same database.
+//-----------------------------------------------------------------------------
+int dpiConn_getSnapshot(dpiConn *conn, dpiSnapshot *snapshot)
+{
+    dpiError error;
+    int status;
+
+    if (dpiConn__check(conn, __func__, &error) < 0)
+        return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(conn, snapshot)
+    status = dpiSnapshot__capture(conn, snapshot, &error);
+    return dpiGen__endPublicFn(conn, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiConn_getSodaDb() [PUBLIC]
 //   Create a new SODA collection with the given name and metadata.
@@ -2676,7 +2847,7 @@ int dpiConn_prepareStmt(dpiConn *conn, int scrollable, const char *sql,
     DPI_CHECK_PTR_AND_LENGTH(conn, sql)
     DPI_CHECK_PTR_AND_LENGTH(conn, tag)
     DPI_CHECK_PTR_NOT_NULL(conn, stmt)
-    if (dpiStmt__allocate(conn, scrollable, &tempStmt, &error) < 0)
+    if (dpiStmt__allocate(conn, scrollable, 0, &tempStmt, &error) < 0)
         return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
     if (dpiStmt__prepare(tempStmt, sql, sqlLength, tag, tagLength,
             &error) < 0) {
@@ -2909,6 +3080,24 @@ int dpiConn_setOciAttr(dpiConn *conn, uint32_t handleType,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiConn_setSnapshot() [PUBLIC]
+//   Set the snapshot seen by queries executed on the connection or clear it
+// if the snapshot is NULL. The snapshot is applied when the next statement is
+// prepared, avoiding a round trip if no statement is prepared before it is
+// changed again.
+//-----------------------------------------------------------------------------
+int dpiConn_setSnapshot(dpiConn *conn, const dpiSnapshot *snapshot)
+{
+    dpiError error;
+
+    if (dpiConn__check(conn, __func__, &error) < 0)
+        return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
+    conn->snapshotScn = (snapshot) ? snapshot->scn : 0;
+    return dpiGen__endPublicFn(conn, DPI_SUCCESS, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiConn_setStmtCacheSize() [PUBLIC]
 //   Set the size of the statement cache.
@@ -2938,7 +3127,7 @@ int dpiConn_stmtFromHandle(dpiConn *conn, void *externalHandle,
 
     if (dpiConn__check(conn, __func__, &error) < 0)
         return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
-    if (dpiStmt__allocate(conn, 0, &tempStmt, &error) < 0)
+    if (dpiStmt__allocate(conn, 0, 0, &tempStmt, &error) < 0)
         return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
     tempStmt->handle = externalHandle;
     tempStmt->externalHandle = 1;
@@ -3233,3 +3422,48 @@ int dpiConn_unsubscribe(dpiConn *conn, dpiSubscr *subscr)
     dpiGen__setRefCount(subscr, &error, -1);
     return dpiGen__endPublicFn(subscr, DPI_SUCCESS, &error);
 }
+
+
+//-----------------------------------------------------------------------------
+// dpiConn_writeLobs() [PUBLIC]
+//   Write the values to the LOBs in a single round trip (one for each group
+// of consecutive LOBs with the same character set form).
+//-----------------------------------------------------------------------------
+int dpiConn_writeLobs(dpiConn *conn, uint32_t numLobs, dpiLob **lobs,
+        const uint64_t *offsets, const char **values,
+        const uint64_t *valueLengths, uint64_t *bytesWritten)
+{
+    dpiError error;
+    uint32_t i;
+    int status;
+
+    if (dpiConn__check(conn, __func__, &error) < 0)
+        return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
+    if (numLobs == 0)
+        return dpiGen__endPublicFn(conn, DPI_SUCCESS, &error);
+    DPI_CHECK_PTR_NOT_NULL(conn, lobs)
+    DPI_CHECK_PTR_NOT_NULL(conn, values)
+    DPI_CHECK_PTR_NOT_NULL(conn, valueLengths)
+    for (i = 0; i < numLobs; i++) {
+        if (dpiGen__checkHandle(lobs[i], DPI_HTYPE_LOB, "check LOB",
+                &error) < 0)
+            return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
+        if (!lobs[i]->locator) {
+            dpiError__set(&error, "check closed", DPI_ERR_LOB_CLOSED);
+            return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
+        }
+        if (lobs[i]->conn != conn) {
+            dpiError__set(&error, "check connection", DPI_ERR_LOB_WRONG_CONN,
+                    i);
+            return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
+        }
+        if (!values[i] && valueLengths[i] > 0) {
+            dpiError__set(&error, "check values", DPI_ERR_PTR_LENGTH_MISMATCH,
+                    "values");
+            return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
+        }
+    }
+    status = dpiLob__writeArray(conn, numLobs, lobs, offsets, values,
+            valueLengths, bytesWritten, &error);
+    return dpiGen__endPublicFn(conn, status, &error);
+}
@@ -73,6 +73,14 @@ static int dpiContext__create(const char *fnName, unsigned int majorVersion,
             error) < 0)
         return DPI_FAILURE;
 
+    // if requested, enable tracking of handles created from now on
+    if (localParams.enableHandleTracking)
+        dpiHandleRegistry__enable();
+
+    // if requested, resolve all OCI symbols now instead of on first use
+    if (localParams.loadAllSymbols && dpiOci__loadAllSymbols(NULL, error) < 0)
+        return DPI_FAILURE;
+
     // allocate context and initialize it
     if (dpiGen__allocate(DPI_HTYPE_CONTEXT, NULL, (void**) &tempContext,
             error) < 0)
@@ -89,6 +97,29 @@ static int dpiContext__create(const char *fnName, unsigned int majorVersion,
         tempContext->useJsonId = localParams.useJsonId;
     }
 
+    // create SQL profiler, if applicable
+    if (localParams.enableSqlProfiler &&
+            dpiSqlProfile__create(&tempContext->sqlProfile, error) < 0) {
+        dpiContext__free(tempContext);
+        return DPI_FAILURE;
+    }
+
+    // create SQL normalizer, if applicable
+    if (localParams.enableSqlNormalizer &&
+            dpiSqlNormalizer__create(&tempContext->sqlNormalizer,
+                    error) < 0) {
+        dpiContext__free(tempContext);
+        return DPI_FAILURE;
+    }
+
+    // create pool of threads for converting fetched data, if applicable
+    if (localParams.numConversionThreads > 0 &&
+            dpiWorkerPool__create(&tempContext->conversionPool,
+                    localParams.numConversionThreads, error) < 0) {
+        dpiContext__free(tempContext);
+        return DPI_FAILURE;
+    }
+
     // store default encoding, if applicable
     if (localParams.defaultEncoding) {
         if (dpiUtils__allocateMemory(1,
@@ -140,6 +171,18 @@ static void dpiContext__free(dpiContext *context)
         dpiUtils__freeMemory((void*) context->defaultEncoding);
         context->defaultEncoding = NULL;
     }
+    if (context->sqlProfile) {
+        dpiSqlProfile__free(context->sqlProfile);
+        context->sqlProfile = NULL;
+    }
+    if (context->sqlNormalizer) {
+        dpiSqlNormalizer__free(context->sqlNormalizer);
+        context->sqlNormalizer = NULL;
+    }
+    if (context->conversionPool) {
+        dpiWorkerPool__free(context->conversionPool);
+        context->conversionPool = NULL;
+    }
     dpiUtils__freeMemory(context);
 }
 
@@ -201,6 +244,21 @@ void dpiContext__initPoolCreateParams(dpiPoolCreateParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiContext__initScanCreateParams() [INTERNAL]
+//   Initialize the parallel scan creation parameters to default values.
+//-----------------------------------------------------------------------------
+void dpiContext__initScanCreateParams(dpiScanCreateParams *params)
+{
+    memset(params, 0, sizeof(dpiScanCreateParams));
+    params->splitMode = DPI_SCAN_SPLIT_ROWID;
+    params->numChunks = 16;
+    params->numConnections = 4;
+    params->fetchArraySize = DPI_DEFAULT_FETCH_ARRAY_SIZE;
+    params->maxPendingBlocks = 8;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiContext__initSodaOperOptions() [INTERNAL]
 //   Initialize the SODA operation options to default values.
@@ -326,6 +384,140 @@ void dpiContext_getError(const dpiContext *context, dpiErrorInfo *info)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiContext_getHandleCounts() [PUBLIC]
+//   Return the number of live and created handles of each type. This is only
+// available when handle tracking has been enabled.
+//-----------------------------------------------------------------------------
+int dpiContext_getHandleCounts(const dpiContext *context,
+        dpiHandleTypeCount *counts, uint32_t *numCounts)
+{
+    dpiError error;
+    int status;
+
+    if (dpiGen__startPublicFn(context, DPI_HTYPE_CONTEXT, __func__,
+            &error) < 0)
+        return dpiGen__endPublicFn(context, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(context, numCounts)
+    status = dpiHandleRegistry__getCounts(counts, numCounts, &error);
+    return dpiGen__endPublicFn(context, status, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiContext_getLiveHandles() [PUBLIC]
+//   Return information about each live handle, oldest first. This is only
+// available when handle tracking has been enabled.
+//-----------------------------------------------------------------------------
+int dpiContext_getLiveHandles(const dpiContext *context,
+        dpiLiveHandleInfo *info, uint32_t *numInfo)
+{
+    dpiError error;
+    int status;
+
+    if (dpiGen__startPublicFn(context, DPI_HTYPE_CONTEXT, __func__,
+            &error) < 0)
+        return dpiGen__endPublicFn(context, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(context, numInfo)
+    status = dpiHandleRegistry__getLiveHandles(info, numInfo, &error);
+    return dpiGen__endPublicFn(context, status, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiContext_getMissingSymbols() [PUBLIC]
+//   Resolve all OCI symbols used by ODPI-C that have not already been resolved
+// and return the names of those that could not be found in the Oracle Client
+// library that was loaded.
+//-----------------------------------------------------------------------------
+int dpiContext_getMissingSymbols(const dpiContext *context,
+        dpiStringList *list)
+{
+    dpiError error;
+    int status;
+
+    if (dpiGen__startPublicFn(context, DPI_HTYPE_CONTEXT, __func__,
+            &error) < 0)
+        return dpiGen__endPublicFn(context, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(context, list)
+    memset(list, 0, sizeof(dpiStringList));
+    status = dpiOci__loadAllSymbols(list, &error);
+    return dpiGen__endPublicFn(context, status, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiContext_getMutexStats() [PUBLIC]
+//   Return lock contention statistics for each site at which an internal
+// mutex has been acquired. This is only available when the library has been
+// built with DPI_MUTEX_STATS defined.
+//-----------------------------------------------------------------------------
+int dpiContext_getMutexStats(const dpiContext *context, dpiMutexStats *stats,
+        uint32_t *numStats)
+{
+    dpiError error;
+    int status;
+
+    if (dpiGen__startPublicFn(context, DPI_HTYPE_CONTEXT, __func__,
+            &error) < 0)
+        return dpiGen__endPublicFn(context, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(context, numStats)
+    status = dpiMutex__getStats(stats, numStats, &error);
+    return dpiGen__endPublicFn(context, status, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiContext_getSqlNormalizerInfo() [PUBLIC]
+//   Return the statistics gathered by the SQL normalizer. This is only
+// available when the context was created with the SQL normalizer enabled.
+//-----------------------------------------------------------------------------
+int dpiContext_getSqlNormalizerInfo(const dpiContext *context,
+        dpiSqlNormalizerInfo *info)
+{
+    dpiError error;
+
+    if (dpiGen__startPublicFn(context, DPI_HTYPE_CONTEXT, __func__,
+            &error) < 0)
+        return dpiGen__endPublicFn(context, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(context, info)
+    if (!context->sqlNormalizer) {
+        dpiError__set(&error, "get SQL normalizer info",
+                DPI_ERR_SQL_NORMALIZER_NOT_ENABLED);
+        return dpiGen__endPublicFn(context, DPI_FAILURE, &error);
+    }
+    dpiSqlNormalizer__getInfo(context->sqlNormalizer, info);
+    return dpiGen__endPublicFn(context, DPI_SUCCESS, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiContext_getSqlProfile() [PUBLIC]
+//   Return the statistics gathered by the SQL profiler for each distinct SQL
+// statement prepared with the context. This is only available when the
+// context was created with the SQL profiler enabled.
+//-----------------------------------------------------------------------------
+int dpiContext_getSqlProfile(const dpiContext *context,
+        dpiSqlProfileInfo *info, uint32_t *numInfo)
+{
+    dpiError error;
+    int status;
+
+    if (dpiGen__startPublicFn(context, DPI_HTYPE_CONTEXT, __func__,
+            &error) < 0)
+        return dpiGen__endPublicFn(context, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(context, numInfo)
+    if (!context->sqlProfile) {
+        dpiError__set(&error, "get SQL profile",
+                DPI_ERR_SQL_PROFILER_NOT_ENABLED);
+        return dpiGen__endPublicFn(context, DPI_FAILURE, &error);
+    }
+    status = dpiSqlProfile__getInfo(context->sqlProfile, info, numInfo,
+            &error);
+    return dpiGen__endPublicFn(context, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiContext_initCommonCreateParams() [PUBLIC]
 //   Initialize the common connection/pool creation parameters to default
@@ -384,6 +576,25 @@ int dpiContext_initPoolCreateParams(const dpiContext *context,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiContext_initScanCreateParams() [PUBLIC]
+//   Initialize the parallel scan creation parameters to default values.
+//-----------------------------------------------------------------------------
+int dpiContext_initScanCreateParams(const dpiContext *context,
+        dpiScanCreateParams *params)
+{
+    dpiError error;
+
+    if (dpiGen__startPublicFn(context, DPI_HTYPE_CONTEXT, __func__,
+            &error) < 0)
+        return dpiGen__endPublicFn(context, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(context, params)
+    dpiContext__initScanCreateParams(params);
+
+    return dpiGen__endPublicFn(context, DPI_SUCCESS, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiContext_initSodaOperOptions() [PUBLIC]
 //   Initialize the SODA operation options to default values.
@@ -420,3 +631,44 @@ int dpiContext_initSubscrCreateParams(const dpiContext *context,
     dpiContext__initSubscrCreateParams(params);
     return dpiGen__endPublicFn(context, DPI_SUCCESS, &error);
 }
+
+
+//-----------------------------------------------------------------------------
+// dpiContext_resetMutexStats() [PUBLIC]
+//   Reset the lock contention statistics gathered for the internal mutexes.
+// This is only available when the library has been built with
+// DPI_MUTEX_STATS defined.
+//-----------------------------------------------------------------------------
+int dpiContext_resetMutexStats(const dpiContext *context)
+{
+    dpiError error;
+    int status;
+
+    if (dpiGen__startPublicFn(context, DPI_HTYPE_CONTEXT, __func__,
+            &error) < 0)
+        return dpiGen__endPublicFn(context, DPI_FAILURE, &error);
+    status = dpiMutex__resetStats(&error);
+    return dpiGen__endPublicFn(context, status, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiContext_resetSqlProfile() [PUBLIC]
+//   Reset the statistics gathered by the SQL profiler. This is only available
+// when the context was created with the SQL profiler enabled.
+//-----------------------------------------------------------------------------
+int dpiContext_resetSqlProfile(const dpiContext *context)
+{
+    dpiError error;
+
+    if (dpiGen__startPublicFn(context, DPI_HTYPE_CONTEXT, __func__,
+            &error) < 0)
+        return dpiGen__endPublicFn(context, DPI_FAILURE, &error);
+    if (!context->sqlProfile) {
+        dpiError__set(&error, "reset SQL profile",
+                DPI_ERR_SQL_PROFILER_NOT_ENABLED);
+        return dpiGen__endPublicFn(context, DPI_FAILURE, &error);
+    }
+    dpiSqlProfile__reset(context->sqlProfile);
+    return dpiGen__endPublicFn(context, DPI_SUCCESS, &error);
+}
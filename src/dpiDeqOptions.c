@@ -62,7 +62,7 @@ void dpiDeqOptions__free(dpiDeqOptions *options, dpiError *error)
         dpiGen__setRefCount(options->conn, error, -1);
         options->conn = NULL;
     }
-    dpiUtils__freeMemory(options);
+    dpiGen__free(options);
 }
 
 
@@ -58,7 +58,7 @@ void dpiEnqOptions__free(dpiEnqOptions *options, dpiError *error)
         dpiGen__setRefCount(options->conn, error, -1);
         options->conn = NULL;
     }
-    dpiUtils__freeMemory(options);
+    dpiGen__free(options);
 }
 
 
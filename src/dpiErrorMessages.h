@@ -115,4 +115,25 @@ static const char* const dpiErrorMessages[DPI_ERR_MAX - DPI_ERR_NO_ERR] = {
     "DPI-1086: SODA document does not have JSON content. Call dpiJson_getContent() instead.", // DPI_ERR_SODA_DOC_IS_NOT_JSON
     "DPI-1087: not a query", // DPI_ERR_NOT_A_QUERY
     "DPI-1088: parameter %s size of %u is too large (max %u)", // DPI_ERR_PARAM_SIZE_TOO_LARGE
+    "DPI-1089: mutex statistics are not available as ODPI-C was not built with DPI_MUTEX_STATS defined", // DPI_ERR_MUTEX_STATS_NOT_ENABLED
+    "DPI-1090: SQL profiler is not enabled for this context", // DPI_ERR_SQL_PROFILER_NOT_ENABLED
+    "DPI-1091: handle tracking is not enabled", // DPI_ERR_HANDLE_TRACKING_NOT_ENABLED
+    "DPI-1092: native type %d of struct field %u is not supported", // DPI_ERR_STRUCT_FIELD_TYPE_NOT_SUPPORTED
+    "DPI-1093: struct field %u does not fit within a struct of %u bytes", // DPI_ERR_STRUCT_FIELD_OUT_OF_BOUNDS
+    "DPI-1094: struct field %u requires a length field", // DPI_ERR_STRUCT_FIELD_NO_LENGTH
+    "DPI-1095: no struct has been defined for this statement", // DPI_ERR_STRUCT_NOT_DEFINED
+    "DPI-1096: callback streaming the value at array position %u failed", // DPI_ERR_STREAM_CALLBACK_FAILED
+    "DPI-1097: values can only be streamed into variables of native type DPI_NATIVE_TYPE_BYTES that are bound dynamically (LONG, LONG RAW or size exceeding %u bytes) outside of PL/SQL", // DPI_ERR_STREAM_NOT_SUPPORTED
+    "DPI-1098: session parameter name \"%.*s\" is not valid", // DPI_ERR_INVALID_SESSION_PARAM
+    "DPI-1099: LOB at array position %u was not created by this connection", // DPI_ERR_LOB_WRONG_CONN
+    "DPI-1100: rows cannot be detached from a scrollable statement or a statement that fetches into an array of structs", // DPI_ERR_ROW_BLOCK_NOT_SUPPORTED
+    "DPI-1101: statement at array position %u cannot be executed in a batch", // DPI_ERR_BATCH_STMT_NOT_SUPPORTED
+    "DPI-1102: statement at array position %u was not created by this connection", // DPI_ERR_STMT_WRONG_CONN
+    "DPI-1103: bind variable %.*s of statement at array position %u has not been bound", // DPI_ERR_BATCH_BIND_MISSING
+    "DPI-1104: SQL normalizer is not enabled for this context", // DPI_ERR_SQL_NORMALIZER_NOT_ENABLED
+    "DPI-1105: parallel scans require a pool created with mode DPI_MODE_CREATE_THREADED", // DPI_ERR_SCAN_NOT_THREADED
+    "DPI-1106: split mode %d is not valid for a parallel scan", // DPI_ERR_SCAN_INVALID_SPLIT_MODE
+    "DPI-1107: native type %d of column %u cannot be materialized", // DPI_ERR_RESULT_SET_TYPE_NOT_SUPPORTED
+    "DPI-1108: row %" PRIu64 " is out of range for a result set with %" PRIu64 " rows", // DPI_ERR_RESULT_SET_ROW_OUT_OF_RANGE
+    "DPI-1109: queries cannot be executed as a unit of work", // DPI_ERR_UNIT_OF_WORK_IS_QUERY
 };
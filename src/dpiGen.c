@@ -164,6 +164,24 @@ static const dpiTypeDef dpiAllTypeDefs[DPI_HTYPE_MAX - DPI_HTYPE_NONE - 1] = {
         sizeof(dpiVector),              // size of structure
         0x6c3dd6e9,                     // check integer
         (dpiTypeFreeProc) dpiVector__free
+    },
+    {
+        "dpiRowBlock",                  // name
+        sizeof(dpiRowBlock),            // size of structure
+        0x5e2a93c7,                     // check integer
+        (dpiTypeFreeProc) dpiRowBlock__free
+    },
+    {
+        "dpiScan",                      // name
+        sizeof(dpiScan),                // size of structure
+        0x2b81f4d6,                     // check integer
+        (dpiTypeFreeProc) dpiScan__free
+    },
+    {
+        "dpiResultSet",                 // name
+        sizeof(dpiResultSet),           // size of structure
+        0x71d0c35a,                     // check integer
+        (dpiTypeFreeProc) dpiResultSet__free
     }
 };
 
@@ -212,6 +230,8 @@ int dpiGen__allocate(dpiHandleTypeNum typeNum, dpiEnv *env, void **handle,
     value->env = env;
     if (dpiDebugLevel & DPI_DEBUG_LEVEL_REFS)
         dpiDebug__print("ref %p (%s) -> 1 [NEW]\n", value, typeDef->name);
+    if (typeNum != DPI_HTYPE_CONTEXT)
+        dpiHandleRegistry__add(value, typeNum, error->buffer->fnName, error);
 
     *handle = value;
     return DPI_SUCCESS;
@@ -255,6 +275,19 @@ int dpiGen__endPublicFn(const void *ptr, int returnValue, dpiError *error)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiGen__free() [INTERNAL]
+//   Free the memory associated with the handle. This is called by the free
+// routine of each type once all other resources have been released; the
+// handle is first removed from the handle registry, if it was tracked.
+//-----------------------------------------------------------------------------
+void dpiGen__free(void *ptr)
+{
+    dpiHandleRegistry__remove((dpiBaseType*) ptr);
+    dpiUtils__freeMemory(ptr);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiGen__release() [INTERNAL]
 //   Release a reference to the specified handle. If the reference count
@@ -287,6 +287,7 @@ DPI_INITIALIZER(dpiGlobal__initialize)
     memset(&dpiGlobalErrorBuffer, 0, sizeof(dpiGlobalErrorBuffer));
     strcpy(dpiGlobalErrorBuffer.encoding, DPI_CHARSET_NAME_UTF8);
     dpiMutex__initialize(dpiGlobalMutex);
+    dpiHandleRegistry__initialize();
     atexit(dpiGlobal__finalize);
 }
 
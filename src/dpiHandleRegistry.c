@@ -0,0 +1,205 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// dpiHandleRegistry.c
+//   Implementation of the registry of live handles which is used to find
+// handles that have been leaked by an application. Tracking is disabled by
+// default and, once enabled, remains enabled for the lifetime of the process;
+// only handles created after tracking was enabled are registered.
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+
+#define DPI_HANDLE_REGISTRY_NUM_TYPES   (DPI_HTYPE_MAX - DPI_HTYPE_NONE - 1)
+
+// global state of the registry; the mutex protects all of the members
+// except the enabled flag which is only ever changed from 0 to 1
+static int dpiHandleRegistryEnabled = 0;
+static dpiMutexType dpiHandleRegistryMutex;
+static dpiHandleRegistryEntry *dpiHandleRegistryFirst = NULL;
+static dpiHandleRegistryEntry *dpiHandleRegistryLast = NULL;
+static uint64_t dpiHandleRegistryNumLive[DPI_HANDLE_REGISTRY_NUM_TYPES];
+static uint64_t dpiHandleRegistryNumCreated[DPI_HANDLE_REGISTRY_NUM_TYPES];
+static const char *dpiHandleRegistryTypeNames[DPI_HANDLE_REGISTRY_NUM_TYPES];
+
+
+//-----------------------------------------------------------------------------
+// dpiHandleRegistry__add() [INTERNAL]
+//   Add the handle to the registry, if tracking is enabled. The name of the
+// public function that is creating the handle is recorded as its allocation
+// site. If memory cannot be allocated the handle is simply not tracked since
+// tracking must not affect the application.
+//-----------------------------------------------------------------------------
+void dpiHandleRegistry__add(dpiBaseType *value, dpiHandleTypeNum typeNum,
+        const char *fnName, dpiError *error)
+{
+    dpiHandleRegistryEntry *entry;
+    uint32_t typeIndex;
+
+    if (!dpiHandleRegistryEnabled)
+        return;
+    if (dpiUtils__allocateMemory(1, sizeof(dpiHandleRegistryEntry), 1,
+            "allocate handle registry entry", (void**) &entry, error) < 0)
+        return;
+    entry->handle = value;
+    entry->typeNum = typeNum;
+    entry->fnName = fnName;
+    entry->createdNs = dpiUtils__getTimeNs();
+    typeIndex = typeNum - DPI_HTYPE_NONE - 1;
+
+    dpiMutex__acquire(dpiHandleRegistryMutex);
+    entry->prev = dpiHandleRegistryLast;
+    if (dpiHandleRegistryLast)
+        dpiHandleRegistryLast->next = entry;
+    else dpiHandleRegistryFirst = entry;
+    dpiHandleRegistryLast = entry;
+    dpiHandleRegistryNumLive[typeIndex]++;
+    dpiHandleRegistryNumCreated[typeIndex]++;
+    dpiHandleRegistryTypeNames[typeIndex] = value->typeDef->name;
+    dpiMutex__release(dpiHandleRegistryMutex);
+
+    value->registryEntry = entry;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiHandleRegistry__enable() [INTERNAL]
+//   Enable tracking of handles created from this point onwards.
+//-----------------------------------------------------------------------------
+void dpiHandleRegistry__enable(void)
+{
+    dpiMutex__acquire(dpiHandleRegistryMutex);
+    dpiHandleRegistryEnabled = 1;
+    dpiMutex__release(dpiHandleRegistryMutex);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiHandleRegistry__getCounts() [INTERNAL]
+//   Populate the array with the number of live and created handles for each
+// type of handle that has been created since tracking was enabled. On input,
+// the number of counts refers to the number of entries available in the
+// array; on output it refers to the number of types known. If the array is
+// NULL, only the number of types is returned.
+//-----------------------------------------------------------------------------
+int dpiHandleRegistry__getCounts(dpiHandleTypeCount *counts,
+        uint32_t *numCounts, dpiError *error)
+{
+    uint32_t numAvailable, numTypes, i;
+
+    if (!dpiHandleRegistryEnabled)
+        return dpiError__set(error, "get handle counts",
+                DPI_ERR_HANDLE_TRACKING_NOT_ENABLED);
+    numAvailable = (counts) ? *numCounts : 0;
+    numTypes = 0;
+    dpiMutex__acquire(dpiHandleRegistryMutex);
+    for (i = 0; i < DPI_HANDLE_REGISTRY_NUM_TYPES; i++) {
+        if (!dpiHandleRegistryTypeNames[i])
+            continue;
+        if (numTypes < numAvailable) {
+            counts[numTypes].typeName = dpiHandleRegistryTypeNames[i];
+            counts[numTypes].numLive = dpiHandleRegistryNumLive[i];
+            counts[numTypes].numCreated = dpiHandleRegistryNumCreated[i];
+        }
+        numTypes++;
+    }
+    dpiMutex__release(dpiHandleRegistryMutex);
+    *numCounts = numTypes;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiHandleRegistry__getLiveHandles() [INTERNAL]
+//   Populate the array with information about the live handles, oldest first.
+// On input, the number of elements refers to the number of entries available
+// in the array; on output it refers to the number of live handles. If the
+// array is NULL, only the number of live handles is returned.
+//-----------------------------------------------------------------------------
+int dpiHandleRegistry__getLiveHandles(dpiLiveHandleInfo *info,
+        uint32_t *numInfo, dpiError *error)
+{
+    uint32_t numAvailable, numHandles;
+    dpiHandleRegistryEntry *entry;
+    const dpiBaseType *value;
+    uint64_t nowNs;
+
+    if (!dpiHandleRegistryEnabled)
+        return dpiError__set(error, "get live handles",
+                DPI_ERR_HANDLE_TRACKING_NOT_ENABLED);
+    numAvailable = (info) ? *numInfo : 0;
+    numHandles = 0;
+    nowNs = dpiUtils__getTimeNs();
+    dpiMutex__acquire(dpiHandleRegistryMutex);
+    for (entry = dpiHandleRegistryFirst; entry;
+            entry = entry->next, numHandles++) {
+        if (numHandles >= numAvailable)
+            continue;
+        value = (const dpiBaseType*) entry->handle;
+        info[numHandles].handle = entry->handle;
+        info[numHandles].typeName = value->typeDef->name;
+        info[numHandles].fnName = entry->fnName;
+        info[numHandles].refCount = value->refCount;
+        info[numHandles].ageMs = (nowNs - entry->createdNs) / 1000000;
+    }
+    dpiMutex__release(dpiHandleRegistryMutex);
+    *numInfo = numHandles;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiHandleRegistry__initialize() [INTERNAL]
+//   Initialize the registry. This is called when the library is first loaded.
+//-----------------------------------------------------------------------------
+void dpiHandleRegistry__initialize(void)
+{
+    dpiMutex__initialize(dpiHandleRegistryMutex);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiHandleRegistry__remove() [INTERNAL]
+//   Remove the handle from the registry, if it was added to it.
+//-----------------------------------------------------------------------------
+void dpiHandleRegistry__remove(dpiBaseType *value)
+{
+    dpiHandleRegistryEntry *entry = value->registryEntry;
+
+    if (!entry)
+        return;
+    dpiMutex__acquire(dpiHandleRegistryMutex);
+    if (entry->prev)
+        entry->prev->next = entry->next;
+    else dpiHandleRegistryFirst = entry->next;
+    if (entry->next)
+        entry->next->prev = entry->prev;
+    else dpiHandleRegistryLast = entry->prev;
+    dpiHandleRegistryNumLive[entry->typeNum - DPI_HTYPE_NONE - 1]--;
+    dpiMutex__release(dpiHandleRegistryMutex);
+    value->registryEntry = NULL;
+    dpiUtils__freeMemory(entry);
+}
@@ -63,6 +63,7 @@
 #include <errno.h>
 #include <pthread.h>
 #include <sys/time.h>
+#include <time.h>
 #include <dlfcn.h>
 #endif
 #ifdef __linux
@@ -100,6 +101,9 @@ extern unsigned long dpiDebugLevel;
 // define context name for server version information
 #define DPI_CONTEXT_SERVER_VERSION                  "DPI_SERVER_VERSION"
 
+// define context name for the session state last applied
+#define DPI_CONTEXT_SESSION_STATE                   "DPI_SESSION_STATE"
+
 // define size of buffer used for numbers transferred to/from Oracle as text
 #define DPI_NUMBER_AS_TEXT_CHARS                    173
 
@@ -115,6 +119,41 @@ extern unsigned long dpiDebugLevel;
 // define maximum buffer size permitted in variables
 #define DPI_MAX_VAR_BUFFER_SIZE                     (1024 * 1024 * 1024 - 2)
 
+// define minimum number of fetched values (rows times columns) for which the
+// conversion worker pool is used; smaller fetches are converted directly
+#define DPI_PARALLEL_CONVERSION_MIN_VALUES          2048
+
+// define maximum number of sharding key descriptors cached by a pool
+#define DPI_MAX_SHARDING_KEY_CACHE_ENTRIES          256
+
+// define maximum number of sets of fetch buffers from released row blocks that
+// are retained by a statement for reuse
+#define DPI_MAX_SPARE_ROW_BLOCKS                    4
+
+// maximum length of the string representation of a rowid used to split a
+// table for a parallel scan
+#define DPI_SCAN_MAX_ROWID_LENGTH                   32
+
+// define default number of rows executed in the first batch of an adaptive
+// execution when no value is specified
+#define DPI_DEFAULT_ADAPTIVE_BATCH_SIZE             1000
+
+// define transaction states tracked on the client; when the state is unknown
+// the server is consulted (or the work is simply performed)
+#define DPI_TXN_STATE_UNKNOWN                       0
+#define DPI_TXN_STATE_NONE                          1
+#define DPI_TXN_STATE_ACTIVE                        2
+
+// define types of tokens found when scanning SQL text
+#define DPI_SQL_TOKEN_SPACE                         1
+#define DPI_SQL_TOKEN_COMMENT                       2
+#define DPI_SQL_TOKEN_WORD                          3
+#define DPI_SQL_TOKEN_QUOTED_NAME                   4
+#define DPI_SQL_TOKEN_STRING                        5
+#define DPI_SQL_TOKEN_NUMBER                        6
+#define DPI_SQL_TOKEN_BIND                          7
+#define DPI_SQL_TOKEN_OTHER                         8
+
 // define subscription grouping repeat count
 #define DPI_SUBSCR_GROUPING_FOREVER                 -1
 
@@ -525,6 +564,7 @@ extern unsigned long dpiDebugLevel;
 #define DPI_OCI_NUMBER_UNSIGNED                     0
 #define DPI_OCI_SUCCESS_WITH_INFO                   1
 #define DPI_OCI_NTV_SYNTAX                          1
+#define DPI_OCI_FIRST_PIECE                         1
 #define DPI_OCI_MEMORY_CLEARED                      1
 #define DPI_OCI_SESSRLS_DROPSESS                    1
 #define DPI_OCI_SESSRLS_MULTIPROPERTY_TAG           4
@@ -540,8 +580,10 @@ extern unsigned long dpiDebugLevel;
 #define DPI_OCI_LOB_READWRITE                       2
 #define DPI_OCI_DATA_AT_EXEC                        2
 #define DPI_OCI_DYNAMIC_FETCH                       2
+#define DPI_OCI_NEXT_PIECE                          2
 #define DPI_OCI_NUMBER_SIGNED                       2
 #define DPI_OCI_PIN_ANY                             3
+#define DPI_OCI_LAST_PIECE                          3
 #define DPI_OCI_PTYPE_TYPE                          6
 #define DPI_OCI_AUTH                                8
 #define DPI_OCI_DURATION_SESSION                    10
@@ -564,6 +606,7 @@ extern unsigned long dpiDebugLevel;
 #define DPI_OCI_TRANS_TWOPHASE                      0x01000000
 #define DPI_OCI_SECURE_NOTIFICATION                 0x20000000
 #define DPI_OCI_BIND_DEDICATED_REF_CURSOR           0x00000400
+#define DPI_OCI_PREP2_CACHE_SEARCHONLY              0x0010
 #define DPI_OCI_PREP2_GET_SQL_ID                    0x2000
 
 //-----------------------------------------------------------------------------
@@ -683,6 +726,27 @@ typedef enum {
     DPI_ERR_SODA_DOC_IS_NOT_JSON,
     DPI_ERR_NOT_A_QUERY,
     DPI_ERR_PARAM_SIZE_TOO_LARGE,
+    DPI_ERR_MUTEX_STATS_NOT_ENABLED,
+    DPI_ERR_SQL_PROFILER_NOT_ENABLED,
+    DPI_ERR_HANDLE_TRACKING_NOT_ENABLED,
+    DPI_ERR_STRUCT_FIELD_TYPE_NOT_SUPPORTED,
+    DPI_ERR_STRUCT_FIELD_OUT_OF_BOUNDS,
+    DPI_ERR_STRUCT_FIELD_NO_LENGTH,
+    DPI_ERR_STRUCT_NOT_DEFINED,
+    DPI_ERR_STREAM_CALLBACK_FAILED,
+    DPI_ERR_STREAM_NOT_SUPPORTED,
+    DPI_ERR_INVALID_SESSION_PARAM,
+    DPI_ERR_LOB_WRONG_CONN,
+    DPI_ERR_ROW_BLOCK_NOT_SUPPORTED,
+    DPI_ERR_BATCH_STMT_NOT_SUPPORTED,
+    DPI_ERR_STMT_WRONG_CONN,
+    DPI_ERR_BATCH_BIND_MISSING,
+    DPI_ERR_SQL_NORMALIZER_NOT_ENABLED,
+    DPI_ERR_SCAN_NOT_THREADED,
+    DPI_ERR_SCAN_INVALID_SPLIT_MODE,
+    DPI_ERR_RESULT_SET_TYPE_NOT_SUPPORTED,
+    DPI_ERR_RESULT_SET_ROW_OUT_OF_RANGE,
+    DPI_ERR_UNIT_OF_WORK_IS_QUERY,
     DPI_ERR_MAX
 } dpiErrorNum;
 
@@ -711,6 +775,9 @@ typedef enum {
     DPI_HTYPE_QUEUE,
     DPI_HTYPE_JSON,
     DPI_HTYPE_VECTOR,
+    DPI_HTYPE_ROW_BLOCK,
+    DPI_HTYPE_SCAN,
+    DPI_HTYPE_RESULT_SET,
     DPI_HTYPE_MAX
 } dpiHandleTypeNum;
 
@@ -722,17 +789,74 @@ typedef enum {
     typedef CRITICAL_SECTION dpiMutexType;
     #define dpiMutex__initialize(m)     InitializeCriticalSection(&m)
     #define dpiMutex__destroy(m)        DeleteCriticalSection(&m)
-    #define dpiMutex__acquire(m)        EnterCriticalSection(&m)
+    #define dpiMutex__lock(m)           EnterCriticalSection(&m)
+    #define dpiMutex__tryLock(m)        TryEnterCriticalSection(&m)
     #define dpiMutex__release(m)        LeaveCriticalSection(&m)
 #else
     typedef pthread_mutex_t dpiMutexType;
     #define dpiMutex__initialize(m)     pthread_mutex_init(&m, NULL)
     #define dpiMutex__destroy(m)        pthread_mutex_destroy(&m)
-    #define dpiMutex__acquire(m)        pthread_mutex_lock(&m)
+    #define dpiMutex__lock(m)           pthread_mutex_lock(&m)
+    #define dpiMutex__tryLock(m)        (pthread_mutex_trylock(&m) == 0)
     #define dpiMutex__release(m)        pthread_mutex_unlock(&m)
 #endif
 
 
+//-----------------------------------------------------------------------------
+// Thread and condition variable definitions
+//-----------------------------------------------------------------------------
+#ifdef _WIN32
+    typedef HANDLE dpiThreadType;
+    typedef CONDITION_VARIABLE dpiCondType;
+    #define dpiCond__initialize(c)      InitializeConditionVariable(&c)
+    #define dpiCond__destroy(c)
+    #define dpiCond__wait(c, m)         SleepConditionVariableCS(&c, &m, \
+                                                INFINITE)
+    #define dpiCond__broadcast(c)       WakeAllConditionVariable(&c)
+#else
+    typedef pthread_t dpiThreadType;
+    typedef pthread_cond_t dpiCondType;
+    #define dpiCond__initialize(c)      pthread_cond_init(&c, NULL)
+    #define dpiCond__destroy(c)         pthread_cond_destroy(&c)
+    #define dpiCond__wait(c, m)         pthread_cond_wait(&c, &m)
+    #define dpiCond__broadcast(c)       pthread_cond_broadcast(&c)
+#endif
+
+// when built with DPI_MUTEX_STATS defined, each place in the code where a
+// mutex is acquired gets its own static structure which records the number of
+// acquisitions, the number of contended acquisitions and a histogram of the
+// time spent waiting; these can be retrieved with dpiContext_getMutexStats()
+#ifdef DPI_MUTEX_STATS
+    #define DPI_MUTEX_STATS_NUM_BUCKETS     40
+    typedef struct dpiMutexSite dpiMutexSite;
+    struct dpiMutexSite {
+        const char *fileName;               // name of source file
+        uint32_t lineNum;                   // line number in source file
+        const char *mutexName;              // expression naming the mutex
+        int registered;                     // site registered with list?
+        dpiMutexSite *next;                 // next site in registered list
+        uint64_t numAcquisitions;           // number of acquisitions
+        uint64_t numContended;              // number of contended acquisitions
+        uint64_t totalWaitNs;               // total time spent waiting (ns)
+        uint64_t maxWaitNs;                 // longest time spent waiting (ns)
+        uint64_t buckets[DPI_MUTEX_STATS_NUM_BUCKETS];  // wait histogram
+    };
+    #define dpiMutex__acquire(m) \
+        do { \
+            static dpiMutexSite dpiMutexSiteInfo = \
+                    { __FILE__, __LINE__, #m, 0, NULL, 0, 0, 0, 0, { 0 } }; \
+            if (!dpiMutex__tryLock(m)) { \
+                uint64_t dpiMutexStartNs = dpiUtils__getTimeNs(); \
+                dpiMutex__lock(m); \
+                dpiMutex__recordContended(&dpiMutexSiteInfo, \
+                        dpiUtils__getTimeNs() - dpiMutexStartNs); \
+            } else dpiMutex__recordUncontended(&dpiMutexSiteInfo); \
+        } while (0)
+#else
+    #define dpiMutex__acquire(m)        dpiMutex__lock(m)
+#endif
+
+
 //-----------------------------------------------------------------------------
 // old type definitions (to be dropped)
 //-----------------------------------------------------------------------------
@@ -1022,6 +1146,199 @@ typedef struct {
     dpiMutexType mutex;                 // enables thread safety
 } dpiHandlePool;
 
+// used to record a live handle when handle tracking is enabled; the entries
+// are linked together in order of creation so that the oldest handles are
+// found first; the functions for managing this structure are found in the
+// file dpiHandleRegistry.c
+typedef struct dpiHandleRegistryEntry dpiHandleRegistryEntry;
+struct dpiHandleRegistryEntry {
+    const void *handle;                 // handle being tracked
+    dpiHandleTypeNum typeNum;           // type of handle
+    const char *fnName;                 // public function creating handle
+    uint64_t createdNs;                 // time handle was created
+    dpiHandleRegistryEntry *prev;       // previous entry (older)
+    dpiHandleRegistryEntry *next;       // next entry (newer)
+};
+
+// used to aggregate the statistics gathered by the SQL profiler for one
+// distinct (normalized) SQL statement; entries are retained until the profiler
+// itself is freed so that statements can safely keep a pointer to them; the
+// functions for managing this structure are found in the file dpiSqlProfile.c
+typedef struct dpiSqlProfileEntry dpiSqlProfileEntry;
+struct dpiSqlProfileEntry {
+    char *sql;                          // normalized SQL text
+    uint32_t sqlLength;                 // length of normalized SQL text
+    uint32_t hashValue;                 // hash of normalized SQL text
+    char sqlId[13];                     // SQL_ID (from v$SQL), if known
+    uint32_t sqlIdLength;               // length of the sqlId
+    uint32_t prefetchRows;              // prefetch rows used last execute
+    uint64_t numPrepares;               // number of prepares
+    uint64_t numExecutions;             // number of successful executions
+    uint64_t numRows;                   // rows affected or fetched
+    uint64_t prepareTimeNs;             // total time spent preparing
+    uint64_t executeTimeNs;             // total time spent executing
+    uint64_t fetchTimeNs;               // total time spent fetching
+    uint64_t numFetches;                // number of fetch calls
+    uint64_t totalFetchArraySize;       // sum of fetch array sizes used
+    uint64_t numBytesFetched;           // bytes placed in fetch buffers
+    dpiSqlProfileEntry *nextInBucket;   // next entry in hash bucket
+    dpiSqlProfileEntry *next;           // next entry (in order of creation)
+};
+
+// used to manage the statistics gathered by the SQL profiler for a context
+// when the profiler is enabled; the entries are stored in a hash table keyed
+// by the normalized SQL text and are also linked together in order of
+// creation
+typedef struct {
+    dpiSqlProfileEntry **buckets;       // hash table buckets
+    uint32_t numBuckets;                // number of hash table buckets
+    uint32_t numEntries;                // number of entries in table
+    dpiSqlProfileEntry *firstEntry;     // first entry created
+    dpiSqlProfileEntry *lastEntry;      // last entry created
+    dpiMutexType mutex;                 // enables thread safety
+} dpiSqlProfile;
+
+// used to manage the statistics gathered by the SQL normalizer for a context
+// when the normalizer is enabled; the functions for managing this structure
+// are found in the file dpiSqlNormalizer.c
+typedef struct {
+    uint64_t numPrepares;               // number of statements prepared
+    uint64_t numNormalized;             // number with literals replaced
+    uint64_t numLiterals;               // number of literals replaced
+    uint64_t numCacheHits;              // number found in statement cache
+    dpiMutexType mutex;                 // enables thread safety
+} dpiSqlNormalizer;
+
+// used to describe one literal replaced by the SQL normalizer; the value
+// refers either to the original SQL text (numbers) or to the values buffer
+// of the normalized SQL (strings, with quotes removed)
+typedef struct {
+    const char *value;                  // value of literal
+    uint32_t valueLength;               // length of value of literal
+    int isNumber;                       // numeric literal?
+} dpiSqlLiteral;
+
+// used to hold the result of normalizing SQL text; if no literals were
+// replaced, the SQL is NULL and the original SQL text is used unchanged
+typedef struct {
+    char *sql;                          // normalized SQL text
+    uint32_t sqlLength;                 // length of normalized SQL text
+    char *values;                       // values of string literals
+    dpiSqlLiteral *literals;            // array of literals replaced
+    uint32_t numLiterals;               // number of literals replaced
+} dpiSqlNormalized;
+
+// used to hold a copy of one block of rows fetched by a scrollable statement;
+// the data for each query variable (Oracle data, indicators, actual lengths
+// and return codes) is stored consecutively in the data buffer
+typedef struct {
+    uint64_t minRow;                    // row num of first row in block
+    uint32_t numRows;                   // number of rows in block (0 = unused)
+    int hasRowsToFetch;                 // more rows to fetch after block?
+    uint64_t lastUsed;                  // value of use counter when last used
+    size_t allocatedSize;               // allocated size of data buffer
+    char *data;                         // copy of variable buffers
+} dpiScrollCacheBlock;
+
+// used to manage the cache of fetched row blocks for a scrollable statement;
+// the functions for managing this structure are found in the file
+// dpiScrollCache.c
+typedef struct {
+    uint32_t numBlocks;                 // number of blocks in cache
+    int readAhead;                      // read ahead in direction of travel?
+    int isUsable;                       // can query be cached? (-1 = unknown)
+    size_t blockSize;                   // size of data buffer for each block
+    uint64_t useCounter;                // counter used for LRU replacement
+    dpiScrollCacheBlock *blocks;        // array of blocks
+} dpiScrollCache;
+
+// used to cache a sharding key descriptor built for a particular set of
+// sharding key column values
+typedef struct {
+    uint32_t hash;                      // hash of the key
+    uint32_t keyLength;                 // length of the key
+    char *key;                          // column values in serialized form
+    void *descriptor;                   // OCI sharding key descriptor
+} dpiShardingKeyCacheEntry;
+
+// used to manage the cache of sharding key descriptors held by a pool, so
+// that descriptors are not built again for each connection request with the
+// same key; entries are never removed until the pool is freed since they may
+// be in use by connections being acquired; the functions for managing this
+// structure are found in the file dpiShardingKeyCache.c
+typedef struct {
+    uint32_t numEntries;                // number of entries in cache
+    dpiShardingKeyCacheEntry *entries;  // array of entries
+    dpiMutexType mutex;                 // enables thread safety
+} dpiShardingKeyCache;
+
+// used to scan SQL and PL/SQL text one token at a time; the functions for
+// managing this structure are found in the file dpiSqlLexer.c
+typedef struct {
+    const char *sql;                    // text being scanned
+    uint32_t sqlLength;                 // length of text being scanned
+    uint32_t pos;                       // position of next token
+    uint32_t tokenType;                 // type of current token
+    uint32_t tokenPos;                  // position of current token
+    uint32_t tokenLength;               // length of current token
+} dpiSqlLexer;
+
+// used to hold information about one bind placeholder found in the text of a
+// statement that is part of a batch
+typedef struct {
+    const char *name;                   // name of placeholder (without colon)
+    uint32_t nameLength;                // length of name of placeholder
+    uint32_t pos;                       // bind position of placeholder
+    dpiVar *var;                        // variable bound to placeholder
+} dpiStmtBatchPlaceholder;
+
+// used to hold the state of a batch of statements that are executed together
+// as a single anonymous PL/SQL block; the functions for managing this
+// structure are found in the file dpiStmtBatch.c
+typedef struct {
+    uint32_t numStmts;                  // number of statements in batch
+    dpiStmt **stmts;                    // array of statements in batch
+    const char **sqls;                  // SQL text of each statement
+    uint32_t *sqlLengths;               // length of SQL text of each statement
+    uint32_t numPlaceholders;           // number of placeholders found
+    dpiStmtBatchPlaceholder *placeholders; // array of placeholders found
+    uint32_t numVars;                   // number of distinct variables
+    dpiVar **vars;                      // array of distinct variables
+    dpiVar **varCopies;                 // copies bound in place of dynamic vars
+    dpiVar **resultVars;                // row count or cursor variables
+    dpiData **resultData;               // data for row count or cursor vars
+    char *sql;                          // text of PL/SQL block
+    uint32_t sqlLength;                 // length of PL/SQL block
+    dpiStmt *stmt;                      // statement for PL/SQL block
+} dpiStmtBatch;
+
+// used to hold information about one field of a caller-owned struct that is
+// bound or defined directly; fields that OCI cannot place directly are
+// transferred through an intermediate buffer, in which case structValue
+// refers to the field in the first struct and value to the intermediate buffer
+typedef struct {
+    uint32_t pos;                       // bind or query position
+    dpiNativeTypeNum nativeTypeNum;     // native type of field
+    uint16_t oracleType;                // OCI type used for transfer
+    char *value;                        // first value transferred by OCI
+    uint32_t valueSize;                 // size of each value
+    uint32_t valueSkip;                 // bytes between values
+    int16_t *indicator;                 // first indicator (or NULL)
+    uint32_t *length;                   // first length (or NULL)
+    char *structValue;                  // first value in structs (or NULL)
+    void *handle;                       // OCI bind or define handle
+} dpiStructMapField;
+
+// used to manage a caller-owned array of structs bound to or defined for a
+// statement; the functions for managing this structure are found in the file
+// dpiStructMap.c
+typedef struct {
+    uint32_t structSize;                // size of each struct
+    uint32_t numRows;                   // number of structs in array
+    uint32_t numFields;                 // number of fields
+    dpiStructMapField *fields;          // array of fields
+} dpiStructMap;
+
 // used to save error information internally; one of these is stored for each
 // thread using OCIThreadKeyGet() and OCIThreadKeySet() with a globally created
 // OCI environment handle; it is also used when getting batch error information
@@ -1076,6 +1393,35 @@ typedef struct {
     dpiEnv *env;                        // env which created OCI error handle
 } dpiError;
 
+// function signature for the tasks performed by a worker pool; each task is
+// identified by its number and is performed exactly once by one of the
+// threads in the pool
+typedef int (*dpiWorkerPoolTaskProc)(void *context, uint32_t taskNum,
+        dpiError *error);
+
+// used to manage a small pool of threads which perform independent tasks on
+// behalf of a calling thread, which also performs tasks until all of them are
+// complete; the functions for managing this structure are found in the file
+// dpiWorkerPool.c
+typedef struct {
+    uint32_t numThreads;                // number of threads in pool
+    dpiThreadType *threads;             // array of threads
+    dpiMutexType mutex;                 // protects all members below
+    dpiCondType workAvailable;          // signalled when a job is started
+    dpiCondType workCompleted;          // signalled when a job is complete
+    int shutdown;                       // pool is being freed?
+    int busy;                           // job in progress?
+    uint64_t jobNum;                    // number of current job
+    uint32_t numWorking;                // threads working on current job
+    dpiWorkerPoolTaskProc taskProc;     // procedure performing each task
+    void *taskContext;                  // context passed to each task
+    uint32_t numTasks;                  // number of tasks in current job
+    uint32_t nextTask;                  // next task to perform
+    dpiEnv *env;                        // environment for OCI error handles
+    int status;                         // status of current job
+    dpiErrorBuffer errorBuffer;         // first error raised by current job
+} dpiWorkerPool;
+
 // function signature for all methods that free publicly exposed handles
 typedef void (*dpiTypeFreeProc)(void*, dpiError*);
 
@@ -1095,7 +1441,8 @@ typedef struct {
     const dpiTypeDef *typeDef; \
     uint32_t checkInt; \
     unsigned refCount; \
-    dpiEnv *env;
+    dpiEnv *env; \
+    dpiHandleRegistryEntry *registryEntry;
 
 // contains the base attributes that all handles exposed publicly have; generic
 // functions for checking and manipulating handles are found in the file
@@ -1230,11 +1577,39 @@ typedef struct {
     void **objectIndicator;             // array of object indicator values
     dpiReferenceBuffer *references;     // array of references (specific types)
     dpiDynamicBytes *dynamicBytes;      // array of dynamically alloced chunks
+    dpiDynamicBytes *pendingLobValues;  // values to write to LOBs (or NULL)
+    uint32_t numPendingLobValues;       // number of values to write to LOBs
     char *tempBuffer;                   // buffer for numeric conversion
     dpiData *externalData;              // array of buffers (externally used)
     dpiOracleData data;                 // Oracle data buffers (internal only)
 } dpiVarBuffer;
 
+// represents the state of values streamed into a dynamically bound variable
+// from read callbacks supplied by the caller; two pieces are used so that the
+// piece following the one handed to OCI can be read ahead, which allows OCI to
+// be told which piece is the last one
+typedef struct {
+    dpiReadCallback *callbacks;         // array of callbacks (or NULL)
+    void **contexts;                    // array of callback contexts
+    char *pieces[2];                    // pieces handed to OCI in turn
+    uint32_t pieceLengths[2];           // length of data in each piece
+    uint32_t currentPiece;              // piece to hand to OCI next
+    int isActive;                       // is a value being streamed?
+    int failed;                         // did a callback fail?
+    dpiErrorBuffer errorBuffer;         // error raised when callback failed
+} dpiVarStream;
+
+// converters used by variables to transfer a single value between the Oracle
+// buffer and the external data buffer, and to transfer a slice of a column
+// after a fetch; they are resolved once when the variable is allocated based
+// on the Oracle type and native type of the variable
+typedef int (*dpiVarGetValueProc)(dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, int inFetch, dpiData *data, dpiError *error);
+typedef int (*dpiVarSetValueProc)(dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, dpiData *data, dpiError *error);
+typedef int (*dpiVarGetColumnProc)(dpiVar *var, uint32_t numRows,
+        dpiError *error);
+
 // represents memory areas used for enqueuing and dequeuing messages from
 // queues
 typedef struct {
@@ -1267,6 +1642,7 @@ struct dpiPool {
     int externalAuth;                   // use external authentication?
     dpiAccessTokenCallback accessTokenCallback; // access token callback
     void *accessTokenCallbackContext;   // context pointer for callback
+    dpiShardingKeyCache *shardingKeys;  // cached sharding key descriptors
 };
 
 // represents connections to the database and is exposed publicly as a handle
@@ -1300,6 +1676,10 @@ struct dpiConn {
     int standalone;                     // standalone connection (not pooled)?
     int creating;                       // connection is being created?
     int closing;                        // connection is being closed?
+    int transactionState;               // transaction state known to client
+    int handleAcquired;                 // OCI handle acquired by caller?
+    uint64_t snapshotScn;               // SCN of snapshot to apply (or 0)
+    uint64_t appliedSnapshotScn;        // SCN of snapshot applied (or 0)
 };
 
 // represents the context in which all activity in the library takes place; the
@@ -1314,6 +1694,9 @@ struct dpiContext {
     uint8_t dpiMinorVersion;            // ODPI-C minor version of application
     int sodaUseJsonDesc;                // use JSON descriptors in SODA?
     int useJsonId;                      // use DPI_ORACLE_TYPE_JSON_ID?
+    dpiSqlProfile *sqlProfile;          // SQL profiler (or NULL)
+    dpiSqlNormalizer *sqlNormalizer;    // SQL normalizer (or NULL)
+    dpiWorkerPool *conversionPool;      // pool for fetch conversion (or NULL)
 };
 
 // represents statements of all types (queries, DML, DDL, PL/SQL) and is
@@ -1336,10 +1719,22 @@ struct dpiStmt {
     dpiBindVar *bindVars;               // array of bind variables
     uint32_t numBatchErrors;            // number of batch errors
     dpiErrorBuffer *batchErrors;        // array of batch errors
+    int implicitResultsCollected;       // all implicit results collected?
+    uint32_t numImplicitResults;        // number of implicit results collected
+    uint32_t implicitResultIndex;       // index of next implicit result
+    uint32_t allocatedImplicitResults;  // number of allocated result handles
+    void **implicitResults;             // array of implicit result handles
     uint64_t rowCount;                  // rows affected or rows fetched so far
+    int hasTotalRowCount;               // total row count valid (adaptive)?
+    uint64_t totalRowCount;             // rows affected by all batches
+    uint32_t numTotalRowCounts;         // number of rows in totalRowCounts
+    uint64_t *totalRowCounts;           // rows affected by each row (or NULL)
     uint64_t bufferMinRow;              // row num of first row in buffers
     uint16_t statementType;             // type of statement
     uint32_t prefetchRows;              // rows to prefetch on query execute
+    uint32_t handlePrefetchRows;        // prefetch rows last set on handle
+    int handlePrefetchRowsKnown;        // handlePrefetchRows is valid?
+    int resetPrefetchRows;              // reset prefetch before next fetch?
     dpiRowid *lastRowid;                // rowid of last affected row
     int isOwned;                        // owned by structure?
     int hasRowsToFetch;                 // potentially more rows to fetch?
@@ -1348,8 +1743,16 @@ struct dpiStmt {
     int deleteFromCache;                // drop from statement cache on close?
     int closing;                        // statement is being closed?
     int externalHandle;                 // is external handle attached?
+    int untracked;                      // not in connection handle list?
     char sqlId[13];                     // SQL_ID (from v$SQL)
     uint32_t sqlIdLength;               // length of the sqlId
+    dpiSqlProfileEntry *profileEntry;   // SQL profiler entry (or NULL)
+    dpiScrollCache *scrollCache;        // cache of fetched blocks (or NULL)
+    dpiStructMap *structBind;           // array of structs bound (or NULL)
+    dpiStructMap *structDefine;         // array of structs defined (or NULL)
+    uint64_t rowBlockGeneration;        // changes when query vars change
+    uint32_t numSpareRowBlocks;         // number of spare row block buffers
+    dpiVarBuffer *spareRowBlocks[DPI_MAX_SPARE_ROW_BLOCKS]; // spare buffers
 };
 
 // represents memory areas used for transferring data to and from the database
@@ -1368,7 +1771,11 @@ struct dpiVar {
     dpiObjectType *objectType;          // object type (or NULL)
     dpiVarBuffer buffer;                // main buffer for data
     dpiVarBuffer *dynBindBuffers;       // array of buffers (DML returning)
+    dpiVarStream *stream;               // values streamed from callbacks
     dpiError *error;                    // error (only for dynamic bind/define)
+    dpiVarGetValueProc getValueProc;    // converter from Oracle buffer
+    dpiVarSetValueProc setValueProc;    // converter to Oracle buffer
+    dpiVarGetColumnProc getColumnProc;  // converter for fetched column slice
 };
 
 // represents JSON values and is exposed publicly as a handle of type
@@ -1447,6 +1854,62 @@ struct dpiObject {
     int closing;                        // is object being closed?
 };
 
+// represents a block of fetched rows whose buffers have been detached from the
+// statement that fetched them and is exposed publicly as a handle of type
+// DPI_HTYPE_ROW_BLOCK; the implementation for this is found in the file
+// dpiRowBlock.c
+struct dpiRowBlock {
+    dpiType_HEAD
+    dpiStmt *stmt;                      // statement which created this
+    uint64_t generation;                // statement query vars generation
+    uint32_t numRows;                   // number of rows in the block
+    uint32_t numColumns;                // number of columns in the block
+    dpiVar **vars;                      // query variables (one per column)
+    dpiVarBuffer *buffers;              // detached buffers (one per column)
+};
+
+// used to describe one column of a materialized result set
+typedef struct {
+    dpiNativeTypeNum nativeTypeNum;     // native type of column values
+    uint32_t valueSize;                 // size of each value (0 for bytes)
+    char encoding[DPI_OCI_NLS_MAXBUFSZ];    // encoding of bytes values
+} dpiResultSetColumn;
+
+// used to describe one segment of a materialized result set, which holds the
+// rows fetched in a single round trip in columnar form; each segment starts
+// with the offset of the region of each column within the segment
+typedef struct {
+    uint64_t firstRow;                  // index of first row in segment
+    uint32_t numRows;                   // number of rows in segment
+    uint64_t size;                      // size of segment, in bytes
+    char *data;                         // segment data (or NULL if spilled)
+    uint64_t fileOffset;                // offset of spilled data in file
+} dpiResultSetSegment;
+
+// represents the rows of a query copied to the client in columnar form, in
+// memory and in a memory-mapped temporary file once the memory budget has
+// been exhausted, and is exposed publicly as a handle of type
+// DPI_HTYPE_RESULT_SET; the implementation for this is found in the file
+// dpiResultSet.c
+struct dpiResultSet {
+    dpiType_HEAD
+    void *owner;                        // pool or standalone conn (owns env)
+    uint32_t numColumns;                // number of columns
+    dpiResultSetColumn *columns;        // array of columns
+    uint64_t numRows;                   // number of rows
+    uint32_t numSegments;               // number of segments
+    uint32_t allocatedSegments;         // number of segments allocated
+    dpiResultSetSegment *segments;      // array of segments
+    uint64_t maxMemory;                 // memory budget, in bytes
+    uint64_t memoryUsed;                // memory used by segments, in bytes
+    FILE *spillFile;                    // temporary file (or NULL)
+    uint64_t spillFileSize;             // size of temporary file, in bytes
+    char *mappedData;                   // mapped temporary file (or NULL)
+#ifdef _WIN32
+    HANDLE mapping;                     // file mapping object (or NULL)
+#endif
+};
+
 // represents the unique identifier of a row in Oracle Database and is exposed
 // publicly as a handle of type DPI_HTYPE_ROWID; the implementation for this is
 // found in the file dpiRowid.c
@@ -1457,6 +1920,69 @@ struct dpiRowid {
     uint16_t bufferLength;              // length of string rep (or 0)
 };
 
+// used to describe one chunk of the rows of a table scanned in parallel; only
+// the members relevant to the split mode of the scan are populated
+typedef struct {
+    int64_t lowKey;                     // lowest key value (key range)
+    int64_t highKey;                    // key value above range (key range)
+    int isNullKey;                      // rows with null key (key range)
+    char lowRowid[DPI_SCAN_MAX_ROWID_LENGTH];   // lowest rowid (rowid)
+    uint32_t lowRowidLength;            // length of lowest rowid
+    char highRowid[DPI_SCAN_MAX_ROWID_LENGTH];  // highest rowid (rowid)
+    uint32_t highRowidLength;           // length of highest rowid
+    char *partitionName;                // name of partition (partition)
+    uint32_t partitionNameLength;       // length of name of partition
+    int complete;                       // all rows of chunk produced?
+} dpiScanChunk;
+
+// used to hold a block of rows produced by a parallel scan until it is
+// returned to the consumer
+typedef struct dpiScanEntry dpiScanEntry;
+struct dpiScanEntry {
+    dpiRowBlock *block;                 // block of rows
+    uint32_t chunkNum;                  // chunk which produced the block
+    dpiScanEntry *next;                 // next entry in queue
+};
+
+// represents a scan of a table which is split into chunks that are fetched in
+// parallel by threads using connections acquired from a pool and is exposed
+// publicly as a handle of type DPI_HTYPE_SCAN; the implementation for this is
+// found in the file dpiScan.c
+struct dpiScan {
+    dpiType_HEAD
+    dpiPool *pool;                      // pool providing connections
+    char *tableName;                    // name of table to scan
+    uint32_t tableNameLength;           // length of name of table
+    char *columns;                      // select list
+    uint32_t columnsLength;             // length of select list
+    char *whereClause;                  // additional filter (or NULL)
+    uint32_t whereClauseLength;         // length of additional filter
+    char *keyColumn;                    // key column (or NULL)
+    uint32_t keyColumnLength;           // length of key column
+    dpiScanSplitMode splitMode;         // method used to split table
+    uint32_t fetchArraySize;            // number of rows in each block
+    uint32_t maxPendingBlocks;          // blocks queued before waiting
+    int ordered;                        // return blocks in chunk order?
+    uint32_t numChunks;                 // number of chunks
+    dpiScanChunk *chunks;               // array of chunks
+    uint32_t numThreads;                // number of threads started
+    dpiThreadType *threads;             // array of threads
+    dpiConn **conns;                    // connection in use by each thread
+    dpiMutexType mutex;                 // protects all members below
+    dpiCondType blocksAvailable;        // signalled when blocks are queued
+    dpiCondType spaceAvailable;         // signalled when blocks are taken
+    uint32_t nextThreadNum;             // number of next thread to start
+    uint32_t nextChunk;                 // next chunk to assign to a thread
+    uint32_t currentChunk;              // chunk being consumed (ordered)
+    uint32_t numChunksComplete;         // number of chunks complete
+    uint32_t numPendingBlocks;          // number of blocks queued
+    dpiScanEntry *firstEntry;           // first block queued
+    dpiScanEntry *lastEntry;            // last block queued
+    int cancelled;                      // scan cancelled?
+    int failed;                         // scan failed?
+    dpiErrorBuffer errorBuffer;         // first error raised by a thread
+};
+
 // represents a subscription to events such as continuous query notification
 // (CQN) and object change notification and is exposed publicly as a handle of
 // type DPI_HTYPE_SUBSCR; the implementation for this is found in the file
@@ -1591,6 +2117,7 @@ void dpiContext__initCommonCreateParams(const dpiContext *context,
         dpiCommonCreateParams *params);
 void dpiContext__initConnCreateParams(dpiConnCreateParams *params);
 void dpiContext__initPoolCreateParams(dpiPoolCreateParams *params);
+void dpiContext__initScanCreateParams(dpiScanCreateParams *params);
 void dpiContext__initSodaOperOptions(dpiSodaOperOptions *options);
 void dpiContext__initSubscrCreateParams(dpiSubscrCreateParams *params);
 
@@ -1673,6 +2200,7 @@ int dpiGen__allocate(dpiHandleTypeNum typeNum, dpiEnv *env, void **handle,
 int dpiGen__checkHandle(const void *ptr, dpiHandleTypeNum typeNum,
         const char *context, dpiError *error);
 int dpiGen__endPublicFn(const void *ptr, int returnValue, dpiError *error);
+void dpiGen__free(void *ptr);
 int dpiGen__release(void *ptr, dpiHandleTypeNum typeNum, const char *fnName);
 void dpiGen__setRefCount(void *ptr, dpiError *error, int increment);
 int dpiGen__startPublicFn(const void *ptr, dpiHandleTypeNum typeNum,
@@ -1706,6 +2234,7 @@ int dpiOracleType__populateTypeInfo(dpiConn *conn, void *handle,
 // definition of internal dpiConn methods
 //-----------------------------------------------------------------------------
 int dpiConn__checkConnected(dpiConn *conn, dpiError *error);
+int dpiConn__commit(dpiConn *conn, dpiError *error);
 int dpiConn__create(dpiConn *conn, const dpiContext *context,
         const char *userName, uint32_t userNameLength, const char *password,
         uint32_t passwordLength, const char *connectString,
@@ -1734,10 +2263,18 @@ void dpiPool__free(dpiPool *pool, dpiError *error);
 //-----------------------------------------------------------------------------
 // definition of internal dpiStmt methods
 //-----------------------------------------------------------------------------
-int dpiStmt__allocate(dpiConn *conn, int scrollable, dpiStmt **stmt,
-        dpiError *error);
+int dpiStmt__allocate(dpiConn *conn, int scrollable, int untracked,
+        dpiStmt **stmt, dpiError *error);
+int dpiStmt__bind(dpiStmt *stmt, dpiVar *var, uint32_t pos,
+        const char *name, uint32_t nameLength, dpiError *error);
 int dpiStmt__close(dpiStmt *stmt, const char *tag, uint32_t tagLength,
         int propagateErrors, dpiError *error);
+int dpiStmt__execute(dpiStmt *stmt, uint32_t numIters, uint32_t mode,
+        int reExecute, dpiError *error);
+int dpiStmt__executeUnitOfWork(dpiConn *conn, const dpiUnitOfWork *unit,
+        uint64_t *rowCount, dpiError *error);
+int dpiStmt__fetchRowBlock(dpiStmt *stmt, dpiRowBlock **block,
+        dpiError *error);
 void dpiStmt__free(dpiStmt *stmt, dpiError *error);
 int dpiStmt__init(dpiStmt *stmt, dpiError *error);
 int dpiStmt__prepare(dpiStmt *stmt, const char *sql, uint32_t sqlLength,
@@ -1759,17 +2296,23 @@ int32_t dpiVar__defineCallback(dpiVar *var, void *defnp, uint32_t iter,
         uint16_t **rcodepp);
 int dpiVar__extendedPreFetch(dpiVar *var, dpiVarBuffer *buffer,
         dpiError *error);
+void dpiVar__finalizeBuffer(dpiVar *var, dpiVarBuffer *buffer,
+        dpiError *error);
 void dpiVar__free(dpiVar *var, dpiError *error);
 int32_t dpiVar__inBindCallback(dpiVar *var, void *bindp, uint32_t iter,
         uint32_t index, void **bufpp, uint32_t *alenp, uint8_t *piecep,
         void **indpp);
+int dpiVar__getColumnValues(dpiVar *var, uint32_t numRows, dpiError *error);
 int dpiVar__getValue(dpiVar *var, dpiVarBuffer *buffer, uint32_t pos,
         int inFetch, dpiError *error);
+int dpiVar__initBuffer(dpiVar *var, dpiVarBuffer *buffer, dpiError *error);
+void dpiVar__resetStream(dpiVar *var);
 int dpiVar__setValue(dpiVar *var, dpiVarBuffer *buffer, uint32_t pos,
         dpiData *data, dpiError *error);
 int32_t dpiVar__outBindCallback(dpiVar *var, void *bindp, uint32_t iter,
         uint32_t index, void **bufpp, uint32_t **alenpp, uint8_t *piecep,
         void **indpp, uint16_t **rcodepp);
+int dpiVar__writePendingLobValues(dpiVar *var, dpiError *error);
 
 
 //-----------------------------------------------------------------------------
@@ -1793,6 +2336,10 @@ int dpiLob__readBytes(dpiLob *lob, uint64_t offset, uint64_t amount,
         char *value, uint64_t *valueLength, dpiError *error);
 int dpiLob__setFromBytes(dpiLob *lob, const char *value, uint64_t valueLength,
         dpiError *error);
+int dpiLob__writeArray(dpiConn *conn, uint32_t numLobs, dpiLob **lobs,
+        const uint64_t *offsets, const char **values,
+        const uint64_t *valueLengths, uint64_t *bytesWritten,
+        dpiError *error);
 
 
 //-----------------------------------------------------------------------------
@@ -1823,6 +2370,26 @@ int dpiObjectAttr__check(dpiObjectAttr *attr, dpiError *error);
 void dpiObjectAttr__free(dpiObjectAttr *attr, dpiError *error);
 
 
+//-----------------------------------------------------------------------------
+// definition of internal dpiResultSet methods
+//-----------------------------------------------------------------------------
+int dpiResultSet__addRows(dpiResultSet *resultSet, dpiVar **vars,
+        uint32_t startRow, uint32_t numRows, dpiError *error);
+int dpiResultSet__allocate(dpiStmt *stmt, uint64_t maxMemory,
+        dpiResultSet **resultSet, dpiError *error);
+int dpiResultSet__complete(dpiResultSet *resultSet, dpiError *error);
+void dpiResultSet__free(dpiResultSet *resultSet, dpiError *error);
+
+
+//-----------------------------------------------------------------------------
+// definition of internal dpiRowBlock methods
+//-----------------------------------------------------------------------------
+int dpiRowBlock__allocate(dpiStmt *stmt, dpiRowBlock **block,
+        dpiError *error);
+void dpiRowBlock__clearSpares(dpiStmt *stmt, dpiError *error);
+void dpiRowBlock__free(dpiRowBlock *block, dpiError *error);
+
+
 //-----------------------------------------------------------------------------
 // definition of internal dpiRowid methods
 //-----------------------------------------------------------------------------
@@ -1830,6 +2397,17 @@ int dpiRowid__allocate(dpiConn *conn, dpiRowid **rowid, dpiError *error);
 void dpiRowid__free(dpiRowid *rowid, dpiError *error);
 
 
+//-----------------------------------------------------------------------------
+// definition of internal dpiScan methods
+//-----------------------------------------------------------------------------
+void dpiScan__cancel(dpiScan *scan, dpiError *error);
+int dpiScan__create(dpiPool *pool, const dpiScanCreateParams *params,
+        dpiScan **scan, dpiError *error);
+void dpiScan__free(dpiScan *scan, dpiError *error);
+int dpiScan__getNext(dpiScan *scan, dpiRowBlock **block, uint32_t *chunkNum,
+        dpiError *error);
+
+
 //-----------------------------------------------------------------------------
 // definition of internal dpiSubscr methods
 //-----------------------------------------------------------------------------
@@ -1935,12 +2513,16 @@ int dpiOci__attrGet(const void *handle, uint32_t handleType, void *ptr,
 int dpiOci__attrSet(void *handle, uint32_t handleType, void *ptr,
         uint32_t size, uint32_t attribute, const char *action,
         dpiError *error);
+int dpiOci__bindArrayOfStruct(dpiStmt *stmt, dpiStructMapField *field,
+        uint32_t structSize, dpiError *error);
 int dpiOci__bindByName2(dpiStmt *stmt, void **bindHandle, const char *name,
         int32_t nameLength, int dynamicBind, dpiVar *var, dpiError *error);
 int dpiOci__bindByPos2(dpiStmt *stmt, void **bindHandle, uint32_t pos,
         int dynamicBind, dpiVar *var, dpiError *error);
 int dpiOci__bindDynamic(dpiVar *var, void *bindHandle, dpiError *error);
 int dpiOci__bindObject(dpiVar *var, void *bindHandle, dpiError *error);
+int dpiOci__bindStructField(dpiStmt *stmt, dpiStructMapField *field,
+        dpiError *error);
 int dpiOci__break(dpiConn *conn, dpiError *error);
 int dpiOci__collAppend(dpiConn *conn, const void *elem, const void *elemInd,
         void *coll, dpiError *error);
@@ -1975,10 +2557,14 @@ int dpiOci__dateTimeSubtract(void *envHandle, void *handle1, void *handle2,
 int dpiOci__dbShutdown(dpiConn *conn, uint32_t mode, dpiError *error);
 int dpiOci__dbStartup(dpiConn *conn, void *adminHandle, uint32_t mode,
         dpiError *error);
+int dpiOci__defineArrayOfStruct(dpiStmt *stmt, dpiStructMapField *field,
+        uint32_t structSize, dpiError *error);
 int dpiOci__defineByPos2(dpiStmt *stmt, void **defineHandle, uint32_t pos,
         dpiVar *var, dpiError *error);
 int dpiOci__defineDynamic(dpiVar *var, void *defineHandle, dpiError *error);
 int dpiOci__defineObject(dpiVar *var, void *defineHandle, dpiError *error);
+int dpiOci__defineStructField(dpiStmt *stmt, dpiStructMapField *field,
+        dpiError *error);
 int dpiOci__describeAny(dpiConn *conn, void *obj, uint32_t objLength,
         uint8_t objType, void *describeHandle, dpiError *error);
 int dpiOci__descriptorAlloc(void *envHandle, void **handle,
@@ -2005,8 +2591,13 @@ int dpiOci__jsonDomDocGet(dpiJson *json, dpiJznDomDoc **domDoc,
         dpiError *error);
 int dpiOci__jsonTextBufferParse(dpiJson *json, const char *value,
         uint64_t valueLength, uint32_t flags, dpiError *error);
+int dpiOci__loadAllSymbols(dpiStringList *missingSymbols, dpiError *error);
 int dpiOci__loadLib(dpiContextCreateParams *params,
         dpiVersionInfo *clientVersionInfo, char **configDir, dpiError *error);
+int dpiOci__lobArrayWrite(dpiConn *conn, uint32_t *numIters, void **locators,
+        uint64_t *byteAmounts, uint64_t *charAmounts, uint64_t *offsets,
+        void **buffers, uint64_t *bufferLengths, uint8_t charsetForm,
+        dpiError *error);
 int dpiOci__lobClose(dpiLob *lob, dpiError *error);
 int dpiOci__lobCreateTemporary(dpiLob *lob, dpiError *error);
 int dpiOci__lobFileExists(dpiLob *lob, int *exists, dpiError *error);
@@ -2165,8 +2756,8 @@ int dpiOci__sodaSaveAndGet(dpiSodaColl *coll, void **handle, uint32_t mode,
         dpiError *error);
 int dpiOci__sodaSaveAndGetWithOpts(dpiSodaColl *coll, void **handle,
         void *operOptions, uint32_t mode, dpiError *error);
-int dpiOci__stmtExecute(dpiStmt *stmt, uint32_t numIters, uint32_t mode,
-        dpiError *error);
+int dpiOci__stmtExecute(dpiStmt *stmt, uint32_t numIters, uint32_t rowOffset,
+        uint32_t mode, dpiError *error);
 int dpiOci__stmtFetch2(dpiStmt *stmt, uint32_t numRows, uint16_t fetchMode,
         int32_t offset, dpiError *error);
 int dpiOci__stmtGetBindInfo(dpiStmt *stmt, uint32_t size, uint32_t startLoc,
@@ -2178,6 +2769,8 @@ int dpiOci__stmtPrepare2(dpiStmt *stmt, const char *sql, uint32_t sqlLength,
         const char *tag, uint32_t tagLength, dpiError *error);
 int dpiOci__stmtRelease(dpiStmt *stmt, const char *tag, uint32_t tagLength,
         int checkError, dpiError *error);
+int dpiOci__stmtSearchCache(dpiStmt *stmt, const char *sql,
+        uint32_t sqlLength, int *found, dpiError *error);
 int dpiOci__stringAssignText(void *envHandle, const char *value,
         uint32_t valueLength, void **handle, dpiError *error);
 int dpiOci__stringPtr(void *envHandle, void *handle, char **ptr);
@@ -2247,6 +2840,20 @@ void dpiHandlePool__free(dpiHandlePool *pool);
 void dpiHandlePool__release(dpiHandlePool *pool, void **handle);
 
 
+//-----------------------------------------------------------------------------
+// definition of internal dpiHandleRegistry methods
+//-----------------------------------------------------------------------------
+void dpiHandleRegistry__add(dpiBaseType *value, dpiHandleTypeNum typeNum,
+        const char *fnName, dpiError *error);
+void dpiHandleRegistry__enable(void);
+int dpiHandleRegistry__getCounts(dpiHandleTypeCount *counts,
+        uint32_t *numCounts, dpiError *error);
+int dpiHandleRegistry__getLiveHandles(dpiLiveHandleInfo *info,
+        uint32_t *numInfo, dpiError *error);
+void dpiHandleRegistry__initialize(void);
+void dpiHandleRegistry__remove(dpiBaseType *value);
+
+
 //-----------------------------------------------------------------------------
 // definition of internal dpiHandleList methods
 //-----------------------------------------------------------------------------
@@ -2257,6 +2864,109 @@ void dpiHandleList__free(dpiHandleList *list);
 void dpiHandleList__removeHandle(dpiHandleList *list, uint32_t slotNum);
 
 
+//-----------------------------------------------------------------------------
+// definition of internal dpiMutex methods
+//-----------------------------------------------------------------------------
+#ifdef DPI_MUTEX_STATS
+void dpiMutex__recordContended(dpiMutexSite *site, uint64_t waitNs);
+void dpiMutex__recordUncontended(dpiMutexSite *site);
+#endif
+int dpiMutex__getStats(dpiMutexStats *stats, uint32_t *numStats,
+        dpiError *error);
+int dpiMutex__resetStats(dpiError *error);
+
+
+//-----------------------------------------------------------------------------
+// definition of internal dpiScrollCache methods
+//-----------------------------------------------------------------------------
+void dpiScrollCache__clear(dpiScrollCache *cache);
+int dpiScrollCache__create(dpiScrollCache **cache, uint32_t numBlocks,
+        int readAhead, dpiError *error);
+void dpiScrollCache__free(dpiScrollCache *cache);
+void dpiScrollCache__lookup(dpiScrollCache *cache, dpiStmt *stmt,
+        uint64_t desiredRow, int *found);
+int dpiScrollCache__store(dpiScrollCache *cache, dpiStmt *stmt,
+        dpiError *error);
+
+
+//-----------------------------------------------------------------------------
+// definition of internal dpiSessionState methods
+//-----------------------------------------------------------------------------
+int dpiSessionState__apply(dpiConn *conn, const dpiSessionState *state,
+        dpiError *error);
+void dpiSessionState__forget(dpiConn *conn, dpiError *error);
+
+
+//-----------------------------------------------------------------------------
+// definition of internal dpiSnapshot methods
+//-----------------------------------------------------------------------------
+int dpiSnapshot__apply(dpiConn *conn, dpiError *error);
+int dpiSnapshot__capture(dpiConn *conn, dpiSnapshot *snapshot,
+        dpiError *error);
+void dpiSnapshot__release(dpiConn *conn, dpiError *error);
+
+
+//-----------------------------------------------------------------------------
+// definition of internal dpiShardingKeyCache methods
+//-----------------------------------------------------------------------------
+int dpiShardingKeyCache__add(dpiShardingKeyCache *cache,
+        dpiShardingKeyColumn *columns, uint8_t numColumns, void **descriptor,
+        dpiError *error);
+int dpiShardingKeyCache__create(dpiShardingKeyCache **cache,
+        dpiError *error);
+void dpiShardingKeyCache__free(dpiShardingKeyCache *cache);
+int dpiShardingKeyCache__lookup(dpiShardingKeyCache *cache,
+        dpiShardingKeyColumn *columns, uint8_t numColumns, void **descriptor,
+        dpiError *error);
+
+
+//-----------------------------------------------------------------------------
+// definition of internal dpiSqlLexer methods
+//-----------------------------------------------------------------------------
+void dpiSqlLexer__init(dpiSqlLexer *lexer, const char *sql,
+        uint32_t sqlLength);
+int dpiSqlLexer__next(dpiSqlLexer *lexer);
+
+
+//-----------------------------------------------------------------------------
+// definition of internal dpiSqlNormalizer methods
+//-----------------------------------------------------------------------------
+int dpiSqlNormalizer__bind(dpiStmt *stmt, dpiSqlNormalized *normalized,
+        dpiError *error);
+int dpiSqlNormalizer__create(dpiSqlNormalizer **normalizer, dpiError *error);
+void dpiSqlNormalizer__free(dpiSqlNormalizer *normalizer);
+void dpiSqlNormalizer__freeNormalized(dpiSqlNormalized *normalized);
+void dpiSqlNormalizer__getInfo(dpiSqlNormalizer *normalizer,
+        dpiSqlNormalizerInfo *info);
+int dpiSqlNormalizer__normalize(const char *sql, uint32_t sqlLength,
+        dpiSqlNormalized *normalized, dpiError *error);
+void dpiSqlNormalizer__recordPrepare(dpiSqlNormalizer *normalizer,
+        dpiSqlNormalized *normalized, int cacheHit);
+
+
+//-----------------------------------------------------------------------------
+// definition of internal dpiSqlProfile methods
+//-----------------------------------------------------------------------------
+int dpiSqlProfile__create(dpiSqlProfile **profile, dpiError *error);
+void dpiSqlProfile__free(dpiSqlProfile *profile);
+int dpiSqlProfile__getInfo(dpiSqlProfile *profile, dpiSqlProfileInfo *info,
+        uint32_t *numInfo, dpiError *error);
+void dpiSqlProfile__recordExecute(dpiStmt *stmt, uint64_t elapsedNs,
+        uint64_t numRows);
+void dpiSqlProfile__recordFetch(dpiStmt *stmt, uint64_t elapsedNs);
+void dpiSqlProfile__recordPrepare(dpiStmt *stmt, const char *sql,
+        uint32_t sqlLength, uint64_t elapsedNs, dpiError *error);
+void dpiSqlProfile__reset(dpiSqlProfile *profile);
+
+
+//-----------------------------------------------------------------------------
+// definition of internal dpiStmtBatch methods
+//-----------------------------------------------------------------------------
+int dpiStmtBatch__execute(dpiConn *conn, uint32_t numStmts, dpiStmt **stmts,
+        uint32_t mode, uint64_t *rowCounts, dpiStmt **queryResults,
+        dpiError *error);
+
+
 //-----------------------------------------------------------------------------
 // definition of internal dpiStringList methods
 //-----------------------------------------------------------------------------
@@ -2265,6 +2975,28 @@ int dpiStringList__addElement(dpiStringList *list, const char *value,
         uint32_t valueLength, uint32_t *numStringsAllocated, dpiError *error);
 
 
+//-----------------------------------------------------------------------------
+// definition of internal dpiStructMap methods
+//-----------------------------------------------------------------------------
+int dpiStructMap__bind(dpiStructMap *map, dpiStmt *stmt, dpiError *error);
+int dpiStructMap__create(const dpiStructLayout *layout, void *rows,
+        uint32_t numRows, dpiStructMap **map, dpiError *error);
+int dpiStructMap__define(dpiStructMap *map, dpiStmt *stmt, dpiError *error);
+void dpiStructMap__free(dpiStructMap *map);
+void dpiStructMap__fromOracle(dpiStructMap *map, uint32_t numRows);
+void dpiStructMap__toOracle(dpiStructMap *map, uint32_t numRows);
+
+
+//-----------------------------------------------------------------------------
+// definition of internal dpiWorkerPool methods
+//-----------------------------------------------------------------------------
+int dpiWorkerPool__create(dpiWorkerPool **pool, uint32_t numThreads,
+        dpiError *error);
+void dpiWorkerPool__free(dpiWorkerPool *pool);
+int dpiWorkerPool__run(dpiWorkerPool *pool, dpiEnv *env, uint32_t numTasks,
+        dpiWorkerPoolTaskProc taskProc, void *taskContext, dpiError *error);
+
+
 //-----------------------------------------------------------------------------
 // definition of internal dpiUtils methods
 //-----------------------------------------------------------------------------
@@ -2283,6 +3015,7 @@ int dpiUtils__ensureBuffer(size_t desiredSize, const char *action,
 int dpiUtils__getTransactionHandle(dpiConn *conn, void **transactionHandle,
         dpiError *error);
 void dpiUtils__freeMemory(void *ptr);
+uint64_t dpiUtils__getTimeNs(void);
 int dpiUtils__getAttrStringWithDup(const char *action, const void *ociHandle,
         uint32_t ociHandleType, uint32_t ociAttribute, const char **value,
         uint32_t *valueLength, dpiError *error);
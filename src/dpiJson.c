@@ -788,7 +788,7 @@ void dpiJson__free(dpiJson *json, dpiError *error)
         json->convIntervalYM = NULL;
     }
     dpiJsonNode__free(&json->topNode);
-    dpiUtils__freeMemory(json);
+    dpiGen__free(json);
 }
 
 
@@ -142,7 +142,7 @@ void dpiLob__free(dpiLob *lob, dpiError *error)
         dpiGen__setRefCount(lob->conn, error, -1);
         lob->conn = NULL;
     }
-    dpiUtils__freeMemory(lob);
+    dpiGen__free(lob);
 }
 
 
@@ -202,6 +202,79 @@ int dpiLob__setFromBytes(dpiLob *lob, const char *value, uint64_t valueLength,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiLob__writeArray() [INTERNAL]
+//   Write the values to the LOBs at the given offsets (or at the start of each
+// LOB if no offsets are specified) using as few round trips as possible. OCI
+// requires all LOBs written in a single call to use the same character set
+// form, so consecutive LOBs with the same form are written together. If an
+// error occurs, the offset in the error is set to the index of the LOB that
+// could not be written.
+//-----------------------------------------------------------------------------
+int dpiLob__writeArray(dpiConn *conn, uint32_t numLobs, dpiLob **lobs,
+        const uint64_t *offsets, const char **values,
+        const uint64_t *valueLengths, uint64_t *bytesWritten,
+        dpiError *error)
+{
+    uint64_t *byteAmounts, *charAmounts, *lobOffsets, *bufferLengths;
+    uint32_t i, start, end, numIters, numWritten;
+    void **locators, **buffers;
+    uint8_t charsetForm;
+    int status;
+
+    // allocate and populate the arrays required by OCI
+    if (dpiUtils__allocateMemory(4 * (size_t) numLobs, sizeof(uint64_t), 0,
+            "allocate LOB write amounts", (void**) &byteAmounts, error) < 0)
+        return DPI_FAILURE;
+    if (dpiUtils__allocateMemory(2 * (size_t) numLobs, sizeof(void*), 0,
+            "allocate LOB write buffers", (void**) &locators, error) < 0) {
+        dpiUtils__freeMemory(byteAmounts);
+        return DPI_FAILURE;
+    }
+    charAmounts = byteAmounts + numLobs;
+    lobOffsets = charAmounts + numLobs;
+    bufferLengths = lobOffsets + numLobs;
+    buffers = locators + numLobs;
+    for (i = 0; i < numLobs; i++) {
+        locators[i] = lobs[i]->locator;
+        byteAmounts[i] = valueLengths[i];
+        charAmounts[i] = 0;
+        lobOffsets[i] = (offsets) ? offsets[i] : 1;
+        buffers[i] = (void*) values[i];
+        bufferLengths[i] = valueLengths[i];
+    }
+
+    // write the LOBs, grouped by character set form
+    status = DPI_SUCCESS;
+    numWritten = numLobs;
+    for (start = 0; start < numLobs; start = end) {
+        charsetForm = lobs[start]->type->charsetForm;
+        for (end = start + 1; end < numLobs &&
+                lobs[end]->type->charsetForm == charsetForm; end++);
+        numIters = end - start;
+        status = dpiOci__lobArrayWrite(conn, &numIters, &locators[start],
+                &byteAmounts[start], &charAmounts[start], &lobOffsets[start],
+                &buffers[start], &bufferLengths[start], charsetForm, error);
+        if (status < 0) {
+            numWritten = (numIters < end - start) ? start + numIters : start;
+            error->buffer->offset = numWritten;
+            break;
+        }
+    }
+
+    // return the number of bytes written to each LOB, if requested; LOBs that
+    // were not written are reported as having no bytes written
+    if (bytesWritten) {
+        for (i = 0; i < numLobs; i++)
+            bytesWritten[i] = (i < numWritten) ? byteAmounts[i] : 0;
+    }
+
+    dpiUtils__freeMemory(locators);
+    dpiUtils__freeMemory(byteAmounts);
+    return status;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiLob_addRef() [PUBLIC]
 //   Add a reference to the LOB.
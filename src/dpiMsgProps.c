@@ -97,7 +97,7 @@ void dpiMsgProps__free(dpiMsgProps *props, dpiError *error)
         dpiGen__setRefCount(props->conn, error, -1);
         props->conn = NULL;
     }
-    dpiUtils__freeMemory(props);
+    dpiGen__free(props);
 }
 
 
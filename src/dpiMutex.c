@@ -0,0 +1,261 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// dpiMutex.c
+//   Implementation of lock contention statistics for the mutexes used
+// internally by ODPI-C. Statistics are only gathered when the library is
+// built with DPI_MUTEX_STATS defined; otherwise the query functions simply
+// return an error.
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+
+#ifdef DPI_MUTEX_STATS
+
+// atomic operations used for updating the statistics; relaxed ordering is
+// sufficient since the values are only ever used for reporting; the flag
+// indicating that a site has been registered is checked without holding the
+// lock protecting the list of sites, so it is also accessed atomically
+#ifdef _WIN32
+    #define dpiMutex__atomicAdd(p, v) \
+        InterlockedExchangeAdd64((LONG64*) (p), (LONG64) (v))
+    #define dpiMutex__atomicLoad(p) \
+        ((uint64_t) InterlockedCompareExchange64((LONG64*) (p), 0, 0))
+    #define dpiMutex__atomicStore(p, v) \
+        InterlockedExchange64((LONG64*) (p), (LONG64) (v))
+    #define dpiMutex__atomicSwap(p, e, n) \
+        (InterlockedCompareExchange64((LONG64*) (p), (LONG64) (n), \
+                (LONG64) (e)) == (LONG64) (e))
+    #define dpiMutex__isRegistered(s) \
+        (InterlockedCompareExchange((LONG*) &(s)->registered, 0, 0) != 0)
+    #define dpiMutex__setRegistered(s) \
+        InterlockedExchange((LONG*) &(s)->registered, 1)
+    static SRWLOCK dpiMutexSitesLock = SRWLOCK_INIT;
+    #define dpiMutex__lockSites()   AcquireSRWLockExclusive(&dpiMutexSitesLock)
+    #define dpiMutex__unlockSites() ReleaseSRWLockExclusive(&dpiMutexSitesLock)
+#else
+    #define dpiMutex__atomicAdd(p, v) \
+        __atomic_fetch_add(p, v, __ATOMIC_RELAXED)
+    #define dpiMutex__atomicLoad(p) \
+        __atomic_load_n(p, __ATOMIC_RELAXED)
+    #define dpiMutex__atomicStore(p, v) \
+        __atomic_store_n(p, v, __ATOMIC_RELAXED)
+    #define dpiMutex__atomicSwap(p, e, n) \
+        __atomic_compare_exchange_n(p, &e, n, 0, __ATOMIC_RELAXED, \
+                __ATOMIC_RELAXED)
+    #define dpiMutex__isRegistered(s) \
+        __atomic_load_n(&(s)->registered, __ATOMIC_ACQUIRE)
+    #define dpiMutex__setRegistered(s) \
+        __atomic_store_n(&(s)->registered, 1, __ATOMIC_RELEASE)
+    static pthread_mutex_t dpiMutexSitesLock = PTHREAD_MUTEX_INITIALIZER;
+    #define dpiMutex__lockSites()   pthread_mutex_lock(&dpiMutexSitesLock)
+    #define dpiMutex__unlockSites() pthread_mutex_unlock(&dpiMutexSitesLock)
+#endif
+
+// list of sites at which a mutex has been acquired at least once
+static dpiMutexSite *dpiMutexSites = NULL;
+
+
+//-----------------------------------------------------------------------------
+// dpiMutex__getPercentile() [INTERNAL]
+//   Return the wait time at the given percentile, calculated from the
+// histogram of wait times. The histogram buckets are powers of two so the
+// upper bound of the bucket is returned, limited by the maximum wait time.
+//-----------------------------------------------------------------------------
+static uint64_t dpiMutex__getPercentile(const uint64_t *buckets,
+        uint64_t numContended, uint64_t maxWaitNs, uint32_t percentile)
+{
+    uint64_t cumulative = 0, upperBound;
+    uint32_t i;
+
+    if (numContended == 0)
+        return 0;
+    for (i = 0; i < DPI_MUTEX_STATS_NUM_BUCKETS; i++) {
+        cumulative += buckets[i];
+        if (cumulative * 100 >= numContended * percentile)
+            break;
+    }
+    if (i >= DPI_MUTEX_STATS_NUM_BUCKETS - 1)
+        return maxWaitNs;
+    upperBound = ((uint64_t) 2 << i) - 1;
+    return (upperBound < maxWaitNs) ? upperBound : maxWaitNs;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiMutex__registerSite() [INTERNAL]
+//   Add the site to the list of known sites, if it has not already been
+// added. This only happens the first time that a mutex is acquired at the
+// site.
+//-----------------------------------------------------------------------------
+static void dpiMutex__registerSite(dpiMutexSite *site)
+{
+    dpiMutex__lockSites();
+    if (!dpiMutex__isRegistered(site)) {
+        site->next = dpiMutexSites;
+        dpiMutexSites = site;
+        dpiMutex__setRegistered(site);
+    }
+    dpiMutex__unlockSites();
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiMutex__recordContended() [INTERNAL]
+//   Record an acquisition of a mutex at the given site that had to wait for
+// another thread to release the mutex first.
+//-----------------------------------------------------------------------------
+void dpiMutex__recordContended(dpiMutexSite *site, uint64_t waitNs)
+{
+    uint64_t maxWaitNs;
+    uint32_t bucket;
+
+    if (!dpiMutex__isRegistered(site))
+        dpiMutex__registerSite(site);
+    dpiMutex__atomicAdd(&site->numAcquisitions, 1);
+    dpiMutex__atomicAdd(&site->numContended, 1);
+    dpiMutex__atomicAdd(&site->totalWaitNs, waitNs);
+    for (bucket = 0; bucket < DPI_MUTEX_STATS_NUM_BUCKETS - 1; bucket++) {
+        if ((waitNs >> (bucket + 1)) == 0)
+            break;
+    }
+    dpiMutex__atomicAdd(&site->buckets[bucket], 1);
+    maxWaitNs = dpiMutex__atomicLoad(&site->maxWaitNs);
+    while (waitNs > maxWaitNs) {
+        if (dpiMutex__atomicSwap(&site->maxWaitNs, maxWaitNs, waitNs))
+            break;
+        maxWaitNs = dpiMutex__atomicLoad(&site->maxWaitNs);
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiMutex__recordUncontended() [INTERNAL]
+//   Record an acquisition of a mutex at the given site that did not have to
+// wait.
+//-----------------------------------------------------------------------------
+void dpiMutex__recordUncontended(dpiMutexSite *site)
+{
+    if (!dpiMutex__isRegistered(site))
+        dpiMutex__registerSite(site);
+    dpiMutex__atomicAdd(&site->numAcquisitions, 1);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiMutex__getStats() [INTERNAL]
+//   Populate the array of statistics with one entry for each site at which a
+// mutex has been acquired. On input, the number of stats refers to the number
+// of entries available in the array; on output it refers to the number of
+// sites known. If the array is NULL, only the number of sites is returned.
+//-----------------------------------------------------------------------------
+int dpiMutex__getStats(dpiMutexStats *stats, uint32_t *numStats,
+        UNUSED dpiError *error)
+{
+    uint64_t buckets[DPI_MUTEX_STATS_NUM_BUCKETS];
+    uint32_t numAvailable, numSites, i;
+    dpiMutexStats *entry;
+    dpiMutexSite *site;
+
+    numAvailable = (stats) ? *numStats : 0;
+    numSites = 0;
+    dpiMutex__lockSites();
+    for (site = dpiMutexSites; site; site = site->next, numSites++) {
+        if (numSites >= numAvailable)
+            continue;
+        entry = &stats[numSites];
+        entry->fileName = site->fileName;
+        entry->lineNum = site->lineNum;
+        entry->mutexName = site->mutexName;
+        entry->numAcquisitions = dpiMutex__atomicLoad(&site->numAcquisitions);
+        entry->numContended = dpiMutex__atomicLoad(&site->numContended);
+        entry->totalWaitNs = dpiMutex__atomicLoad(&site->totalWaitNs);
+        entry->maxWaitNs = dpiMutex__atomicLoad(&site->maxWaitNs);
+        for (i = 0; i < DPI_MUTEX_STATS_NUM_BUCKETS; i++)
+            buckets[i] = dpiMutex__atomicLoad(&site->buckets[i]);
+        entry->p50WaitNs = dpiMutex__getPercentile(buckets,
+                entry->numContended, entry->maxWaitNs, 50);
+        entry->p90WaitNs = dpiMutex__getPercentile(buckets,
+                entry->numContended, entry->maxWaitNs, 90);
+        entry->p99WaitNs = dpiMutex__getPercentile(buckets,
+                entry->numContended, entry->maxWaitNs, 99);
+    }
+    dpiMutex__unlockSites();
+    *numStats = numSites;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiMutex__resetStats() [INTERNAL]
+//   Reset the statistics for all sites at which a mutex has been acquired.
+// The sites themselves remain registered.
+//-----------------------------------------------------------------------------
+int dpiMutex__resetStats(UNUSED dpiError *error)
+{
+    dpiMutexSite *site;
+    uint32_t i;
+
+    dpiMutex__lockSites();
+    for (site = dpiMutexSites; site; site = site->next) {
+        dpiMutex__atomicStore(&site->numAcquisitions, 0);
+        dpiMutex__atomicStore(&site->numContended, 0);
+        dpiMutex__atomicStore(&site->totalWaitNs, 0);
+        dpiMutex__atomicStore(&site->maxWaitNs, 0);
+        for (i = 0; i < DPI_MUTEX_STATS_NUM_BUCKETS; i++)
+            dpiMutex__atomicStore(&site->buckets[i], 0);
+    }
+    dpiMutex__unlockSites();
+    return DPI_SUCCESS;
+}
+
+#else
+
+//-----------------------------------------------------------------------------
+// dpiMutex__getStats() [INTERNAL]
+//   Statistics are not gathered unless DPI_MUTEX_STATS is defined so an error
+// is raised instead.
+//-----------------------------------------------------------------------------
+int dpiMutex__getStats(UNUSED dpiMutexStats *stats, UNUSED uint32_t *numStats,
+        dpiError *error)
+{
+    return dpiError__set(error, "get mutex stats",
+            DPI_ERR_MUTEX_STATS_NOT_ENABLED);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiMutex__resetStats() [INTERNAL]
+//   Statistics are not gathered unless DPI_MUTEX_STATS is defined so an error
+// is raised instead.
+//-----------------------------------------------------------------------------
+int dpiMutex__resetStats(dpiError *error)
+{
+    return dpiError__set(error, "reset mutex stats",
+            DPI_ERR_MUTEX_STATS_NOT_ENABLED);
+}
+
+#endif
@@ -235,7 +235,7 @@ void dpiObject__free(dpiObject *obj, dpiError *error)
         dpiGen__setRefCount(obj->dependsOnObj, error, -1);
         obj->dependsOnObj = NULL;
     }
-    dpiUtils__freeMemory(obj);
+    dpiGen__free(obj);
 }
 
 
@@ -84,7 +84,7 @@ void dpiObjectAttr__free(dpiObjectAttr *attr, dpiError *error)
         dpiUtils__freeMemory((void*) attr->name);
         attr->name = NULL;
     }
-    dpiUtils__freeMemory(attr);
+    dpiGen__free(attr);
 }
 
 
@@ -178,7 +178,7 @@ void dpiObjectType__free(dpiObjectType *objType, dpiError *error)
         dpiUtils__freeMemory((void*) objType->packageName);
         objType->packageName = NULL;
     }
-    dpiUtils__freeMemory(objType);
+    dpiGen__free(objType);
 }
 
 
@@ -48,6 +48,12 @@ typedef struct {
     char **configDir;
 } dpiOciLoadLibParams;
 
+// define structure used for resolving all OCI symbols at once
+typedef struct {
+    const char *name;
+    void **symbol;
+} dpiOciSymbolInfo;
+
 
 // forward declarations of internal functions only used in this file
 static void *dpiOci__allocateMem(void *unused, size_t size);
@@ -122,6 +128,8 @@ typedef int (*dpiOciFnType__attrGet)(const void  *trgthndlp,
         uint32_t attrtype, void *errhp);
 typedef int (*dpiOciFnType__attrSet)(void *trgthndlp, uint32_t trghndltyp,
         void *attributep, uint32_t size, uint32_t attrtype, void *errhp);
+typedef int (*dpiOciFnType__bindArrayOfStruct)(void *bindp, void *errhp,
+        uint32_t pvskip, uint32_t indskip, uint32_t alskip, uint32_t rcskip);
 typedef int (*dpiOciFnType__bindByName)(void *stmtp, void **bindp, void *errhp,
         const char *placeholder, int32_t placeh_len, void *valuep,
         int32_t value_sz, uint16_t dty, void *indp, uint16_t *alenp,
@@ -188,6 +196,8 @@ typedef int (*dpiOciFnType__defineByPos)(void *stmtp, void **defnp,
         void *errhp, uint32_t position, void *valuep, int32_t value_sz,
         uint16_t dty, void *indp, uint16_t *rlenp, uint16_t *rcodep,
         uint32_t mode);
+typedef int (*dpiOciFnType__defineArrayOfStruct)(void *defnp, void *errhp,
+        uint32_t pvskip, uint32_t indskip, uint32_t rlskip, uint32_t rcskip);
 typedef int (*dpiOciFnType__defineByPos2)(void *stmtp, void **defnp,
         void *errhp, uint32_t position, void *valuep, uint64_t value_sz,
         uint16_t dty, void *indp, uint32_t *rlenp, uint16_t *rcodep,
@@ -229,6 +239,11 @@ typedef int (*dpiOciFnType__jsonDomDocGet)(void *svchp, void *jsond,
 typedef int (*dpiOciFnType__jsonTextBufferParse)(void *hndlp, void *jsond,
         void *bufp, uint64_t buf_sz, uint32_t validation, uint16_t encoding,
         void *errhp, uint32_t mode);
+typedef int (*dpiOciFnType__lobArrayWrite)(void *svchp, void *errhp,
+        uint32_t *array_iter, void **lobp_arr, uint64_t *byte_amt_arr,
+        uint64_t *char_amt_arr, uint64_t *offset_arr, void **bufp_arr,
+        uint64_t *bufl_arr, uint8_t piece, void *ctxp, void *cbfp,
+        uint16_t csid, uint8_t csfrm);
 typedef int (*dpiOciFnType__lobClose)(void *svchp, void *errhp, void *locp);
 typedef int (*dpiOciFnType__lobCreateTemporary)(void *svchp, void *errhp,
         void *locp, uint16_t csid, uint8_t csfrm, uint8_t lobtype, int cache,
@@ -550,6 +565,7 @@ static struct {
     dpiOciFnType__arrayDescriptorFree fnArrayDescriptorFree;
     dpiOciFnType__attrGet fnAttrGet;
     dpiOciFnType__attrSet fnAttrSet;
+    dpiOciFnType__bindArrayOfStruct fnBindArrayOfStruct;
     dpiOciFnType__bindByName fnBindByName;
     dpiOciFnType__bindByName2 fnBindByName2;
     dpiOciFnType__bindByPos fnBindByPos;
@@ -575,6 +591,7 @@ static struct {
     dpiOciFnType__dbShutdown fnDbShutdown;
     dpiOciFnType__dbStartup fnDbStartup;
     dpiOciFnType__defineByPos fnDefineByPos;
+    dpiOciFnType__defineArrayOfStruct fnDefineArrayOfStruct;
     dpiOciFnType__defineByPos2 fnDefineByPos2;
     dpiOciFnType__defineDynamic fnDefineDynamic;
     dpiOciFnType__defineObject fnDefineObject;
@@ -591,6 +608,7 @@ static struct {
     dpiOciFnType__intervalSetYearMonth fnIntervalSetYearMonth;
     dpiOciFnType__jsonDomDocGet fnJsonDomDocGet;
     dpiOciFnType__jsonTextBufferParse fnJsonTextBufferParse;
+    dpiOciFnType__lobArrayWrite fnLobArrayWrite;
     dpiOciFnType__lobClose fnLobClose;
     dpiOciFnType__lobCreateTemporary fnLobCreateTemporary;
     dpiOciFnType__lobFileExists fnLobFileExists;
@@ -710,6 +728,201 @@ static struct {
 } dpiOciSymbols;
 
 
+// table of all OCI symbols used by ODPI-C; this is used when all symbols are
+// resolved at once instead of on first use
+static const dpiOciSymbolInfo dpiOciSymbolTable[] = {
+    { "OCIAppCtxClearAll", (void**) &dpiOciSymbols.fnAppCtxClearAll },
+    { "OCIAppCtxSet", (void**) &dpiOciSymbols.fnAppCtxSet },
+    { "OCIAQDeq", (void**) &dpiOciSymbols.fnAqDeq },
+    { "OCIAQDeqArray", (void**) &dpiOciSymbols.fnAqDeqArray },
+    { "OCIAQEnq", (void**) &dpiOciSymbols.fnAqEnq },
+    { "OCIAQEnqArray", (void**) &dpiOciSymbols.fnAqEnqArray },
+    { "OCIArrayDescriptorAlloc",
+            (void**) &dpiOciSymbols.fnArrayDescriptorAlloc },
+    { "OCIArrayDescriptorFree",
+            (void**) &dpiOciSymbols.fnArrayDescriptorFree },
+    { "OCIAttrGet", (void**) &dpiOciSymbols.fnAttrGet },
+    { "OCIAttrSet", (void**) &dpiOciSymbols.fnAttrSet },
+    { "OCIBindArrayOfStruct", (void**) &dpiOciSymbols.fnBindArrayOfStruct },
+    { "OCIBindByName2", (void**) &dpiOciSymbols.fnBindByName2 },
+    { "OCIBindByPos2", (void**) &dpiOciSymbols.fnBindByPos2 },
+    { "OCIBindDynamic", (void**) &dpiOciSymbols.fnBindDynamic },
+    { "OCIBindObject", (void**) &dpiOciSymbols.fnBindObject },
+    { "OCIBreak", (void**) &dpiOciSymbols.fnBreak },
+    { "OCIClientVersion", (void**) &dpiOciSymbols.fnClientVersion },
+    { "OCICollAppend", (void**) &dpiOciSymbols.fnCollAppend },
+    { "OCICollAssignElem", (void**) &dpiOciSymbols.fnCollAssignElem },
+    { "OCICollGetElem", (void**) &dpiOciSymbols.fnCollGetElem },
+    { "OCICollSize", (void**) &dpiOciSymbols.fnCollSize },
+    { "OCICollTrim", (void**) &dpiOciSymbols.fnCollTrim },
+    { "OCIContextGetValue", (void**) &dpiOciSymbols.fnContextGetValue },
+    { "OCIContextSetValue", (void**) &dpiOciSymbols.fnContextSetValue },
+    { "OCIDateTimeConstruct", (void**) &dpiOciSymbols.fnDateTimeConstruct },
+    { "OCIDateTimeConvert", (void**) &dpiOciSymbols.fnDateTimeConvert },
+    { "OCIDateTimeGetDate", (void**) &dpiOciSymbols.fnDateTimeGetDate },
+    { "OCIDateTimeGetTime", (void**) &dpiOciSymbols.fnDateTimeGetTime },
+    { "OCIDateTimeGetTimeZoneOffset",
+            (void**) &dpiOciSymbols.fnDateTimeGetTimeZoneOffset },
+    { "OCIDateTimeIntervalAdd",
+            (void**) &dpiOciSymbols.fnDateTimeIntervalAdd },
+    { "OCIDateTimeSubtract", (void**) &dpiOciSymbols.fnDateTimeSubtract },
+    { "OCIDBShutdown", (void**) &dpiOciSymbols.fnDbShutdown },
+    { "OCIDBStartup", (void**) &dpiOciSymbols.fnDbStartup },
+    { "OCIDefineArrayOfStruct",
+            (void**) &dpiOciSymbols.fnDefineArrayOfStruct },
+    { "OCIDefineByPos2", (void**) &dpiOciSymbols.fnDefineByPos2 },
+    { "OCIDefineDynamic", (void**) &dpiOciSymbols.fnDefineDynamic },
+    { "OCIDefineObject", (void**) &dpiOciSymbols.fnDefineObject },
+    { "OCIDescribeAny", (void**) &dpiOciSymbols.fnDescribeAny },
+    { "OCIDescriptorAlloc", (void**) &dpiOciSymbols.fnDescriptorAlloc },
+    { "OCIDescriptorFree", (void**) &dpiOciSymbols.fnDescriptorFree },
+    { "OCIEnvNlsCreate", (void**) &dpiOciSymbols.fnEnvNlsCreate },
+    { "OCIErrorGet", (void**) &dpiOciSymbols.fnErrorGet },
+    { "OCIHandleAlloc", (void**) &dpiOciSymbols.fnHandleAlloc },
+    { "OCIHandleFree", (void**) &dpiOciSymbols.fnHandleFree },
+    { "OCIIntervalGetDaySecond",
+            (void**) &dpiOciSymbols.fnIntervalGetDaySecond },
+    { "OCIIntervalGetYearMonth",
+            (void**) &dpiOciSymbols.fnIntervalGetYearMonth },
+    { "OCIIntervalSetDaySecond",
+            (void**) &dpiOciSymbols.fnIntervalSetDaySecond },
+    { "OCIIntervalSetYearMonth",
+            (void**) &dpiOciSymbols.fnIntervalSetYearMonth },
+    { "OCIJsonDomDocGet", (void**) &dpiOciSymbols.fnJsonDomDocGet },
+    { "OCIJsonTextBufferParse",
+            (void**) &dpiOciSymbols.fnJsonTextBufferParse },
+    { "OCILobArrayWrite", (void**) &dpiOciSymbols.fnLobArrayWrite },
+    { "OCILobClose", (void**) &dpiOciSymbols.fnLobClose },
+    { "OCILobCreateTemporary", (void**) &dpiOciSymbols.fnLobCreateTemporary },
+    { "OCILobFileExists", (void**) &dpiOciSymbols.fnLobFileExists },
+    { "OCILobFileGetName", (void**) &dpiOciSymbols.fnLobFileGetName },
+    { "OCILobFileSetName", (void**) &dpiOciSymbols.fnLobFileSetName },
+    { "OCILobFreeTemporary", (void**) &dpiOciSymbols.fnLobFreeTemporary },
+    { "OCILobGetChunkSize", (void**) &dpiOciSymbols.fnLobGetChunkSize },
+    { "OCILobGetLength2", (void**) &dpiOciSymbols.fnLobGetLength2 },
+    { "OCILobIsOpen", (void**) &dpiOciSymbols.fnLobIsOpen },
+    { "OCILobIsTemporary", (void**) &dpiOciSymbols.fnLobIsTemporary },
+    { "OCILobLocatorAssign", (void**) &dpiOciSymbols.fnLobLocatorAssign },
+    { "OCILobOpen", (void**) &dpiOciSymbols.fnLobOpen },
+    { "OCILobRead2", (void**) &dpiOciSymbols.fnLobRead2 },
+    { "OCILobTrim2", (void**) &dpiOciSymbols.fnLobTrim2 },
+    { "OCILobWrite2", (void**) &dpiOciSymbols.fnLobWrite2 },
+    { "OCIMemoryAlloc", (void**) &dpiOciSymbols.fnMemoryAlloc },
+    { "OCIMemoryFree", (void**) &dpiOciSymbols.fnMemoryFree },
+    { "OCINlsCharSetConvert", (void**) &dpiOciSymbols.fnNlsCharSetConvert },
+    { "OCINlsCharSetIdToName", (void**) &dpiOciSymbols.fnNlsCharSetIdToName },
+    { "OCINlsCharSetNameToId", (void**) &dpiOciSymbols.fnNlsCharSetNameToId },
+    { "OCINlsEnvironmentVariableGet",
+            (void**) &dpiOciSymbols.fnNlsEnvironmentVariableGet },
+    { "OCINlsNameMap", (void**) &dpiOciSymbols.fnNlsNameMap },
+    { "OCINlsNumericInfoGet", (void**) &dpiOciSymbols.fnNlsNumericInfoGet },
+    { "OCINumberFromInt", (void**) &dpiOciSymbols.fnNumberFromInt },
+    { "OCINumberFromReal", (void**) &dpiOciSymbols.fnNumberFromReal },
+    { "OCINumberToInt", (void**) &dpiOciSymbols.fnNumberToInt },
+    { "OCINumberToReal", (void**) &dpiOciSymbols.fnNumberToReal },
+    { "OCIObjectCopy", (void**) &dpiOciSymbols.fnObjectCopy },
+    { "OCIObjectFree", (void**) &dpiOciSymbols.fnObjectFree },
+    { "OCIObjectGetAttr", (void**) &dpiOciSymbols.fnObjectGetAttr },
+    { "OCIObjectGetInd", (void**) &dpiOciSymbols.fnObjectGetInd },
+    { "OCIObjectNew", (void**) &dpiOciSymbols.fnObjectNew },
+    { "OCIObjectPin", (void**) &dpiOciSymbols.fnObjectPin },
+    { "OCIObjectSetAttr", (void**) &dpiOciSymbols.fnObjectSetAttr },
+    { "OCIParamGet", (void**) &dpiOciSymbols.fnParamGet },
+    { "OCIPasswordChange", (void**) &dpiOciSymbols.fnPasswordChange },
+    { "OCIPing", (void**) &dpiOciSymbols.fnPing },
+    { "OCIRawAssignBytes", (void**) &dpiOciSymbols.fnRawAssignBytes },
+    { "OCIRawPtr", (void**) &dpiOciSymbols.fnRawPtr },
+    { "OCIRawResize", (void**) &dpiOciSymbols.fnRawResize },
+    { "OCIRawSize", (void**) &dpiOciSymbols.fnRawSize },
+    { "OCIRowidToChar", (void**) &dpiOciSymbols.fnRowidToChar },
+    { "OCIServerAttach", (void**) &dpiOciSymbols.fnServerAttach },
+    { "OCIServerDetach", (void**) &dpiOciSymbols.fnServerDetach },
+    { "OCIServerRelease", (void**) &dpiOciSymbols.fnServerRelease },
+    { "OCIServerRelease2", (void**) &dpiOciSymbols.fnServerRelease2 },
+    { "OCISessionBegin", (void**) &dpiOciSymbols.fnSessionBegin },
+    { "OCISessionEnd", (void**) &dpiOciSymbols.fnSessionEnd },
+    { "OCISessionGet", (void**) &dpiOciSymbols.fnSessionGet },
+    { "OCISessionPoolCreate", (void**) &dpiOciSymbols.fnSessionPoolCreate },
+    { "OCISessionPoolDestroy", (void**) &dpiOciSymbols.fnSessionPoolDestroy },
+    { "OCISessionRelease", (void**) &dpiOciSymbols.fnSessionRelease },
+    { "OCIShardingKeyColumnAdd",
+            (void**) &dpiOciSymbols.fnShardingKeyColumnAdd },
+    { "OCIStmtExecute", (void**) &dpiOciSymbols.fnStmtExecute },
+    { "OCISodaBulkInsert", (void**) &dpiOciSymbols.fnSodaBulkInsert },
+    { "OCISodaBulkInsertAndGet",
+            (void**) &dpiOciSymbols.fnSodaBulkInsertAndGet },
+    { "OCISodaBulkInsertAndGetWithOpts",
+            (void**) &dpiOciSymbols.fnSodaBulkInsertAndGetWithOpts },
+    { "OCISodaCollCreateWithMetadata",
+            (void**) &dpiOciSymbols.fnSodaCollCreateWithMetadata },
+    { "OCISodaCollDrop", (void**) &dpiOciSymbols.fnSodaCollDrop },
+    { "OCISodaCollGetNext", (void**) &dpiOciSymbols.fnSodaCollGetNext },
+    { "OCISodaCollList", (void**) &dpiOciSymbols.fnSodaCollList },
+    { "OCISodaCollOpen", (void**) &dpiOciSymbols.fnSodaCollOpen },
+    { "OCISodaCollTruncate", (void**) &dpiOciSymbols.fnSodaCollTruncate },
+    { "OCISodaDataGuideGet", (void**) &dpiOciSymbols.fnSodaDataGuideGet },
+    { "OCISodaDocCount", (void**) &dpiOciSymbols.fnSodaDocCount },
+    { "OCISodaDocGetNext", (void**) &dpiOciSymbols.fnSodaDocGetNext },
+    { "OCISodaFind", (void**) &dpiOciSymbols.fnSodaFind },
+    { "OCISodaFindOne", (void**) &dpiOciSymbols.fnSodaFindOne },
+    { "OCISodaIndexCreate", (void**) &dpiOciSymbols.fnSodaIndexCreate },
+    { "OCISodaIndexDrop", (void**) &dpiOciSymbols.fnSodaIndexDrop },
+    { "OCISodaIndexList", (void**) &dpiOciSymbols.fnSodaIndexList },
+    { "OCISodaInsert", (void**) &dpiOciSymbols.fnSodaInsert },
+    { "OCISodaInsertAndGet", (void**) &dpiOciSymbols.fnSodaInsertAndGet },
+    { "OCISodaInsertAndGetWithOpts",
+            (void**) &dpiOciSymbols.fnSodaInsertAndGetWithOpts },
+    { "OCISodaOperKeysSet", (void**) &dpiOciSymbols.fnSodaOperKeysSet },
+    { "OCISodaRemove", (void**) &dpiOciSymbols.fnSodaRemove },
+    { "OCISodaReplOne", (void**) &dpiOciSymbols.fnSodaReplOne },
+    { "OCISodaReplOneAndGet", (void**) &dpiOciSymbols.fnSodaReplOneAndGet },
+    { "OCISodaSave", (void**) &dpiOciSymbols.fnSodaSave },
+    { "OCISodaSaveAndGet", (void**) &dpiOciSymbols.fnSodaSaveAndGet },
+    { "OCISodaSaveAndGetWithOpts",
+            (void**) &dpiOciSymbols.fnSodaSaveAndGetWithOpts },
+    { "OCIStmtFetch2", (void**) &dpiOciSymbols.fnStmtFetch2 },
+    { "OCIStmtGetBindInfo", (void**) &dpiOciSymbols.fnStmtGetBindInfo },
+    { "OCIStmtGetNextResult", (void**) &dpiOciSymbols.fnStmtGetNextResult },
+    { "OCIStmtPrepare2", (void**) &dpiOciSymbols.fnStmtPrepare2 },
+    { "OCIStmtRelease", (void**) &dpiOciSymbols.fnStmtRelease },
+    { "OCIStringAssignText", (void**) &dpiOciSymbols.fnStringAssignText },
+    { "OCIStringPtr", (void**) &dpiOciSymbols.fnStringPtr },
+    { "OCIStringResize", (void**) &dpiOciSymbols.fnStringResize },
+    { "OCIStringSize", (void**) &dpiOciSymbols.fnStringSize },
+    { "OCISubscriptionRegister",
+            (void**) &dpiOciSymbols.fnSubscriptionRegister },
+    { "OCISubscriptionUnRegister",
+            (void**) &dpiOciSymbols.fnSubscriptionUnRegister },
+    { "OCITableDelete", (void**) &dpiOciSymbols.fnTableDelete },
+    { "OCITableExists", (void**) &dpiOciSymbols.fnTableExists },
+    { "OCITableFirst", (void**) &dpiOciSymbols.fnTableFirst },
+    { "OCITableLast", (void**) &dpiOciSymbols.fnTableLast },
+    { "OCITableNext", (void**) &dpiOciSymbols.fnTableNext },
+    { "OCITablePrev", (void**) &dpiOciSymbols.fnTablePrev },
+    { "OCITableSize", (void**) &dpiOciSymbols.fnTableSize },
+    { "OCIThreadKeyDestroy", (void**) &dpiOciSymbols.fnThreadKeyDestroy },
+    { "OCIThreadKeyGet", (void**) &dpiOciSymbols.fnThreadKeyGet },
+    { "OCIThreadKeyInit", (void**) &dpiOciSymbols.fnThreadKeyInit },
+    { "OCIThreadKeySet", (void**) &dpiOciSymbols.fnThreadKeySet },
+    { "OCIThreadProcessInit", (void**) &dpiOciSymbols.fnThreadProcessInit },
+    { "OCITransCommit", (void**) &dpiOciSymbols.fnTransCommit },
+    { "OCITransDetach", (void**) &dpiOciSymbols.fnTransDetach },
+    { "OCITransForget", (void**) &dpiOciSymbols.fnTransForget },
+    { "OCITransPrepare", (void**) &dpiOciSymbols.fnTransPrepare },
+    { "OCITransRollback", (void**) &dpiOciSymbols.fnTransRollback },
+    { "OCITransStart", (void**) &dpiOciSymbols.fnTransStart },
+    { "OCITypeByFullName", (void**) &dpiOciSymbols.fnTypeByFullName },
+    { "OCITypeByName", (void**) &dpiOciSymbols.fnTypeByName },
+    { "OCIVectorFromArray", (void**) &dpiOciSymbols.fnVectorFromArray },
+    { "OCIVectorFromSparseArray",
+            (void**) &dpiOciSymbols.fnVectorFromSparseArray },
+    { "OCIVectorToArray", (void**) &dpiOciSymbols.fnVectorToArray },
+    { "OCIVectorToSparseArray",
+            (void**) &dpiOciSymbols.fnVectorToSparseArray },
+    { NULL, NULL }
+};
+
+
 //-----------------------------------------------------------------------------
 // dpiOci__allocateMem() [INTERNAL]
 //   Wrapper for OCI allocation of memory, only used when debugging memory
@@ -765,7 +978,8 @@ int dpiOci__appCtxSet(dpiConn *conn, dpiAppContext *appContext,
 
 //-----------------------------------------------------------------------------
 // dpiOci__aqDeq() [INTERNAL]
-//   Wrapper for OCIAQDeq().
+//   Wrapper for OCIAQDeq(). The transaction state tracked by the client is no
+// longer known once this is called.
 //-----------------------------------------------------------------------------
 int dpiOci__aqDeq(dpiConn *conn, const char *queueName, void *options,
         void *msgProps, void *payloadType, void **payload, void **payloadInd,
@@ -775,6 +989,7 @@ int dpiOci__aqDeq(dpiConn *conn, const char *queueName, void *options,
 
     DPI_OCI_LOAD_SYMBOL("OCIAQDeq", dpiOciSymbols.fnAqDeq)
     DPI_OCI_ENSURE_ERROR_HANDLE(error)
+    conn->transactionState = DPI_TXN_STATE_UNKNOWN;
     status = (*dpiOciSymbols.fnAqDeq)(conn->handle, error->handle, queueName,
             options, msgProps, payloadType, payload, payloadInd, msgId,
             DPI_OCI_DEFAULT);
@@ -784,7 +999,8 @@ int dpiOci__aqDeq(dpiConn *conn, const char *queueName, void *options,
 
 //-----------------------------------------------------------------------------
 // dpiOci__aqDeqArray() [INTERNAL]
-//   Wrapper for OCIAQDeqArray().
+//   Wrapper for OCIAQDeqArray(). The transaction state tracked by the client
+// is no longer known once this is called.
 //-----------------------------------------------------------------------------
 int dpiOci__aqDeqArray(dpiConn *conn, const char *queueName, void *options,
         uint32_t *numIters, void **msgProps, void *payloadType, void **payload,
@@ -794,6 +1010,7 @@ int dpiOci__aqDeqArray(dpiConn *conn, const char *queueName, void *options,
 
     DPI_OCI_LOAD_SYMBOL("OCIAQDeqArray", dpiOciSymbols.fnAqDeqArray)
     DPI_OCI_ENSURE_ERROR_HANDLE(error)
+    conn->transactionState = DPI_TXN_STATE_UNKNOWN;
     status = (*dpiOciSymbols.fnAqDeqArray)(conn->handle, error->handle,
             queueName, options, numIters, msgProps, payloadType, payload,
             payloadInd, msgId, NULL, NULL, DPI_OCI_DEFAULT);
@@ -803,7 +1020,8 @@ int dpiOci__aqDeqArray(dpiConn *conn, const char *queueName, void *options,
 
 //-----------------------------------------------------------------------------
 // dpiOci__aqEnq() [INTERNAL]
-//   Wrapper for OCIAQEnq().
+//   Wrapper for OCIAQEnq(). The transaction state tracked by the client is no
+// longer known once this is called.
 //-----------------------------------------------------------------------------
 int dpiOci__aqEnq(dpiConn *conn, const char *queueName, void *options,
         void *msgProps, void *payloadType, void **payload, void **payloadInd,
@@ -813,6 +1031,7 @@ int dpiOci__aqEnq(dpiConn *conn, const char *queueName, void *options,
 
     DPI_OCI_LOAD_SYMBOL("OCIAQEnq", dpiOciSymbols.fnAqEnq)
     DPI_OCI_ENSURE_ERROR_HANDLE(error)
+    conn->transactionState = DPI_TXN_STATE_UNKNOWN;
     status = (*dpiOciSymbols.fnAqEnq)(conn->handle, error->handle, queueName,
             options, msgProps, payloadType, payload, payloadInd, msgId,
             DPI_OCI_DEFAULT);
@@ -822,7 +1041,8 @@ int dpiOci__aqEnq(dpiConn *conn, const char *queueName, void *options,
 
 //-----------------------------------------------------------------------------
 // dpiOci__aqEnqArray() [INTERNAL]
-//   Wrapper for OCIAQEnqArray().
+//   Wrapper for OCIAQEnqArray(). The transaction state tracked by the client
+// is no longer known once this is called.
 //-----------------------------------------------------------------------------
 int dpiOci__aqEnqArray(dpiConn *conn, const char *queueName, void *options,
         uint32_t *numIters, void **msgProps, void *payloadType, void **payload,
@@ -832,6 +1052,7 @@ int dpiOci__aqEnqArray(dpiConn *conn, const char *queueName, void *options,
 
     DPI_OCI_LOAD_SYMBOL("OCIAQEnqArray", dpiOciSymbols.fnAqEnqArray)
     DPI_OCI_ENSURE_ERROR_HANDLE(error)
+    conn->transactionState = DPI_TXN_STATE_UNKNOWN;
     status = (*dpiOciSymbols.fnAqEnqArray)(conn->handle, error->handle,
             queueName, options, numIters, msgProps, payloadType, payload,
             payloadInd, msgId, NULL, NULL, DPI_OCI_DEFAULT);
@@ -917,6 +1138,25 @@ int dpiOci__attrSet(void *handle, uint32_t handleType, void *ptr,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiOci__bindArrayOfStruct() [INTERNAL]
+//   Wrapper for OCIBindArrayOfStruct().
+//-----------------------------------------------------------------------------
+int dpiOci__bindArrayOfStruct(dpiStmt *stmt, dpiStructMapField *field,
+        uint32_t structSize, dpiError *error)
+{
+    int status;
+
+    DPI_OCI_LOAD_SYMBOL("OCIBindArrayOfStruct",
+            dpiOciSymbols.fnBindArrayOfStruct)
+    DPI_OCI_ENSURE_ERROR_HANDLE(error)
+    status = (*dpiOciSymbols.fnBindArrayOfStruct)(field->handle,
+            error->handle, field->valueSkip, structSize, structSize, 0);
+    DPI_OCI_CHECK_AND_RETURN(error, status, stmt->conn,
+            "bind array of struct");
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiOci__bindByName2() [INTERNAL]
 //   Wrapper for OCIBindByName2().
@@ -991,6 +1231,26 @@ int dpiOci__bindDynamic(dpiVar *var, void *bindHandle, dpiError *error)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiOci__bindStructField() [INTERNAL]
+//   Wrapper for OCIBindByPos2() used for a field of a caller-owned struct.
+//-----------------------------------------------------------------------------
+int dpiOci__bindStructField(dpiStmt *stmt, dpiStructMapField *field,
+        dpiError *error)
+{
+    uint32_t mode = DPI_OCI_DEFAULT_BIND_MODE(stmt);
+    int status;
+
+    DPI_OCI_LOAD_SYMBOL("OCIBindByPos2", dpiOciSymbols.fnBindByPos2)
+    DPI_OCI_ENSURE_ERROR_HANDLE(error)
+    status = (*dpiOciSymbols.fnBindByPos2)(stmt->handle, &field->handle,
+            error->handle, field->pos, field->value, field->valueSize,
+            field->oracleType, field->indicator, field->length, NULL, 0, NULL,
+            mode);
+    DPI_OCI_CHECK_AND_RETURN(error, status, stmt->conn, "bind struct field");
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiOci__bindObject() [INTERNAL]
 //   Wrapper for OCIBindObject().
@@ -1305,6 +1565,25 @@ int dpiOci__dbStartup(dpiConn *conn, void *adminHandle, uint32_t mode,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiOci__defineArrayOfStruct() [INTERNAL]
+//   Wrapper for OCIDefineArrayOfStruct().
+//-----------------------------------------------------------------------------
+int dpiOci__defineArrayOfStruct(dpiStmt *stmt, dpiStructMapField *field,
+        uint32_t structSize, dpiError *error)
+{
+    int status;
+
+    DPI_OCI_LOAD_SYMBOL("OCIDefineArrayOfStruct",
+            dpiOciSymbols.fnDefineArrayOfStruct)
+    DPI_OCI_ENSURE_ERROR_HANDLE(error)
+    status = (*dpiOciSymbols.fnDefineArrayOfStruct)(field->handle,
+            error->handle, field->valueSkip, structSize, structSize, 0);
+    DPI_OCI_CHECK_AND_RETURN(error, status, stmt->conn,
+            "define array of struct");
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiOci__defineByPos2() [INTERNAL]
 //   Wrapper for OCIDefineByPos2().
@@ -1362,6 +1641,26 @@ int dpiOci__defineObject(dpiVar *var, void *defineHandle, dpiError *error)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiOci__defineStructField() [INTERNAL]
+//   Wrapper for OCIDefineByPos2() used for a field of a caller-owned struct.
+//-----------------------------------------------------------------------------
+int dpiOci__defineStructField(dpiStmt *stmt, dpiStructMapField *field,
+        dpiError *error)
+{
+    int status;
+
+    DPI_OCI_LOAD_SYMBOL("OCIDefineByPos2", dpiOciSymbols.fnDefineByPos2)
+    DPI_OCI_ENSURE_ERROR_HANDLE(error)
+    status = (*dpiOciSymbols.fnDefineByPos2)(stmt->handle, &field->handle,
+            error->handle, field->pos, field->value, field->valueSize,
+            field->oracleType, field->indicator, field->length, NULL,
+            DPI_OCI_DEFAULT);
+    DPI_OCI_CHECK_AND_RETURN(error, status, stmt->conn,
+            "define struct field");
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiOci__describeAny() [INTERNAL]
 //   Wrapper for OCIDescribeAny().
@@ -2123,6 +2422,38 @@ static int dpiOci__loadLibWithDir(dpiOciLoadLibParams *loadParams,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiOci__loadAllSymbols() [INTERNAL]
+//   Resolve all of the OCI symbols used by ODPI-C at once, rather than on
+// first use, so that the cost of looking up symbols is not incurred at some
+// unpredictable later time. Symbols that cannot be found are not considered
+// an error since they are only needed for features that are not available in
+// the version of the Oracle Client library that was loaded; if a string list
+// is supplied, the names of these symbols are added to it.
+//-----------------------------------------------------------------------------
+int dpiOci__loadAllSymbols(dpiStringList *missingSymbols, dpiError *error)
+{
+    const dpiOciSymbolInfo *info;
+    uint32_t numAllocated = 0;
+
+    for (info = dpiOciSymbolTable; info->name; info++) {
+        if (*info->symbol || dpiOci__loadSymbol(info->name, info->symbol,
+                NULL) == DPI_SUCCESS)
+            continue;
+        if (dpiDebugLevel & DPI_DEBUG_LEVEL_LOAD_LIB)
+            dpiDebug__print("symbol %s not found\n", info->name);
+        if (missingSymbols && dpiStringList__addElement(missingSymbols,
+                info->name, (uint32_t) strlen(info->name), &numAllocated,
+                error) < 0) {
+            dpiStringList__free(missingSymbols);
+            return DPI_FAILURE;
+        }
+    }
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiOci__loadLib() [INTERNAL]
 //   Load the OCI library.
@@ -2365,6 +2696,34 @@ static int dpiOci__loadSymbol(const char *symbolName, void **symbol,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiOci__lobArrayWrite() [INTERNAL]
+//   Wrapper for OCILobArrayWrite(). All of the LOBs must use the same
+// character set form. On failure, the number of iterations is set by OCI to
+// the iteration that failed. The transaction state tracked by the client is
+// no longer known once this is called.
+//-----------------------------------------------------------------------------
+int dpiOci__lobArrayWrite(dpiConn *conn, uint32_t *numIters, void **locators,
+        uint64_t *byteAmounts, uint64_t *charAmounts, uint64_t *offsets,
+        void **buffers, uint64_t *bufferLengths, uint8_t charsetForm,
+        dpiError *error)
+{
+    uint16_t charsetId;
+    int status;
+
+    DPI_OCI_LOAD_SYMBOL("OCILobArrayWrite", dpiOciSymbols.fnLobArrayWrite)
+    DPI_OCI_ENSURE_ERROR_HANDLE(error)
+    conn->transactionState = DPI_TXN_STATE_UNKNOWN;
+    charsetId = (charsetForm == DPI_SQLCS_NCHAR) ? conn->env->ncharsetId :
+            conn->env->charsetId;
+    status = (*dpiOciSymbols.fnLobArrayWrite)(conn->handle, error->handle,
+            numIters, locators, byteAmounts, charAmounts, offsets, buffers,
+            bufferLengths, DPI_OCI_ONE_PIECE, NULL, NULL, charsetId,
+            charsetForm);
+    DPI_OCI_CHECK_AND_RETURN(error, status, conn, "write LOBs");
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiOci__lobClose() [INTERNAL]
 //   Wrapper for OCILobClose().
@@ -2609,7 +2968,8 @@ int dpiOci__lobRead2(dpiLob *lob, uint64_t offset, uint64_t *amountInBytes,
 
 //-----------------------------------------------------------------------------
 // dpiOci__lobTrim2() [INTERNAL]
-//   Wrapper for OCILobTrim2().
+//   Wrapper for OCILobTrim2(). The transaction state tracked by the client is
+// no longer known once this is called.
 //-----------------------------------------------------------------------------
 int dpiOci__lobTrim2(dpiLob *lob, uint64_t newLength, dpiError *error)
 {
@@ -2617,6 +2977,7 @@ int dpiOci__lobTrim2(dpiLob *lob, uint64_t newLength, dpiError *error)
 
     DPI_OCI_LOAD_SYMBOL("OCILobTrim2", dpiOciSymbols.fnLobTrim2)
     DPI_OCI_ENSURE_ERROR_HANDLE(error)
+    lob->conn->transactionState = DPI_TXN_STATE_UNKNOWN;
     status = (*dpiOciSymbols.fnLobTrim2)(lob->conn->handle, error->handle,
             lob->locator, newLength);
     if (status == DPI_OCI_INVALID_HANDLE)
@@ -2627,7 +2988,8 @@ int dpiOci__lobTrim2(dpiLob *lob, uint64_t newLength, dpiError *error)
 
 //-----------------------------------------------------------------------------
 // dpiOci__lobWrite2() [INTERNAL]
-//   Wrapper for OCILobWrite2().
+//   Wrapper for OCILobWrite2(). The transaction state tracked by the client is
+// no longer known once this is called.
 //-----------------------------------------------------------------------------
 int dpiOci__lobWrite2(dpiLob *lob, uint64_t offset, const char *value,
         uint64_t valueLength, dpiError *error)
@@ -2638,6 +3000,7 @@ int dpiOci__lobWrite2(dpiLob *lob, uint64_t offset, const char *value,
 
     DPI_OCI_LOAD_SYMBOL("OCILobWrite2", dpiOciSymbols.fnLobWrite2)
     DPI_OCI_ENSURE_ERROR_HANDLE(error)
+    lob->conn->transactionState = DPI_TXN_STATE_UNKNOWN;
     charsetId = (lob->type->charsetForm == DPI_SQLCS_NCHAR) ?
             lob->env->ncharsetId : lob->env->charsetId;
     status = (*dpiOciSymbols.fnLobWrite2)(lob->conn->handle, error->handle,
@@ -3894,15 +4257,15 @@ int dpiOci__sodaSaveAndGetWithOpts(dpiSodaColl *coll, void **handle,
 // dpiOci__stmtExecute() [INTERNAL]
 //   Wrapper for OCIStmtExecute().
 //-----------------------------------------------------------------------------
-int dpiOci__stmtExecute(dpiStmt *stmt, uint32_t numIters, uint32_t mode,
-        dpiError *error)
+int dpiOci__stmtExecute(dpiStmt *stmt, uint32_t numIters, uint32_t rowOffset,
+        uint32_t mode, dpiError *error)
 {
     int status;
 
     DPI_OCI_LOAD_SYMBOL("OCIStmtExecute", dpiOciSymbols.fnStmtExecute)
     DPI_OCI_ENSURE_ERROR_HANDLE(error)
     status = (*dpiOciSymbols.fnStmtExecute)(stmt->conn->handle, stmt->handle,
-            error->handle, numIters, 0, 0, 0, mode);
+            error->handle, numIters, rowOffset, 0, 0, mode);
     DPI_OCI_CHECK_AND_RETURN(error, status, stmt->conn, "execute");
 }
 
@@ -4035,6 +4398,32 @@ int dpiOci__stmtRelease(dpiStmt *stmt, const char *tag, uint32_t tagLength,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiOci__stmtSearchCache() [INTERNAL]
+//   Wrapper for OCIStmtPrepare2() which only searches the statement cache for
+// the SQL text. If the statement is not found in the cache, no error is
+// raised and the statement handle is left as NULL.
+//-----------------------------------------------------------------------------
+int dpiOci__stmtSearchCache(dpiStmt *stmt, const char *sql,
+        uint32_t sqlLength, int *found, dpiError *error)
+{
+    uint32_t mode = DPI_OCI_PREP2_CACHE_SEARCHONLY;
+    int status;
+
+    DPI_OCI_LOAD_SYMBOL("OCIStmtPrepare2", dpiOciSymbols.fnStmtPrepare2)
+    DPI_OCI_ENSURE_ERROR_HANDLE(error)
+    if (dpiUtils__checkClientVersion(stmt->env->versionInfo, 12, 2,
+            NULL) == DPI_SUCCESS)
+        mode |= DPI_OCI_PREP2_GET_SQL_ID;
+    status = (*dpiOciSymbols.fnStmtPrepare2)(stmt->conn->handle, &stmt->handle,
+            error->handle, sql, sqlLength, NULL, 0, DPI_OCI_NTV_SYNTAX, mode);
+    *found = !DPI_OCI_ERROR_OCCURRED(status);
+    if (!*found)
+        stmt->handle = NULL;
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiOci__stringAssignText() [INTERNAL]
 //   Wrapper for OCIStringAssignText().
@@ -124,6 +124,11 @@ static int dpiPool__create(dpiPool *pool, const char *userName,
         return dpiError__set(error, "check mixed credentials",
                 DPI_ERR_EXT_AUTH_WITH_CREDENTIALS);
 
+    // create the cache of sharding key descriptors used by connections
+    // acquired from the pool
+    if (dpiShardingKeyCache__create(&pool->shardingKeys, error) < 0)
+        return DPI_FAILURE;
+
     // create the session pool handle
     if (dpiOci__handleAlloc(pool->env->handle, &pool->handle,
             DPI_OCI_HTYPE_SPOOL, "allocate pool handle", error) < 0)
@@ -285,11 +290,15 @@ void dpiPool__free(dpiPool *pool, dpiError *error)
         dpiOci__sessionPoolDestroy(pool, DPI_OCI_SPD_FORCE, 0, error);
         pool->handle = NULL;
     }
+    if (pool->shardingKeys) {
+        dpiShardingKeyCache__free(pool->shardingKeys);
+        pool->shardingKeys = NULL;
+    }
     if (pool->env) {
         dpiEnv__free(pool->env, error);
         pool->env = NULL;
     }
-    dpiUtils__freeMemory(pool);
+    dpiGen__free(pool);
 }
 
 
@@ -518,6 +527,125 @@ int dpiPool_create(const dpiContext *context, const char *userName,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiPool_createScan() [PUBLIC]
+//   Create a scan of a table which is split into chunks that are fetched in
+// parallel by threads using connections acquired from the pool.
+//-----------------------------------------------------------------------------
+int dpiPool_createScan(dpiPool *pool, const dpiScanCreateParams *params,
+        dpiScan **scan)
+{
+    dpiError error;
+    int status;
+
+    // validate parameters
+    if (dpiPool__checkConnected(pool, __func__, &error) < 0)
+        return dpiGen__endPublicFn(pool, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(pool, params)
+    DPI_CHECK_PTR_NOT_NULL(pool, scan)
+    if (!params->tableName || params->tableNameLength == 0) {
+        dpiError__set(&error, "check table name",
+                DPI_ERR_NULL_POINTER_PARAMETER, "tableName");
+        return dpiGen__endPublicFn(pool, DPI_FAILURE, &error);
+    }
+    if (!params->columns && params->columnsLength > 0) {
+        dpiError__set(&error, "check columns", DPI_ERR_PTR_LENGTH_MISMATCH,
+                "columns");
+        return dpiGen__endPublicFn(pool, DPI_FAILURE, &error);
+    }
+    if (!params->whereClause && params->whereClauseLength > 0) {
+        dpiError__set(&error, "check where clause",
+                DPI_ERR_PTR_LENGTH_MISMATCH, "whereClause");
+        return dpiGen__endPublicFn(pool, DPI_FAILURE, &error);
+    }
+
+    // the split mode must be valid and a key column is required when the
+    // table is split by ranges of key values
+    switch (params->splitMode) {
+        case DPI_SCAN_SPLIT_ROWID:
+        case DPI_SCAN_SPLIT_PARTITION:
+            break;
+        case DPI_SCAN_SPLIT_KEY_RANGE:
+            if (!params->keyColumn || params->keyColumnLength == 0) {
+                dpiError__set(&error, "check key column",
+                        DPI_ERR_NULL_POINTER_PARAMETER, "keyColumn");
+                return dpiGen__endPublicFn(pool, DPI_FAILURE, &error);
+            }
+            break;
+        default:
+            dpiError__set(&error, "check split mode",
+                    DPI_ERR_SCAN_INVALID_SPLIT_MODE, params->splitMode);
+            return dpiGen__endPublicFn(pool, DPI_FAILURE, &error);
+    }
+
+    // blocks of rows are handed from the threads performing the scan to the
+    // caller so the pool must have been created in threaded mode
+    if (!pool->env->threaded) {
+        dpiError__set(&error, "check threaded", DPI_ERR_SCAN_NOT_THREADED);
+        return dpiGen__endPublicFn(pool, DPI_FAILURE, &error);
+    }
+
+    status = dpiScan__create(pool, params, scan, &error);
+    return dpiGen__endPublicFn(pool, status, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiPool_executeUnitOfWork() [PUBLIC]
+//   Acquire a connection from the pool, execute a single statement on it,
+// commit if the execution succeeds and release the connection back to the
+// pool. If any error takes place, the connection is released without
+// committing, which rolls back any changes that were made.
+//-----------------------------------------------------------------------------
+int dpiPool_executeUnitOfWork(dpiPool *pool, const dpiUnitOfWork *unit,
+        uint64_t *rowCount)
+{
+    dpiErrorBuffer localErrorBuffer;
+    dpiConnCreateParams params;
+    dpiError error, localError;
+    dpiConn *conn;
+    int status;
+
+    // validate parameters
+    if (dpiPool__checkConnected(pool, __func__, &error) < 0)
+        return dpiGen__endPublicFn(pool, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(pool, unit)
+    if (!unit->sql || unit->sqlLength == 0) {
+        dpiError__set(&error, "check SQL", DPI_ERR_NULL_POINTER_PARAMETER,
+                "sql");
+        return dpiGen__endPublicFn(pool, DPI_FAILURE, &error);
+    }
+    if (!unit->tag && unit->tagLength > 0) {
+        dpiError__set(&error, "check tag", DPI_ERR_PTR_LENGTH_MISMATCH,
+                "tag");
+        return dpiGen__endPublicFn(pool, DPI_FAILURE, &error);
+    }
+    if (!unit->binds && unit->numBinds > 0) {
+        dpiError__set(&error, "check binds", DPI_ERR_PTR_LENGTH_MISMATCH,
+                "binds");
+        return dpiGen__endPublicFn(pool, DPI_FAILURE, &error);
+    }
+
+    // acquire a connection with the default parameters, execute the statement
+    // and release the connection; the statement holds no reference to the
+    // connection so releasing it returns the session to the pool immediately
+    dpiContext__initConnCreateParams(&params);
+    if (dpiPool__acquireConnection(pool, NULL, 0, NULL, 0, &params, &conn,
+            &error) < 0)
+        return dpiGen__endPublicFn(pool, DPI_FAILURE, &error);
+    status = dpiStmt__executeUnitOfWork(conn, unit, rowCount, &error);
+
+    // release the connection; a separate error buffer is used so that any
+    // error raised during execution is the one returned
+    localError.buffer = &localErrorBuffer;
+    localError.handle = error.handle;
+    localError.env = error.env;
+    dpiGen__setRefCount(conn, &localError, -1);
+    error.handle = localError.handle;
+    return dpiGen__endPublicFn(pool, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiPool_getBusyCount() [PUBLIC]
 //   Return the pool's busy count.
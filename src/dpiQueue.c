@@ -414,7 +414,7 @@ void dpiQueue__free(dpiQueue *queue, dpiError *error)
         queue->enqOptions = NULL;
     }
     dpiQueue__freeBuffer(queue, error);
-    dpiUtils__freeMemory(queue);
+    dpiGen__free(queue);
 }
 
 
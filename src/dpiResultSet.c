@@ -0,0 +1,511 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// dpiResultSet.c
+//   Implementation of materialized result sets. The rows of a query are copied
+// to the client in columnar segments, one for each fetch. Segments are kept in
+// memory until the memory budget of the result set is exhausted and are then
+// written to a temporary file which is mapped into memory once all of the rows
+// have been fetched. The result set holds no reference to the statement so it
+// remains usable after the statement and connection have been released.
+//
+// Each segment starts with the offset of the region of each column within the
+// segment. A column region consists of one null indicator for each row
+// followed, for fixed size values, by the array of values or, for bytes
+// values, by the offset of each value (plus the end offset of the last value)
+// and the concatenated values. All offsets are aligned to 8 bytes so that the
+// values can be accessed in place, whether in memory or in the mapped file.
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/mman.h>
+#endif
+
+// the number of segments allocated at a time
+#define DPI_RESULT_SET_SEGMENT_INCREMENT    16
+
+// round a size up to a multiple of 8 bytes
+#define DPI_RESULT_SET_ALIGN(size)          (((size) + 7) & ~((uint64_t) 7))
+
+// forward declarations of internal functions only used in this file
+static int dpiResultSet__spill(dpiResultSet *resultSet,
+        dpiResultSetSegment *segment, dpiError *error);
+
+
+//-----------------------------------------------------------------------------
+// dpiResultSet__addRows() [INTERNAL]
+//   Copy the specified rows from the buffers of the query variables into a new
+// segment of the result set. The segment is retained in memory if it fits
+// within the memory budget; otherwise, it is written to the temporary file.
+//-----------------------------------------------------------------------------
+int dpiResultSet__addRows(dpiResultSet *resultSet, dpiVar **vars,
+        uint32_t startRow, uint32_t numRows, dpiError *error)
+{
+    uint64_t size, *offsets, *valueOffsets, valueOffset;
+    dpiResultSetSegment *segment, *tempSegments;
+    uint32_t i, j, numAllocated;
+    dpiResultSetColumn *column;
+    dpiData *data;
+    char *ptr;
+
+    // ensure there is space for another segment
+    if (resultSet->numSegments == resultSet->allocatedSegments) {
+        numAllocated = resultSet->allocatedSegments +
+                DPI_RESULT_SET_SEGMENT_INCREMENT;
+        if (dpiUtils__allocateMemory(numAllocated,
+                sizeof(dpiResultSetSegment), 1, "allocate segments",
+                (void**) &tempSegments, error) < 0)
+            return DPI_FAILURE;
+        if (resultSet->segments) {
+            memcpy(tempSegments, resultSet->segments,
+                    resultSet->numSegments * sizeof(dpiResultSetSegment));
+            dpiUtils__freeMemory(resultSet->segments);
+        }
+        resultSet->segments = tempSegments;
+        resultSet->allocatedSegments = numAllocated;
+    }
+
+    // determine the size of the segment
+    size = DPI_RESULT_SET_ALIGN(resultSet->numColumns * sizeof(uint64_t));
+    for (i = 0; i < resultSet->numColumns; i++) {
+        column = &resultSet->columns[i];
+        size += DPI_RESULT_SET_ALIGN(numRows);
+        if (column->valueSize > 0) {
+            size += DPI_RESULT_SET_ALIGN((uint64_t) numRows *
+                    column->valueSize);
+            continue;
+        }
+        size += ((uint64_t) numRows + 1) * sizeof(uint64_t);
+        valueOffset = 0;
+        for (j = 0; j < numRows; j++) {
+            data = &vars[i]->buffer.externalData[startRow + j];
+            if (!data->isNull)
+                valueOffset += data->value.asBytes.length;
+        }
+        size += DPI_RESULT_SET_ALIGN(valueOffset);
+    }
+    if ((uint64_t) (size_t) size != size)
+        return dpiError__set(error, "check segment size", DPI_ERR_NO_MEMORY);
+
+    // allocate the segment
+    segment = &resultSet->segments[resultSet->numSegments];
+    memset(segment, 0, sizeof(dpiResultSetSegment));
+    if (dpiUtils__allocateMemory(1, (size_t) size, 1, "allocate segment",
+            (void**) &segment->data, error) < 0)
+        return DPI_FAILURE;
+    segment->firstRow = resultSet->numRows;
+    segment->numRows = numRows;
+    segment->size = size;
+    resultSet->numSegments++;
+
+    // populate the regions of each column
+    offsets = (uint64_t*) segment->data;
+    size = DPI_RESULT_SET_ALIGN(resultSet->numColumns * sizeof(uint64_t));
+    for (i = 0; i < resultSet->numColumns; i++) {
+        column = &resultSet->columns[i];
+        offsets[i] = size;
+        ptr = segment->data + size;
+        for (j = 0; j < numRows; j++)
+            ptr[j] = (char) vars[i]->buffer.externalData[startRow + j].isNull;
+        size += DPI_RESULT_SET_ALIGN(numRows);
+        ptr = segment->data + size;
+        if (column->valueSize > 0) {
+            for (j = 0; j < numRows; j++) {
+                data = &vars[i]->buffer.externalData[startRow + j];
+                if (!data->isNull)
+                    memcpy(ptr + (size_t) j * column->valueSize,
+                            &data->value, column->valueSize);
+            }
+            size += DPI_RESULT_SET_ALIGN((uint64_t) numRows *
+                    column->valueSize);
+            continue;
+        }
+        valueOffsets = (uint64_t*) ptr;
+        ptr += ((size_t) numRows + 1) * sizeof(uint64_t);
+        valueOffset = 0;
+        for (j = 0; j < numRows; j++) {
+            data = &vars[i]->buffer.externalData[startRow + j];
+            valueOffsets[j] = valueOffset;
+            if (data->isNull || data->value.asBytes.length == 0)
+                continue;
+            memcpy(ptr + valueOffset, data->value.asBytes.ptr,
+                    data->value.asBytes.length);
+            valueOffset += data->value.asBytes.length;
+        }
+        valueOffsets[numRows] = valueOffset;
+        size += ((uint64_t) numRows + 1) * sizeof(uint64_t) +
+                DPI_RESULT_SET_ALIGN(valueOffset);
+    }
+    resultSet->numRows += numRows;
+
+    // retain the segment in memory if it fits within the budget; otherwise,
+    // write it to the temporary file
+    if (resultSet->memoryUsed + segment->size <= resultSet->maxMemory) {
+        resultSet->memoryUsed += segment->size;
+        return DPI_SUCCESS;
+    }
+    return dpiResultSet__spill(resultSet, segment, error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiResultSet__allocate() [INTERNAL]
+//   Allocate and initialize a result set for the query variables of the
+// statement. Only values which are self-contained can be materialized; values
+// which refer to other handles (such as LOBs and objects) require the
+// connection and are rejected. A reference is retained to the pool from which
+// the connection was acquired or, for standalone connections, to the
+// connection itself, since the environment used by the result set belongs to
+// them.
+//-----------------------------------------------------------------------------
+int dpiResultSet__allocate(dpiStmt *stmt, uint64_t maxMemory,
+        dpiResultSet **resultSet, dpiError *error)
+{
+    dpiResultSetColumn *column;
+    dpiResultSet *temp;
+    const char *encoding;
+    uint32_t i;
+    dpiVar *var;
+
+    // allocate the result set
+    if (dpiGen__allocate(DPI_HTYPE_RESULT_SET, stmt->env, (void**) &temp,
+            error) < 0)
+        return DPI_FAILURE;
+    temp->maxMemory = maxMemory;
+    if (stmt->conn->pool)
+        temp->owner = stmt->conn->pool;
+    else temp->owner = stmt->conn;
+    dpiGen__setRefCount(temp->owner, error, 1);
+
+    // describe the columns
+    temp->numColumns = stmt->numQueryVars;
+    if (dpiUtils__allocateMemory(temp->numColumns, sizeof(dpiResultSetColumn),
+            1, "allocate columns", (void**) &temp->columns, error) < 0) {
+        dpiResultSet__free(temp, error);
+        return DPI_FAILURE;
+    }
+    for (i = 0; i < temp->numColumns; i++) {
+        var = stmt->queryVars[i];
+        column = &temp->columns[i];
+        column->nativeTypeNum = var->nativeTypeNum;
+        switch (var->nativeTypeNum) {
+            case DPI_NATIVE_TYPE_INT64:
+            case DPI_NATIVE_TYPE_UINT64:
+                column->valueSize = sizeof(int64_t);
+                break;
+            case DPI_NATIVE_TYPE_FLOAT:
+                column->valueSize = sizeof(float);
+                break;
+            case DPI_NATIVE_TYPE_DOUBLE:
+                column->valueSize = sizeof(double);
+                break;
+            case DPI_NATIVE_TYPE_BOOLEAN:
+                column->valueSize = sizeof(int);
+                break;
+            case DPI_NATIVE_TYPE_TIMESTAMP:
+                column->valueSize = sizeof(dpiTimestamp);
+                break;
+            case DPI_NATIVE_TYPE_INTERVAL_DS:
+                column->valueSize = sizeof(dpiIntervalDS);
+                break;
+            case DPI_NATIVE_TYPE_INTERVAL_YM:
+                column->valueSize = sizeof(dpiIntervalYM);
+                break;
+            case DPI_NATIVE_TYPE_BYTES:
+                encoding = (var->type->charsetForm == DPI_SQLCS_IMPLICIT) ?
+                        stmt->env->encoding : stmt->env->nencoding;
+                memcpy(column->encoding, encoding,
+                        sizeof(column->encoding));
+                break;
+            default:
+                dpiError__set(error, "check native type",
+                        DPI_ERR_RESULT_SET_TYPE_NOT_SUPPORTED,
+                        var->nativeTypeNum, i + 1);
+                dpiResultSet__free(temp, error);
+                return DPI_FAILURE;
+        }
+    }
+
+    *resultSet = temp;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiResultSet__complete() [INTERNAL]
+//   Complete the result set once all of the rows have been added by mapping
+// the temporary file into memory, if any segments were written to it.
+//-----------------------------------------------------------------------------
+int dpiResultSet__complete(dpiResultSet *resultSet, dpiError *error)
+{
+#ifdef _WIN32
+    HANDLE fileHandle;
+#else
+    void *mappedData;
+#endif
+
+    if (!resultSet->spillFile)
+        return DPI_SUCCESS;
+    if (fflush(resultSet->spillFile) != 0)
+        return dpiError__setFromOS(error, "flush temporary file");
+    if ((uint64_t) (size_t) resultSet->spillFileSize !=
+            resultSet->spillFileSize)
+        return dpiError__set(error, "check temporary file size",
+                DPI_ERR_NO_MEMORY);
+
+#ifdef _WIN32
+    fileHandle = (HANDLE) _get_osfhandle(_fileno(resultSet->spillFile));
+    resultSet->mapping = CreateFileMapping(fileHandle, NULL, PAGE_READONLY,
+            0, 0, NULL);
+    if (!resultSet->mapping)
+        return dpiError__setFromOS(error, "create file mapping");
+    resultSet->mappedData = (char*) MapViewOfFile(resultSet->mapping,
+            FILE_MAP_READ, 0, 0, 0);
+    if (!resultSet->mappedData)
+        return dpiError__setFromOS(error, "map temporary file");
+#else
+    mappedData = mmap(NULL, (size_t) resultSet->spillFileSize, PROT_READ,
+            MAP_SHARED, fileno(resultSet->spillFile), 0);
+    if (mappedData == MAP_FAILED)
+        return dpiError__setFromOS(error, "map temporary file");
+    resultSet->mappedData = (char*) mappedData;
+#endif
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiResultSet__free() [INTERNAL]
+//   Free the memory associated with the result set, unmap and close the
+// temporary file, if one was created, and release the reference to the pool
+// or connection.
+//-----------------------------------------------------------------------------
+void dpiResultSet__free(dpiResultSet *resultSet, dpiError *error)
+{
+    uint32_t i;
+
+    if (resultSet->mappedData) {
+#ifdef _WIN32
+        UnmapViewOfFile(resultSet->mappedData);
+#else
+        munmap(resultSet->mappedData, (size_t) resultSet->spillFileSize);
+#endif
+        resultSet->mappedData = NULL;
+    }
+#ifdef _WIN32
+    if (resultSet->mapping) {
+        CloseHandle(resultSet->mapping);
+        resultSet->mapping = NULL;
+    }
+#endif
+    if (resultSet->spillFile) {
+        fclose(resultSet->spillFile);
+        resultSet->spillFile = NULL;
+    }
+    if (resultSet->segments) {
+        for (i = 0; i < resultSet->numSegments; i++) {
+            if (resultSet->segments[i].data)
+                dpiUtils__freeMemory(resultSet->segments[i].data);
+        }
+        dpiUtils__freeMemory(resultSet->segments);
+        resultSet->segments = NULL;
+    }
+    if (resultSet->columns) {
+        dpiUtils__freeMemory(resultSet->columns);
+        resultSet->columns = NULL;
+    }
+    if (resultSet->owner) {
+        dpiGen__setRefCount(resultSet->owner, error, -1);
+        resultSet->owner = NULL;
+    }
+    dpiGen__free(resultSet);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiResultSet__getValue() [INTERNAL]
+//   Populate the data structure with the value of the column in the specified
+// row. The segment containing the row is found by a binary search of the
+// segments, which are ordered by the index of their first row.
+//-----------------------------------------------------------------------------
+static void dpiResultSet__getValue(dpiResultSet *resultSet, uint64_t rowIndex,
+        uint32_t pos, dpiData *data)
+{
+    uint32_t low, high, mid, row, valueSize;
+    dpiResultSetSegment *segment;
+    uint64_t *valueOffsets;
+    char *segmentData, *ptr;
+
+    // locate the segment containing the row
+    low = 0;
+    high = resultSet->numSegments - 1;
+    while (low < high) {
+        mid = low + (high - low + 1) / 2;
+        if (resultSet->segments[mid].firstRow <= rowIndex)
+            low = mid;
+        else high = mid - 1;
+    }
+    segment = &resultSet->segments[low];
+    row = (uint32_t) (rowIndex - segment->firstRow);
+    segmentData = (segment->data) ? segment->data :
+            resultSet->mappedData + segment->fileOffset;
+
+    // determine if the value is null
+    ptr = segmentData + ((uint64_t*) segmentData)[pos - 1];
+    data->isNull = ptr[row];
+    if (data->isNull)
+        return;
+
+    // populate the value
+    ptr += DPI_RESULT_SET_ALIGN(segment->numRows);
+    valueSize = resultSet->columns[pos - 1].valueSize;
+    if (valueSize > 0) {
+        memcpy(&data->value, ptr + (size_t) row * valueSize, valueSize);
+        return;
+    }
+    valueOffsets = (uint64_t*) ptr;
+    ptr += ((size_t) segment->numRows + 1) * sizeof(uint64_t);
+    data->value.asBytes.ptr = ptr + valueOffsets[row];
+    data->value.asBytes.length =
+            (uint32_t) (valueOffsets[row + 1] - valueOffsets[row]);
+    data->value.asBytes.encoding = resultSet->columns[pos - 1].encoding;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiResultSet__spill() [INTERNAL]
+//   Write the data of the segment to the temporary file, creating the file
+// first if necessary. The temporary file is removed automatically when it is
+// closed.
+//-----------------------------------------------------------------------------
+static int dpiResultSet__spill(dpiResultSet *resultSet,
+        dpiResultSetSegment *segment, dpiError *error)
+{
+    if (!resultSet->spillFile) {
+        resultSet->spillFile = tmpfile();
+        if (!resultSet->spillFile)
+            return dpiError__setFromOS(error, "create temporary file");
+    }
+    if (fwrite(segment->data, 1, (size_t) segment->size,
+            resultSet->spillFile) != (size_t) segment->size)
+        return dpiError__setFromOS(error, "write temporary file");
+    segment->fileOffset = resultSet->spillFileSize;
+    resultSet->spillFileSize += segment->size;
+    dpiUtils__freeMemory(segment->data);
+    segment->data = NULL;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiResultSet_addRef() [PUBLIC]
+//   Add a reference to the result set.
+//-----------------------------------------------------------------------------
+int dpiResultSet_addRef(dpiResultSet *resultSet)
+{
+    return dpiGen__addRef(resultSet, DPI_HTYPE_RESULT_SET, __func__);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiResultSet_getNumColumns() [PUBLIC]
+//   Return the number of columns in the result set.
+//-----------------------------------------------------------------------------
+int dpiResultSet_getNumColumns(dpiResultSet *resultSet, uint32_t *numColumns)
+{
+    dpiError error;
+
+    if (dpiGen__startPublicFn(resultSet, DPI_HTYPE_RESULT_SET, __func__,
+            &error) < 0)
+        return dpiGen__endPublicFn(resultSet, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(resultSet, numColumns)
+    *numColumns = resultSet->numColumns;
+    return dpiGen__endPublicFn(resultSet, DPI_SUCCESS, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiResultSet_getNumRows() [PUBLIC]
+//   Return the number of rows in the result set.
+//-----------------------------------------------------------------------------
+int dpiResultSet_getNumRows(dpiResultSet *resultSet, uint64_t *numRows)
+{
+    dpiError error;
+
+    if (dpiGen__startPublicFn(resultSet, DPI_HTYPE_RESULT_SET, __func__,
+            &error) < 0)
+        return dpiGen__endPublicFn(resultSet, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(resultSet, numRows)
+    *numRows = resultSet->numRows;
+    return dpiGen__endPublicFn(resultSet, DPI_SUCCESS, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiResultSet_getValue() [PUBLIC]
+//   Return the value of the column at the specified position (1 based) in the
+// row at the specified index (0 based). Bytes values refer to the memory of
+// the result set and remain valid as long as a reference to it is held.
+//-----------------------------------------------------------------------------
+int dpiResultSet_getValue(dpiResultSet *resultSet, uint64_t rowIndex,
+        uint32_t pos, dpiNativeTypeNum *nativeTypeNum, dpiData *data)
+{
+    dpiError error;
+
+    if (dpiGen__startPublicFn(resultSet, DPI_HTYPE_RESULT_SET, __func__,
+            &error) < 0)
+        return dpiGen__endPublicFn(resultSet, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(resultSet, nativeTypeNum)
+    DPI_CHECK_PTR_NOT_NULL(resultSet, data)
+    if (pos == 0 || pos > resultSet->numColumns) {
+        dpiError__set(&error, "check query position",
+                DPI_ERR_QUERY_POSITION_INVALID, pos);
+        return dpiGen__endPublicFn(resultSet, DPI_FAILURE, &error);
+    }
+    if (rowIndex >= resultSet->numRows) {
+        dpiError__set(&error, "check row index",
+                DPI_ERR_RESULT_SET_ROW_OUT_OF_RANGE, rowIndex,
+                resultSet->numRows);
+        return dpiGen__endPublicFn(resultSet, DPI_FAILURE, &error);
+    }
+    *nativeTypeNum = resultSet->columns[pos - 1].nativeTypeNum;
+    dpiResultSet__getValue(resultSet, rowIndex, pos, data);
+    return dpiGen__endPublicFn(resultSet, DPI_SUCCESS, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiResultSet_release() [PUBLIC]
+//   Release a reference to the result set.
+//-----------------------------------------------------------------------------
+int dpiResultSet_release(dpiResultSet *resultSet)
+{
+    return dpiGen__release(resultSet, DPI_HTYPE_RESULT_SET, __func__);
+}
@@ -0,0 +1,258 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// dpiRowBlock.c
+//   Implementation of row blocks. A row block takes ownership of the fetch
+// buffers of the query variables of a statement so that the rows they contain
+// can be used after further rows have been fetched, without copying them. When
+// the last reference to a row block is released, its buffers are retained by
+// the statement for reuse, unless the query variables of the statement have
+// changed in the meantime.
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+
+// forward declarations of internal functions only used in this file
+static void dpiRowBlock__freeBuffers(dpiVar **vars, dpiVarBuffer *buffers,
+        uint32_t numColumns, dpiError *error);
+
+
+//-----------------------------------------------------------------------------
+// dpiRowBlock__allocate() [INTERNAL]
+//   Allocate and initialize a row block for the query variables of the
+// statement. The buffers for the block are taken from the spare buffers
+// retained by the statement, if any are available, or are newly allocated;
+// the caller is expected to exchange them with the buffers of the query
+// variables.
+//-----------------------------------------------------------------------------
+int dpiRowBlock__allocate(dpiStmt *stmt, dpiRowBlock **block,
+        dpiError *error)
+{
+    dpiVarBuffer *buffer;
+    dpiRowBlock *temp;
+    uint32_t i;
+
+    // allocate the block and retain references to the statement and its
+    // query variables
+    if (dpiGen__allocate(DPI_HTYPE_ROW_BLOCK, stmt->env, (void**) &temp,
+            error) < 0)
+        return DPI_FAILURE;
+    dpiGen__setRefCount(stmt, error, 1);
+    temp->stmt = stmt;
+    temp->generation = stmt->rowBlockGeneration;
+    if (dpiUtils__allocateMemory(stmt->numQueryVars, sizeof(dpiVar*), 1,
+            "allocate row block vars", (void**) &temp->vars, error) < 0) {
+        dpiRowBlock__free(temp, error);
+        return DPI_FAILURE;
+    }
+    temp->numColumns = stmt->numQueryVars;
+    for (i = 0; i < temp->numColumns; i++) {
+        temp->vars[i] = stmt->queryVars[i];
+        dpiGen__setRefCount(temp->vars[i], error, 1);
+    }
+
+    // use a spare set of buffers, if one is available
+    if (stmt->env->threaded)
+        dpiMutex__acquire(stmt->env->mutex);
+    if (stmt->numSpareRowBlocks > 0)
+        temp->buffers = stmt->spareRowBlocks[--stmt->numSpareRowBlocks];
+    if (stmt->env->threaded)
+        dpiMutex__release(stmt->env->mutex);
+    if (temp->buffers) {
+        *block = temp;
+        return DPI_SUCCESS;
+    }
+
+    // otherwise, allocate a new set of buffers
+    if (dpiUtils__allocateMemory(temp->numColumns, sizeof(dpiVarBuffer), 1,
+            "allocate row block buffers", (void**) &temp->buffers,
+            error) < 0) {
+        dpiRowBlock__free(temp, error);
+        return DPI_FAILURE;
+    }
+    for (i = 0; i < temp->numColumns; i++) {
+        buffer = &temp->buffers[i];
+        buffer->maxArraySize = temp->vars[i]->buffer.maxArraySize;
+        if (dpiVar__initBuffer(temp->vars[i], buffer, error) < 0) {
+            dpiRowBlock__freeBuffers(temp->vars, temp->buffers,
+                    temp->numColumns, error);
+            temp->buffers = NULL;
+            dpiRowBlock__free(temp, error);
+            return DPI_FAILURE;
+        }
+    }
+
+    *block = temp;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiRowBlock__clearSpares() [INTERNAL]
+//   Free the spare buffers retained by the statement. This is called whenever
+// the query variables of the statement are about to change; row blocks
+// released after this point free their buffers instead of returning them to
+// the statement.
+//-----------------------------------------------------------------------------
+void dpiRowBlock__clearSpares(dpiStmt *stmt, dpiError *error)
+{
+    dpiVarBuffer *spares[DPI_MAX_SPARE_ROW_BLOCKS];
+    uint32_t i, numSpares;
+
+    if (stmt->env->threaded)
+        dpiMutex__acquire(stmt->env->mutex);
+    stmt->rowBlockGeneration++;
+    numSpares = stmt->numSpareRowBlocks;
+    for (i = 0; i < numSpares; i++)
+        spares[i] = stmt->spareRowBlocks[i];
+    stmt->numSpareRowBlocks = 0;
+    if (stmt->env->threaded)
+        dpiMutex__release(stmt->env->mutex);
+    for (i = 0; i < numSpares; i++)
+        dpiRowBlock__freeBuffers(stmt->queryVars, spares[i],
+                stmt->numQueryVars, error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiRowBlock__free() [INTERNAL]
+//   Free the memory for a row block. If the query variables of the statement
+// have not changed since the block was detached and the statement has room
+// for them, the buffers are returned to the statement for reuse.
+//-----------------------------------------------------------------------------
+void dpiRowBlock__free(dpiRowBlock *block, dpiError *error)
+{
+    dpiStmt *stmt = block->stmt;
+    uint32_t i;
+
+    if (block->buffers) {
+        if (stmt->env->threaded)
+            dpiMutex__acquire(stmt->env->mutex);
+        if (block->generation == stmt->rowBlockGeneration &&
+                block->numColumns == stmt->numQueryVars &&
+                stmt->numSpareRowBlocks < DPI_MAX_SPARE_ROW_BLOCKS) {
+            stmt->spareRowBlocks[stmt->numSpareRowBlocks++] = block->buffers;
+            block->buffers = NULL;
+        }
+        if (stmt->env->threaded)
+            dpiMutex__release(stmt->env->mutex);
+        if (block->buffers) {
+            dpiRowBlock__freeBuffers(block->vars, block->buffers,
+                    block->numColumns, error);
+            block->buffers = NULL;
+        }
+    }
+    if (block->vars) {
+        for (i = 0; i < block->numColumns; i++) {
+            if (block->vars[i])
+                dpiGen__setRefCount(block->vars[i], error, -1);
+        }
+        dpiUtils__freeMemory(block->vars);
+        block->vars = NULL;
+    }
+    if (block->stmt) {
+        dpiGen__setRefCount(block->stmt, error, -1);
+        block->stmt = NULL;
+    }
+    dpiGen__free(block);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiRowBlock__freeBuffers() [INTERNAL]
+//   Finalize and free a set of buffers belonging to the given variables.
+//-----------------------------------------------------------------------------
+static void dpiRowBlock__freeBuffers(dpiVar **vars, dpiVarBuffer *buffers,
+        uint32_t numColumns, dpiError *error)
+{
+    uint32_t i;
+
+    for (i = 0; i < numColumns; i++)
+        dpiVar__finalizeBuffer(vars[i], &buffers[i], error);
+    dpiUtils__freeMemory(buffers);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiRowBlock_addRef() [PUBLIC]
+//   Add a reference to the row block.
+//-----------------------------------------------------------------------------
+int dpiRowBlock_addRef(dpiRowBlock *block)
+{
+    return dpiGen__addRef(block, DPI_HTYPE_ROW_BLOCK, __func__);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiRowBlock_getColumnData() [PUBLIC]
+//   Return the array of data for the column at the specified position (1
+// based). The array contains one element for each row in the block.
+//-----------------------------------------------------------------------------
+int dpiRowBlock_getColumnData(dpiRowBlock *block, uint32_t pos,
+        dpiNativeTypeNum *nativeTypeNum, dpiData **data)
+{
+    dpiError error;
+
+    if (dpiGen__startPublicFn(block, DPI_HTYPE_ROW_BLOCK, __func__,
+            &error) < 0)
+        return dpiGen__endPublicFn(block, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(block, nativeTypeNum)
+    DPI_CHECK_PTR_NOT_NULL(block, data)
+    if (pos == 0 || pos > block->numColumns) {
+        dpiError__set(&error, "check query position",
+                DPI_ERR_QUERY_POSITION_INVALID, pos);
+        return dpiGen__endPublicFn(block, DPI_FAILURE, &error);
+    }
+    *nativeTypeNum = block->vars[pos - 1]->nativeTypeNum;
+    *data = block->buffers[pos - 1].externalData;
+    return dpiGen__endPublicFn(block, DPI_SUCCESS, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiRowBlock_getNumRows() [PUBLIC]
+//   Return the number of rows contained in the row block.
+//-----------------------------------------------------------------------------
+int dpiRowBlock_getNumRows(dpiRowBlock *block, uint32_t *numRows)
+{
+    dpiError error;
+
+    if (dpiGen__startPublicFn(block, DPI_HTYPE_ROW_BLOCK, __func__,
+            &error) < 0)
+        return dpiGen__endPublicFn(block, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(block, numRows)
+    *numRows = block->numRows;
+    return dpiGen__endPublicFn(block, DPI_SUCCESS, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiRowBlock_release() [PUBLIC]
+//   Release a reference to the row block.
+//-----------------------------------------------------------------------------
+int dpiRowBlock_release(dpiRowBlock *block)
+{
+    return dpiGen__release(block, DPI_HTYPE_ROW_BLOCK, __func__);
+}
@@ -65,7 +65,7 @@ void dpiRowid__free(dpiRowid *rowid, UNUSED dpiError *error)
         dpiUtils__freeMemory(rowid->buffer);
         rowid->buffer = NULL;
     }
-    dpiUtils__freeMemory(rowid);
+    dpiGen__free(rowid);
 }
 
 
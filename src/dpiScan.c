@@ -0,0 +1,1047 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// dpiScan.c
+//   Implementation of parallel scans. The table is split into chunks (ranges
+// of rowids, partitions or ranges of key values) when the scan is created.
+// Each thread started by the scan acquires a connection from the pool and
+// fetches the chunks assigned to it, detaching each set of fetched rows as a
+// row block and placing it in a queue from which the consumer takes them. The
+// number of blocks in the queue is limited so that threads wait for the
+// consumer to catch up; cancelling the scan wakes up any waiting threads and
+// interrupts the statements that are being executed.
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+
+// SQL used to determine the ranges of rowids of the extents of a table; the
+// rowids span the first row of the first block to the last possible row of
+// the last block of each extent
+static const char *dpiScan__rowidRangesSql =
+        "select cast(o.data_object_id as number(18)), "
+        "rowidtochar(dbms_rowid.rowid_create(1, o.data_object_id, "
+        "e.relative_fno, e.block_id, 0)), "
+        "rowidtochar(dbms_rowid.rowid_create(1, o.data_object_id, "
+        "e.relative_fno, e.block_id + e.blocks - 1, 32767)) "
+        "from user_extents e, user_objects o "
+        "where e.segment_name = :1 "
+        "and e.segment_type in ('TABLE', 'TABLE PARTITION', "
+        "'TABLE SUBPARTITION') "
+        "and o.object_name = e.segment_name "
+        "and o.object_type = e.segment_type "
+        "and decode(o.subobject_name, e.partition_name, 1, 0) = 1 "
+        "order by o.data_object_id, e.relative_fno, e.block_id";
+
+// SQL used to determine the partitions of a table
+static const char *dpiScan__partitionsSql =
+        "select partition_name from user_tab_partitions "
+        "where table_name = :1 order by partition_position";
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__append() [INTERNAL]
+//   Append the value to the SQL being built. If the SQL buffer is NULL, only
+// the length is calculated.
+//-----------------------------------------------------------------------------
+static void dpiScan__append(char *sql, uint32_t *sqlLength, const char *value,
+        uint32_t valueLength)
+{
+    if (sql)
+        memcpy(sql + *sqlLength, value, valueLength);
+    *sqlLength += valueLength;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__appendName() [INTERNAL]
+//   Append the name, enclosed in double quotes, to the SQL being built. If
+// the SQL buffer is NULL, only the length is calculated.
+//-----------------------------------------------------------------------------
+static void dpiScan__appendName(char *sql, uint32_t *sqlLength,
+        const char *name, uint32_t nameLength)
+{
+    dpiScan__append(sql, sqlLength, "\"", 1);
+    dpiScan__append(sql, sqlLength, name, nameLength);
+    dpiScan__append(sql, sqlLength, "\"", 1);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__populateSql() [INTERNAL]
+//   Populate the SQL used to fetch the rows of a chunk or, if no chunk is
+// specified, the SQL used to determine the range of key values of the table.
+// The key values are rounded down to integers so that the half-open ranges
+// of the chunks also cover keys with fractional parts; keys with more than 18
+// digits cause the query to fail. If the SQL buffer is NULL, only the length
+// is calculated.
+//-----------------------------------------------------------------------------
+static void dpiScan__populateSql(dpiScan *scan, dpiScanChunk *chunk,
+        char *sql, uint32_t *sqlLength)
+{
+    int hasWhere = 0;
+
+    // select list
+    *sqlLength = 0;
+    dpiScan__append(sql, sqlLength, "select ", 7);
+    if (!chunk) {
+        dpiScan__append(sql, sqlLength, "cast(floor(min(", 15);
+        dpiScan__appendName(sql, sqlLength, scan->keyColumn,
+                scan->keyColumnLength);
+        dpiScan__append(sql, sqlLength, ")) as number(18)), "
+                "cast(floor(max(", 34);
+        dpiScan__appendName(sql, sqlLength, scan->keyColumn,
+                scan->keyColumnLength);
+        dpiScan__append(sql, sqlLength, ")) as number(18))", 17);
+    } else if (scan->columns) {
+        dpiScan__append(sql, sqlLength, scan->columns, scan->columnsLength);
+    } else {
+        dpiScan__append(sql, sqlLength, "*", 1);
+    }
+
+    // table (and partition, if applicable)
+    dpiScan__append(sql, sqlLength, " from ", 6);
+    dpiScan__appendName(sql, sqlLength, scan->tableName,
+            scan->tableNameLength);
+    if (chunk && chunk->partitionName) {
+        dpiScan__append(sql, sqlLength, " partition (", 12);
+        dpiScan__appendName(sql, sqlLength, chunk->partitionName,
+                chunk->partitionNameLength);
+        dpiScan__append(sql, sqlLength, ")", 1);
+    }
+
+    // restriction to the rows of the chunk; a rowid chunk without rowids
+    // covers the whole table
+    if (chunk && scan->splitMode == DPI_SCAN_SPLIT_ROWID &&
+            chunk->lowRowidLength > 0) {
+        dpiScan__append(sql, sqlLength, " where rowid between "
+                "chartorowid(:1) and chartorowid(:2)", 56);
+        hasWhere = 1;
+    } else if (chunk && scan->splitMode == DPI_SCAN_SPLIT_KEY_RANGE) {
+        dpiScan__append(sql, sqlLength, " where ", 7);
+        dpiScan__appendName(sql, sqlLength, scan->keyColumn,
+                scan->keyColumnLength);
+        if (chunk->isNullKey) {
+            dpiScan__append(sql, sqlLength, " is null", 8);
+        } else {
+            dpiScan__append(sql, sqlLength, " >= :1 and ", 11);
+            dpiScan__appendName(sql, sqlLength, scan->keyColumn,
+                    scan->keyColumnLength);
+            dpiScan__append(sql, sqlLength, " < :2", 5);
+        }
+        hasWhere = 1;
+    }
+
+    // additional filter supplied by the caller
+    if (scan->whereClause) {
+        if (hasWhere)
+            dpiScan__append(sql, sqlLength, " and (", 6);
+        else dpiScan__append(sql, sqlLength, " where (", 8);
+        dpiScan__append(sql, sqlLength, scan->whereClause,
+                scan->whereClauseLength);
+        dpiScan__append(sql, sqlLength, ")", 1);
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__bindBytes() [INTERNAL]
+//   Bind a string value to the statement at the specified position.
+//-----------------------------------------------------------------------------
+static int dpiScan__bindBytes(dpiStmt *stmt, uint32_t pos, const char *value,
+        uint32_t valueLength, dpiError *error)
+{
+    dpiData *data, sourceData;
+    dpiVar *var;
+    int status;
+
+    if (dpiVar__allocate(stmt->conn, DPI_ORACLE_TYPE_VARCHAR,
+            DPI_NATIVE_TYPE_BYTES, 1, valueLength, 1, 0, NULL, &var, &data,
+            error) < 0)
+        return DPI_FAILURE;
+    sourceData.isNull = 0;
+    sourceData.value.asBytes.ptr = (char*) value;
+    sourceData.value.asBytes.length = valueLength;
+    sourceData.value.asBytes.encoding = NULL;
+    status = dpiVar__copyData(var, 0, &sourceData, error);
+    if (status == DPI_SUCCESS)
+        status = dpiStmt__bind(stmt, var, pos, NULL, 0, error);
+    dpiGen__setRefCount(var, error, -1);
+    return status;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__bindInt64() [INTERNAL]
+//   Bind an integer value to the statement at the specified position.
+//-----------------------------------------------------------------------------
+static int dpiScan__bindInt64(dpiStmt *stmt, uint32_t pos, int64_t value,
+        dpiError *error)
+{
+    dpiData *data;
+    dpiVar *var;
+    int status;
+
+    if (dpiVar__allocate(stmt->conn, DPI_ORACLE_TYPE_NUMBER,
+            DPI_NATIVE_TYPE_INT64, 1, 0, 0, 0, NULL, &var, &data, error) < 0)
+        return DPI_FAILURE;
+    data->isNull = 0;
+    data->value.asInt64 = value;
+    status = dpiStmt__bind(stmt, var, pos, NULL, 0, error);
+    dpiGen__setRefCount(var, error, -1);
+    return status;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__prepare() [INTERNAL]
+//   Prepare a statement with the specified SQL on the connection.
+//-----------------------------------------------------------------------------
+static int dpiScan__prepare(dpiConn *conn, const char *sql,
+        uint32_t sqlLength, uint32_t fetchArraySize, dpiStmt **stmt,
+        dpiError *error)
+{
+    dpiStmt *tempStmt;
+
+    if (dpiStmt__allocate(conn, 0, 0, &tempStmt, error) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt__prepare(tempStmt, sql, sqlLength, NULL, 0, error) < 0) {
+        dpiStmt__free(tempStmt, error);
+        return DPI_FAILURE;
+    }
+    tempStmt->fetchArraySize = fetchArraySize;
+    *stmt = tempStmt;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__addChunk() [INTERNAL]
+//   Add a chunk to the array of chunks, growing the array if needed, and
+// return a pointer to it.
+//-----------------------------------------------------------------------------
+static int dpiScan__addChunk(dpiScan *scan, uint32_t *allocatedChunks,
+        dpiScanChunk **chunk, dpiError *error)
+{
+    dpiScanChunk *tempChunks;
+    uint32_t numAllocated;
+
+    if (scan->numChunks == *allocatedChunks) {
+        numAllocated = (*allocatedChunks == 0) ? 16 : *allocatedChunks * 2;
+        if (dpiUtils__allocateMemory(numAllocated, sizeof(dpiScanChunk), 1,
+                "allocate chunks", (void**) &tempChunks, error) < 0)
+            return DPI_FAILURE;
+        if (scan->chunks) {
+            memcpy(tempChunks, scan->chunks,
+                    scan->numChunks * sizeof(dpiScanChunk));
+            dpiUtils__freeMemory(scan->chunks);
+        }
+        scan->chunks = tempChunks;
+        *allocatedChunks = numAllocated;
+    }
+    *chunk = &scan->chunks[scan->numChunks++];
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__splitByKeyRange() [INTERNAL]
+//   Split the table into chunks covering equal half-open ranges of key values
+// between the minimum and maximum values found in the table, followed by a
+// chunk for the rows in which the key is null.
+//-----------------------------------------------------------------------------
+static int dpiScan__splitByKeyRange(dpiScan *scan, dpiConn *conn,
+        uint32_t maxChunks, dpiError *error)
+{
+    uint64_t range, step = 0, offset;
+    int64_t minKey = 0, maxKey = 0;
+    uint32_t sqlLength, i;
+    dpiRowBlock *block;
+    dpiStmt *stmt;
+    char *sql;
+    int status;
+
+    // determine the range of key values
+    dpiScan__populateSql(scan, NULL, NULL, &sqlLength);
+    if (dpiUtils__allocateMemory(1, sqlLength, 0, "allocate SQL",
+            (void**) &sql, error) < 0)
+        return DPI_FAILURE;
+    dpiScan__populateSql(scan, NULL, sql, &sqlLength);
+    status = dpiScan__prepare(conn, sql, sqlLength, 1, &stmt, error);
+    dpiUtils__freeMemory(sql);
+    if (status < 0)
+        return DPI_FAILURE;
+    if (dpiStmt__execute(stmt, 0, DPI_MODE_EXEC_DEFAULT, 1, error) < 0 ||
+            dpiStmt__fetchRowBlock(stmt, &block, error) < 0) {
+        dpiGen__setRefCount(stmt, error, -1);
+        return DPI_FAILURE;
+    }
+    dpiGen__setRefCount(stmt, error, -1);
+    if (!block || block->buffers[0].externalData[0].isNull ||
+            block->buffers[1].externalData[0].isNull) {
+        range = 0;
+        scan->numChunks = 1;
+    } else {
+        minKey = block->buffers[0].externalData[0].value.asInt64;
+        maxKey = block->buffers[1].externalData[0].value.asInt64;
+        range = (uint64_t) maxKey - (uint64_t) minKey + 1;
+    }
+    if (block)
+        dpiGen__setRefCount(block, error, -1);
+
+    // split the range into chunks of equal size, each of which includes its
+    // low key and excludes its high key; the range is limited to keys of 18
+    // digits so the arithmetic cannot overflow
+    if (range > 0) {
+        step = (range + maxChunks - 1) / maxChunks;
+        scan->numChunks = (uint32_t) ((range + step - 1) / step) + 1;
+    }
+    if (dpiUtils__allocateMemory(scan->numChunks, sizeof(dpiScanChunk), 1,
+            "allocate chunks", (void**) &scan->chunks, error) < 0)
+        return DPI_FAILURE;
+    for (i = 0, offset = 0; offset < range; i++, offset += step) {
+        scan->chunks[i].lowKey = minKey + (int64_t) offset;
+        scan->chunks[i].highKey = (range - offset <= step) ? maxKey + 1 :
+                minKey + (int64_t) (offset + step);
+    }
+
+    // rows in which the key is null are not part of any range
+    scan->chunks[i].isNullKey = 1;
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__splitByPartition() [INTERNAL]
+//   Split the table into one chunk for each of its partitions. If the table
+// is not partitioned, a single chunk covering the whole table is used.
+//-----------------------------------------------------------------------------
+static int dpiScan__splitByPartition(dpiScan *scan, dpiConn *conn,
+        dpiError *error)
+{
+    uint32_t i, allocatedChunks = 0;
+    dpiScanChunk *chunk;
+    dpiRowBlock *block;
+    dpiBytes *name;
+    dpiStmt *stmt;
+
+    // execute the query to determine the partitions
+    if (dpiScan__prepare(conn, dpiScan__partitionsSql,
+            (uint32_t) strlen(dpiScan__partitionsSql),
+            DPI_DEFAULT_FETCH_ARRAY_SIZE, &stmt, error) < 0)
+        return DPI_FAILURE;
+    if (dpiScan__bindBytes(stmt, 1, scan->tableName, scan->tableNameLength,
+            error) < 0 || dpiStmt__execute(stmt, 0, DPI_MODE_EXEC_DEFAULT, 1,
+            error) < 0) {
+        dpiGen__setRefCount(stmt, error, -1);
+        return DPI_FAILURE;
+    }
+
+    // add a chunk for each partition
+    while (1) {
+        if (dpiStmt__fetchRowBlock(stmt, &block, error) < 0) {
+            dpiGen__setRefCount(stmt, error, -1);
+            return DPI_FAILURE;
+        }
+        if (!block)
+            break;
+        for (i = 0; i < block->numRows; i++) {
+            name = &block->buffers[0].externalData[i].value.asBytes;
+            if (dpiScan__addChunk(scan, &allocatedChunks, &chunk,
+                    error) < 0 || dpiUtils__allocateMemory(1, name->length,
+                    0, "allocate partition name",
+                    (void**) &chunk->partitionName, error) < 0) {
+                dpiGen__setRefCount(block, error, -1);
+                dpiGen__setRefCount(stmt, error, -1);
+                return DPI_FAILURE;
+            }
+            memcpy(chunk->partitionName, name->ptr, name->length);
+            chunk->partitionNameLength = name->length;
+        }
+        dpiGen__setRefCount(block, error, -1);
+    }
+    dpiGen__setRefCount(stmt, error, -1);
+
+    // a table that is not partitioned is scanned as a single chunk
+    if (scan->numChunks == 0)
+        return dpiScan__addChunk(scan, &allocatedChunks, &chunk, error);
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__splitByRowid() [INTERNAL]
+//   Split the table into chunks covering ranges of rowids. The rowid ranges
+// of the extents of the table are determined first and consecutive extents
+// belonging to the same segment are then combined so that at most the
+// specified number of chunks (plus one for each additional segment) are
+// created. Rowids sort by segment, file and block so the range between the
+// first rowid of one extent and the last rowid of a later extent of the same
+// segment contains only the rows of the extents in between. If no extents are
+// found (such as for an index-organized table), a single chunk covering the
+// whole table is used so that the rows are still returned or, if the table
+// does not exist, the error is raised when the chunk is scanned.
+//-----------------------------------------------------------------------------
+static int dpiScan__splitByRowid(dpiScan *scan, dpiConn *conn,
+        uint32_t maxChunks, dpiError *error)
+{
+    uint32_t i, numInGroup = 0, groupSize, allocatedChunks = 0;
+    dpiScanChunk *chunk, *extent;
+    dpiBytes *lowRowid, *highRowid;
+    dpiRowBlock *block;
+    dpiStmt *stmt;
+
+    // execute the query to determine the ranges of rowids of the extents
+    if (dpiScan__prepare(conn, dpiScan__rowidRangesSql,
+            (uint32_t) strlen(dpiScan__rowidRangesSql),
+            DPI_DEFAULT_FETCH_ARRAY_SIZE, &stmt, error) < 0)
+        return DPI_FAILURE;
+    if (dpiScan__bindBytes(stmt, 1, scan->tableName, scan->tableNameLength,
+            error) < 0 || dpiStmt__execute(stmt, 0, DPI_MODE_EXEC_DEFAULT, 1,
+            error) < 0) {
+        dpiGen__setRefCount(stmt, error, -1);
+        return DPI_FAILURE;
+    }
+
+    // add a chunk for each extent; the data object id of the segment is
+    // retained temporarily in the low key of each chunk
+    while (1) {
+        if (dpiStmt__fetchRowBlock(stmt, &block, error) < 0) {
+            dpiGen__setRefCount(stmt, error, -1);
+            return DPI_FAILURE;
+        }
+        if (!block)
+            break;
+        for (i = 0; i < block->numRows; i++) {
+            if (dpiScan__addChunk(scan, &allocatedChunks, &chunk,
+                    error) < 0) {
+                dpiGen__setRefCount(block, error, -1);
+                dpiGen__setRefCount(stmt, error, -1);
+                return DPI_FAILURE;
+            }
+            lowRowid = &block->buffers[1].externalData[i].value.asBytes;
+            highRowid = &block->buffers[2].externalData[i].value.asBytes;
+            chunk->lowKey = block->buffers[0].externalData[i].value.asInt64;
+            chunk->lowRowidLength = (lowRowid->length <
+                    DPI_SCAN_MAX_ROWID_LENGTH) ? lowRowid->length :
+                    DPI_SCAN_MAX_ROWID_LENGTH;
+            memcpy(chunk->lowRowid, lowRowid->ptr, chunk->lowRowidLength);
+            chunk->highRowidLength = (highRowid->length <
+                    DPI_SCAN_MAX_ROWID_LENGTH) ? highRowid->length :
+                    DPI_SCAN_MAX_ROWID_LENGTH;
+            memcpy(chunk->highRowid, highRowid->ptr, chunk->highRowidLength);
+        }
+        dpiGen__setRefCount(block, error, -1);
+    }
+    dpiGen__setRefCount(stmt, error, -1);
+
+    // a table without extents is scanned as a single chunk
+    if (scan->numChunks == 0)
+        return dpiScan__addChunk(scan, &allocatedChunks, &chunk, error);
+
+    // combine consecutive extents of the same segment
+    if (scan->numChunks <= maxChunks)
+        return DPI_SUCCESS;
+    groupSize = (scan->numChunks + maxChunks - 1) / maxChunks;
+    chunk = NULL;
+    for (i = 0; i < scan->numChunks; i++) {
+        extent = &scan->chunks[i];
+        if (chunk && numInGroup < groupSize &&
+                extent->lowKey == chunk->lowKey) {
+            memcpy(chunk->highRowid, extent->highRowid,
+                    extent->highRowidLength);
+            chunk->highRowidLength = extent->highRowidLength;
+            numInGroup++;
+        } else {
+            chunk = (chunk) ? chunk + 1 : scan->chunks;
+            if (chunk != extent)
+                *chunk = *extent;
+            numInGroup = 1;
+        }
+    }
+    scan->numChunks = (uint32_t) (chunk - scan->chunks) + 1;
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__split() [INTERNAL]
+//   Split the table into chunks using a connection acquired from the pool.
+//-----------------------------------------------------------------------------
+static int dpiScan__split(dpiScan *scan, uint32_t maxChunks, dpiError *error)
+{
+    dpiConnCreateParams params;
+    dpiConn *conn;
+    int status;
+
+    dpiContext__initConnCreateParams(&params);
+    if (dpiPool__acquireConnection(scan->pool, NULL, 0, NULL, 0, &params,
+            &conn, error) < 0)
+        return DPI_FAILURE;
+    switch (scan->splitMode) {
+        case DPI_SCAN_SPLIT_ROWID:
+            status = dpiScan__splitByRowid(scan, conn, maxChunks, error);
+            break;
+        case DPI_SCAN_SPLIT_PARTITION:
+            status = dpiScan__splitByPartition(scan, conn, error);
+            break;
+        default:
+            status = dpiScan__splitByKeyRange(scan, conn, maxChunks, error);
+            break;
+    }
+    dpiGen__setRefCount(conn, error, -1);
+    return status;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__queueBlock() [INTERNAL]
+//   Place a block of rows in the queue for the consumer. If the queue is full,
+// wait until the consumer has taken enough blocks from it; the thread
+// producing the chunk that the consumer is waiting for in an ordered scan
+// never waits. If the scan has been cancelled or has failed, the block is
+// released and the flag indicating that the chunk should be abandoned is set.
+//-----------------------------------------------------------------------------
+static int dpiScan__queueBlock(dpiScan *scan, dpiRowBlock *block,
+        uint32_t chunkNum, int *abandon, dpiError *error)
+{
+    dpiScanEntry *entry;
+
+    if (dpiUtils__allocateMemory(1, sizeof(dpiScanEntry), 1,
+            "allocate scan entry", (void**) &entry, error) < 0) {
+        dpiGen__setRefCount(block, error, -1);
+        return DPI_FAILURE;
+    }
+    entry->block = block;
+    entry->chunkNum = chunkNum;
+    dpiMutex__acquire(scan->mutex);
+    while (!scan->cancelled && !scan->failed &&
+            scan->numPendingBlocks >= scan->maxPendingBlocks &&
+            !(scan->ordered && chunkNum == scan->currentChunk))
+        dpiCond__wait(scan->spaceAvailable, scan->mutex);
+    *abandon = (scan->cancelled || scan->failed);
+    if (!*abandon) {
+        if (scan->lastEntry)
+            scan->lastEntry->next = entry;
+        else scan->firstEntry = entry;
+        scan->lastEntry = entry;
+        scan->numPendingBlocks++;
+        dpiCond__broadcast(scan->blocksAvailable);
+    }
+    dpiMutex__release(scan->mutex);
+    if (*abandon) {
+        dpiUtils__freeMemory(entry);
+        dpiGen__setRefCount(block, error, -1);
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__scanChunk() [INTERNAL]
+//   Fetch the rows of a chunk and place them in the queue for the consumer.
+//-----------------------------------------------------------------------------
+static int dpiScan__scanChunk(dpiScan *scan, dpiConn *conn,
+        uint32_t chunkNum, dpiError *error)
+{
+    dpiScanChunk *chunk = &scan->chunks[chunkNum];
+    int status, abandon = 0;
+    dpiRowBlock *block;
+    uint32_t sqlLength;
+    dpiStmt *stmt;
+    char *sql;
+
+    // prepare the statement
+    dpiScan__populateSql(scan, chunk, NULL, &sqlLength);
+    if (dpiUtils__allocateMemory(1, sqlLength, 0, "allocate SQL",
+            (void**) &sql, error) < 0)
+        return DPI_FAILURE;
+    dpiScan__populateSql(scan, chunk, sql, &sqlLength);
+    status = dpiScan__prepare(conn, sql, sqlLength, scan->fetchArraySize,
+            &stmt, error);
+    dpiUtils__freeMemory(sql);
+    if (status < 0)
+        return DPI_FAILURE;
+
+    // bind the bounds of the chunk, if applicable, and execute the statement
+    if (scan->splitMode == DPI_SCAN_SPLIT_ROWID &&
+            chunk->lowRowidLength > 0) {
+        if (dpiScan__bindBytes(stmt, 1, chunk->lowRowid,
+                chunk->lowRowidLength, error) < 0 ||
+                dpiScan__bindBytes(stmt, 2, chunk->highRowid,
+                        chunk->highRowidLength, error) < 0)
+            status = DPI_FAILURE;
+    } else if (scan->splitMode == DPI_SCAN_SPLIT_KEY_RANGE &&
+            !chunk->isNullKey) {
+        if (dpiScan__bindInt64(stmt, 1, chunk->lowKey, error) < 0 ||
+                dpiScan__bindInt64(stmt, 2, chunk->highKey, error) < 0)
+            status = DPI_FAILURE;
+    }
+    if (status == DPI_SUCCESS)
+        status = dpiStmt__execute(stmt, 0, DPI_MODE_EXEC_DEFAULT, 1, error);
+
+    // fetch the rows and place them in the queue
+    while (status == DPI_SUCCESS && !abandon) {
+        status = dpiStmt__fetchRowBlock(stmt, &block, error);
+        if (status < 0 || !block)
+            break;
+        status = dpiScan__queueBlock(scan, block, chunkNum, &abandon, error);
+    }
+
+    // the statement remains open until all of its blocks have been released
+    dpiGen__setRefCount(stmt, error, -1);
+    return status;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__setFailed() [INTERNAL]
+//   Record the failure of a thread. The first error raised is retained so
+// that it can be returned to the consumer; errors raised after the scan was
+// cancelled (such as those caused by interrupting a statement) are ignored.
+//-----------------------------------------------------------------------------
+static void dpiScan__setFailed(dpiScan *scan, dpiError *error)
+{
+    dpiMutex__acquire(scan->mutex);
+    if (!scan->failed && !scan->cancelled) {
+        scan->failed = 1;
+        memcpy(&scan->errorBuffer, error->buffer, sizeof(dpiErrorBuffer));
+    }
+    dpiCond__broadcast(scan->blocksAvailable);
+    dpiCond__broadcast(scan->spaceAvailable);
+    dpiMutex__release(scan->mutex);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__threadMain() [INTERNAL]
+//   Main routine for each thread started by the scan. The thread acquires a
+// connection from the pool and scans chunks until none remain or the scan is
+// cancelled or fails. Each thread uses its own error buffer and OCI error
+// handle.
+//-----------------------------------------------------------------------------
+#ifdef _WIN32
+static DWORD WINAPI dpiScan__threadMain(LPVOID arg)
+#else
+static void *dpiScan__threadMain(void *arg)
+#endif
+{
+    dpiScan *scan = (dpiScan*) arg;
+    dpiConnCreateParams params;
+    dpiErrorBuffer errorBuffer;
+    uint32_t threadNum, chunkNum;
+    dpiConn *conn;
+    dpiError error;
+
+    // acquire a connection from the pool
+    error.buffer = &errorBuffer;
+    error.env = scan->env;
+    error.handle = NULL;
+    dpiMutex__acquire(scan->mutex);
+    threadNum = scan->nextThreadNum++;
+    dpiMutex__release(scan->mutex);
+    dpiContext__initConnCreateParams(&params);
+    if (dpiPool__acquireConnection(scan->pool, NULL, 0, NULL, 0, &params,
+            &conn, &error) < 0) {
+        dpiScan__setFailed(scan, &error);
+    } else {
+
+        // retain the connection so that the scan can interrupt it when it is
+        // cancelled
+        dpiMutex__acquire(scan->mutex);
+        scan->conns[threadNum] = conn;
+        dpiMutex__release(scan->mutex);
+
+        // scan chunks until none remain
+        while (1) {
+            dpiMutex__acquire(scan->mutex);
+            if (scan->cancelled || scan->failed ||
+                    scan->nextChunk >= scan->numChunks) {
+                dpiMutex__release(scan->mutex);
+                break;
+            }
+            chunkNum = scan->nextChunk++;
+            dpiMutex__release(scan->mutex);
+            if (dpiScan__scanChunk(scan, conn, chunkNum, &error) < 0) {
+                dpiScan__setFailed(scan, &error);
+                break;
+            }
+            dpiMutex__acquire(scan->mutex);
+            scan->chunks[chunkNum].complete = 1;
+            scan->numChunksComplete++;
+            dpiCond__broadcast(scan->blocksAvailable);
+            dpiMutex__release(scan->mutex);
+        }
+
+        // release the connection; it is returned to the pool once all of the
+        // blocks fetched with it have been released as well
+        dpiMutex__acquire(scan->mutex);
+        scan->conns[threadNum] = NULL;
+        dpiMutex__release(scan->mutex);
+        dpiGen__setRefCount(conn, &error, -1);
+
+    }
+
+    if (error.handle)
+        dpiHandlePool__release(error.env->errorHandles, &error.handle);
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__cancel() [INTERNAL]
+//   Cancel the scan. Threads waiting for the consumer are woken up and the
+// statements being executed on the connections in use by the threads are
+// interrupted.
+//-----------------------------------------------------------------------------
+void dpiScan__cancel(dpiScan *scan, dpiError *error)
+{
+    uint32_t i;
+
+    dpiMutex__acquire(scan->mutex);
+    if (!scan->cancelled) {
+        scan->cancelled = 1;
+        dpiCond__broadcast(scan->blocksAvailable);
+        dpiCond__broadcast(scan->spaceAvailable);
+        for (i = 0; i < scan->numThreads; i++) {
+            if (scan->conns[i])
+                dpiOci__break(scan->conns[i], error);
+        }
+    }
+    dpiMutex__release(scan->mutex);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__copyString() [INTERNAL]
+//   Retain a copy of the string, if one was specified.
+//-----------------------------------------------------------------------------
+static int dpiScan__copyString(const char *value, uint32_t valueLength,
+        char **copy, uint32_t *copyLength, dpiError *error)
+{
+    if (!value || valueLength == 0)
+        return DPI_SUCCESS;
+    if (dpiUtils__allocateMemory(1, valueLength, 0, "copy scan parameter",
+            (void**) copy, error) < 0)
+        return DPI_FAILURE;
+    memcpy(*copy, value, valueLength);
+    *copyLength = valueLength;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__create() [INTERNAL]
+//   Create a scan, split the table into chunks and start the threads which
+// fetch them. The parameters are assumed to have been validated already.
+//-----------------------------------------------------------------------------
+int dpiScan__create(dpiPool *pool, const dpiScanCreateParams *params,
+        dpiScan **scan, dpiError *error)
+{
+    uint32_t i, numThreads, maxChunks;
+    dpiScan *tempScan;
+
+    // allocate the scan and retain a reference to the pool
+    if (dpiGen__allocate(DPI_HTYPE_SCAN, pool->env, (void**) &tempScan,
+            error) < 0)
+        return DPI_FAILURE;
+    dpiGen__setRefCount(pool, error, 1);
+    tempScan->pool = pool;
+    dpiMutex__initialize(tempScan->mutex);
+    dpiCond__initialize(tempScan->blocksAvailable);
+    dpiCond__initialize(tempScan->spaceAvailable);
+
+    // retain the parameters
+    numThreads = (params->numConnections > 0) ? params->numConnections : 1;
+    maxChunks = (params->numChunks > 0) ? params->numChunks : numThreads;
+    tempScan->splitMode = params->splitMode;
+    tempScan->ordered = params->ordered;
+    tempScan->fetchArraySize = (params->fetchArraySize > 0) ?
+            params->fetchArraySize : DPI_DEFAULT_FETCH_ARRAY_SIZE;
+    tempScan->maxPendingBlocks = (params->maxPendingBlocks > 0) ?
+            params->maxPendingBlocks : numThreads;
+    if (dpiScan__copyString(params->tableName, params->tableNameLength,
+                    &tempScan->tableName, &tempScan->tableNameLength,
+                    error) < 0 ||
+            dpiScan__copyString(params->columns, params->columnsLength,
+                    &tempScan->columns, &tempScan->columnsLength,
+                    error) < 0 ||
+            dpiScan__copyString(params->whereClause,
+                    params->whereClauseLength, &tempScan->whereClause,
+                    &tempScan->whereClauseLength, error) < 0 ||
+            dpiScan__copyString(params->keyColumn, params->keyColumnLength,
+                    &tempScan->keyColumn, &tempScan->keyColumnLength,
+                    error) < 0) {
+        dpiScan__free(tempScan, error);
+        return DPI_FAILURE;
+    }
+
+    // split the table into chunks
+    if (dpiScan__split(tempScan, maxChunks, error) < 0) {
+        dpiScan__free(tempScan, error);
+        return DPI_FAILURE;
+    }
+
+    // start the threads; no more threads are started than there are chunks
+    if (numThreads > tempScan->numChunks)
+        numThreads = tempScan->numChunks;
+    if (numThreads > 0) {
+        if (dpiUtils__allocateMemory(numThreads, sizeof(dpiThreadType), 1,
+                "allocate scan threads", (void**) &tempScan->threads,
+                error) < 0 ||
+                dpiUtils__allocateMemory(numThreads, sizeof(dpiConn*), 1,
+                "allocate scan connections", (void**) &tempScan->conns,
+                error) < 0) {
+            dpiScan__free(tempScan, error);
+            return DPI_FAILURE;
+        }
+    }
+    for (i = 0; i < numThreads; i++) {
+#ifdef _WIN32
+        tempScan->threads[i] = CreateThread(NULL, 0, dpiScan__threadMain,
+                tempScan, 0, NULL);
+        if (!tempScan->threads[i])
+            break;
+#else
+        if (pthread_create(&tempScan->threads[i], NULL, dpiScan__threadMain,
+                tempScan) != 0)
+            break;
+#endif
+        tempScan->numThreads++;
+    }
+    if (i < numThreads) {
+        dpiScan__free(tempScan, error);
+        return dpiError__set(error, "start scan threads", DPI_ERR_OS,
+                "unable to start thread");
+    }
+
+    *scan = tempScan;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__free() [INTERNAL]
+//   Cancel the scan, if it is still in progress, wait for its threads to
+// terminate and free the memory associated with it. Blocks that were never
+// taken by the consumer are released.
+//-----------------------------------------------------------------------------
+void dpiScan__free(dpiScan *scan, dpiError *error)
+{
+    dpiScanEntry *entry;
+    uint32_t i;
+
+    // stop the threads
+    if (scan->numThreads > 0) {
+        dpiScan__cancel(scan, error);
+        for (i = 0; i < scan->numThreads; i++) {
+#ifdef _WIN32
+            WaitForSingleObject(scan->threads[i], INFINITE);
+            CloseHandle(scan->threads[i]);
+#else
+            pthread_join(scan->threads[i], NULL);
+#endif
+        }
+    }
+
+    // release the blocks remaining in the queue
+    while (scan->firstEntry) {
+        entry = scan->firstEntry;
+        scan->firstEntry = entry->next;
+        dpiGen__setRefCount(entry->block, error, -1);
+        dpiUtils__freeMemory(entry);
+    }
+
+    // free the chunks and the copies of the parameters
+    if (scan->chunks) {
+        for (i = 0; i < scan->numChunks; i++) {
+            if (scan->chunks[i].partitionName)
+                dpiUtils__freeMemory(scan->chunks[i].partitionName);
+        }
+        dpiUtils__freeMemory(scan->chunks);
+        scan->chunks = NULL;
+    }
+    if (scan->tableName) {
+        dpiUtils__freeMemory(scan->tableName);
+        scan->tableName = NULL;
+    }
+    if (scan->columns) {
+        dpiUtils__freeMemory(scan->columns);
+        scan->columns = NULL;
+    }
+    if (scan->whereClause) {
+        dpiUtils__freeMemory(scan->whereClause);
+        scan->whereClause = NULL;
+    }
+    if (scan->keyColumn) {
+        dpiUtils__freeMemory(scan->keyColumn);
+        scan->keyColumn = NULL;
+    }
+    if (scan->threads) {
+        dpiUtils__freeMemory(scan->threads);
+        scan->threads = NULL;
+    }
+    if (scan->conns) {
+        dpiUtils__freeMemory(scan->conns);
+        scan->conns = NULL;
+    }
+    if (scan->pool) {
+        dpiGen__setRefCount(scan->pool, error, -1);
+        scan->pool = NULL;
+    }
+    dpiCond__destroy(scan->blocksAvailable);
+    dpiCond__destroy(scan->spaceAvailable);
+    dpiMutex__destroy(scan->mutex);
+    dpiGen__free(scan);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan__getNext() [INTERNAL]
+//   Return the next block of rows produced by the scan, waiting for one to be
+// produced if necessary. In an ordered scan, all of the blocks of one chunk
+// are returned before any of the blocks of the next chunk. If no more blocks
+// will be produced, the block is set to NULL.
+//-----------------------------------------------------------------------------
+int dpiScan__getNext(dpiScan *scan, dpiRowBlock **block, uint32_t *chunkNum,
+        dpiError *error)
+{
+    dpiScanEntry *entry, *prevEntry;
+
+    *block = NULL;
+    dpiMutex__acquire(scan->mutex);
+    while (1) {
+
+        // if a thread has failed, return its error
+        if (scan->failed) {
+            memcpy(error->buffer, &scan->errorBuffer, sizeof(dpiErrorBuffer));
+            dpiMutex__release(scan->mutex);
+            return DPI_FAILURE;
+        }
+
+        // a cancelled scan produces no more blocks
+        if (scan->cancelled)
+            break;
+
+        // look for a block that can be returned
+        prevEntry = NULL;
+        for (entry = scan->firstEntry; entry; entry = entry->next) {
+            if (!scan->ordered || entry->chunkNum == scan->currentChunk)
+                break;
+            prevEntry = entry;
+        }
+        if (entry) {
+            if (prevEntry)
+                prevEntry->next = entry->next;
+            else scan->firstEntry = entry->next;
+            if (scan->lastEntry == entry)
+                scan->lastEntry = prevEntry;
+            scan->numPendingBlocks--;
+            dpiCond__broadcast(scan->spaceAvailable);
+            *block = entry->block;
+            if (chunkNum)
+                *chunkNum = entry->chunkNum;
+            dpiUtils__freeMemory(entry);
+            break;
+        }
+
+        // in an ordered scan, move to the next chunk once all of the blocks
+        // of the current chunk have been returned
+        if (scan->ordered && scan->currentChunk < scan->numChunks &&
+                scan->chunks[scan->currentChunk].complete) {
+            scan->currentChunk++;
+            dpiCond__broadcast(scan->spaceAvailable);
+            continue;
+        }
+
+        // determine if all of the chunks have been returned
+        if (scan->ordered && scan->currentChunk >= scan->numChunks)
+            break;
+        if (!scan->ordered && scan->numChunksComplete == scan->numChunks)
+            break;
+
+        // wait for more blocks to be produced
+        dpiCond__wait(scan->blocksAvailable, scan->mutex);
+
+    }
+    dpiMutex__release(scan->mutex);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan_addRef() [PUBLIC]
+//   Add a reference to the scan.
+//-----------------------------------------------------------------------------
+int dpiScan_addRef(dpiScan *scan)
+{
+    return dpiGen__addRef(scan, DPI_HTYPE_SCAN, __func__);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan_cancel() [PUBLIC]
+//   Cancel the scan. No more blocks are returned by dpiScan_getNext() after
+// this function has been called.
+//-----------------------------------------------------------------------------
+int dpiScan_cancel(dpiScan *scan)
+{
+    dpiError error;
+
+    if (dpiGen__startPublicFn(scan, DPI_HTYPE_SCAN, __func__, &error) < 0)
+        return dpiGen__endPublicFn(scan, DPI_FAILURE, &error);
+    dpiScan__cancel(scan, &error);
+    return dpiGen__endPublicFn(scan, DPI_SUCCESS, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan_getNext() [PUBLIC]
+//   Return the next block of rows produced by the scan. If no more blocks are
+// available, the block is set to NULL.
+//-----------------------------------------------------------------------------
+int dpiScan_getNext(dpiScan *scan, dpiRowBlock **block, uint32_t *chunkNum)
+{
+    dpiError error;
+    int status;
+
+    if (dpiGen__startPublicFn(scan, DPI_HTYPE_SCAN, __func__, &error) < 0)
+        return dpiGen__endPublicFn(scan, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(scan, block)
+    status = dpiScan__getNext(scan, block, chunkNum, &error);
+    return dpiGen__endPublicFn(scan, status, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScan_release() [PUBLIC]
+//   Release a reference to the scan.
+//-----------------------------------------------------------------------------
+int dpiScan_release(dpiScan *scan)
+{
+    return dpiGen__release(scan, DPI_HTYPE_SCAN, __func__);
+}
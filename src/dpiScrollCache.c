@@ -0,0 +1,291 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// dpiScrollCache.c
+//   Implementation of the cache of fetched row blocks used by scrollable
+// statements. Each block holds a copy of the Oracle data buffers of the query
+// variables for one fetch; blocks are replaced on a least recently used basis.
+// Only columns whose Oracle data is self-contained (no descriptors, locators or
+// dynamically allocated chunks) can be cached; if any column of the query does
+// not qualify, nothing is stored and every move goes to the database.
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+
+
+//-----------------------------------------------------------------------------
+// dpiScrollCache__isVarUsable() [INTERNAL]
+//   Return whether the Oracle data of the variable can be copied to and from
+// the cache as plain memory.
+//-----------------------------------------------------------------------------
+static int dpiScrollCache__isVarUsable(dpiVar *var)
+{
+    if (var->isDynamic || var->dynBindBuffers || var->buffer.references ||
+            var->buffer.dynamicBytes || var->buffer.objectIndicator)
+        return 0;
+    switch (var->type->oracleTypeNum) {
+        case DPI_ORACLE_TYPE_TIMESTAMP:
+        case DPI_ORACLE_TYPE_TIMESTAMP_TZ:
+        case DPI_ORACLE_TYPE_TIMESTAMP_LTZ:
+        case DPI_ORACLE_TYPE_INTERVAL_DS:
+        case DPI_ORACLE_TYPE_INTERVAL_YM:
+        case DPI_ORACLE_TYPE_OBJECT:
+            return 0;
+        default:
+            break;
+    }
+    return 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScrollCache__getRowSize() [INTERNAL]
+//   Return the number of bytes required to store one row of the variable.
+//-----------------------------------------------------------------------------
+static size_t dpiScrollCache__getRowSize(dpiVar *var)
+{
+    size_t rowSize;
+
+    rowSize = var->sizeInBytes + sizeof(int16_t) + sizeof(uint32_t);
+    if (var->buffer.returnCode)
+        rowSize += sizeof(uint16_t);
+    return rowSize;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScrollCache__prepare() [INTERNAL]
+//   Determine whether the query variables of the statement can be cached and,
+// if so, the size of each block. This is done once after the cache is cleared,
+// since the query variables cannot change without the cache being cleared.
+//-----------------------------------------------------------------------------
+static void dpiScrollCache__prepare(dpiScrollCache *cache, dpiStmt *stmt)
+{
+    size_t blockSize = 0;
+    uint32_t i;
+    dpiVar *var;
+
+    cache->isUsable = 0;
+    for (i = 0; i < stmt->numQueryVars; i++) {
+        var = stmt->queryVars[i];
+        if (!var || !dpiScrollCache__isVarUsable(var))
+            return;
+        blockSize += dpiScrollCache__getRowSize(var) * stmt->fetchArraySize;
+    }
+    cache->blockSize = blockSize;
+    cache->isUsable = (blockSize > 0);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScrollCache__clear() [INTERNAL]
+//   Discard all of the blocks in the cache. This is called whenever the query
+// variables or fetch array size of the statement change. The memory allocated
+// for the blocks is retained for reuse.
+//-----------------------------------------------------------------------------
+void dpiScrollCache__clear(dpiScrollCache *cache)
+{
+    uint32_t i;
+
+    for (i = 0; i < cache->numBlocks; i++)
+        cache->blocks[i].numRows = 0;
+    cache->isUsable = -1;
+    cache->blockSize = 0;
+    cache->useCounter = 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScrollCache__create() [INTERNAL]
+//   Create a new scroll cache with the specified number of blocks.
+//-----------------------------------------------------------------------------
+int dpiScrollCache__create(dpiScrollCache **cache, uint32_t numBlocks,
+        int readAhead, dpiError *error)
+{
+    dpiScrollCache *tempCache;
+
+    if (dpiUtils__allocateMemory(1, sizeof(dpiScrollCache), 1,
+            "allocate scroll cache", (void**) &tempCache, error) < 0)
+        return DPI_FAILURE;
+    if (dpiUtils__allocateMemory(numBlocks, sizeof(dpiScrollCacheBlock), 1,
+            "allocate scroll cache blocks", (void**) &tempCache->blocks,
+            error) < 0) {
+        dpiUtils__freeMemory(tempCache);
+        return DPI_FAILURE;
+    }
+    tempCache->numBlocks = numBlocks;
+    tempCache->readAhead = readAhead;
+    tempCache->isUsable = -1;
+    *cache = tempCache;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScrollCache__free() [INTERNAL]
+//   Free the memory associated with the scroll cache.
+//-----------------------------------------------------------------------------
+void dpiScrollCache__free(dpiScrollCache *cache)
+{
+    uint32_t i;
+
+    for (i = 0; i < cache->numBlocks; i++) {
+        if (cache->blocks[i].data) {
+            dpiUtils__freeMemory(cache->blocks[i].data);
+            cache->blocks[i].data = NULL;
+        }
+    }
+    dpiUtils__freeMemory(cache->blocks);
+    dpiUtils__freeMemory(cache);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScrollCache__lookup() [INTERNAL]
+//   Look for a block containing the desired row. If one is found, its contents
+// are copied back into the buffers of the query variables and the buffer
+// information of the statement is updated to match; the caller is
+// responsible for positioning within the buffer and for performing the
+// post-fetch conversion.
+//-----------------------------------------------------------------------------
+void dpiScrollCache__lookup(dpiScrollCache *cache, dpiStmt *stmt,
+        uint64_t desiredRow, int *found)
+{
+    dpiScrollCacheBlock *block = NULL;
+    uint32_t i, numRows;
+    char *ptr;
+    dpiVar *var;
+
+    // search for a block containing the row
+    *found = 0;
+    if (cache->isUsable != 1)
+        return;
+    for (i = 0; i < cache->numBlocks; i++) {
+        block = &cache->blocks[i];
+        if (block->numRows > 0 && desiredRow >= block->minRow &&
+                desiredRow < block->minRow + block->numRows)
+            break;
+    }
+    if (i == cache->numBlocks)
+        return;
+
+    // copy the block into the variable buffers
+    numRows = block->numRows;
+    ptr = block->data;
+    for (i = 0; i < stmt->numQueryVars; i++) {
+        var = stmt->queryVars[i];
+        memcpy(var->buffer.data.asRaw, ptr, (size_t) numRows *
+                var->sizeInBytes);
+        ptr += (size_t) numRows * var->sizeInBytes;
+        memcpy(var->buffer.indicator, ptr, numRows * sizeof(int16_t));
+        ptr += numRows * sizeof(int16_t);
+        memcpy(var->buffer.actualLength, ptr, numRows * sizeof(uint32_t));
+        ptr += numRows * sizeof(uint32_t);
+        if (var->buffer.returnCode) {
+            memcpy(var->buffer.returnCode, ptr, numRows * sizeof(uint16_t));
+            ptr += numRows * sizeof(uint16_t);
+        }
+    }
+    block->lastUsed = ++cache->useCounter;
+    stmt->bufferMinRow = block->minRow;
+    stmt->bufferRowCount = numRows;
+    stmt->hasRowsToFetch = block->hasRowsToFetch;
+    *found = 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiScrollCache__store() [INTERNAL]
+//   Store the rows currently in the buffers of the query variables in the
+// cache, replacing the least recently used block (or the block that already
+// starts at the same row). Nothing is stored if the query variables cannot
+// be cached.
+//-----------------------------------------------------------------------------
+int dpiScrollCache__store(dpiScrollCache *cache, dpiStmt *stmt,
+        dpiError *error)
+{
+    dpiScrollCacheBlock *block, *candidate;
+    uint32_t i, numRows;
+    char *ptr;
+    dpiVar *var;
+
+    // determine if the query can be cached at all
+    if (cache->isUsable < 0)
+        dpiScrollCache__prepare(cache, stmt);
+    numRows = stmt->bufferRowCount;
+    if (!cache->isUsable || numRows == 0 || numRows > stmt->fetchArraySize)
+        return DPI_SUCCESS;
+
+    // determine which block to replace
+    block = &cache->blocks[0];
+    for (i = 0; i < cache->numBlocks; i++) {
+        candidate = &cache->blocks[i];
+        if (candidate->numRows > 0 &&
+                candidate->minRow == stmt->bufferMinRow) {
+            block = candidate;
+            break;
+        }
+        if (candidate->numRows == 0 || candidate->lastUsed < block->lastUsed)
+            block = candidate;
+    }
+
+    // ensure the block has sufficient space
+    block->numRows = 0;
+    if (block->allocatedSize < cache->blockSize) {
+        if (block->data) {
+            dpiUtils__freeMemory(block->data);
+            block->data = NULL;
+            block->allocatedSize = 0;
+        }
+        if (dpiUtils__allocateMemory(1, cache->blockSize, 0,
+                "allocate scroll cache block", (void**) &block->data,
+                error) < 0)
+            return DPI_FAILURE;
+        block->allocatedSize = cache->blockSize;
+    }
+
+    // copy the variable buffers into the block
+    ptr = block->data;
+    for (i = 0; i < stmt->numQueryVars; i++) {
+        var = stmt->queryVars[i];
+        memcpy(ptr, var->buffer.data.asRaw, (size_t) numRows *
+                var->sizeInBytes);
+        ptr += (size_t) numRows * var->sizeInBytes;
+        memcpy(ptr, var->buffer.indicator, numRows * sizeof(int16_t));
+        ptr += numRows * sizeof(int16_t);
+        memcpy(ptr, var->buffer.actualLength, numRows * sizeof(uint32_t));
+        ptr += numRows * sizeof(uint32_t);
+        if (var->buffer.returnCode) {
+            memcpy(ptr, var->buffer.returnCode, numRows * sizeof(uint16_t));
+            ptr += numRows * sizeof(uint16_t);
+        }
+    }
+    block->minRow = stmt->bufferMinRow;
+    block->numRows = numRows;
+    block->hasRowsToFetch = stmt->hasRowsToFetch;
+    block->lastUsed = ++cache->useCounter;
+    return DPI_SUCCESS;
+}
@@ -0,0 +1,551 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// dpiSessionState.c
+//   Implementation of the desired session state applied to connections when
+// they are created. For pooled connections, the state last applied to each
+// session is retained in the session context (in serialized form) so that
+// only the values that differ need to be applied the next time the session is
+// acquired from the pool. Values applied through session handle attributes
+// are sent to the database with the next round trip; all other values are
+// applied in a single PL/SQL block.
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+
+// kinds of entries making up the session state
+#define DPI_SESSION_STATE_MODULE                    1
+#define DPI_SESSION_STATE_ACTION                    2
+#define DPI_SESSION_STATE_CLIENT_IDENTIFIER         3
+#define DPI_SESSION_STATE_CLIENT_INFO               4
+#define DPI_SESSION_STATE_CURRENT_SCHEMA            5
+#define DPI_SESSION_STATE_PARAM                     6
+#define DPI_SESSION_STATE_APP_CONTEXT               7
+
+// a single entry of the session state; the names identify the entry within
+// its kind (the parameter name or the namespace and attribute name of the
+// application context) and are empty for attributes
+typedef struct {
+    uint8_t kind;
+    const char *name;
+    uint32_t nameLength;
+    const char *subName;
+    uint32_t subNameLength;
+    const char *value;
+    uint32_t valueLength;
+} dpiSessionStateEntry;
+
+// session state retained in the session context; the data consists of the
+// serialized entries, each one being the kind followed by the name, subName
+// and value, each preceded by its length
+typedef struct {
+    uint32_t length;
+    char data[1];
+} dpiSessionStateStore;
+
+
+//-----------------------------------------------------------------------------
+// dpiSessionState__appendQuoted() [INTERNAL]
+//   Append the value to the SQL being built as a string literal, doubling any
+// embedded quotes. The value is quoted the specified number of times, which
+// permits building a literal nested within another literal. If the buffer is
+// NULL, only the length is calculated.
+//-----------------------------------------------------------------------------
+static void dpiSessionState__appendQuoted(char *sql, uint32_t *sqlLength,
+        const char *value, uint32_t valueLength, uint32_t numQuotes)
+{
+    uint32_t i, j;
+
+    for (j = 0; j < numQuotes; j++) {
+        if (sql)
+            sql[*sqlLength] = '\'';
+        (*sqlLength)++;
+    }
+    for (i = 0; i < valueLength; i++) {
+        if (value[i] == '\'') {
+            for (j = 0; j < numQuotes * 2 - 1; j++) {
+                if (sql)
+                    sql[*sqlLength] = '\'';
+                (*sqlLength)++;
+            }
+        }
+        if (sql)
+            sql[*sqlLength] = value[i];
+        (*sqlLength)++;
+    }
+    for (j = 0; j < numQuotes; j++) {
+        if (sql)
+            sql[*sqlLength] = '\'';
+        (*sqlLength)++;
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSessionState__appendText() [INTERNAL]
+//   Append the text to the SQL being built. If the buffer is NULL, only the
+// length is calculated.
+//-----------------------------------------------------------------------------
+static void dpiSessionState__appendText(char *sql, uint32_t *sqlLength,
+        const char *value, uint32_t valueLength)
+{
+    if (sql)
+        memcpy(sql + *sqlLength, value, valueLength);
+    *sqlLength += valueLength;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSessionState__buildSql() [INTERNAL]
+//   Build the PL/SQL block which applies the parameter and application
+// context entries that have changed. If the buffer is NULL, only the length
+// is calculated.
+//-----------------------------------------------------------------------------
+static void dpiSessionState__buildSql(dpiSessionStateEntry *entries,
+        uint32_t numEntries, int *changed, char *sql, uint32_t *sqlLength)
+{
+    dpiSessionStateEntry *entry;
+    uint32_t i;
+
+    *sqlLength = 0;
+    dpiSessionState__appendText(sql, sqlLength, "begin ", 6);
+    for (i = 0; i < numEntries; i++) {
+        entry = &entries[i];
+        if (!changed[i])
+            continue;
+        if (entry->kind == DPI_SESSION_STATE_PARAM) {
+            dpiSessionState__appendText(sql, sqlLength,
+                    "execute immediate 'alter session set ", 37);
+            dpiSessionState__appendText(sql, sqlLength, entry->name,
+                    entry->nameLength);
+            dpiSessionState__appendText(sql, sqlLength, " = ", 3);
+            dpiSessionState__appendQuoted(sql, sqlLength, entry->value,
+                    entry->valueLength, 2);
+            dpiSessionState__appendText(sql, sqlLength, "'; ", 3);
+        } else if (entry->kind == DPI_SESSION_STATE_APP_CONTEXT) {
+            dpiSessionState__appendText(sql, sqlLength,
+                    "dbms_session.set_context(", 25);
+            dpiSessionState__appendQuoted(sql, sqlLength, entry->name,
+                    entry->nameLength, 1);
+            dpiSessionState__appendText(sql, sqlLength, ", ", 2);
+            dpiSessionState__appendQuoted(sql, sqlLength, entry->subName,
+                    entry->subNameLength, 1);
+            dpiSessionState__appendText(sql, sqlLength, ", ", 2);
+            dpiSessionState__appendQuoted(sql, sqlLength, entry->value,
+                    entry->valueLength, 1);
+            dpiSessionState__appendText(sql, sqlLength, "); ", 3);
+        }
+    }
+    dpiSessionState__appendText(sql, sqlLength, "end;", 4);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSessionState__executeSql() [INTERNAL]
+//   Execute the PL/SQL block which applies the parameter and application
+// context entries that have changed.
+//-----------------------------------------------------------------------------
+static int dpiSessionState__executeSql(dpiConn *conn,
+        dpiSessionStateEntry *entries, uint32_t numEntries, int *changed,
+        dpiError *error)
+{
+    uint32_t sqlLength;
+    dpiStmt *stmt;
+    char *sql;
+    int status;
+
+    dpiSessionState__buildSql(entries, numEntries, changed, NULL, &sqlLength);
+    if (dpiUtils__allocateMemory(1, sqlLength, 0, "allocate session state SQL",
+            (void**) &sql, error) < 0)
+        return DPI_FAILURE;
+    dpiSessionState__buildSql(entries, numEntries, changed, sql, &sqlLength);
+    if (dpiStmt__allocate(conn, 0, 0, &stmt, error) < 0) {
+        dpiUtils__freeMemory(sql);
+        return DPI_FAILURE;
+    }
+    status = dpiStmt__prepare(stmt, sql, sqlLength, NULL, 0, error);
+    if (status == DPI_SUCCESS)
+        status = dpiOci__stmtExecute(stmt, 1, 0, DPI_OCI_DEFAULT, error);
+    dpiStmt__free(stmt, error);
+    dpiUtils__freeMemory(sql);
+    return status;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSessionState__isSameEntry() [INTERNAL]
+//   Return whether the two entries are of the same kind and have the same
+// names (and therefore refer to the same piece of session state).
+//-----------------------------------------------------------------------------
+static int dpiSessionState__isSameEntry(dpiSessionStateEntry *entry1,
+        dpiSessionStateEntry *entry2)
+{
+    return (entry1->kind == entry2->kind &&
+            entry1->nameLength == entry2->nameLength &&
+            entry1->subNameLength == entry2->subNameLength &&
+            (entry1->nameLength == 0 ||
+                    memcmp(entry1->name, entry2->name,
+                            entry1->nameLength) == 0) &&
+            (entry1->subNameLength == 0 ||
+                    memcmp(entry1->subName, entry2->subName,
+                            entry1->subNameLength) == 0));
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSessionState__readEntry() [INTERNAL]
+//   Read the entry found at the given position in the store and advance the
+// position past it.
+//-----------------------------------------------------------------------------
+static void dpiSessionState__readEntry(dpiSessionStateStore *store,
+        uint32_t *pos, dpiSessionStateEntry *entry)
+{
+    entry->kind = (uint8_t) store->data[(*pos)++];
+    memcpy(&entry->nameLength, store->data + *pos, sizeof(uint32_t));
+    entry->name = store->data + *pos + sizeof(uint32_t);
+    *pos += (uint32_t) sizeof(uint32_t) + entry->nameLength;
+    memcpy(&entry->subNameLength, store->data + *pos, sizeof(uint32_t));
+    entry->subName = store->data + *pos + sizeof(uint32_t);
+    *pos += (uint32_t) sizeof(uint32_t) + entry->subNameLength;
+    memcpy(&entry->valueLength, store->data + *pos, sizeof(uint32_t));
+    entry->value = store->data + *pos + sizeof(uint32_t);
+    *pos += (uint32_t) sizeof(uint32_t) + entry->valueLength;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSessionState__hasChanged() [INTERNAL]
+//   Return whether the value of the entry differs from the value last applied
+// to the session, as found in the store (if one exists).
+//-----------------------------------------------------------------------------
+static int dpiSessionState__hasChanged(dpiSessionStateStore *store,
+        dpiSessionStateEntry *entry)
+{
+    dpiSessionStateEntry storedEntry;
+    uint32_t pos = 0;
+
+    if (!store)
+        return 1;
+    while (pos < store->length) {
+        dpiSessionState__readEntry(store, &pos, &storedEntry);
+        if (dpiSessionState__isSameEntry(&storedEntry, entry))
+            return (storedEntry.valueLength != entry->valueLength ||
+                    (entry->valueLength > 0 && memcmp(storedEntry.value,
+                            entry->value, entry->valueLength) != 0));
+    }
+    return 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSessionState__serializeEntry() [INTERNAL]
+//   Serialize the entry into the data buffer. If the buffer is NULL, only the
+// length is calculated.
+//-----------------------------------------------------------------------------
+static void dpiSessionState__serializeEntry(dpiSessionStateEntry *entry,
+        char *data, uint32_t *length)
+{
+    if (data)
+        data[*length] = (char) entry->kind;
+    (*length)++;
+    dpiSessionState__appendText(data, length,
+            (const char*) &entry->nameLength, sizeof(uint32_t));
+    dpiSessionState__appendText(data, length, entry->name,
+            entry->nameLength);
+    dpiSessionState__appendText(data, length,
+            (const char*) &entry->subNameLength, sizeof(uint32_t));
+    dpiSessionState__appendText(data, length, entry->subName,
+            entry->subNameLength);
+    dpiSessionState__appendText(data, length,
+            (const char*) &entry->valueLength, sizeof(uint32_t));
+    dpiSessionState__appendText(data, length, entry->value,
+            entry->valueLength);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSessionState__serialize() [INTERNAL]
+//   Serialize the entries into the data buffer, followed by the entries
+// found in the existing store that are not replaced by one of them. If the
+// buffer is NULL, only the length is calculated.
+//-----------------------------------------------------------------------------
+static void dpiSessionState__serialize(dpiSessionStateEntry *entries,
+        uint32_t numEntries, dpiSessionStateStore *store, char *data,
+        uint32_t *length)
+{
+    dpiSessionStateEntry storedEntry;
+    uint32_t i, pos = 0;
+
+    *length = 0;
+    for (i = 0; i < numEntries; i++)
+        dpiSessionState__serializeEntry(&entries[i], data, length);
+    if (!store)
+        return;
+    while (pos < store->length) {
+        dpiSessionState__readEntry(store, &pos, &storedEntry);
+        for (i = 0; i < numEntries; i++) {
+            if (dpiSessionState__isSameEntry(&entries[i], &storedEntry))
+                break;
+        }
+        if (i == numEntries)
+            dpiSessionState__serializeEntry(&storedEntry, data, length);
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSessionState__store() [INTERNAL]
+//   Replace the state retained in the session context with one that includes
+// the entries that were just applied. If this fails for any reason, the
+// state is simply forgotten so that all entries are applied the next time.
+//-----------------------------------------------------------------------------
+static void dpiSessionState__store(dpiConn *conn,
+        dpiSessionStateEntry *entries, uint32_t numEntries,
+        dpiSessionStateStore *store, dpiError *error)
+{
+    dpiSessionStateStore *newStore;
+    uint32_t length;
+
+    dpiSessionState__serialize(entries, numEntries, store, NULL, &length);
+    if (dpiOci__memoryAlloc(conn, (void**) &newStore,
+            (uint32_t) sizeof(dpiSessionStateStore) + length, 1, error) < 0) {
+        dpiSessionState__forget(conn, error);
+        return;
+    }
+    dpiSessionState__serialize(entries, numEntries, store, newStore->data,
+            &newStore->length);
+    if (dpiOci__contextSetValue(conn, DPI_CONTEXT_SESSION_STATE,
+            (uint32_t) (sizeof(DPI_CONTEXT_SESSION_STATE) - 1), newStore, 1,
+            error) < 0) {
+        dpiOci__memoryFree(conn, newStore, error);
+        dpiSessionState__forget(conn, error);
+        return;
+    }
+    if (store)
+        dpiOci__memoryFree(conn, store, error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSessionState__addEntry() [INTERNAL]
+//   Add an entry to the array of entries, if a value has been specified.
+//-----------------------------------------------------------------------------
+static void dpiSessionState__addEntry(dpiSessionStateEntry *entries,
+        uint32_t *numEntries, uint8_t kind, const char *name,
+        uint32_t nameLength, const char *subName, uint32_t subNameLength,
+        const char *value, uint32_t valueLength)
+{
+    dpiSessionStateEntry *entry;
+
+    if (!value)
+        return;
+    entry = &entries[(*numEntries)++];
+    entry->kind = kind;
+    entry->name = name;
+    entry->nameLength = nameLength;
+    entry->subName = subName;
+    entry->subNameLength = subNameLength;
+    entry->value = value;
+    entry->valueLength = valueLength;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSessionState__getEntries() [INTERNAL]
+//   Populate the array of entries from the desired session state. Parameter
+// names are included in the SQL that is executed so they are verified to
+// contain only the characters permitted in an unquoted identifier.
+//-----------------------------------------------------------------------------
+static int dpiSessionState__getEntries(const dpiSessionState *state,
+        dpiSessionStateEntry *entries, uint32_t *numEntries, dpiError *error)
+{
+    dpiSessionParam *param;
+    dpiAppContext *context;
+    uint32_t i, j;
+    char ch;
+
+    *numEntries = 0;
+    dpiSessionState__addEntry(entries, numEntries, DPI_SESSION_STATE_MODULE,
+            NULL, 0, NULL, 0, state->module, state->moduleLength);
+    dpiSessionState__addEntry(entries, numEntries, DPI_SESSION_STATE_ACTION,
+            NULL, 0, NULL, 0, state->action, state->actionLength);
+    dpiSessionState__addEntry(entries, numEntries,
+            DPI_SESSION_STATE_CLIENT_IDENTIFIER, NULL, 0, NULL, 0,
+            state->clientIdentifier, state->clientIdentifierLength);
+    dpiSessionState__addEntry(entries, numEntries,
+            DPI_SESSION_STATE_CLIENT_INFO, NULL, 0, NULL, 0,
+            state->clientInfo, state->clientInfoLength);
+    dpiSessionState__addEntry(entries, numEntries,
+            DPI_SESSION_STATE_CURRENT_SCHEMA, NULL, 0, NULL, 0,
+            state->currentSchema, state->currentSchemaLength);
+    for (i = 0; i < state->numParams; i++) {
+        param = &state->params[i];
+        if (!param->name || param->nameLength == 0 || !param->value)
+            return dpiError__set(error, "check session parameter",
+                    DPI_ERR_INVALID_SESSION_PARAM,
+                    (param->name) ? param->nameLength : 0,
+                    (param->name) ? param->name : "");
+        for (j = 0; j < param->nameLength; j++) {
+            ch = param->name[j];
+            if ((ch < 'A' || ch > 'Z') && (ch < 'a' || ch > 'z') &&
+                    (ch < '0' || ch > '9') && ch != '_')
+                return dpiError__set(error, "check session parameter",
+                        DPI_ERR_INVALID_SESSION_PARAM, param->nameLength,
+                        param->name);
+        }
+        dpiSessionState__addEntry(entries, numEntries,
+                DPI_SESSION_STATE_PARAM, param->name, param->nameLength, NULL,
+                0, param->value, param->valueLength);
+    }
+    for (i = 0; i < state->numAppContext; i++) {
+        context = &state->appContext[i];
+        dpiSessionState__addEntry(entries, numEntries,
+                DPI_SESSION_STATE_APP_CONTEXT, context->namespaceName,
+                context->namespaceNameLength, context->name,
+                context->nameLength, context->value, context->valueLength);
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSessionState__apply() [INTERNAL]
+//   Apply the desired session state to the connection. For pooled
+// connections, only the values that differ from the ones last applied to the
+// session are applied and the state retained in the session is updated.
+//-----------------------------------------------------------------------------
+int dpiSessionState__apply(dpiConn *conn, const dpiSessionState *state,
+        dpiError *error)
+{
+    uint32_t i, numEntries, attribute;
+    dpiSessionStateEntry *entries;
+    dpiSessionStateStore *store;
+    int *changed, needsSql;
+
+    // allocate memory for the entries and determine them
+    numEntries = 5 + state->numParams + state->numAppContext;
+    if (dpiUtils__allocateMemory(numEntries, sizeof(dpiSessionStateEntry), 0,
+            "allocate session state entries", (void**) &entries, error) < 0)
+        return DPI_FAILURE;
+    if (dpiUtils__allocateMemory(numEntries, sizeof(int), 0,
+            "allocate session state flags", (void**) &changed, error) < 0) {
+        dpiUtils__freeMemory(entries);
+        return DPI_FAILURE;
+    }
+    if (dpiSessionState__getEntries(state, entries, &numEntries,
+            error) < 0) {
+        dpiUtils__freeMemory(changed);
+        dpiUtils__freeMemory(entries);
+        return DPI_FAILURE;
+    }
+
+    // get the state last applied to the session, if applicable
+    store = NULL;
+    if (conn->pool && dpiOci__contextGetValue(conn,
+            DPI_CONTEXT_SESSION_STATE,
+            (uint32_t) (sizeof(DPI_CONTEXT_SESSION_STATE) - 1),
+            (void**) &store, 1, error) < 0) {
+        dpiUtils__freeMemory(changed);
+        dpiUtils__freeMemory(entries);
+        return DPI_FAILURE;
+    }
+
+    // set the attributes that have changed on the session handle; these are
+    // sent to the database with the next round trip
+    needsSql = 0;
+    for (i = 0; i < numEntries; i++) {
+        changed[i] = dpiSessionState__hasChanged(store, &entries[i]);
+        if (!changed[i])
+            continue;
+        switch (entries[i].kind) {
+            case DPI_SESSION_STATE_MODULE:
+                attribute = DPI_OCI_ATTR_MODULE;
+                break;
+            case DPI_SESSION_STATE_ACTION:
+                attribute = DPI_OCI_ATTR_ACTION;
+                break;
+            case DPI_SESSION_STATE_CLIENT_IDENTIFIER:
+                attribute = DPI_OCI_ATTR_CLIENT_IDENTIFIER;
+                break;
+            case DPI_SESSION_STATE_CLIENT_INFO:
+                attribute = DPI_OCI_ATTR_CLIENT_INFO;
+                break;
+            case DPI_SESSION_STATE_CURRENT_SCHEMA:
+                attribute = DPI_OCI_ATTR_CURRENT_SCHEMA;
+                break;
+            default:
+                needsSql = 1;
+                continue;
+        }
+        if (dpiOci__attrSet(conn->sessionHandle, DPI_OCI_HTYPE_SESSION,
+                (void*) entries[i].value, entries[i].valueLength, attribute,
+                "set session value", error) < 0)
+            break;
+    }
+
+    // apply all other changes in a single round trip
+    if (i == numEntries && needsSql &&
+            dpiSessionState__executeSql(conn, entries, numEntries, changed,
+                    error) < 0)
+        i = 0;
+
+    // if all changes were applied successfully, retain the state that was
+    // applied; otherwise, the state of the session is unknown and is
+    // forgotten
+    if (conn->pool) {
+        if (i == numEntries)
+            dpiSessionState__store(conn, entries, numEntries, store, error);
+        else dpiSessionState__forget(conn, error);
+    }
+
+    dpiUtils__freeMemory(changed);
+    dpiUtils__freeMemory(entries);
+    return (i == numEntries) ? DPI_SUCCESS : DPI_FAILURE;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSessionState__forget() [INTERNAL]
+//   Forget the state retained in the session context. This is done whenever
+// the state of the session is changed by other means or the session is going
+// to be dropped.
+//-----------------------------------------------------------------------------
+void dpiSessionState__forget(dpiConn *conn, dpiError *error)
+{
+    dpiSessionStateStore *store = NULL;
+
+    if (!conn->pool || !conn->sessionHandle)
+        return;
+    dpiOci__contextGetValue(conn, DPI_CONTEXT_SESSION_STATE,
+            (uint32_t) (sizeof(DPI_CONTEXT_SESSION_STATE) - 1),
+            (void**) &store, 0, error);
+    if (!store)
+        return;
+    dpiOci__contextSetValue(conn, DPI_CONTEXT_SESSION_STATE,
+            (uint32_t) (sizeof(DPI_CONTEXT_SESSION_STATE) - 1), NULL, 0,
+            error);
+    dpiOci__memoryFree(conn, store, error);
+}
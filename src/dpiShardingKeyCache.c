@@ -0,0 +1,266 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// dpiShardingKeyCache.c
+//   Implementation of the cache of sharding key descriptors held by a pool.
+// Each entry is identified by the sharding key column values in serialized
+// form. Entries are added until the cache is full and are only removed when
+// the pool is freed, since a descriptor may be in use by a connection being
+// acquired from the pool at any time.
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+
+
+//-----------------------------------------------------------------------------
+// dpiShardingKeyCache__append() [INTERNAL]
+//   Append the value to the key being built. If the key is NULL, only the
+// length is calculated.
+//-----------------------------------------------------------------------------
+static void dpiShardingKeyCache__append(char *key, uint32_t *keyLength,
+        const void *value, uint32_t valueLength)
+{
+    if (key)
+        memcpy(key + *keyLength, value, valueLength);
+    *keyLength += valueLength;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiShardingKeyCache__serialize() [INTERNAL]
+//   Serialize the sharding key column values into the key. If the key is
+// NULL, only the length is calculated. Columns with native types that cannot
+// be used for sharding keys result in a length of zero, in which case the
+// key is not cached.
+//-----------------------------------------------------------------------------
+static void dpiShardingKeyCache__serialize(dpiShardingKeyColumn *columns,
+        uint8_t numColumns, char *key, uint32_t *keyLength)
+{
+    dpiShardingKeyColumn *column;
+    dpiTimestamp *timestamp;
+    uint32_t typeNums[2];
+    uint8_t i;
+
+    *keyLength = 0;
+    for (i = 0; i < numColumns; i++) {
+        column = &columns[i];
+        typeNums[0] = column->oracleTypeNum;
+        typeNums[1] = column->nativeTypeNum;
+        dpiShardingKeyCache__append(key, keyLength, typeNums,
+                sizeof(typeNums));
+        switch (column->nativeTypeNum) {
+            case DPI_NATIVE_TYPE_BYTES:
+                dpiShardingKeyCache__append(key, keyLength,
+                        &column->value.asBytes.length, sizeof(uint32_t));
+                dpiShardingKeyCache__append(key, keyLength,
+                        column->value.asBytes.ptr,
+                        column->value.asBytes.length);
+                break;
+            case DPI_NATIVE_TYPE_INT64:
+            case DPI_NATIVE_TYPE_UINT64:
+            case DPI_NATIVE_TYPE_DOUBLE:
+                dpiShardingKeyCache__append(key, keyLength,
+                        &column->value.asInt64, sizeof(int64_t));
+                break;
+            case DPI_NATIVE_TYPE_TIMESTAMP:
+                timestamp = &column->value.asTimestamp;
+                dpiShardingKeyCache__append(key, keyLength, &timestamp->year,
+                        sizeof(timestamp->year));
+                dpiShardingKeyCache__append(key, keyLength, &timestamp->month,
+                        5 * sizeof(uint8_t));
+                dpiShardingKeyCache__append(key, keyLength,
+                        &timestamp->fsecond, sizeof(timestamp->fsecond));
+                dpiShardingKeyCache__append(key, keyLength,
+                        &timestamp->tzHourOffset, 2 * sizeof(int8_t));
+                break;
+            default:
+                *keyLength = 0;
+                return;
+        }
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiShardingKeyCache__buildKey() [INTERNAL]
+//   Build the serialized form of the sharding key column values and calculate
+// its hash (FNV-1a). If the key cannot be cached, NULL is returned.
+//-----------------------------------------------------------------------------
+static int dpiShardingKeyCache__buildKey(dpiShardingKeyColumn *columns,
+        uint8_t numColumns, char **key, uint32_t *keyLength, uint32_t *hash,
+        dpiError *error)
+{
+    uint32_t i;
+
+    *key = NULL;
+    dpiShardingKeyCache__serialize(columns, numColumns, NULL, keyLength);
+    if (*keyLength == 0)
+        return DPI_SUCCESS;
+    if (dpiUtils__allocateMemory(1, *keyLength, 0, "allocate sharding key",
+            (void**) key, error) < 0)
+        return DPI_FAILURE;
+    dpiShardingKeyCache__serialize(columns, numColumns, *key, keyLength);
+    *hash = 2166136261u;
+    for (i = 0; i < *keyLength; i++) {
+        *hash ^= (uint8_t) (*key)[i];
+        *hash *= 16777619u;
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiShardingKeyCache__find() [INTERNAL]
+//   Return the entry matching the key or NULL if no such entry exists. The
+// mutex is expected to be held by the caller.
+//-----------------------------------------------------------------------------
+static dpiShardingKeyCacheEntry *dpiShardingKeyCache__find(
+        dpiShardingKeyCache *cache, const char *key, uint32_t keyLength,
+        uint32_t hash)
+{
+    dpiShardingKeyCacheEntry *entry;
+    uint32_t i;
+
+    for (i = 0; i < cache->numEntries; i++) {
+        entry = &cache->entries[i];
+        if (entry->hash == hash && entry->keyLength == keyLength &&
+                memcmp(entry->key, key, keyLength) == 0)
+            return entry;
+    }
+    return NULL;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiShardingKeyCache__add() [INTERNAL]
+//   Add the descriptor built for the sharding key column values to the cache.
+// If the descriptor was added, ownership passes to the cache and the
+// descriptor is set to NULL; otherwise (the cache is full, the key cannot be
+// cached or another thread added the same key first) it remains owned by the
+// caller.
+//-----------------------------------------------------------------------------
+int dpiShardingKeyCache__add(dpiShardingKeyCache *cache,
+        dpiShardingKeyColumn *columns, uint8_t numColumns, void **descriptor,
+        dpiError *error)
+{
+    dpiShardingKeyCacheEntry *entry;
+    uint32_t keyLength, hash;
+    char *key;
+
+    if (dpiShardingKeyCache__buildKey(columns, numColumns, &key, &keyLength,
+            &hash, error) < 0)
+        return DPI_FAILURE;
+    if (!key)
+        return DPI_SUCCESS;
+    dpiMutex__acquire(cache->mutex);
+    if (cache->numEntries < DPI_MAX_SHARDING_KEY_CACHE_ENTRIES &&
+            !dpiShardingKeyCache__find(cache, key, keyLength, hash)) {
+        entry = &cache->entries[cache->numEntries++];
+        entry->hash = hash;
+        entry->keyLength = keyLength;
+        entry->key = key;
+        entry->descriptor = *descriptor;
+        *descriptor = NULL;
+        key = NULL;
+    }
+    dpiMutex__release(cache->mutex);
+    if (key)
+        dpiUtils__freeMemory(key);
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiShardingKeyCache__create() [INTERNAL]
+//   Create a new, empty sharding key cache.
+//-----------------------------------------------------------------------------
+int dpiShardingKeyCache__create(dpiShardingKeyCache **cache, dpiError *error)
+{
+    dpiShardingKeyCache *tempCache;
+
+    if (dpiUtils__allocateMemory(1, sizeof(dpiShardingKeyCache), 1,
+            "allocate sharding key cache", (void**) &tempCache, error) < 0)
+        return DPI_FAILURE;
+    if (dpiUtils__allocateMemory(DPI_MAX_SHARDING_KEY_CACHE_ENTRIES,
+            sizeof(dpiShardingKeyCacheEntry), 1,
+            "allocate sharding key cache entries",
+            (void**) &tempCache->entries, error) < 0) {
+        dpiUtils__freeMemory(tempCache);
+        return DPI_FAILURE;
+    }
+    dpiMutex__initialize(tempCache->mutex);
+    *cache = tempCache;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiShardingKeyCache__free() [INTERNAL]
+//   Free the descriptors held by the cache and the memory associated with it.
+//-----------------------------------------------------------------------------
+void dpiShardingKeyCache__free(dpiShardingKeyCache *cache)
+{
+    dpiShardingKeyCacheEntry *entry;
+    uint32_t i;
+
+    for (i = 0; i < cache->numEntries; i++) {
+        entry = &cache->entries[i];
+        dpiOci__descriptorFree(entry->descriptor, DPI_OCI_DTYPE_SHARDING_KEY);
+        dpiUtils__freeMemory(entry->key);
+    }
+    dpiMutex__destroy(cache->mutex);
+    dpiUtils__freeMemory(cache->entries);
+    dpiUtils__freeMemory(cache);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiShardingKeyCache__lookup() [INTERNAL]
+//   Look for a descriptor built earlier for the same sharding key column
+// values. If none is found, the descriptor is set to NULL.
+//-----------------------------------------------------------------------------
+int dpiShardingKeyCache__lookup(dpiShardingKeyCache *cache,
+        dpiShardingKeyColumn *columns, uint8_t numColumns, void **descriptor,
+        dpiError *error)
+{
+    dpiShardingKeyCacheEntry *entry;
+    uint32_t keyLength, hash;
+    char *key;
+
+    *descriptor = NULL;
+    if (dpiShardingKeyCache__buildKey(columns, numColumns, &key, &keyLength,
+            &hash, error) < 0)
+        return DPI_FAILURE;
+    if (!key)
+        return DPI_SUCCESS;
+    dpiMutex__acquire(cache->mutex);
+    entry = dpiShardingKeyCache__find(cache, key, keyLength, hash);
+    if (entry)
+        *descriptor = entry->descriptor;
+    dpiMutex__release(cache->mutex);
+    dpiUtils__freeMemory(key);
+    return DPI_SUCCESS;
+}
@@ -0,0 +1,178 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// dpiSnapshot.c
+//   Implementation of read consistency snapshots shared between connections.
+// A snapshot is the system change number (SCN) captured on one connection.
+// When it is set on another connection, the session is placed in flashback
+// mode at that SCN (using the package DBMS_FLASHBACK) before the next
+// statement is prepared, so that all queries executed on the connection see
+// the data as it was at that SCN. Cursors opened in flashback mode continue to
+// return data as of the SCN after flashback mode has been disabled. Flashback
+// mode is disabled again before a connection is released back to a pool.
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+
+// SQL used to capture the current SCN
+static const char *dpiSnapshot__captureSql =
+        "select cast(dbms_flashback.get_system_change_number as number(18)) "
+        "from dual";
+
+// SQL used to place the session in flashback mode at an SCN; flashback mode
+// must be disabled before it can be enabled at a different SCN
+static const char *dpiSnapshot__enableSql =
+        "begin "
+        "dbms_flashback.disable; "
+        "dbms_flashback.enable_at_system_change_number(:1); "
+        "end;";
+
+// SQL used to take the session out of flashback mode
+static const char *dpiSnapshot__disableSql =
+        "begin dbms_flashback.disable; end;";
+
+
+//-----------------------------------------------------------------------------
+// dpiSnapshot__executeSql() [INTERNAL]
+//   Execute the PL/SQL block which enables or disables flashback mode. If the
+// SCN is non-zero it is bound to the block. The block is executed directly so
+// that the transaction state tracked by the connection is not affected.
+//-----------------------------------------------------------------------------
+static int dpiSnapshot__executeSql(dpiConn *conn, const char *sql,
+        uint64_t scn, dpiError *error)
+{
+    dpiData *data;
+    dpiStmt *stmt;
+    dpiVar *var;
+    int status;
+
+    if (dpiStmt__allocate(conn, 0, 0, &stmt, error) < 0)
+        return DPI_FAILURE;
+    status = dpiStmt__prepare(stmt, sql, (uint32_t) strlen(sql), NULL, 0,
+            error);
+    if (status == DPI_SUCCESS && scn > 0) {
+        status = dpiVar__allocate(conn, DPI_ORACLE_TYPE_NUMBER,
+                DPI_NATIVE_TYPE_UINT64, 1, 0, 0, 0, NULL, &var, &data, error);
+        if (status == DPI_SUCCESS) {
+            data->isNull = 0;
+            data->value.asUint64 = scn;
+            status = dpiStmt__bind(stmt, var, 1, NULL, 0, error);
+            dpiGen__setRefCount(var, error, -1);
+        }
+    }
+    if (status == DPI_SUCCESS)
+        status = dpiOci__stmtExecute(stmt, 1, 0, DPI_OCI_DEFAULT, error);
+    dpiStmt__free(stmt, error);
+    return status;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSnapshot__apply() [INTERNAL]
+//   Enable flashback mode at the SCN of the snapshot set on the connection or
+// disable it if the snapshot has been cleared. The snapshot is marked as
+// applied before the PL/SQL block is prepared so that it is not applied again
+// when that block is prepared; if the block fails, the snapshot that was in
+// effect previously is retained so that flashback mode is still disabled
+// before the connection is released.
+//-----------------------------------------------------------------------------
+int dpiSnapshot__apply(dpiConn *conn, dpiError *error)
+{
+    uint64_t prevScn = conn->appliedSnapshotScn;
+
+    conn->appliedSnapshotScn = conn->snapshotScn;
+    if (dpiSnapshot__executeSql(conn, (conn->snapshotScn > 0) ?
+            dpiSnapshot__enableSql : dpiSnapshot__disableSql,
+            conn->snapshotScn, error) < 0) {
+        conn->appliedSnapshotScn = prevScn;
+        return DPI_FAILURE;
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSnapshot__capture() [INTERNAL]
+//   Capture the current SCN of the database. A query is used (rather than a
+// PL/SQL block) so that the transaction state tracked by the connection is not
+// affected.
+//-----------------------------------------------------------------------------
+int dpiSnapshot__capture(dpiConn *conn, dpiSnapshot *snapshot,
+        dpiError *error)
+{
+    dpiRowBlock *block;
+    dpiStmt *stmt;
+    dpiData *data;
+
+    if (dpiStmt__allocate(conn, 0, 0, &stmt, error) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt__prepare(stmt, dpiSnapshot__captureSql,
+                    (uint32_t) strlen(dpiSnapshot__captureSql), NULL, 0,
+                    error) < 0 ||
+            dpiStmt__execute(stmt, 0, DPI_MODE_EXEC_DEFAULT, 1, error) < 0 ||
+            dpiStmt__fetchRowBlock(stmt, &block, error) < 0) {
+        dpiGen__setRefCount(stmt, error, -1);
+        return DPI_FAILURE;
+    }
+    dpiGen__setRefCount(stmt, error, -1);
+    if (!block)
+        return dpiError__set(error, "capture snapshot",
+                DPI_ERR_NO_ROW_FETCHED);
+    data = &block->buffers[0].externalData[0];
+    snapshot->scn = (data->isNull) ? 0 : (uint64_t) data->value.asInt64;
+    dpiGen__setRefCount(block, error, -1);
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSnapshot__release() [INTERNAL]
+//   Disable flashback mode before the connection is released back to the
+// pool, if a snapshot was set on it. If this fails, the session is dropped
+// from the pool instead so that no other user of the pool sees the snapshot.
+// This may be called after the last reference to the connection has been
+// released, so a reference is acquired directly while the PL/SQL block is
+// executed; otherwise, releasing the reference held by the statement would
+// free the connection a second time!
+//-----------------------------------------------------------------------------
+void dpiSnapshot__release(dpiConn *conn, dpiError *error)
+{
+    if (conn->snapshotScn == 0 && conn->appliedSnapshotScn == 0)
+        return;
+    conn->snapshotScn = 0;
+    conn->appliedSnapshotScn = 0;
+    if (conn->env->threaded)
+        dpiMutex__acquire(conn->env->mutex);
+    conn->refCount += 1;
+    if (conn->env->threaded)
+        dpiMutex__release(conn->env->mutex);
+    if (dpiSnapshot__executeSql(conn, dpiSnapshot__disableSql, 0, error) < 0)
+        conn->deadSession = 1;
+    if (conn->env->threaded)
+        dpiMutex__acquire(conn->env->mutex);
+    conn->refCount -= 1;
+    if (conn->env->threaded)
+        dpiMutex__release(conn->env->mutex);
+}
@@ -79,6 +79,10 @@ static int dpiSodaColl__check(dpiSodaColl *coll, const char *fnName,
         return DPI_FAILURE;
     if (!coll->db->conn->handle || coll->db->conn->closing)
         return dpiError__set(error, "check connection", DPI_ERR_NOT_CONNECTED);
+
+    // SODA operations may start or end transactions without the client
+    // knowing about it
+    coll->db->conn->transactionState = DPI_TXN_STATE_UNKNOWN;
     return DPI_SUCCESS;
 }
 
@@ -191,7 +195,7 @@ void dpiSodaColl__free(dpiSodaColl *coll, dpiError *error)
         dpiGen__setRefCount(coll->db, error, -1);
         coll->db = NULL;
     }
-    dpiUtils__freeMemory(coll);
+    dpiGen__free(coll);
 }
 
 
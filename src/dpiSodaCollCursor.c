@@ -84,7 +84,7 @@ void dpiSodaCollCursor__free(dpiSodaCollCursor *cursor, dpiError *error)
         dpiGen__setRefCount(cursor->db, error, -1);
         cursor->db = NULL;
     }
-    dpiUtils__freeMemory(cursor);
+    dpiGen__free(cursor);
 }
 
 
@@ -40,6 +40,10 @@ static int dpiSodaDb__checkConnected(dpiSodaDb *db, const char *fnName,
         return DPI_FAILURE;
     if (!db->conn->handle || db->conn->closing)
         return dpiError__set(error, "check connection", DPI_ERR_NOT_CONNECTED);
+
+    // SODA operations may start or end transactions without the client
+    // knowing about it
+    db->conn->transactionState = DPI_TXN_STATE_UNKNOWN;
     return DPI_SUCCESS;
 }
 
@@ -159,7 +163,7 @@ void dpiSodaDb__free(dpiSodaDb *db, dpiError *error)
         dpiGen__setRefCount(db->conn, error, -1);
         db->conn = NULL;
     }
-    dpiUtils__freeMemory(db);
+    dpiGen__free(db);
 }
 
 
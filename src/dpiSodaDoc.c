@@ -120,7 +120,7 @@ void dpiSodaDoc__free(dpiSodaDoc *doc, dpiError *error)
         dpiGen__setRefCount(doc->db, error, -1);
         doc->db = NULL;
     }
-    dpiUtils__freeMemory(doc);
+    dpiGen__free(doc);
 }
 
 
@@ -84,7 +84,7 @@ void dpiSodaDocCursor__free(dpiSodaDocCursor *cursor, dpiError *error)
         dpiGen__setRefCount(cursor->coll, error, -1);
         cursor->coll = NULL;
     }
-    dpiUtils__freeMemory(cursor);
+    dpiGen__free(cursor);
 }
 
 
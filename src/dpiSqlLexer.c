@@ -0,0 +1,255 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// dpiSqlLexer.c
+//   Implementation of a simple lexer for SQL and PL/SQL text. It only needs to
+// be accurate enough to find bind placeholders and literals without being
+// confused by the contents of strings, quoted identifiers and comments; the
+// text itself is never modified.
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlLexer__isWordChar() [INTERNAL]
+//   Return whether the character may be part of an unquoted identifier or
+// keyword. Bytes outside the ASCII range are treated as identifier characters
+// so that multibyte characters are never split.
+//-----------------------------------------------------------------------------
+static int dpiSqlLexer__isWordChar(char ch)
+{
+    return (isalnum((unsigned char) ch) || ch == '_' || ch == '$' ||
+            ch == '#' || (unsigned char) ch >= 0x80);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlLexer__scanNumber() [INTERNAL]
+//   Scan a numeric literal starting at the current position. A period that is
+// followed by another period is not consumed since it forms part of the range
+// operator used in PL/SQL.
+//-----------------------------------------------------------------------------
+static void dpiSqlLexer__scanNumber(dpiSqlLexer *lexer)
+{
+    const char *sql = lexer->sql;
+    uint32_t pos = lexer->pos;
+
+    while (pos < lexer->sqlLength && isdigit((unsigned char) sql[pos]))
+        pos++;
+    if (pos < lexer->sqlLength && sql[pos] == '.' &&
+            (pos + 1 >= lexer->sqlLength || sql[pos + 1] != '.')) {
+        pos++;
+        while (pos < lexer->sqlLength && isdigit((unsigned char) sql[pos]))
+            pos++;
+    }
+    if (pos + 1 < lexer->sqlLength && (sql[pos] == 'e' || sql[pos] == 'E')) {
+        if (isdigit((unsigned char) sql[pos + 1])) {
+            pos += 2;
+        } else if (pos + 2 < lexer->sqlLength &&
+                (sql[pos + 1] == '+' || sql[pos + 1] == '-') &&
+                isdigit((unsigned char) sql[pos + 2])) {
+            pos += 3;
+        }
+        while (pos < lexer->sqlLength && isdigit((unsigned char) sql[pos]))
+            pos++;
+    }
+    if (pos < lexer->sqlLength && (sql[pos] == 'f' || sql[pos] == 'F' ||
+            sql[pos] == 'd' || sql[pos] == 'D') &&
+            (pos + 1 >= lexer->sqlLength ||
+            !dpiSqlLexer__isWordChar(sql[pos + 1])))
+        pos++;
+    lexer->tokenType = DPI_SQL_TOKEN_NUMBER;
+    lexer->pos = pos;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlLexer__scanString() [INTERNAL]
+//   Scan a string literal whose opening quote is at the specified position.
+// Both the standard form (with embedded quotes doubled) and the alternative
+// quoting form (q'[...]') are supported; the prefix has already been consumed
+// by the caller. An unterminated string extends to the end of the text.
+//-----------------------------------------------------------------------------
+static void dpiSqlLexer__scanString(dpiSqlLexer *lexer, uint32_t pos,
+        int alternativeQuoting)
+{
+    const char *sql = lexer->sql;
+    char endChar;
+
+    lexer->tokenType = DPI_SQL_TOKEN_STRING;
+    pos++;
+    if (alternativeQuoting && pos < lexer->sqlLength) {
+        switch (sql[pos]) {
+            case '[': endChar = ']'; break;
+            case '{': endChar = '}'; break;
+            case '<': endChar = '>'; break;
+            case '(': endChar = ')'; break;
+            default: endChar = sql[pos];
+        }
+        for (pos++; pos + 1 < lexer->sqlLength; pos++) {
+            if (sql[pos] == endChar && sql[pos + 1] == '\'') {
+                lexer->pos = pos + 2;
+                return;
+            }
+        }
+    } else {
+        while (pos < lexer->sqlLength) {
+            if (sql[pos++] != '\'')
+                continue;
+            if (pos < lexer->sqlLength && sql[pos] == '\'') {
+                pos++;
+                continue;
+            }
+            lexer->pos = pos;
+            return;
+        }
+    }
+    lexer->pos = lexer->sqlLength;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlLexer__init() [INTERNAL]
+//   Initialize the lexer to scan the specified SQL text.
+//-----------------------------------------------------------------------------
+void dpiSqlLexer__init(dpiSqlLexer *lexer, const char *sql,
+        uint32_t sqlLength)
+{
+    lexer->sql = sql;
+    lexer->sqlLength = sqlLength;
+    lexer->pos = 0;
+    lexer->tokenType = 0;
+    lexer->tokenPos = 0;
+    lexer->tokenLength = 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlLexer__next() [INTERNAL]
+//   Scan the next token in the SQL text and return 1 if one was found or 0 if
+// the end of the text was reached. The type, position and length of the token
+// are stored in the lexer.
+//-----------------------------------------------------------------------------
+int dpiSqlLexer__next(dpiSqlLexer *lexer)
+{
+    const char *sql = lexer->sql;
+    uint32_t pos = lexer->pos;
+    char ch, nextCh;
+
+    if (pos >= lexer->sqlLength)
+        return 0;
+    lexer->tokenPos = pos;
+    ch = sql[pos];
+    nextCh = (pos + 1 < lexer->sqlLength) ? sql[pos + 1] : '\0';
+
+    // white space
+    if (isspace((unsigned char) ch)) {
+        while (pos < lexer->sqlLength && isspace((unsigned char) sql[pos]))
+            pos++;
+        lexer->tokenType = DPI_SQL_TOKEN_SPACE;
+        lexer->pos = pos;
+
+    // single line comments (including hints)
+    } else if (ch == '-' && nextCh == '-') {
+        while (pos < lexer->sqlLength && sql[pos] != '\n')
+            pos++;
+        lexer->tokenType = DPI_SQL_TOKEN_COMMENT;
+        lexer->pos = pos;
+
+    // multiple line comments (including hints)
+    } else if (ch == '/' && nextCh == '*') {
+        for (pos += 2; pos + 1 < lexer->sqlLength; pos++) {
+            if (sql[pos] == '*' && sql[pos + 1] == '/')
+                break;
+        }
+        lexer->tokenType = DPI_SQL_TOKEN_COMMENT;
+        lexer->pos = (pos + 1 < lexer->sqlLength) ? pos + 2 :
+                lexer->sqlLength;
+
+    // quoted identifiers
+    } else if (ch == '"') {
+        pos++;
+        while (pos < lexer->sqlLength && sql[pos] != '"')
+            pos++;
+        lexer->tokenType = DPI_SQL_TOKEN_QUOTED_NAME;
+        lexer->pos = (pos < lexer->sqlLength) ? pos + 1 : lexer->sqlLength;
+
+    // string literals
+    } else if (ch == '\'') {
+        dpiSqlLexer__scanString(lexer, pos, 0);
+
+    // numeric literals
+    } else if (isdigit((unsigned char) ch) ||
+            (ch == '.' && isdigit((unsigned char) nextCh))) {
+        dpiSqlLexer__scanNumber(lexer);
+
+    // bind placeholders; the name may be an identifier, a number or a quoted
+    // identifier
+    } else if (ch == ':' && (dpiSqlLexer__isWordChar(nextCh) ||
+            nextCh == '"')) {
+        pos++;
+        if (nextCh == '"') {
+            pos++;
+            while (pos < lexer->sqlLength && sql[pos] != '"')
+                pos++;
+            if (pos < lexer->sqlLength)
+                pos++;
+        } else {
+            while (pos < lexer->sqlLength &&
+                    dpiSqlLexer__isWordChar(sql[pos]))
+                pos++;
+        }
+        lexer->tokenType = DPI_SQL_TOKEN_BIND;
+        lexer->pos = pos;
+
+    // identifiers and keywords; the prefixes of national character and
+    // alternatively quoted string literals are recognized here
+    } else if (dpiSqlLexer__isWordChar(ch)) {
+        if ((ch == 'n' || ch == 'N') && nextCh == '\'') {
+            dpiSqlLexer__scanString(lexer, pos + 1, 0);
+        } else if ((ch == 'q' || ch == 'Q') && nextCh == '\'') {
+            dpiSqlLexer__scanString(lexer, pos + 1, 1);
+        } else if ((ch == 'n' || ch == 'N') && (nextCh == 'q' ||
+                nextCh == 'Q') && pos + 2 < lexer->sqlLength &&
+                sql[pos + 2] == '\'') {
+            dpiSqlLexer__scanString(lexer, pos + 2, 1);
+        } else {
+            while (pos < lexer->sqlLength &&
+                    dpiSqlLexer__isWordChar(sql[pos]))
+                pos++;
+            lexer->tokenType = DPI_SQL_TOKEN_WORD;
+            lexer->pos = pos;
+        }
+
+    // all other characters are returned as single character tokens
+    } else {
+        lexer->tokenType = DPI_SQL_TOKEN_OTHER;
+        lexer->pos = pos + 1;
+    }
+
+    lexer->tokenLength = lexer->pos - lexer->tokenPos;
+    return 1;
+}
@@ -0,0 +1,524 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// dpiSqlNormalizer.c
+//   Implementation of the SQL normalizer. When enabled for a context, the
+// numeric and string literals found in queries and DML statements are
+// replaced by bind placeholders before the statement is prepared and the
+// values of the literals are bound automatically, so that statements which
+// only differ in their literals share a single entry in the statement cache
+// and a single cursor on the server. Literals are only replaced where a bind
+// variable is known to be permitted and to have the same meaning; statements
+// that already contain bind placeholders are left untouched.
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+
+// maximum depth of parentheses that is tracked; literals nested more deeply
+// than this are left untouched
+#define DPI_SQL_NORMALIZER_MAX_DEPTH        32
+
+// kinds of parentheses that are tracked
+#define DPI_SQL_NORMALIZER_PAREN_DEFAULT    0
+#define DPI_SQL_NORMALIZER_PAREN_TYPE       1
+#define DPI_SQL_NORMALIZER_PAREN_LITERAL    2
+
+// maximum length of a string literal that is replaced; longer strings cannot
+// be bound as fixed length character strings
+#define DPI_SQL_NORMALIZER_MAX_STRING       2000
+
+// keywords which introduce a typed literal; the string that follows cannot be
+// replaced by a bind variable
+static const char *dpiSqlNormalizer__typedLiteralWords[] = {
+    "date", "interval", "timestamp", NULL
+};
+
+// keywords after which a literal is required: the timeout of FOR UPDATE WAIT,
+// the limit of REJECT LIMIT and the values of the cycle mark column of the
+// CYCLE clause (SET c TO 'Y' DEFAULT 'N')
+static const char *dpiSqlNormalizer__literalPrefixWords[] = {
+    "default", "limit", "to", "wait", NULL
+};
+
+// keywords which, followed by parentheses, contain sizes, precisions or
+// sample percentages that must be specified as numeric literals
+static const char *dpiSqlNormalizer__typeWords[] = {
+    "block", "char", "day", "dec", "decimal", "float", "month", "nchar",
+    "number", "numeric", "nvarchar2", "raw", "sample", "second", "seed",
+    "timestamp", "urowid", "varchar", "varchar2", "vector", "year", NULL
+};
+
+// functions whose arguments include path expressions, queries or delimiters
+// that must be specified as literals
+static const char *dpiSqlNormalizer__literalFunctions[] = {
+    "json_exists", "json_query", "json_table", "json_textcontains",
+    "json_value", "listagg", "xmlexists", "xmlquery", "xmltable", NULL
+};
+
+// keywords which end an ORDER BY clause
+static const char *dpiSqlNormalizer__orderByEndWords[] = {
+    "except", "fetch", "for", "intersect", "minus", "offset", "union", NULL
+};
+
+// keywords which introduce clauses that require literals in lists whose
+// extent is not tracked; statements containing them are left untouched
+static const char *dpiSqlNormalizer__unsupportedWords[] = {
+    "pivot", "unpivot", NULL
+};
+
+// keywords with which the statements that are normalized begin
+static const char *dpiSqlNormalizer__statementWords[] = {
+    "delete", "insert", "merge", "select", "update", "with", NULL
+};
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlNormalizer__isWord() [INTERNAL]
+//   Return whether the token is a word matching the keyword (in lower case),
+// ignoring case.
+//-----------------------------------------------------------------------------
+static int dpiSqlNormalizer__isWord(const char *sql, uint32_t tokenType,
+        uint32_t tokenPos, uint32_t tokenLength, const char *keyword)
+{
+    uint32_t i;
+
+    if (tokenType != DPI_SQL_TOKEN_WORD || strlen(keyword) != tokenLength)
+        return 0;
+    for (i = 0; i < tokenLength; i++) {
+        if (tolower((unsigned char) sql[tokenPos + i]) != keyword[i])
+            return 0;
+    }
+    return 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlNormalizer__isOneOfWords() [INTERNAL]
+//   Return whether the token is a word matching any of the keywords in the
+// NULL terminated list.
+//-----------------------------------------------------------------------------
+static int dpiSqlNormalizer__isOneOfWords(const char *sql, uint32_t tokenType,
+        uint32_t tokenPos, uint32_t tokenLength, const char **keywords)
+{
+    for (; *keywords; keywords++) {
+        if (dpiSqlNormalizer__isWord(sql, tokenType, tokenPos, tokenLength,
+                *keywords))
+            return 1;
+    }
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlNormalizer__getStringValue() [INTERNAL]
+//   Determine the value of a string literal, with the quotes removed and
+// embedded quotes no longer doubled. If the value buffer is NULL, only the
+// length is calculated.
+//-----------------------------------------------------------------------------
+static uint32_t dpiSqlNormalizer__getStringValue(const char *literal,
+        uint32_t literalLength, char *value)
+{
+    uint32_t i, valueLength = 0;
+
+    // alternative quoting: the contents are taken as is
+    if (literal[0] == 'q' || literal[0] == 'Q') {
+        valueLength = literalLength - 5;
+        if (value)
+            memcpy(value, literal + 3, valueLength);
+        return valueLength;
+    }
+
+    // standard quoting: embedded quotes are doubled
+    for (i = 1; i < literalLength - 1; i++) {
+        if (literal[i] == '\'')
+            i++;
+        if (value)
+            value[valueLength] = literal[i];
+        valueLength++;
+    }
+    return valueLength;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlNormalizer__scan() [INTERNAL]
+//   Scan the SQL text and replace each literal that can be replaced by a bind
+// placeholder. If the normalized SQL buffer is NULL, only the number of
+// literals and the lengths of the normalized SQL and the string values are
+// calculated; otherwise, the normalized SQL and the literals are populated.
+// If the statement cannot be normalized, the number of literals is zero.
+//-----------------------------------------------------------------------------
+static void dpiSqlNormalizer__scan(const char *sql, uint32_t sqlLength,
+        dpiSqlNormalized *result, uint32_t *valuesLength)
+{
+    uint8_t parenKinds[DPI_SQL_NORMALIZER_MAX_DEPTH];
+    uint32_t prevType = 0, prevPos = 0, prevLength = 0, numTokens = 0;
+    int32_t depth = 0, orderByDepth = -1, selectListDepth = -1;
+    int replace;
+    dpiSqlLiteral *literal;
+    dpiSqlLexer lexer;
+    char buffer[16];
+    uint32_t length;
+
+    result->numLiterals = 0;
+    result->sqlLength = 0;
+    *valuesLength = 0;
+    dpiSqlLexer__init(&lexer, sql, sqlLength);
+    while (dpiSqlLexer__next(&lexer)) {
+
+        // white space and comments (including hints) are copied unchanged
+        if (lexer.tokenType == DPI_SQL_TOKEN_SPACE ||
+                lexer.tokenType == DPI_SQL_TOKEN_COMMENT) {
+            if (result->sql)
+                memcpy(result->sql + result->sqlLength, sql + lexer.tokenPos,
+                        lexer.tokenLength);
+            result->sqlLength += lexer.tokenLength;
+            continue;
+        }
+
+        // only queries and DML statements are normalized; statements which
+        // already contain bind placeholders, GROUP BY clauses (where the
+        // expressions must match those in the select list exactly), PIVOT or
+        // UNPIVOT clauses or PL/SQL declarations in a WITH clause are left
+        // untouched
+        if ((numTokens == 0 && !dpiSqlNormalizer__isOneOfWords(sql,
+                        lexer.tokenType, lexer.tokenPos, lexer.tokenLength,
+                        dpiSqlNormalizer__statementWords)) ||
+                lexer.tokenType == DPI_SQL_TOKEN_BIND ||
+                dpiSqlNormalizer__isOneOfWords(sql, lexer.tokenType,
+                        lexer.tokenPos, lexer.tokenLength,
+                        dpiSqlNormalizer__unsupportedWords) ||
+                (dpiSqlNormalizer__isWord(sql, lexer.tokenType,
+                        lexer.tokenPos, lexer.tokenLength, "by") &&
+                dpiSqlNormalizer__isWord(sql, prevType, prevPos, prevLength,
+                        "group")) ||
+                (numTokens == 1 && dpiSqlNormalizer__isWord(sql, prevType,
+                        prevPos, prevLength, "with") &&
+                (dpiSqlNormalizer__isWord(sql, lexer.tokenType,
+                        lexer.tokenPos, lexer.tokenLength, "function") ||
+                dpiSqlNormalizer__isWord(sql, lexer.tokenType, lexer.tokenPos,
+                        lexer.tokenLength, "procedure")))) {
+            result->numLiterals = 0;
+            return;
+        }
+        numTokens++;
+
+        // track parentheses and the kind of contents they have; parentheses
+        // nested within the arguments of a function that requires literals
+        // require them as well
+        replace = 0;
+        if (lexer.tokenType == DPI_SQL_TOKEN_OTHER &&
+                sql[lexer.tokenPos] == '(') {
+            if (depth < DPI_SQL_NORMALIZER_MAX_DEPTH) {
+                parenKinds[depth] = DPI_SQL_NORMALIZER_PAREN_DEFAULT;
+                if (depth > 0 && parenKinds[depth - 1] ==
+                        DPI_SQL_NORMALIZER_PAREN_LITERAL)
+                    parenKinds[depth] = DPI_SQL_NORMALIZER_PAREN_LITERAL;
+                else if (dpiSqlNormalizer__isOneOfWords(sql, prevType, prevPos,
+                        prevLength, dpiSqlNormalizer__typeWords))
+                    parenKinds[depth] = DPI_SQL_NORMALIZER_PAREN_TYPE;
+                else if (dpiSqlNormalizer__isOneOfWords(sql, prevType,
+                        prevPos, prevLength,
+                        dpiSqlNormalizer__literalFunctions))
+                    parenKinds[depth] = DPI_SQL_NORMALIZER_PAREN_LITERAL;
+            }
+            depth++;
+        } else if (lexer.tokenType == DPI_SQL_TOKEN_OTHER &&
+                sql[lexer.tokenPos] == ')') {
+            if (depth > 0)
+                depth--;
+            if (depth < orderByDepth)
+                orderByDepth = -1;
+            if (depth < selectListDepth)
+                selectListDepth = -1;
+
+        // track select lists, in which the literals determine the names and
+        // types of the columns of the query
+        } else if (selectListDepth < 0 && dpiSqlNormalizer__isWord(sql,
+                lexer.tokenType, lexer.tokenPos, lexer.tokenLength,
+                "select")) {
+            selectListDepth = depth;
+        } else if (depth == selectListDepth && dpiSqlNormalizer__isWord(sql,
+                lexer.tokenType, lexer.tokenPos, lexer.tokenLength, "from")) {
+            selectListDepth = -1;
+
+        // track ORDER BY clauses, in which numeric literals refer to columns
+        // of the select list
+        } else if (dpiSqlNormalizer__isWord(sql, lexer.tokenType,
+                lexer.tokenPos, lexer.tokenLength, "by") &&
+                (dpiSqlNormalizer__isWord(sql, prevType, prevPos, prevLength,
+                        "order") || dpiSqlNormalizer__isWord(sql, prevType,
+                        prevPos, prevLength, "siblings"))) {
+            orderByDepth = depth;
+        } else if (depth == orderByDepth && dpiSqlNormalizer__isOneOfWords(sql,
+                lexer.tokenType, lexer.tokenPos, lexer.tokenLength,
+                dpiSqlNormalizer__orderByEndWords)) {
+            orderByDepth = -1;
+
+        // determine whether literals can be replaced
+        } else if (lexer.tokenType == DPI_SQL_TOKEN_NUMBER ||
+                lexer.tokenType == DPI_SQL_TOKEN_STRING) {
+            replace = (orderByDepth < 0 && selectListDepth < 0 &&
+                    depth <= DPI_SQL_NORMALIZER_MAX_DEPTH &&
+                    !dpiSqlNormalizer__isOneOfWords(sql, prevType, prevPos,
+                            prevLength,
+                            dpiSqlNormalizer__literalPrefixWords) &&
+                    (depth == 0 || parenKinds[depth - 1] ==
+                            DPI_SQL_NORMALIZER_PAREN_DEFAULT));
+            if (lexer.tokenType == DPI_SQL_TOKEN_NUMBER) {
+                switch (sql[lexer.tokenPos + lexer.tokenLength - 1]) {
+                    case 'd':
+                    case 'D':
+                    case 'f':
+                    case 'F':
+                        replace = 0;
+                        break;
+                }
+                if (lexer.tokenLength > DPI_NUMBER_MAX_DIGITS)
+                    replace = 0;
+            } else if (sql[lexer.tokenPos] == 'n' ||
+                    sql[lexer.tokenPos] == 'N' ||
+                    lexer.tokenLength < 2 ||
+                    sql[lexer.tokenPos + lexer.tokenLength - 1] != '\'' ||
+                    lexer.tokenLength > DPI_SQL_NORMALIZER_MAX_STRING ||
+                    dpiSqlNormalizer__isOneOfWords(sql, prevType, prevPos,
+                            prevLength, dpiSqlNormalizer__typedLiteralWords)) {
+                replace = 0;
+            }
+        }
+
+        // copy the token or the placeholder that replaces it
+        if (!replace) {
+            if (result->sql)
+                memcpy(result->sql + result->sqlLength, sql + lexer.tokenPos,
+                        lexer.tokenLength);
+            result->sqlLength += lexer.tokenLength;
+        } else {
+            length = (uint32_t) sprintf(buffer, ":%u",
+                    result->numLiterals + 1);
+            if (result->sql) {
+                memcpy(result->sql + result->sqlLength, buffer, length);
+                literal = &result->literals[result->numLiterals];
+                literal->isNumber =
+                        (lexer.tokenType == DPI_SQL_TOKEN_NUMBER);
+                if (literal->isNumber) {
+                    literal->value = sql + lexer.tokenPos;
+                    literal->valueLength = lexer.tokenLength;
+                } else {
+                    literal->value = result->values + *valuesLength;
+                    literal->valueLength = dpiSqlNormalizer__getStringValue(
+                            sql + lexer.tokenPos, lexer.tokenLength,
+                            result->values + *valuesLength);
+                }
+            }
+            result->sqlLength += length;
+            if (lexer.tokenType == DPI_SQL_TOKEN_STRING)
+                *valuesLength += dpiSqlNormalizer__getStringValue(
+                        sql + lexer.tokenPos, lexer.tokenLength, NULL);
+            result->numLiterals++;
+        }
+
+        // retain the previous significant token
+        prevType = lexer.tokenType;
+        prevPos = lexer.tokenPos;
+        prevLength = lexer.tokenLength;
+
+    }
+
+    // if the statement is empty, nothing is replaced
+    if (numTokens == 0)
+        result->numLiterals = 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlNormalizer__bind() [INTERNAL]
+//   Bind the values of the literals that were replaced to the statement.
+// Numeric literals are bound as numbers and string literals as fixed length
+// character strings, which retain the blank-padded comparison semantics of
+// the literals they replace.
+//-----------------------------------------------------------------------------
+int dpiSqlNormalizer__bind(dpiStmt *stmt, dpiSqlNormalized *normalized,
+        dpiError *error)
+{
+    dpiOracleTypeNum oracleTypeNum;
+    dpiSqlLiteral *literal;
+    dpiData *data, value;
+    uint32_t i, size;
+    dpiVar *var;
+    int status;
+
+    value.isNull = 0;
+    value.value.asBytes.encoding = NULL;
+    for (i = 0; i < normalized->numLiterals; i++) {
+        literal = &normalized->literals[i];
+        oracleTypeNum = (literal->isNumber) ? DPI_ORACLE_TYPE_NUMBER :
+                DPI_ORACLE_TYPE_CHAR;
+        size = (literal->isNumber || literal->valueLength > 0) ?
+                literal->valueLength : 1;
+        if (dpiVar__allocate(stmt->conn, oracleTypeNum, DPI_NATIVE_TYPE_BYTES,
+                1, size, 1, 0, NULL, &var, &data, error) < 0)
+            return DPI_FAILURE;
+        value.value.asBytes.ptr = (char*) literal->value;
+        value.value.asBytes.length = literal->valueLength;
+        if (literal->valueLength == 0) {
+            data->isNull = 1;
+            status = DPI_SUCCESS;
+        } else {
+            status = dpiVar__copyData(var, 0, &value, error);
+        }
+        if (status == DPI_SUCCESS)
+            status = dpiStmt__bind(stmt, var, i + 1, NULL, 0, error);
+        dpiGen__setRefCount(var, error, -1);
+        if (status < 0)
+            return DPI_FAILURE;
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlNormalizer__create() [INTERNAL]
+//   Create a new SQL normalizer with all statistics set to zero.
+//-----------------------------------------------------------------------------
+int dpiSqlNormalizer__create(dpiSqlNormalizer **normalizer, dpiError *error)
+{
+    dpiSqlNormalizer *tempNormalizer;
+
+    if (dpiUtils__allocateMemory(1, sizeof(dpiSqlNormalizer), 1,
+            "allocate SQL normalizer", (void**) &tempNormalizer, error) < 0)
+        return DPI_FAILURE;
+    dpiMutex__initialize(tempNormalizer->mutex);
+    *normalizer = tempNormalizer;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlNormalizer__free() [INTERNAL]
+//   Free the memory associated with the SQL normalizer.
+//-----------------------------------------------------------------------------
+void dpiSqlNormalizer__free(dpiSqlNormalizer *normalizer)
+{
+    dpiMutex__destroy(normalizer->mutex);
+    dpiUtils__freeMemory(normalizer);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlNormalizer__freeNormalized() [INTERNAL]
+//   Free the memory associated with the result of normalizing SQL text.
+//-----------------------------------------------------------------------------
+void dpiSqlNormalizer__freeNormalized(dpiSqlNormalized *normalized)
+{
+    if (normalized->sql) {
+        dpiUtils__freeMemory(normalized->sql);
+        normalized->sql = NULL;
+    }
+    if (normalized->values) {
+        dpiUtils__freeMemory(normalized->values);
+        normalized->values = NULL;
+    }
+    if (normalized->literals) {
+        dpiUtils__freeMemory(normalized->literals);
+        normalized->literals = NULL;
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlNormalizer__getInfo() [INTERNAL]
+//   Return the statistics gathered by the SQL normalizer.
+//-----------------------------------------------------------------------------
+void dpiSqlNormalizer__getInfo(dpiSqlNormalizer *normalizer,
+        dpiSqlNormalizerInfo *info)
+{
+    dpiMutex__acquire(normalizer->mutex);
+    info->numPrepares = normalizer->numPrepares;
+    info->numNormalized = normalizer->numNormalized;
+    info->numLiterals = normalizer->numLiterals;
+    info->numCacheHits = normalizer->numCacheHits;
+    info->numCacheMisses = normalizer->numPrepares - normalizer->numCacheHits;
+    dpiMutex__release(normalizer->mutex);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlNormalizer__normalize() [INTERNAL]
+//   Normalize the SQL text by replacing its literals with bind placeholders.
+// If no literals can be replaced, the normalized SQL is left as NULL and the
+// original SQL text should be used instead.
+//-----------------------------------------------------------------------------
+int dpiSqlNormalizer__normalize(const char *sql, uint32_t sqlLength,
+        dpiSqlNormalized *normalized, dpiError *error)
+{
+    uint32_t valuesLength;
+
+    // determine the number of literals and the sizes of the buffers required
+    memset(normalized, 0, sizeof(dpiSqlNormalized));
+    dpiSqlNormalizer__scan(sql, sqlLength, normalized, &valuesLength);
+    if (normalized->numLiterals == 0)
+        return DPI_SUCCESS;
+
+    // allocate the buffers and populate them
+    if (dpiUtils__allocateMemory(1, normalized->sqlLength, 0,
+            "allocate normalized SQL", (void**) &normalized->sql, error) < 0)
+        return DPI_FAILURE;
+    if (dpiUtils__allocateMemory(normalized->numLiterals,
+            sizeof(dpiSqlLiteral), 1, "allocate literals",
+            (void**) &normalized->literals, error) < 0) {
+        dpiSqlNormalizer__freeNormalized(normalized);
+        return DPI_FAILURE;
+    }
+    if (valuesLength > 0 && dpiUtils__allocateMemory(1, valuesLength, 0,
+            "allocate literal values", (void**) &normalized->values,
+            error) < 0) {
+        dpiSqlNormalizer__freeNormalized(normalized);
+        return DPI_FAILURE;
+    }
+    dpiSqlNormalizer__scan(sql, sqlLength, normalized, &valuesLength);
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlNormalizer__recordPrepare() [INTERNAL]
+//   Record the preparation of a statement, noting whether it was found in the
+// statement cache and how many literals were replaced in it.
+//-----------------------------------------------------------------------------
+void dpiSqlNormalizer__recordPrepare(dpiSqlNormalizer *normalizer,
+        dpiSqlNormalized *normalized, int cacheHit)
+{
+    dpiMutex__acquire(normalizer->mutex);
+    normalizer->numPrepares++;
+    if (cacheHit)
+        normalizer->numCacheHits++;
+    if (normalized->numLiterals > 0) {
+        normalizer->numNormalized++;
+        normalizer->numLiterals += normalized->numLiterals;
+    }
+    dpiMutex__release(normalizer->mutex);
+}
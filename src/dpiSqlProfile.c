@@ -0,0 +1,387 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlProfile.c
+//   Implementation of the SQL profiler which aggregates client-side execution
+// statistics for each distinct SQL statement executed with a context. The
+// statistics are keyed by the SQL text after normalizing whitespace so that
+// statements differing only in formatting are combined.
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+
+// initial number of buckets in the hash table
+#define DPI_SQL_PROFILE_INITIAL_BUCKETS     64
+
+// maximum number of distinct statements tracked; statements prepared after
+// this limit is reached are not profiled
+#define DPI_SQL_PROFILE_MAX_ENTRIES         4096
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlProfile__hash() [INTERNAL]
+//   Calculate the hash value (FNV-1a) for the normalized SQL text.
+//-----------------------------------------------------------------------------
+static uint32_t dpiSqlProfile__hash(const char *sql, uint32_t sqlLength)
+{
+    uint32_t hashValue = 2166136261u, i;
+
+    for (i = 0; i < sqlLength; i++) {
+        hashValue ^= (uint8_t) sql[i];
+        hashValue *= 16777619u;
+    }
+    return hashValue;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlProfile__normalize() [INTERNAL]
+//   Normalize the SQL text by removing leading and trailing whitespace and
+// replacing each run of whitespace with a single space. Whitespace within
+// quoted strings and identifiers is left untouched. The normalized text is
+// never longer than the original text.
+//-----------------------------------------------------------------------------
+static uint32_t dpiSqlProfile__normalize(const char *sql, uint32_t sqlLength,
+        char *normalizedSql)
+{
+    uint32_t i, normalizedLength = 0;
+    int pendingSpace = 0;
+    char quoteChar = 0;
+
+    for (i = 0; i < sqlLength; i++) {
+        if (!quoteChar && isspace((unsigned char) sql[i])) {
+            pendingSpace = (normalizedLength > 0);
+            continue;
+        }
+        if (pendingSpace) {
+            normalizedSql[normalizedLength++] = ' ';
+            pendingSpace = 0;
+        }
+        if (quoteChar && sql[i] == quoteChar)
+            quoteChar = 0;
+        else if (!quoteChar && (sql[i] == '\'' || sql[i] == '"'))
+            quoteChar = sql[i];
+        normalizedSql[normalizedLength++] = sql[i];
+    }
+    return normalizedLength;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlProfile__resize() [INTERNAL]
+//   Double the number of buckets in the hash table and redistribute the
+// entries. If memory cannot be allocated, the existing table is retained.
+//-----------------------------------------------------------------------------
+static void dpiSqlProfile__resize(dpiSqlProfile *profile, dpiError *error)
+{
+    dpiSqlProfileEntry **buckets, *entry;
+    uint32_t numBuckets, bucketNum;
+
+    numBuckets = profile->numBuckets * 2;
+    if (dpiUtils__allocateMemory(numBuckets, sizeof(dpiSqlProfileEntry*), 1,
+            "allocate SQL profile buckets", (void**) &buckets, error) < 0)
+        return;
+    for (entry = profile->firstEntry; entry; entry = entry->next) {
+        bucketNum = entry->hashValue % numBuckets;
+        entry->nextInBucket = buckets[bucketNum];
+        buckets[bucketNum] = entry;
+    }
+    dpiUtils__freeMemory(profile->buckets);
+    profile->buckets = buckets;
+    profile->numBuckets = numBuckets;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlProfile__getEntry() [INTERNAL]
+//   Return the entry for the normalized SQL text, creating it if needed. The
+// normalized SQL text is owned by the new entry if one is created; otherwise
+// it is freed. A NULL entry is returned if the maximum number of entries has
+// been reached or memory could not be allocated.
+//-----------------------------------------------------------------------------
+static dpiSqlProfileEntry *dpiSqlProfile__getEntry(dpiSqlProfile *profile,
+        char *sql, uint32_t sqlLength, dpiError *error)
+{
+    dpiSqlProfileEntry *entry;
+    uint32_t hashValue;
+
+    hashValue = dpiSqlProfile__hash(sql, sqlLength);
+    dpiMutex__acquire(profile->mutex);
+
+    // search for an existing entry
+    entry = profile->buckets[hashValue % profile->numBuckets];
+    while (entry && (entry->hashValue != hashValue ||
+            entry->sqlLength != sqlLength ||
+            memcmp(entry->sql, sql, sqlLength) != 0))
+        entry = entry->nextInBucket;
+    if (entry) {
+        dpiMutex__release(profile->mutex);
+        dpiUtils__freeMemory(sql);
+        return entry;
+    }
+
+    // create a new entry, if permitted
+    if (profile->numEntries >= DPI_SQL_PROFILE_MAX_ENTRIES ||
+            dpiUtils__allocateMemory(1, sizeof(dpiSqlProfileEntry), 1,
+                    "allocate SQL profile entry", (void**) &entry,
+                    error) < 0) {
+        dpiMutex__release(profile->mutex);
+        dpiUtils__freeMemory(sql);
+        return NULL;
+    }
+    entry->sql = sql;
+    entry->sqlLength = sqlLength;
+    entry->hashValue = hashValue;
+    if (profile->numEntries >= profile->numBuckets * 2)
+        dpiSqlProfile__resize(profile, error);
+    entry->nextInBucket = profile->buckets[hashValue % profile->numBuckets];
+    profile->buckets[hashValue % profile->numBuckets] = entry;
+    if (profile->lastEntry)
+        profile->lastEntry->next = entry;
+    else profile->firstEntry = entry;
+    profile->lastEntry = entry;
+    profile->numEntries++;
+    dpiMutex__release(profile->mutex);
+
+    return entry;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlProfile__create() [INTERNAL]
+//   Create a new SQL profiler.
+//-----------------------------------------------------------------------------
+int dpiSqlProfile__create(dpiSqlProfile **profile, dpiError *error)
+{
+    dpiSqlProfile *tempProfile;
+
+    if (dpiUtils__allocateMemory(1, sizeof(dpiSqlProfile), 1,
+            "allocate SQL profile", (void**) &tempProfile, error) < 0)
+        return DPI_FAILURE;
+    tempProfile->numBuckets = DPI_SQL_PROFILE_INITIAL_BUCKETS;
+    if (dpiUtils__allocateMemory(tempProfile->numBuckets,
+            sizeof(dpiSqlProfileEntry*), 1, "allocate SQL profile buckets",
+            (void**) &tempProfile->buckets, error) < 0) {
+        dpiUtils__freeMemory(tempProfile);
+        return DPI_FAILURE;
+    }
+    dpiMutex__initialize(tempProfile->mutex);
+    *profile = tempProfile;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlProfile__free() [INTERNAL]
+//   Free the memory associated with the SQL profiler, including all of its
+// entries.
+//-----------------------------------------------------------------------------
+void dpiSqlProfile__free(dpiSqlProfile *profile)
+{
+    dpiSqlProfileEntry *entry;
+
+    while (profile->firstEntry) {
+        entry = profile->firstEntry;
+        profile->firstEntry = entry->next;
+        dpiUtils__freeMemory(entry->sql);
+        dpiUtils__freeMemory(entry);
+    }
+    if (profile->buckets) {
+        dpiUtils__freeMemory(profile->buckets);
+        profile->buckets = NULL;
+    }
+    dpiMutex__destroy(profile->mutex);
+    dpiUtils__freeMemory(profile);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlProfile__getInfo() [INTERNAL]
+//   Populate the array with the statistics for each statement known to the
+// profiler. On input, the number of elements refers to the number of entries
+// available in the array; on output it refers to the number of statements
+// known. If the array is NULL, only the number of statements is returned.
+// The SQL_ID is copied while the mutex is held since it is replaced whenever
+// the statement is executed.
+//-----------------------------------------------------------------------------
+int dpiSqlProfile__getInfo(dpiSqlProfile *profile, dpiSqlProfileInfo *info,
+        uint32_t *numInfo, UNUSED dpiError *error)
+{
+    uint32_t numAvailable, numEntries;
+    dpiSqlProfileEntry *entry;
+    dpiSqlProfileInfo *target;
+
+    numAvailable = (info) ? *numInfo : 0;
+    numEntries = 0;
+    dpiMutex__acquire(profile->mutex);
+    for (entry = profile->firstEntry; entry;
+            entry = entry->next, numEntries++) {
+        if (numEntries >= numAvailable)
+            continue;
+        target = &info[numEntries];
+        target->sql = entry->sql;
+        target->sqlLength = entry->sqlLength;
+        memcpy(target->sqlId, entry->sqlId, entry->sqlIdLength);
+        target->sqlIdLength = entry->sqlIdLength;
+        target->numPrepares = entry->numPrepares;
+        target->numExecutions = entry->numExecutions;
+        target->numRows = entry->numRows;
+        target->prepareTimeNs = entry->prepareTimeNs;
+        target->executeTimeNs = entry->executeTimeNs;
+        target->fetchTimeNs = entry->fetchTimeNs;
+        target->numFetches = entry->numFetches;
+        target->avgFetchArraySize = (entry->numFetches == 0) ? 0 :
+                (double) entry->totalFetchArraySize /
+                (double) entry->numFetches;
+        target->prefetchRows = entry->prefetchRows;
+        target->numBytesFetched = entry->numBytesFetched;
+    }
+    dpiMutex__release(profile->mutex);
+    *numInfo = numEntries;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlProfile__recordExecute() [INTERNAL]
+//   Record the successful execution of a statement. The number of rows is
+// the number of rows affected for DML; rows returned by queries are recorded
+// when they are fetched.
+//-----------------------------------------------------------------------------
+void dpiSqlProfile__recordExecute(dpiStmt *stmt, uint64_t elapsedNs,
+        uint64_t numRows)
+{
+    dpiSqlProfile *profile = stmt->env->context->sqlProfile;
+    dpiSqlProfileEntry *entry = stmt->profileEntry;
+
+    dpiMutex__acquire(profile->mutex);
+    entry->numExecutions++;
+    entry->numRows += numRows;
+    entry->executeTimeNs += elapsedNs;
+    if (stmt->statementType == DPI_STMT_TYPE_SELECT)
+        entry->prefetchRows = stmt->prefetchRows;
+    if (stmt->sqlIdLength > 0) {
+        memcpy(entry->sqlId, stmt->sqlId, stmt->sqlIdLength);
+        entry->sqlIdLength = stmt->sqlIdLength;
+    }
+    dpiMutex__release(profile->mutex);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlProfile__recordFetch() [INTERNAL]
+//   Record a fetch of rows into the statement's fetch buffers. The number of
+// bytes fetched is the sum of the actual lengths of variable length columns
+// and the buffer sizes of fixed length columns.
+//-----------------------------------------------------------------------------
+void dpiSqlProfile__recordFetch(dpiStmt *stmt, uint64_t elapsedNs)
+{
+    dpiSqlProfile *profile = stmt->env->context->sqlProfile;
+    dpiSqlProfileEntry *entry = stmt->profileEntry;
+    uint64_t numBytes = 0;
+    uint32_t i, j;
+    dpiVar *var;
+
+    for (i = 0; i < stmt->numQueryVars; i++) {
+        var = stmt->queryVars[i];
+        if (!var->buffer.actualLength) {
+            numBytes += (uint64_t) var->sizeInBytes * stmt->bufferRowCount;
+            continue;
+        }
+        for (j = 0; j < stmt->bufferRowCount; j++)
+            numBytes += var->buffer.actualLength[j];
+    }
+
+    dpiMutex__acquire(profile->mutex);
+    entry->numFetches++;
+    entry->numRows += stmt->bufferRowCount;
+    entry->fetchTimeNs += elapsedNs;
+    entry->totalFetchArraySize += stmt->fetchArraySize;
+    entry->numBytesFetched += numBytes;
+    dpiMutex__release(profile->mutex);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlProfile__recordPrepare() [INTERNAL]
+//   Associate the statement with the entry for its SQL text and record the
+// time taken to prepare it. If no SQL text was supplied (the statement was
+// found in the statement cache by tag), the SQL text is acquired from the
+// statement handle. Failures are not propagated since profiling must not
+// affect the application; the statement is simply not profiled.
+//-----------------------------------------------------------------------------
+void dpiSqlProfile__recordPrepare(dpiStmt *stmt, const char *sql,
+        uint32_t sqlLength, uint64_t elapsedNs, dpiError *error)
+{
+    dpiSqlProfile *profile = stmt->env->context->sqlProfile;
+    dpiSqlProfileEntry *entry;
+    char *normalizedSql;
+
+    if (!sql && dpiOci__attrGet(stmt->handle, DPI_OCI_HTYPE_STMT,
+            (void*) &sql, &sqlLength, DPI_OCI_ATTR_STATEMENT,
+            "get statement", error) < 0)
+        return;
+    if (!sql || sqlLength == 0)
+        return;
+    if (dpiUtils__allocateMemory(1, sqlLength, 0, "allocate normalized SQL",
+            (void**) &normalizedSql, error) < 0)
+        return;
+    sqlLength = dpiSqlProfile__normalize(sql, sqlLength, normalizedSql);
+    entry = dpiSqlProfile__getEntry(profile, normalizedSql, sqlLength, error);
+    if (!entry)
+        return;
+
+    dpiMutex__acquire(profile->mutex);
+    entry->numPrepares++;
+    entry->prepareTimeNs += elapsedNs;
+    dpiMutex__release(profile->mutex);
+    stmt->profileEntry = entry;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiSqlProfile__reset() [INTERNAL]
+//   Reset the statistics for all statements known to the profiler. The
+// entries themselves are retained since statements may refer to them.
+//-----------------------------------------------------------------------------
+void dpiSqlProfile__reset(dpiSqlProfile *profile)
+{
+    dpiSqlProfileEntry *entry;
+
+    dpiMutex__acquire(profile->mutex);
+    for (entry = profile->firstEntry; entry; entry = entry->next) {
+        entry->numPrepares = 0;
+        entry->numExecutions = 0;
+        entry->numRows = 0;
+        entry->prepareTimeNs = 0;
+        entry->executeTimeNs = 0;
+        entry->fetchTimeNs = 0;
+        entry->numFetches = 0;
+        entry->totalFetchArraySize = 0;
+        entry->numBytesFetched = 0;
+    }
+    dpiMutex__release(profile->mutex);
+}
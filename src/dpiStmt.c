@@ -30,23 +30,71 @@
 #include "dpiImpl.h"
 
 // forward declarations of internal functions only used in this file
+static int dpiStmt__createQueryVars(dpiStmt *stmt, dpiError *error);
+static int dpiStmt__defineBuffers(dpiStmt *stmt, uint32_t pos, dpiVar *var,
+        dpiError *error);
+static int dpiStmt__executeRows(dpiStmt *stmt, uint32_t rowOffset,
+        uint32_t numIters, uint32_t mode, int reExecute, dpiError *error);
+static int dpiStmt__getBatchErrors(dpiStmt *stmt, dpiError *error);
 static int dpiStmt__getQueryInfo(dpiStmt *stmt, uint32_t pos,
         dpiQueryInfo *info, dpiError *error);
 static int dpiStmt__getQueryInfoFromParam(dpiStmt *stmt, void *param,
         dpiQueryInfo *info, dpiError *error);
+static int dpiStmt__getRowCount(dpiStmt *stmt, uint64_t *count,
+        dpiError *error);
+static int dpiStmt__isTransientError(int32_t code);
 static int dpiStmt__postFetch(dpiStmt *stmt, dpiError *error);
 static int dpiStmt__beforeFetch(dpiStmt *stmt, dpiError *error);
 static int dpiStmt__reExecute(dpiStmt *stmt, uint32_t numIters,
         uint32_t mode, dpiError *error);
+static int dpiStmt__resetPrefetchRows(dpiStmt *stmt, uint32_t numRows,
+        dpiError *error);
+static int dpiStmt__setPrefetchRows(dpiStmt *stmt, uint32_t numRows,
+        dpiError *error);
+static int dpiStmt__transferBindValues(dpiStmt *stmt, uint32_t numIters,
+        uint32_t numRows, dpiError *error);
+static void dpiStmt__updateTransactionState(dpiStmt *stmt, uint32_t mode,
+        int succeeded, dpiError *error);
+
+
+//-----------------------------------------------------------------------------
+// dpiStmt__addRowCounts() [INTERNAL]
+//   Add the number of rows affected by the execution just completed to the
+// totals kept for an adaptive execution. If the number of rows affected by
+// each row is being collected, the counts for the rows executed replace the
+// counts recorded for those rows earlier, as happens when a row is retried.
+//-----------------------------------------------------------------------------
+static int dpiStmt__addRowCounts(dpiStmt *stmt, uint32_t rowOffset,
+        uint32_t numIters, dpiError *error)
+{
+    uint32_t i, numRowCounts;
+    uint64_t rowCount, *rowCounts;
+
+    if (dpiStmt__getRowCount(stmt, &rowCount, error) < 0)
+        return DPI_FAILURE;
+    stmt->totalRowCount += rowCount;
+    if (!stmt->totalRowCounts)
+        return DPI_SUCCESS;
+    if (dpiOci__attrGet(stmt->handle, DPI_OCI_HTYPE_STMT, &rowCounts,
+            &numRowCounts, DPI_OCI_ATTR_DML_ROW_COUNT_ARRAY, "get row counts",
+            error) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < numRowCounts && i < numIters; i++)
+        stmt->totalRowCounts[rowOffset + i] = rowCounts[i];
+    return DPI_SUCCESS;
+}
 
 
 //-----------------------------------------------------------------------------
 // dpiStmt__allocate() [INTERNAL]
 //   Create a new statement object and return it. In case of error NULL is
-// returned.
+// returned. An untracked statement borrows the caller's reference to the
+// connection instead of acquiring its own and is not added to the list of
+// open statements on the connection; the caller must ensure that it is freed
+// before the connection is released.
 //-----------------------------------------------------------------------------
-int dpiStmt__allocate(dpiConn *conn, int scrollable, dpiStmt **stmt,
-        dpiError *error)
+int dpiStmt__allocate(dpiConn *conn, int scrollable, int untracked,
+        dpiStmt **stmt, dpiError *error)
 {
     dpiStmt *tempStmt;
 
@@ -54,7 +102,9 @@ int dpiStmt__allocate(dpiConn *conn, int scrollable, dpiStmt **stmt,
     if (dpiGen__allocate(DPI_HTYPE_STMT, conn->env, (void**) &tempStmt,
             error) < 0)
         return DPI_FAILURE;
-    dpiGen__setRefCount(conn, error, 1);
+    if (!untracked)
+        dpiGen__setRefCount(conn, error, 1);
+    tempStmt->untracked = untracked;
     tempStmt->conn = conn;
     tempStmt->fetchArraySize = DPI_DEFAULT_FETCH_ARRAY_SIZE;
     tempStmt->prefetchRows = DPI_DEFAULT_PREFETCH_ROWS;
@@ -69,7 +119,7 @@ int dpiStmt__allocate(dpiConn *conn, int scrollable, dpiStmt **stmt,
 //   Bind the variable to the statement using either a position or a name. A
 // reference to the variable will be retained.
 //-----------------------------------------------------------------------------
-static int dpiStmt__bind(dpiStmt *stmt, dpiVar *var, uint32_t pos,
+int dpiStmt__bind(dpiStmt *stmt, dpiVar *var, uint32_t pos,
         const char *name, uint32_t nameLength, dpiError *error)
 {
     dpiBindVar *bindVars, *entry = NULL;
@@ -152,10 +202,13 @@ static int dpiStmt__bind(dpiStmt *stmt, dpiVar *var, uint32_t pos,
     }
 
     // for PL/SQL where the maxSize is greater than 32K, adjust the variable
-    // so that LOBs are used internally
+    // so that LOBs are used internally; values cannot be streamed in that case
     if (var->isDynamic && (stmt->statementType == DPI_STMT_TYPE_BEGIN ||
             stmt->statementType == DPI_STMT_TYPE_DECLARE ||
             stmt->statementType == DPI_STMT_TYPE_CALL)) {
+        if (var->stream)
+            return dpiError__set(error, "check stream",
+                    DPI_ERR_STREAM_NOT_SUPPORTED, DPI_MAX_BASIC_BUFFER_SIZE);
         if (dpiVar__convertToLob(var, error) < 0)
             return DPI_FAILURE;
     }
@@ -231,6 +284,30 @@ static int dpiStmt__check(dpiStmt *stmt, const char *fnName, dpiError *error)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiStmt__checkArraySize() [INTERNAL]
+//   Ensure that all bind variables (and the array of structs bound, if
+// applicable) have a big enough maxArraySize to support executing the
+// statement the specified number of times.
+//-----------------------------------------------------------------------------
+static int dpiStmt__checkArraySize(dpiStmt *stmt, uint32_t numIters,
+        dpiError *error)
+{
+    uint32_t i;
+
+    for (i = 0; i < stmt->numBindVars; i++) {
+        if (stmt->bindVars[i].var->buffer.maxArraySize < numIters)
+            return dpiError__set(error, "check array size",
+                    DPI_ERR_ARRAY_SIZE_TOO_SMALL,
+                    stmt->bindVars[i].var->buffer.maxArraySize);
+    }
+    if (stmt->structBind && stmt->structBind->numRows < numIters)
+        return dpiError__set(error, "check array size",
+                DPI_ERR_ARRAY_SIZE_TOO_SMALL, stmt->structBind->numRows);
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiStmt__clearBatchErrors() [INTERNAL]
 //   Clear the batch errors associated with the statement.
@@ -245,6 +322,24 @@ static void dpiStmt__clearBatchErrors(dpiStmt *stmt)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiStmt__clearImplicitResults() [INTERNAL]
+//   Clear the implicit result handles collected from the statement. The
+// handles themselves are owned by the OCI statement handle.
+//-----------------------------------------------------------------------------
+static void dpiStmt__clearImplicitResults(dpiStmt *stmt)
+{
+    if (stmt->implicitResults) {
+        dpiUtils__freeMemory(stmt->implicitResults);
+        stmt->implicitResults = NULL;
+    }
+    stmt->implicitResultsCollected = 0;
+    stmt->numImplicitResults = 0;
+    stmt->implicitResultIndex = 0;
+    stmt->allocatedImplicitResults = 0;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiStmt__clearBindVars() [INTERNAL]
 //   Clear the bind variables associated with the statement.
@@ -265,6 +360,10 @@ static void dpiStmt__clearBindVars(dpiStmt *stmt, dpiError *error)
     }
     stmt->numBindVars = 0;
     stmt->allocatedBindVars = 0;
+    if (stmt->structBind) {
+        dpiStructMap__free(stmt->structBind);
+        stmt->structBind = NULL;
+    }
 }
 
 
@@ -278,6 +377,7 @@ static void dpiStmt__clearQueryVars(dpiStmt *stmt, dpiError *error)
     uint32_t i;
 
     if (stmt->queryVars) {
+        dpiRowBlock__clearSpares(stmt, error);
         for (i = 0; i < stmt->numQueryVars; i++) {
             if (stmt->queryVars[i]) {
                 dpiGen__setRefCount(stmt->queryVars[i], error, -1);
@@ -301,6 +401,12 @@ static void dpiStmt__clearQueryVars(dpiStmt *stmt, dpiError *error)
         stmt->queryInfo = NULL;
     }
     stmt->numQueryVars = 0;
+    if (stmt->scrollCache)
+        dpiScrollCache__clear(stmt->scrollCache);
+    if (stmt->structDefine) {
+        dpiStructMap__free(stmt->structDefine);
+        stmt->structDefine = NULL;
+    }
 }
 
 
@@ -332,10 +438,20 @@ int dpiStmt__close(dpiStmt *stmt, const char *tag, uint32_t tagLength,
 
     // perform actual work of closing statement
     dpiStmt__clearBatchErrors(stmt);
+    if (stmt->totalRowCounts) {
+        dpiUtils__freeMemory(stmt->totalRowCounts);
+        stmt->totalRowCounts = NULL;
+    }
+    stmt->hasTotalRowCount = 0;
+    dpiStmt__clearImplicitResults(stmt);
     dpiStmt__clearBindVars(stmt, error);
     dpiStmt__clearQueryVars(stmt, error);
     if (stmt->lastRowid)
         dpiGen__setRefCount(stmt->lastRowid, error, -1);
+    if (stmt->scrollCache) {
+        dpiScrollCache__free(stmt->scrollCache);
+        stmt->scrollCache = NULL;
+    }
     if (stmt->handle) {
         if (stmt->parentStmt) {
             dpiGen__setRefCount(stmt->parentStmt, error, -1);
@@ -438,6 +554,67 @@ static int dpiStmt__createBindVar(dpiStmt *stmt,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiStmt__collectImplicitResults() [INTERNAL]
+//   Collect the handles of all implicit results of the last execution that
+// have not yet been returned, so that they can be described and fetched in
+// any order.
+//-----------------------------------------------------------------------------
+static int dpiStmt__collectImplicitResults(dpiStmt *stmt, dpiError *error)
+{
+    void *handle, **tempResults;
+
+    if (stmt->implicitResultsCollected)
+        return DPI_SUCCESS;
+    while (1) {
+        if (dpiOci__stmtGetNextResult(stmt, &handle, error) < 0)
+            return DPI_FAILURE;
+        if (!handle)
+            break;
+        if (stmt->numImplicitResults == stmt->allocatedImplicitResults) {
+            if (dpiUtils__allocateMemory(stmt->allocatedImplicitResults + 8,
+                    sizeof(void*), 0, "allocate implicit results",
+                    (void**) &tempResults, error) < 0)
+                return DPI_FAILURE;
+            if (stmt->implicitResults) {
+                memcpy(tempResults, stmt->implicitResults,
+                        stmt->numImplicitResults * sizeof(void*));
+                dpiUtils__freeMemory(stmt->implicitResults);
+            }
+            stmt->implicitResults = tempResults;
+            stmt->allocatedImplicitResults += 8;
+        }
+        stmt->implicitResults[stmt->numImplicitResults++] = handle;
+    }
+    stmt->implicitResultsCollected = 1;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmt__createImplicitResult() [INTERNAL]
+//   Create a statement for the implicit result handle and describe the
+// columns it returns. The new statement holds a reference to its parent.
+//-----------------------------------------------------------------------------
+static int dpiStmt__createImplicitResult(dpiStmt *stmt, void *handle,
+        dpiStmt **implicitResult, dpiError *error)
+{
+    dpiStmt *tempStmt;
+
+    if (dpiStmt__allocate(stmt->conn, 0, 0, &tempStmt, error) < 0)
+        return DPI_FAILURE;
+    tempStmt->handle = handle;
+    dpiGen__setRefCount(stmt, error, 1);
+    tempStmt->parentStmt = stmt;
+    if (dpiStmt__createQueryVars(tempStmt, error) < 0) {
+        dpiStmt__free(tempStmt, error);
+        return DPI_FAILURE;
+    }
+    *implicitResult = tempStmt;
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiStmt__createQueryVars() [INTERNAL]
 //   Create space for the number of query variables required to support the
@@ -477,9 +654,12 @@ static int dpiStmt__createQueryVars(dpiStmt *stmt, dpiError *error)
         }
     }
 
-    // indicate start of fetch
+    // indicate start of fetch; any blocks cached from a previous execution
+    // are no longer valid
     stmt->bufferRowIndex = stmt->fetchArraySize;
     stmt->hasRowsToFetch = 1;
+    if (stmt->scrollCache)
+        dpiScrollCache__clear(stmt->scrollCache);
     return DPI_SUCCESS;
 }
 
@@ -493,14 +673,25 @@ static int dpiStmt__createQueryVars(dpiStmt *stmt, dpiError *error)
 static int dpiStmt__define(dpiStmt *stmt, uint32_t pos, dpiVar *var,
         dpiError *error)
 {
-    void *defineHandle = NULL;
     dpiQueryInfo *queryInfo;
-    int tempBool;
+    uint32_t i;
 
     // no need to perform define if variable is unchanged
     if (stmt->queryVars[pos - 1] == var)
         return DPI_SUCCESS;
 
+    // if the column was defined as part of an array of structs, that define
+    // is replaced, so the array of structs can no longer be used
+    if (stmt->structDefine) {
+        for (i = 0; i < stmt->structDefine->numFields; i++) {
+            if (stmt->structDefine->fields[i].pos == pos) {
+                dpiStructMap__free(stmt->structDefine);
+                stmt->structDefine = NULL;
+                break;
+            }
+        }
+    }
+
     // for objects, the type specified must match the type in the database
     queryInfo = &stmt->queryInfo[pos - 1];
     if (var->objectType && queryInfo->typeInfo.objectType &&
@@ -514,89 +705,146 @@ static int dpiStmt__define(dpiStmt *stmt, uint32_t pos, dpiVar *var,
                 queryInfo->typeInfo.objectType->name);
 
     // perform the define
-    if (dpiOci__defineByPos2(stmt, &defineHandle, pos, var, error) < 0)
-        return DPI_FAILURE;
-
-    // set the charset form if applicable
-    if (var->type->charsetForm != DPI_SQLCS_IMPLICIT) {
-        if (dpiOci__attrSet(defineHandle, DPI_OCI_HTYPE_DEFINE,
-                (void*) &var->type->charsetForm, 0, DPI_OCI_ATTR_CHARSET_FORM,
-                "set charset form", error) < 0)
-            return DPI_FAILURE;
-    }
-
-    // specify that the LOB length should be prefetched
-    if (var->nativeTypeNum == DPI_NATIVE_TYPE_LOB) {
-        tempBool = 1;
-        if (dpiOci__attrSet(defineHandle, DPI_OCI_HTYPE_DEFINE,
-                (void*) &tempBool, 0, DPI_OCI_ATTR_LOBPREFETCH_LENGTH,
-                "set lob prefetch length", error) < 0)
-            return DPI_FAILURE;
-    }
-
-    // define objects, if applicable
-    if (var->buffer.objectIndicator && dpiOci__defineObject(var, defineHandle,
-            error) < 0)
+    if (dpiStmt__defineBuffers(stmt, pos, var, error) < 0)
         return DPI_FAILURE;
 
-    // register callback for dynamic defines
-    if (var->isDynamic && dpiOci__defineDynamic(var, defineHandle, error) < 0)
-        return DPI_FAILURE;
+    // spare row block buffers belong to the previous variable and can no
+    // longer be used
+    dpiRowBlock__clearSpares(stmt, error);
 
     // remove previous variable and retain new one
     if (stmt->queryVars[pos - 1])
         dpiGen__setRefCount(stmt->queryVars[pos - 1], error, -1);
     dpiGen__setRefCount(var, error, 1);
     stmt->queryVars[pos - 1] = var;
+    if (stmt->scrollCache)
+        dpiScrollCache__clear(stmt->scrollCache);
 
     return DPI_SUCCESS;
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiStmt__executeBatch() [INTERNAL]
+//   Execute one batch of an adaptive execution with batch errors enabled.
+// If the batch as a whole fails with a transient error, it is executed again
+// up to the specified number of times. Errors for individual rows are then
+// retrieved as batch errors.
+//-----------------------------------------------------------------------------
+static int dpiStmt__executeBatch(dpiStmt *stmt, uint32_t rowOffset,
+        uint32_t numIters, uint32_t mode, uint32_t maxRetries,
+        dpiError *error)
+{
+    uint32_t attempt;
+
+    for (attempt = 0; ; attempt++) {
+        if (dpiStmt__executeRows(stmt, rowOffset, numIters, mode, 0,
+                error) == DPI_SUCCESS)
+            break;
+        if (attempt >= maxRetries ||
+                !dpiStmt__isTransientError(error->buffer->code))
+            return DPI_FAILURE;
+    }
+    return dpiStmt__getBatchErrors(stmt, error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiStmt__execute() [INTERNAL]
 //   Internal execution of statement.
 //-----------------------------------------------------------------------------
-static int dpiStmt__execute(dpiStmt *stmt, uint32_t numIters,
+int dpiStmt__execute(dpiStmt *stmt, uint32_t numIters,
         uint32_t mode, int reExecute, dpiError *error)
 {
-    uint32_t i, j, temp, sqlIdLength;
-    uint16_t tempOffset;
-    dpiData *data;
+    if (dpiStmt__transferBindValues(stmt, numIters, UINT32_MAX, error) < 0)
+        return DPI_FAILURE;
+    return dpiStmt__executeRows(stmt, 0, numIters, mode, reExecute, error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmt__executeUnitOfWork() [INTERNAL]
+//   Prepare, bind and execute the statement described by the unit of work on
+// the connection, committing if the execution succeeds. The statement only
+// exists for the duration of this call so it is untracked.
+//-----------------------------------------------------------------------------
+int dpiStmt__executeUnitOfWork(dpiConn *conn, const dpiUnitOfWork *unit,
+        uint64_t *rowCount, dpiError *error)
+{
+    dpiErrorBuffer localErrorBuffer;
+    dpiUnitOfWorkBind *bind;
+    dpiError localError;
+    dpiStmt *stmt;
     dpiVar *var;
-    char *sqlId;
+    uint32_t i;
+    int status;
 
-    // for all bound variables, transfer data from dpiData structure to Oracle
-    // buffer structures
-    for (i = 0; i < stmt->numBindVars; i++) {
-        var = stmt->bindVars[i].var;
-        if (var->isArray && numIters > 1)
-            return dpiError__set(error, "bind array var",
-                    DPI_ERR_ARRAY_VAR_NOT_SUPPORTED);
-        for (j = 0; j < var->buffer.maxArraySize; j++) {
-            data = &var->buffer.externalData[j];
-            if (dpiVar__setValue(var, &var->buffer, j, data, error) < 0)
-                return DPI_FAILURE;
-            if (var->dynBindBuffers)
-                var->dynBindBuffers[j].actualArraySize = 0;
-        }
-        if (stmt->isReturning || var->isDynamic)
-            var->error = error;
+    // create the statement
+    if (dpiStmt__allocate(conn, 0, 1, &stmt, error) < 0)
+        return DPI_FAILURE;
+
+    // prepare the statement; queries are not supported as there is no way to
+    // return their rows after the connection has been released
+    status = dpiStmt__prepare(stmt, unit->sql, unit->sqlLength, unit->tag,
+            unit->tagLength, error);
+    if (status == DPI_SUCCESS && stmt->statementType == DPI_STMT_TYPE_SELECT)
+        status = dpiError__set(error, "check query",
+                DPI_ERR_UNIT_OF_WORK_IS_QUERY);
+
+    // bind the values by position, execute and commit if successful
+    for (i = 0; status == DPI_SUCCESS && i < unit->numBinds; i++) {
+        bind = &unit->binds[i];
+        status = dpiStmt__createBindVar(stmt, bind->nativeTypeNum,
+                &bind->value, &var, i + 1, NULL, 0, error);
     }
+    if (status == DPI_SUCCESS)
+        status = dpiStmt__execute(stmt, 1, DPI_MODE_EXEC_COMMIT_ON_SUCCESS, 1,
+                error);
+    if (status == DPI_SUCCESS && rowCount)
+        status = dpiStmt__getRowCount(stmt, rowCount, error);
+
+    // return the statement to the statement cache and free it; a separate
+    // error buffer is used so that any error raised during execution is the
+    // one returned
+    localError.buffer = &localErrorBuffer;
+    localError.handle = error->handle;
+    localError.env = error->env;
+    dpiStmt__close(stmt, unit->tag, unit->tagLength, 0, &localError);
+    dpiStmt__free(stmt, &localError);
+    error->handle = localError.handle;
+    return status;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmt__executeRows() [INTERNAL]
+//   Execute the statement for the specified number of iterations, starting at
+// the given row of the bind variables. The values of the bind variables must
+// already have been transferred to the Oracle buffers.
+//-----------------------------------------------------------------------------
+static int dpiStmt__executeRows(dpiStmt *stmt, uint32_t rowOffset,
+        uint32_t numIters, uint32_t mode, int reExecute, dpiError *error)
+{
+    uint64_t startNs = 0, elapsedNs = 0, rowCount = 0;
+    uint32_t i, j, sqlIdLength;
+    uint16_t tempOffset;
+    int streamFailed;
+    dpiVar *var;
+    char *sqlId;
 
     // for queries, set the OCI prefetch; the default value prevents an
     // additional round trip for single row fetches while avoiding the overhead
     // of copying from the OCI prefetch buffer to our own buffers for larger
     // fetches
-    if (stmt->statementType == DPI_STMT_TYPE_SELECT) {
-        if (dpiOci__attrSet(stmt->handle, DPI_OCI_HTYPE_STMT,
-                &stmt->prefetchRows, sizeof(stmt->prefetchRows),
-                DPI_OCI_ATTR_PREFETCH_ROWS, "set prefetch rows", error) < 0)
-            return DPI_FAILURE;
-    }
+    if (stmt->statementType == DPI_STMT_TYPE_SELECT &&
+            dpiStmt__setPrefetchRows(stmt, stmt->prefetchRows, error) < 0)
+        return DPI_FAILURE;
 
-    // clear batch errors from any previous execution
+    // clear batch errors, implicit results and accumulated row counts from
+    // any previous execution
     dpiStmt__clearBatchErrors(stmt);
+    dpiStmt__clearImplicitResults(stmt);
+    stmt->hasTotalRowCount = 0;
 
     // adjust mode for scrollable cursors, but not if performing a describe
     // only (or a malformed TTC packet from client exception is thrown)
@@ -611,12 +859,24 @@ static int dpiStmt__execute(dpiStmt *stmt, uint32_t numIters,
             return DPI_FAILURE;
     }
 
+    // ALTER SESSION and PL/SQL may change the session state (such as the
+    // module, action or NLS settings) by means other than dpiSessionState, so
+    // the state retained on a pooled session is no longer reliable; this is
+    // done before execution since the state may change even if it fails
+    if (stmt->conn->pool && (stmt->statementType == DPI_STMT_TYPE_ALTER ||
+            stmt->statementType == DPI_STMT_TYPE_BEGIN ||
+            stmt->statementType == DPI_STMT_TYPE_DECLARE ||
+            stmt->statementType == DPI_STMT_TYPE_CALL))
+        dpiSessionState__forget(stmt->conn, error);
+
     // perform execution
     // re-execute statement for ORA-01007: variable not in select list and
     // ORA-00932: inconsistent data types; drop statement from cache for all
     // errors (except those which are due to invalid data which may be fixed in
     // subsequent execution)
-    if (dpiOci__stmtExecute(stmt, numIters, mode, error) < 0) {
+    if (stmt->profileEntry)
+        startNs = dpiUtils__getTimeNs();
+    if (dpiOci__stmtExecute(stmt, numIters, rowOffset, mode, error) < 0) {
         dpiOci__attrGet(stmt->handle, DPI_OCI_HTYPE_STMT, &tempOffset, 0,
                 DPI_OCI_ATTR_PARSE_ERROR_OFFSET, "set parse offset", error);
         error->buffer->offset = tempOffset;
@@ -639,8 +899,29 @@ static int dpiStmt__execute(dpiStmt *stmt, uint32_t numIters,
             default:
                 stmt->deleteFromCache = 1;
         }
+
+        // if a callback streaming a value failed, OCI replaces the error
+        // raised by the callback with its own; restore the original error;
+        // the callbacks may have been partially consumed so they are all
+        // cleared and must be set again before the next execute
+        streamFailed = 0;
+        for (i = 0; i < stmt->numBindVars; i++) {
+            var = stmt->bindVars[i].var;
+            if (!var->stream)
+                continue;
+            if (var->stream->failed && !streamFailed) {
+                memcpy(error->buffer, &var->stream->errorBuffer,
+                        sizeof(dpiErrorBuffer));
+                streamFailed = 1;
+            }
+            dpiVar__resetStream(var);
+        }
+        dpiStmt__updateTransactionState(stmt, mode, 0, error);
         return DPI_FAILURE;
     }
+    if (stmt->profileEntry)
+        elapsedNs = dpiUtils__getTimeNs() - startNs;
+    dpiStmt__updateTransactionState(stmt, mode, 1, error);
 
     // if requested, the sessionless transaction would have been suspended so
     // clear the transaction now
@@ -649,8 +930,10 @@ static int dpiStmt__execute(dpiStmt *stmt, uint32_t numIters,
             return DPI_FAILURE;
     }
 
-    // fetch SQL_ID, if applicable
-    if (dpiUtils__checkClientVersion(stmt->env->versionInfo, 12, 2,
+    // fetch SQL_ID, if applicable; this does not change until the statement
+    // is prepared again so it is only acquired once
+    if (stmt->sqlIdLength == 0 &&
+            dpiUtils__checkClientVersion(stmt->env->versionInfo, 12, 2,
             NULL) == DPI_SUCCESS) {
         if (dpiOci__attrGet(stmt->handle, DPI_OCI_HTYPE_STMT, &sqlId,
                 &sqlIdLength, DPI_OCI_ATTR_SQL_ID, "get SQL_ID", error) < 0)
@@ -661,16 +944,22 @@ static int dpiStmt__execute(dpiStmt *stmt, uint32_t numIters,
         stmt->sqlIdLength = sqlIdLength;
     }
 
-    // for queries, disable prefetch for subsequent fetches in order to avoid
-    // the overhead of copying from prefetch buffers to our own buffers
-    if (stmt->statementType == DPI_STMT_TYPE_SELECT) {
-        temp = 0;
-        if (dpiOci__attrSet(stmt->handle, DPI_OCI_HTYPE_STMT, &temp,
-                sizeof(temp), DPI_OCI_ATTR_PREFETCH_ROWS,
-                "reset prefetch rows", error) < 0)
+    // if the SQL profiler is enabled, record the execution; rows returned by
+    // queries are recorded as they are fetched
+    if (stmt->profileEntry) {
+        if (stmt->statementType != DPI_STMT_TYPE_SELECT &&
+                dpiStmt__getRowCount(stmt, &rowCount, error) < 0)
             return DPI_FAILURE;
+        dpiSqlProfile__recordExecute(stmt, elapsedNs, rowCount);
     }
 
+    // for queries, prefetch may need to be disabled for subsequent fetches in
+    // order to avoid the overhead of copying from prefetch buffers to our own
+    // buffers; this is deferred until the first fetch is performed, when the
+    // number of rows requested by each fetch is known
+    if (stmt->statementType == DPI_STMT_TYPE_SELECT)
+        stmt->resetPrefetchRows = 1;
+
     // for all bound variables, transfer data from Oracle buffer structures to
     // dpiData structures; OCI doesn't provide a way of knowing if a variable
     // is an out variable so do this for all of them when this is a possibility
@@ -699,19 +988,138 @@ static int dpiStmt__execute(dpiStmt *stmt, uint32_t numIters,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiStmt__defineBuffers() [INTERNAL]
+//   Define the buffers of the variable in the specified column. This is also
+// used to define new buffers when the buffers of the query variables have been
+// detached in a row block.
+//-----------------------------------------------------------------------------
+static int dpiStmt__defineBuffers(dpiStmt *stmt, uint32_t pos, dpiVar *var,
+        dpiError *error)
+{
+    void *defineHandle = NULL;
+    int tempBool;
+
+    // perform the define
+    if (dpiOci__defineByPos2(stmt, &defineHandle, pos, var, error) < 0)
+        return DPI_FAILURE;
+
+    // set the charset form if applicable
+    if (var->type->charsetForm != DPI_SQLCS_IMPLICIT) {
+        if (dpiOci__attrSet(defineHandle, DPI_OCI_HTYPE_DEFINE,
+                (void*) &var->type->charsetForm, 0, DPI_OCI_ATTR_CHARSET_FORM,
+                "set charset form", error) < 0)
+            return DPI_FAILURE;
+    }
+
+    // specify that the LOB length should be prefetched
+    if (var->nativeTypeNum == DPI_NATIVE_TYPE_LOB) {
+        tempBool = 1;
+        if (dpiOci__attrSet(defineHandle, DPI_OCI_HTYPE_DEFINE,
+                (void*) &tempBool, 0, DPI_OCI_ATTR_LOBPREFETCH_LENGTH,
+                "set lob prefetch length", error) < 0)
+            return DPI_FAILURE;
+    }
+
+    // define objects, if applicable
+    if (var->buffer.objectIndicator && dpiOci__defineObject(var, defineHandle,
+            error) < 0)
+        return DPI_FAILURE;
+
+    // register callback for dynamic defines
+    if (var->isDynamic && dpiOci__defineDynamic(var, defineHandle, error) < 0)
+        return DPI_FAILURE;
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmt__detachRowBlock() [INTERNAL]
+//   Detach the buffers of the query variables in a row block and define new
+// buffers (or spare buffers from a row block released earlier) in their
+// place. All of the rows in the buffers are transferred to the row block and
+// the next fetch retrieves rows from the database.
+//-----------------------------------------------------------------------------
+static int dpiStmt__detachRowBlock(dpiStmt *stmt, dpiRowBlock **block,
+        dpiError *error)
+{
+    dpiVarBuffer tempBuffer;
+    dpiRowBlock *tempBlock;
+    dpiVar *var;
+    uint32_t i;
+
+    // acquire a block with buffers to exchange with the query variables
+    if (dpiRowBlock__allocate(stmt, &tempBlock, error) < 0)
+        return DPI_FAILURE;
+
+    // exchange the buffers and define the new ones; if the define fails the
+    // query variables are cleared so that they are created afresh before the
+    // next fetch
+    for (i = 0; i < stmt->numQueryVars; i++) {
+        var = stmt->queryVars[i];
+        tempBuffer = var->buffer;
+        var->buffer = tempBlock->buffers[i];
+        tempBlock->buffers[i] = tempBuffer;
+    }
+    for (i = 0; i < stmt->numQueryVars; i++) {
+        if (dpiStmt__defineBuffers(stmt, i + 1, stmt->queryVars[i],
+                error) < 0) {
+            dpiStmt__clearQueryVars(stmt, error);
+            dpiGen__setRefCount(tempBlock, error, -1);
+            return DPI_FAILURE;
+        }
+    }
+
+    // all rows in the buffers now belong to the block
+    tempBlock->numRows = stmt->bufferRowCount;
+    stmt->rowCount += stmt->bufferRowCount - stmt->bufferRowIndex;
+    stmt->bufferRowCount = 0;
+    stmt->bufferRowIndex = 0;
+
+    *block = tempBlock;
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiStmt__fetch() [INTERNAL]
 //   Performs the actual fetch from Oracle.
 //-----------------------------------------------------------------------------
 static int dpiStmt__fetch(dpiStmt *stmt, dpiError *error)
 {
+    uint64_t startNs = 0;
+    int found;
+
+    // if a scroll cache is in use, the next block of rows may already be
+    // available in the cache
+    if (stmt->scrollCache) {
+        dpiScrollCache__lookup(stmt->scrollCache, stmt, stmt->rowCount + 1,
+                &found);
+        if (found) {
+            stmt->bufferRowIndex =
+                    (uint32_t) (stmt->rowCount + 1 - stmt->bufferMinRow);
+            return dpiStmt__postFetch(stmt, error);
+        }
+    }
+
+    // if the SQL profiler is enabled, note the time the fetch started
+    if (stmt->profileEntry)
+        startNs = dpiUtils__getTimeNs();
+
     // perform any pre-fetch activities required
     if (dpiStmt__beforeFetch(stmt, error) < 0)
         return DPI_FAILURE;
 
-    // perform fetch
-    if (dpiOci__stmtFetch2(stmt, stmt->fetchArraySize, DPI_MODE_FETCH_NEXT, 0,
-            error) < 0)
+    // perform fetch; if a scroll cache is in use the position of the cursor
+    // may not match the rows in the buffers so an absolute fetch is required
+    if (stmt->scrollCache) {
+        if (dpiOci__stmtFetch2(stmt, stmt->fetchArraySize,
+                DPI_MODE_FETCH_ABSOLUTE, (int32_t) (stmt->rowCount + 1),
+                error) < 0)
+            return DPI_FAILURE;
+    } else if (dpiOci__stmtFetch2(stmt, stmt->fetchArraySize,
+            DPI_MODE_FETCH_NEXT, 0, error) < 0)
         return DPI_FAILURE;
 
     // determine the number of rows fetched into buffers
@@ -724,14 +1132,43 @@ static int dpiStmt__fetch(dpiStmt *stmt, dpiError *error)
     stmt->bufferMinRow = stmt->rowCount + 1;
     stmt->bufferRowIndex = 0;
 
+    // retain a copy of the rows in the scroll cache, if applicable
+    if (stmt->scrollCache && dpiScrollCache__store(stmt->scrollCache, stmt,
+            error) < 0)
+        return DPI_FAILURE;
+
     // perform post-fetch activities required
     if (dpiStmt__postFetch(stmt, error) < 0)
         return DPI_FAILURE;
 
+    // if the SQL profiler is enabled, record the fetch
+    if (stmt->profileEntry)
+        dpiSqlProfile__recordFetch(stmt, dpiUtils__getTimeNs() - startNs);
+
     return DPI_SUCCESS;
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiStmt__fetchRowBlock() [INTERNAL]
+//   Fetch the next set of rows from the database, if none remain in the fetch
+// buffers, and detach them from the statement as a row block. If no more rows
+// are available, the block is set to NULL.
+//-----------------------------------------------------------------------------
+int dpiStmt__fetchRowBlock(dpiStmt *stmt, dpiRowBlock **block,
+        dpiError *error)
+{
+    *block = NULL;
+    if (stmt->bufferRowIndex >= stmt->bufferRowCount) {
+        if (stmt->hasRowsToFetch && dpiStmt__fetch(stmt, error) < 0)
+            return DPI_FAILURE;
+        if (stmt->bufferRowIndex >= stmt->bufferRowCount)
+            return DPI_SUCCESS;
+    }
+    return dpiStmt__detachRowBlock(stmt, block, error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiStmt__free() [INTERNAL]
 //   Free the memory associated with the statement.
@@ -744,11 +1181,14 @@ void dpiStmt__free(dpiStmt *stmt, dpiError *error)
         stmt->parentStmt = NULL;
     }
     if (stmt->conn) {
-        dpiHandleList__removeHandle(stmt->conn->openStmts, stmt->openSlotNum);
-        dpiGen__setRefCount(stmt->conn, error, -1);
+        if (!stmt->untracked) {
+            dpiHandleList__removeHandle(stmt->conn->openStmts,
+                    stmt->openSlotNum);
+            dpiGen__setRefCount(stmt->conn, error, -1);
+        }
         stmt->conn = NULL;
     }
-    dpiUtils__freeMemory(stmt);
+    dpiGen__free(stmt);
 }
 
 
@@ -851,6 +1291,8 @@ static int dpiStmt__getRowCount(dpiStmt *stmt, uint64_t *count,
 {
     if (stmt->statementType == DPI_STMT_TYPE_SELECT)
         *count = stmt->rowCount;
+    else if (stmt->hasTotalRowCount)
+        *count = stmt->totalRowCount;
     else if (stmt->statementType != DPI_STMT_TYPE_INSERT &&
             stmt->statementType != DPI_STMT_TYPE_UPDATE &&
             stmt->statementType != DPI_STMT_TYPE_DELETE &&
@@ -927,6 +1369,11 @@ static int dpiStmt__getQueryInfoFromParam(dpiStmt *stmt, void *param,
 //-----------------------------------------------------------------------------
 int dpiStmt__init(dpiStmt *stmt, dpiError *error)
 {
+    // nothing is known about the attributes of a new handle
+    stmt->handlePrefetchRowsKnown = 0;
+    stmt->resetPrefetchRows = 0;
+    stmt->sqlIdLength = 0;
+
     // get statement type
     if (dpiOci__attrGet(stmt->handle, DPI_OCI_HTYPE_STMT,
             (void*) &stmt->statementType, 0, DPI_OCI_ATTR_STMT_TYPE,
@@ -947,27 +1394,154 @@ int dpiStmt__init(dpiStmt *stmt, dpiError *error)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiStmt__isTransientError() [INTERNAL]
+//   Return whether the Oracle error is one that may not occur if the work is
+// simply attempted again: deadlocks, busy resources and serialization
+// failures.
+//-----------------------------------------------------------------------------
+static int dpiStmt__isTransientError(int32_t code)
+{
+    switch (code) {
+        case 54:        // resource busy and acquire with NOWAIT specified
+        case 60:        // deadlock detected while waiting for resource
+        case 8177:      // can't serialize access for this transaction
+        case 30006:     // resource busy; acquire with WAIT timeout expired
+            return 1;
+        default:
+            break;
+    }
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmt__isParallelSafe() [INTERNAL]
+//   Return whether the fetched rows of the variable can be converted on a
+// thread other than the one performing the fetch, concurrently with other
+// columns. Conversions that create handles or reference counted objects, or
+// that make use of state cached in the environment, are excluded.
+//-----------------------------------------------------------------------------
+static int dpiStmt__isParallelSafe(dpiVar *var)
+{
+    if (var->type->requiresPreFetch || var->objectType)
+        return 0;
+    switch (var->nativeTypeNum) {
+        case DPI_NATIVE_TYPE_LOB:
+        case DPI_NATIVE_TYPE_OBJECT:
+        case DPI_NATIVE_TYPE_STMT:
+        case DPI_NATIVE_TYPE_ROWID:
+        case DPI_NATIVE_TYPE_JSON:
+        case DPI_NATIVE_TYPE_VECTOR:
+            return 0;
+        case DPI_NATIVE_TYPE_DOUBLE:
+            switch (var->type->oracleTypeNum) {
+                case DPI_ORACLE_TYPE_DATE:
+                case DPI_ORACLE_TYPE_TIMESTAMP:
+                case DPI_ORACLE_TYPE_TIMESTAMP_TZ:
+                case DPI_ORACLE_TYPE_TIMESTAMP_LTZ:
+                    return 0;
+                default:
+                    break;
+            }
+            break;
+        default:
+            break;
+    }
+    return 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmt__postFetchColumn() [INTERNAL]
+//   Performs the transformations required to convert the Oracle data values
+// of a single column into C data values.
+//-----------------------------------------------------------------------------
+static int dpiStmt__postFetchColumn(dpiStmt *stmt, dpiVar *var,
+        dpiError *error)
+{
+    if (dpiVar__getColumnValues(var, stmt->bufferRowCount, error) < 0)
+        return DPI_FAILURE;
+    if (var->type->requiresPreFetch && stmt->bufferRowCount > 0)
+        var->requiresPreFetch = 1;
+    var->error = NULL;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmt__postFetchTask() [INTERNAL]
+//   Task performed by the conversion pool of the context; each task converts
+// one column, skipping those that were already converted serially.
+//-----------------------------------------------------------------------------
+static int dpiStmt__postFetchTask(void *context, uint32_t taskNum,
+        dpiError *error)
+{
+    dpiStmt *stmt = (dpiStmt*) context;
+    dpiVar *var;
+
+    var = stmt->queryVars[taskNum];
+    if (!dpiStmt__isParallelSafe(var))
+        return DPI_SUCCESS;
+    return dpiStmt__postFetchColumn(stmt, var, error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiStmt__postFetch() [INTERNAL]
 //   Performs the transformations required to convert Oracle data values into
-// C data values.
+// C data values. The fetched rows of each column are transformed in a single
+// call to the converter resolved for the variable. If the context has a
+// conversion pool and the batch is large enough, the columns are split between
+// the threads of the pool; columns that cannot safely be converted that way
+// are converted first on the calling thread.
 //-----------------------------------------------------------------------------
 static int dpiStmt__postFetch(dpiStmt *stmt, dpiError *error)
 {
-    uint32_t i, j;
+    dpiWorkerPool *pool = stmt->env->context->conversionPool;
+    uint32_t i;
     dpiVar *var;
 
-    for (i = 0; i < stmt->numQueryVars; i++) {
-        var = stmt->queryVars[i];
-        for (j = 0; j < stmt->bufferRowCount; j++) {
-            if (dpiVar__getValue(var, &var->buffer, j, 1, error) < 0)
+    // convert the columns in parallel, if applicable
+    if (pool && stmt->env->threaded && stmt->numQueryVars > 1 &&
+            (uint64_t) stmt->numQueryVars * stmt->bufferRowCount >=
+                    DPI_PARALLEL_CONVERSION_MIN_VALUES) {
+        for (i = 0; i < stmt->numQueryVars; i++) {
+            var = stmt->queryVars[i];
+            if (!dpiStmt__isParallelSafe(var) &&
+                    dpiStmt__postFetchColumn(stmt, var, error) < 0)
                 return DPI_FAILURE;
-            if (var->type->requiresPreFetch)
-                var->requiresPreFetch = 1;
         }
-        var->error = NULL;
+        return dpiWorkerPool__run(pool, stmt->env, stmt->numQueryVars,
+                dpiStmt__postFetchTask, stmt, error);
     }
 
+    // otherwise, convert each column in turn
+    for (i = 0; i < stmt->numQueryVars; i++) {
+        if (dpiStmt__postFetchColumn(stmt, stmt->queryVars[i], error) < 0)
+            return DPI_FAILURE;
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmt__beforeFetchColumn() [INTERNAL]
+//   Performs the work that needs to be done prior to fetch for a single
+// variable, after ensuring that it has enough space to hold the number of rows
+// that are to be fetched.
+//-----------------------------------------------------------------------------
+static int dpiStmt__beforeFetchColumn(dpiVar *var, uint32_t numRows,
+        dpiError *error)
+{
+    var->error = error;
+    if (numRows > var->buffer.maxArraySize)
+        return dpiError__set(error, "check array size",
+                DPI_ERR_ARRAY_SIZE_TOO_SMALL, var->buffer.maxArraySize);
+    if (var->requiresPreFetch && dpiVar__extendedPreFetch(var,
+            &var->buffer, error) < 0)
+        return DPI_FAILURE;
     return DPI_SUCCESS;
 }
 
@@ -988,6 +1562,8 @@ static int dpiStmt__beforeFetch(dpiStmt *stmt, dpiError *error)
 
     if (!stmt->queryInfo && dpiStmt__createQueryVars(stmt, error) < 0)
         return DPI_FAILURE;
+    if (dpiStmt__resetPrefetchRows(stmt, stmt->fetchArraySize, error) < 0)
+        return DPI_FAILURE;
     for (i = 0; i < stmt->numQueryVars; i++) {
         var = stmt->queryVars[i];
         if (!var) {
@@ -1002,12 +1578,7 @@ static int dpiStmt__beforeFetch(dpiStmt *stmt, dpiError *error)
                 return DPI_FAILURE;
             dpiGen__setRefCount(var, error, -1);
         }
-        var->error = error;
-        if (stmt->fetchArraySize > var->buffer.maxArraySize)
-            return dpiError__set(error, "check array size",
-                    DPI_ERR_ARRAY_SIZE_TOO_SMALL, var->buffer.maxArraySize);
-        if (var->requiresPreFetch && dpiVar__extendedPreFetch(var,
-                &var->buffer, error) < 0)
+        if (dpiStmt__beforeFetchColumn(var, stmt->fetchArraySize, error) < 0)
             return DPI_FAILURE;
     }
 
@@ -1015,25 +1586,109 @@ static int dpiStmt__beforeFetch(dpiStmt *stmt, dpiError *error)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiStmt__setPrefetchRows() [INTERNAL]
+//   Set the number of rows to prefetch on the OCI statement handle. The value
+// last set on the handle is retained so that setting the same value again, as
+// happens when a statement is executed repeatedly, does not call OCI.
+//-----------------------------------------------------------------------------
+static int dpiStmt__setPrefetchRows(dpiStmt *stmt, uint32_t numRows,
+        dpiError *error)
+{
+    if (stmt->handlePrefetchRowsKnown && stmt->handlePrefetchRows == numRows)
+        return DPI_SUCCESS;
+    stmt->handlePrefetchRowsKnown = 0;
+    if (dpiOci__attrSet(stmt->handle, DPI_OCI_HTYPE_STMT, &numRows,
+            sizeof(numRows), DPI_OCI_ATTR_PREFETCH_ROWS, "set prefetch rows",
+            error) < 0)
+        return DPI_FAILURE;
+    stmt->handlePrefetchRows = numRows;
+    stmt->handlePrefetchRowsKnown = 1;
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiStmt__prepare() [INTERNAL]
-//   Prepare a statement for execution.
+//   Prepare a statement for execution. If the SQL normalizer is enabled, the
+// literals in the SQL text are replaced with bind placeholders, the statement
+// cache is searched first so that cache hits can be counted and the values of
+// the literals are bound once the statement has been prepared.
 //-----------------------------------------------------------------------------
 int dpiStmt__prepare(dpiStmt *stmt, const char *sql, uint32_t sqlLength,
         const char *tag, uint32_t tagLength, dpiError *error)
 {
+    dpiSqlNormalizer *normalizer = stmt->env->context->sqlNormalizer;
+    dpiSqlProfile *profile = stmt->env->context->sqlProfile;
+    const char *preparedSql = sql;
+    uint32_t preparedSqlLength = sqlLength;
+    dpiSqlNormalized normalized;
+    uint64_t startNs = 0;
+    int cacheHit = 0;
+
+    // apply the snapshot set on the connection, if it has changed since it
+    // was last applied
+    if (sql && stmt->conn->snapshotScn != stmt->conn->appliedSnapshotScn &&
+            dpiSnapshot__apply(stmt->conn, error) < 0)
+        return DPI_FAILURE;
+
+    // normalize the SQL text, if applicable
     if (sql && dpiDebugLevel & DPI_DEBUG_LEVEL_SQL)
         dpiDebug__print("SQL %.*s\n", sqlLength, sql);
-    if (dpiOci__stmtPrepare2(stmt, sql, sqlLength, tag, tagLength, error) < 0)
+    memset(&normalized, 0, sizeof(normalized));
+    if (!sql || tag)
+        normalizer = NULL;
+    if (normalizer) {
+        if (dpiSqlNormalizer__normalize(sql, sqlLength, &normalized,
+                error) < 0)
+            return DPI_FAILURE;
+        if (normalized.sql) {
+            preparedSql = normalized.sql;
+            preparedSqlLength = normalized.sqlLength;
+            if (dpiDebugLevel & DPI_DEBUG_LEVEL_SQL)
+                dpiDebug__print("normalized SQL %.*s\n", preparedSqlLength,
+                        preparedSql);
+        }
+    }
+
+    // prepare the statement; when the normalizer is enabled, the statement
+    // cache is searched first
+    if (profile)
+        startNs = dpiUtils__getTimeNs();
+    if (normalizer)
+        dpiOci__stmtSearchCache(stmt, preparedSql, preparedSqlLength,
+                &cacheHit, error);
+    if (!cacheHit && dpiOci__stmtPrepare2(stmt, preparedSql,
+            preparedSqlLength, tag, tagLength, error) < 0) {
+        dpiSqlNormalizer__freeNormalized(&normalized);
         return DPI_FAILURE;
-    if (dpiHandleList__addHandle(stmt->conn->openStmts, stmt,
-            &stmt->openSlotNum, error) < 0) {
+    }
+    if (profile)
+        dpiSqlProfile__recordPrepare(stmt, preparedSql, preparedSqlLength,
+                dpiUtils__getTimeNs() - startNs, error);
+    if (!stmt->untracked && dpiHandleList__addHandle(stmt->conn->openStmts,
+            stmt, &stmt->openSlotNum, error) < 0) {
         dpiOci__stmtRelease(stmt, NULL, 0, 0, error);
         stmt->handle = NULL;
+        dpiSqlNormalizer__freeNormalized(&normalized);
+        return DPI_FAILURE;
+    }
+    if (dpiStmt__init(stmt, error) < 0) {
+        dpiSqlNormalizer__freeNormalized(&normalized);
         return DPI_FAILURE;
     }
 
-    return dpiStmt__init(stmt, error);
+    // bind the values of the literals that were replaced, if applicable
+    if (normalizer) {
+        if (dpiSqlNormalizer__bind(stmt, &normalized, error) < 0) {
+            dpiSqlNormalizer__freeNormalized(&normalized);
+            return DPI_FAILURE;
+        }
+        dpiSqlNormalizer__recordPrepare(normalizer, &normalized, cacheHit);
+        dpiSqlNormalizer__freeNormalized(&normalized);
+    }
+
+    return DPI_SUCCESS;
 }
 
 
@@ -1077,7 +1732,11 @@ static int dpiStmt__reExecute(dpiStmt *stmt, uint32_t numIters,
     if (dpiOci__stmtRelease(stmt, NULL, 0, 1, &localError) < 0 || status < 0)
         return DPI_FAILURE;
     stmt->handle = newHandle;
+    stmt->handlePrefetchRowsKnown = 0;
+    stmt->resetPrefetchRows = 0;
+    stmt->sqlIdLength = 0;
     dpiStmt__clearBatchErrors(stmt);
+    dpiStmt__clearImplicitResults(stmt);
     dpiStmt__clearQueryVars(stmt, error);
 
     // perform binds
@@ -1093,12 +1752,194 @@ static int dpiStmt__reExecute(dpiStmt *stmt, uint32_t numIters,
             return DPI_FAILURE;
         }
     }
+    if (stmt->structBind &&
+            dpiStructMap__bind(stmt->structBind, stmt, error) < 0)
+        return DPI_FAILURE;
 
     // now re-execute the statement
     return dpiStmt__execute(stmt, numIters, mode, 0, error);
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiStmt__resetPrefetchRows() [INTERNAL]
+//   Disable prefetch before the first fetch following an execute, if needed.
+// Prefetch only results in rows being copied from the OCI prefetch buffer to
+// our own buffers when more rows are prefetched than are requested by each
+// fetch; otherwise the prefetch value is left in place so that the next
+// execute does not need to set it again.
+//-----------------------------------------------------------------------------
+static int dpiStmt__resetPrefetchRows(dpiStmt *stmt, uint32_t numRows,
+        dpiError *error)
+{
+    if (!stmt->resetPrefetchRows)
+        return DPI_SUCCESS;
+    if (stmt->prefetchRows > numRows &&
+            dpiStmt__setPrefetchRows(stmt, 0, error) < 0)
+        return DPI_FAILURE;
+    stmt->resetPrefetchRows = 0;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmt__retryRow() [INTERNAL]
+//   Execute a single row that failed with a transient error again, up to the
+// specified number of times. If the row still fails, the row error is
+// replaced with the last error encountered; if it succeeds, the rows it
+// affected are added to the totals.
+//-----------------------------------------------------------------------------
+static int dpiStmt__retryRow(dpiStmt *stmt, uint32_t rowNum, uint32_t mode,
+        uint32_t maxRetries, dpiErrorBuffer *rowError, int *succeeded,
+        dpiError *error)
+{
+    uint32_t attempt;
+
+    *succeeded = 0;
+    for (attempt = 0; attempt < maxRetries &&
+            dpiStmt__isTransientError(rowError->code); attempt++) {
+        if (dpiStmt__executeRows(stmt, rowNum, 1, mode, 0, error) < 0) {
+            if (!dpiStmt__isTransientError(error->buffer->code))
+                return DPI_FAILURE;
+            memcpy(rowError, error->buffer, sizeof(dpiErrorBuffer));
+            rowError->offset = rowNum;
+            continue;
+        }
+        if (dpiStmt__getBatchErrors(stmt, error) < 0)
+            return DPI_FAILURE;
+        if (stmt->numBatchErrors == 0) {
+            *succeeded = 1;
+            return dpiStmt__addRowCounts(stmt, rowNum, 1, error);
+        }
+        memcpy(rowError, &stmt->batchErrors[0], sizeof(dpiErrorBuffer));
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmt__transferBindValues() [INTERNAL]
+//   Transfer the values of the bind variables from the dpiData structures to
+// the Oracle buffers, for at most the specified number of rows of each
+// variable (all elements are always transferred for arrays).
+//-----------------------------------------------------------------------------
+static int dpiStmt__transferBindValues(dpiStmt *stmt, uint32_t numIters,
+        uint32_t numRows, dpiError *error)
+{
+    uint32_t i, j, numVarRows;
+    dpiData *data;
+    dpiVar *var;
+
+    // for all bound variables, transfer data from dpiData structure to Oracle
+    // buffer structures
+    for (i = 0; i < stmt->numBindVars; i++) {
+        var = stmt->bindVars[i].var;
+        if (var->isArray && numIters > 1)
+            return dpiError__set(error, "bind array var",
+                    DPI_ERR_ARRAY_VAR_NOT_SUPPORTED);
+        if (dpiVar__writePendingLobValues(var, error) < 0)
+            return DPI_FAILURE;
+        numVarRows = var->buffer.maxArraySize;
+        if (!var->isArray && numRows < numVarRows)
+            numVarRows = numRows;
+        for (j = 0; j < numVarRows; j++) {
+            data = &var->buffer.externalData[j];
+            if (dpiVar__setValue(var, &var->buffer, j, data, error) < 0)
+                return DPI_FAILURE;
+            if (var->dynBindBuffers)
+                var->dynBindBuffers[j].actualArraySize = 0;
+        }
+        if (stmt->isReturning || var->isDynamic)
+            var->error = error;
+        if (var->stream) {
+            var->stream->isActive = 0;
+            var->stream->failed = 0;
+        }
+    }
+
+    // transfer data from an array of structs bound to the statement, if
+    // applicable; queries are executed with zero iterations but still use
+    // the first row
+    if (stmt->structBind)
+        dpiStructMap__toOracle(stmt->structBind,
+                (numIters > 0) ? numIters : 1);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmt__updateTransactionState() [INTERNAL]
+//   Update the transaction state tracked by the connection after the
+// statement has been executed. Where the effect of the statement on the
+// transaction cannot be determined from its type (such as for queries, which
+// may lock rows or access a remote database, and PL/SQL), the session
+// attribute that the server returns with each call is consulted; this does
+// not require a round trip. With clients older than 12.1 this attribute is
+// not available and the state becomes unknown instead, so that the server is
+// consulted by the next commit or rollback.
+//-----------------------------------------------------------------------------
+static void dpiStmt__updateTransactionState(dpiStmt *stmt, uint32_t mode,
+        int succeeded, dpiError *error)
+{
+    dpiErrorBuffer localErrorBuffer;
+    dpiConn *conn = stmt->conn;
+    uint32_t txnInProgress;
+    dpiError localError;
+
+    // statements that are only parsed or described are not executed
+    if (mode & (DPI_MODE_EXEC_DESCRIBE_ONLY | DPI_MODE_EXEC_PARSE_ONLY))
+        return;
+
+    switch (stmt->statementType) {
+        case DPI_STMT_TYPE_SELECT:
+            if (conn->transactionState != DPI_TXN_STATE_ACTIVE)
+                conn->transactionState = DPI_TXN_STATE_UNKNOWN;
+            break;
+        case DPI_STMT_TYPE_INSERT:
+        case DPI_STMT_TYPE_UPDATE:
+        case DPI_STMT_TYPE_DELETE:
+        case DPI_STMT_TYPE_MERGE:
+        case DPI_STMT_TYPE_EXPLAIN_PLAN:
+            conn->transactionState = DPI_TXN_STATE_ACTIVE;
+            break;
+        case DPI_STMT_TYPE_CREATE:
+        case DPI_STMT_TYPE_DROP:
+        case DPI_STMT_TYPE_COMMIT:
+            conn->transactionState = (succeeded) ? DPI_TXN_STATE_NONE :
+                    DPI_TXN_STATE_UNKNOWN;
+            break;
+        case DPI_STMT_TYPE_ALTER:
+            // ALTER SESSION does not commit but other ALTER statements do; in
+            // either case no transaction remains if none was in progress
+            if (!succeeded || conn->transactionState != DPI_TXN_STATE_NONE)
+                conn->transactionState = DPI_TXN_STATE_UNKNOWN;
+            break;
+        default:
+            // PL/SQL, ROLLBACK (which may be to a savepoint) and all other
+            // statements
+            conn->transactionState = DPI_TXN_STATE_UNKNOWN;
+            break;
+    }
+    if (succeeded && (mode & DPI_MODE_EXEC_COMMIT_ON_SUCCESS))
+        conn->transactionState = DPI_TXN_STATE_NONE;
+    if (succeeded && conn->transactionState == DPI_TXN_STATE_UNKNOWN &&
+            conn->sessionHandle && conn->env->versionInfo->versionNum >= 12) {
+        localError.buffer = &localErrorBuffer;
+        localError.handle = error->handle;
+        localError.env = error->env;
+        if (dpiOci__attrGet(conn->sessionHandle, DPI_OCI_HTYPE_SESSION,
+                &txnInProgress, NULL, DPI_OCI_ATTR_TRANSACTION_IN_PROGRESS,
+                "get transaction in progress", &localError) == DPI_SUCCESS)
+            conn->transactionState = (txnInProgress) ? DPI_TXN_STATE_ACTIVE :
+                    DPI_TXN_STATE_NONE;
+        error->handle = localError.handle;
+    }
+    if (mode & DPI_MODE_EXEC_SUSPEND_ON_SUCCESS)
+        conn->transactionState = DPI_TXN_STATE_UNKNOWN;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiStmt_addRef() [PUBLIC]
 //   Add a reference to the statement.
@@ -1188,6 +2029,67 @@ int dpiStmt_bindValueByPos(dpiStmt *stmt, uint32_t pos,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiStmt_bindStruct() [PUBLIC]
+//   Bind the fields of a caller-owned array of structs to the statement by
+// position. Any array of structs previously bound is replaced, and variables
+// previously bound at the same positions are released.
+//-----------------------------------------------------------------------------
+int dpiStmt_bindStruct(dpiStmt *stmt, const dpiStructLayout *layout,
+        void *rows, uint32_t numRows)
+{
+    dpiStructMap *map;
+    dpiBindVar *entry;
+    dpiError error;
+    uint32_t i, j;
+
+    // verify parameters
+    if (dpiStmt__check(stmt, __func__, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(stmt, layout)
+    DPI_CHECK_PTR_NOT_NULL(stmt, rows)
+    if (layout->numFields > 0 && !layout->fields) {
+        dpiError__set(&error, "check parameter layout->fields",
+                DPI_ERR_NULL_POINTER_PARAMETER, "layout->fields");
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    }
+    if (numRows == 0) {
+        dpiError__set(&error, "check number of rows", DPI_ERR_ARRAY_SIZE_ZERO);
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    }
+
+    // create the map and perform the binds
+    if (dpiStructMap__create(layout, rows, numRows, &map, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    if (dpiStructMap__bind(map, stmt, &error) < 0) {
+        dpiStructMap__free(map);
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    }
+
+    // release any variables that were bound at the same positions
+    for (i = 0; i < map->numFields; i++) {
+        for (j = 0; j < stmt->numBindVars; j++) {
+            entry = &stmt->bindVars[j];
+            if (entry->pos != map->fields[i].pos || entry->nameLength > 0)
+                continue;
+            if (entry->var)
+                dpiGen__setRefCount(entry->var, &error, -1);
+            stmt->numBindVars--;
+            if (j < stmt->numBindVars)
+                memmove(entry, entry + 1,
+                        (stmt->numBindVars - j) * sizeof(dpiBindVar));
+            break;
+        }
+    }
+
+    // replace any array of structs that was previously bound
+    if (stmt->structBind)
+        dpiStructMap__free(stmt->structBind);
+    stmt->structBind = map;
+    return dpiGen__endPublicFn(stmt, DPI_SUCCESS, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiStmt_close() [PUBLIC]
 //   Close the statement so that it is no longer usable and all resources have
@@ -1271,6 +2173,129 @@ int dpiStmt_defineValue(dpiStmt *stmt, uint32_t pos,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiStmt_defineStruct() [PUBLIC]
+//   Define the fields of a caller-owned array of structs to accept the data
+// fetched by dpiStmt_fetchStruct(). Any variables defined for the same columns
+// are released and any rows remaining in the internal buffers are discarded.
+// Variables defined for other columns which are too small to hold the maximum
+// number of rows are replaced.
+//-----------------------------------------------------------------------------
+int dpiStmt_defineStruct(dpiStmt *stmt, const dpiStructLayout *layout,
+        void *rows, uint32_t maxRows)
+{
+    dpiStructMap *map;
+    dpiError error;
+    uint32_t i, pos;
+    dpiData *data;
+    dpiVar *var;
+
+    // verify parameters
+    if (dpiStmt__check(stmt, __func__, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(stmt, layout)
+    DPI_CHECK_PTR_NOT_NULL(stmt, rows)
+    if (layout->numFields > 0 && !layout->fields) {
+        dpiError__set(&error, "check parameter layout->fields",
+                DPI_ERR_NULL_POINTER_PARAMETER, "layout->fields");
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    }
+    if (maxRows == 0) {
+        dpiError__set(&error, "check max rows", DPI_ERR_ARRAY_SIZE_ZERO);
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    }
+    if (!stmt->queryInfo && dpiStmt__createQueryVars(stmt, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    for (i = 0; i < layout->numFields; i++) {
+        pos = layout->fields[i].pos;
+        if (pos == 0 || pos > stmt->numQueryVars) {
+            dpiError__set(&error, "check query position",
+                    DPI_ERR_QUERY_POSITION_INVALID, pos);
+            return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+        }
+    }
+
+    // the remaining columns are fetched into their variables by the same
+    // fetch call, so any that cannot hold the number of rows fetched are
+    // replaced by variables that can
+    for (pos = 1; pos <= stmt->numQueryVars; pos++) {
+        var = stmt->queryVars[pos - 1];
+        if (!var || var->buffer.maxArraySize >= maxRows)
+            continue;
+        for (i = 0; i < layout->numFields; i++) {
+            if (layout->fields[i].pos == pos)
+                break;
+        }
+        if (i < layout->numFields)
+            continue;
+        if (dpiVar__allocate(stmt->conn, var->type->oracleTypeNum,
+                var->nativeTypeNum, maxRows, var->sizeInBytes, 1, 0,
+                var->objectType, &var, &data, &error) < 0)
+            return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+        if (dpiStmt__define(stmt, pos, var, &error) < 0) {
+            dpiGen__setRefCount(var, &error, -1);
+            return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+        }
+        dpiGen__setRefCount(var, &error, -1);
+    }
+
+    // create the map and perform the defines
+    if (dpiStructMap__create(layout, rows, maxRows, &map, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    if (dpiStructMap__define(map, stmt, &error) < 0) {
+        dpiStructMap__free(map);
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    }
+
+    // release any variables that were defined for the same columns; rows in
+    // the internal buffers and cached blocks are no longer valid
+    for (i = 0; i < map->numFields; i++) {
+        pos = map->fields[i].pos;
+        if (stmt->queryVars[pos - 1]) {
+            dpiGen__setRefCount(stmt->queryVars[pos - 1], &error, -1);
+            stmt->queryVars[pos - 1] = NULL;
+        }
+    }
+    stmt->bufferRowIndex = stmt->bufferRowCount;
+    if (stmt->scrollCache)
+        dpiScrollCache__clear(stmt->scrollCache);
+
+    // replace any array of structs that was previously defined
+    if (stmt->structDefine)
+        dpiStructMap__free(stmt->structDefine);
+    stmt->structDefine = map;
+    return dpiGen__endPublicFn(stmt, DPI_SUCCESS, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmt_detachRowBlock() [PUBLIC]
+//   Detach the rows currently held in the fetch buffers of the statement as a
+// row block which can be used independently of the statement.
+//-----------------------------------------------------------------------------
+int dpiStmt_detachRowBlock(dpiStmt *stmt, dpiRowBlock **block)
+{
+    dpiError error;
+    int status;
+
+    if (dpiStmt__check(stmt, __func__, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(stmt, block)
+    if (!stmt->queryVars) {
+        dpiError__set(&error, "check query vars",
+                DPI_ERR_QUERY_NOT_EXECUTED);
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    }
+    if (stmt->scrollable || stmt->structDefine) {
+        dpiError__set(&error, "check statement",
+                DPI_ERR_ROW_BLOCK_NOT_SUPPORTED);
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    }
+    status = dpiStmt__detachRowBlock(stmt, block, &error);
+    return dpiGen__endPublicFn(stmt, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiStmt_execute() [PUBLIC]
 //   Execute a statement. If the statement has been executed before, however,
@@ -1303,7 +2328,6 @@ int dpiStmt_execute(dpiStmt *stmt, dpiExecMode mode, uint32_t *numQueryColumns)
 int dpiStmt_executeMany(dpiStmt *stmt, dpiExecMode mode, uint32_t numIters)
 {
     dpiError error;
-    uint32_t i;
 
     // verify statement is open
     if (dpiStmt__check(stmt, __func__, &error) < 0)
@@ -1329,14 +2353,8 @@ int dpiStmt_executeMany(dpiStmt *stmt, dpiExecMode mode, uint32_t numIters)
 
     // ensure that all bind variables have a big enough maxArraySize to
     // support this operation
-    for (i = 0; i < stmt->numBindVars; i++) {
-        if (stmt->bindVars[i].var->buffer.maxArraySize < numIters) {
-            dpiError__set(&error, "check array size",
-                    DPI_ERR_ARRAY_SIZE_TOO_SMALL,
-                    stmt->bindVars[i].var->buffer.maxArraySize);
-            return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
-        }
-    }
+    if (dpiStmt__checkArraySize(stmt, numIters, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
 
     // perform execution
     dpiStmt__clearBatchErrors(stmt);
@@ -1353,6 +2371,170 @@ int dpiStmt_executeMany(dpiStmt *stmt, dpiExecMode mode, uint32_t numIters)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiStmt_executeManyAdaptive() [PUBLIC]
+//   Execute a DML statement multiple times in batches. The size of each batch
+// is adjusted to approach the target execution time per batch. Errors for
+// individual rows are collected as batch errors; rows (and batches) that fail
+// with a transient error are executed again up to the specified number of
+// times before the error is recorded.
+//-----------------------------------------------------------------------------
+int dpiStmt_executeManyAdaptive(dpiStmt *stmt, dpiExecMode mode,
+        uint32_t numIters, const dpiAdaptiveExecParams *params)
+{
+    uint32_t i, rowOffset, batchSize, maxBatchSize, targetMs, maxRetries;
+    uint32_t numErrors = 0, numAllocatedErrors = 0, numBatchErrors;
+    dpiErrorBuffer *errors = NULL, *tempErrors, *batchErrors;
+    uint64_t startNs, elapsedMs, nextBatchSize;
+    uint32_t batchMode;
+    int status, succeeded;
+    dpiError error;
+
+    // verify parameters
+    if (dpiStmt__check(stmt, __func__, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    if (stmt->statementType != DPI_STMT_TYPE_INSERT &&
+            stmt->statementType != DPI_STMT_TYPE_UPDATE &&
+            stmt->statementType != DPI_STMT_TYPE_DELETE &&
+            stmt->statementType != DPI_STMT_TYPE_MERGE) {
+        dpiError__set(&error, "check statement type",
+                DPI_ERR_EXEC_MODE_ONLY_FOR_DML);
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    }
+    if (stmt->isReturning || (mode & ~((uint32_t)
+            (DPI_MODE_EXEC_COMMIT_ON_SUCCESS |
+             DPI_MODE_EXEC_ARRAY_DML_ROWCOUNTS))) != 0) {
+        dpiError__set(&error, "check mode", DPI_ERR_NOT_SUPPORTED);
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    }
+    if (dpiStmt__checkArraySize(stmt, numIters, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    batchMode = DPI_MODE_EXEC_BATCH_ERRORS;
+    if (mode & DPI_MODE_EXEC_ARRAY_DML_ROWCOUNTS) {
+        if (dpiUtils__checkClientVersion(stmt->env->versionInfo, 12, 1,
+                &error) < 0)
+            return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+        batchMode |= DPI_MODE_EXEC_ARRAY_DML_ROWCOUNTS;
+    }
+
+    // prepare the totals of the rows affected by all of the batches
+    if (stmt->totalRowCounts) {
+        dpiUtils__freeMemory(stmt->totalRowCounts);
+        stmt->totalRowCounts = NULL;
+    }
+    stmt->totalRowCount = 0;
+    stmt->numTotalRowCounts = 0;
+    if ((mode & DPI_MODE_EXEC_ARRAY_DML_ROWCOUNTS) && numIters > 0) {
+        if (dpiUtils__allocateMemory(numIters, sizeof(uint64_t), 1,
+                "allocate row counts", (void**) &stmt->totalRowCounts,
+                &error) < 0)
+            return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+        stmt->numTotalRowCounts = numIters;
+    }
+
+    // determine batch sizes to use
+    maxBatchSize = numIters;
+    batchSize = DPI_DEFAULT_ADAPTIVE_BATCH_SIZE;
+    targetMs = maxRetries = 0;
+    if (params) {
+        if (params->maxBatchSize > 0 && params->maxBatchSize < numIters)
+            maxBatchSize = params->maxBatchSize;
+        if (params->initialBatchSize > 0)
+            batchSize = params->initialBatchSize;
+        targetMs = params->targetBatchTimeMs;
+        maxRetries = params->maxRetries;
+    }
+    if (batchSize > maxBatchSize)
+        batchSize = maxBatchSize;
+
+    // transfer the values of all rows to the Oracle buffers once; each batch
+    // then refers to a range of these rows
+    dpiStmt__clearBatchErrors(stmt);
+    if (dpiStmt__transferBindValues(stmt, numIters, numIters, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+
+    // execute each batch, collecting the batch errors from each of them
+    status = DPI_SUCCESS;
+    rowOffset = 0;
+    while (rowOffset < numIters) {
+        if (batchSize > numIters - rowOffset)
+            batchSize = numIters - rowOffset;
+        startNs = dpiUtils__getTimeNs();
+        if (dpiStmt__executeBatch(stmt, rowOffset, batchSize, batchMode,
+                maxRetries, &error) < 0 ||
+                dpiStmt__addRowCounts(stmt, rowOffset, batchSize,
+                        &error) < 0) {
+            status = DPI_FAILURE;
+            break;
+        }
+        elapsedMs = (dpiUtils__getTimeNs() - startNs) / 1000000;
+
+        // take ownership of the batch errors and retry any rows that failed
+        // with a transient error; rows that succeed are dropped from the list
+        batchErrors = stmt->batchErrors;
+        numBatchErrors = stmt->numBatchErrors;
+        stmt->batchErrors = NULL;
+        stmt->numBatchErrors = 0;
+        if (numErrors + numBatchErrors > numAllocatedErrors) {
+            numAllocatedErrors = numErrors + numBatchErrors + 16;
+            if (dpiUtils__allocateMemory(numAllocatedErrors,
+                    sizeof(dpiErrorBuffer), 0, "allocate errors",
+                    (void**) &tempErrors, &error) < 0) {
+                dpiUtils__freeMemory(batchErrors);
+                status = DPI_FAILURE;
+                break;
+            }
+            if (errors) {
+                memcpy(tempErrors, errors, numErrors * sizeof(dpiErrorBuffer));
+                dpiUtils__freeMemory(errors);
+            }
+            errors = tempErrors;
+        }
+        for (i = 0; i < numBatchErrors && status == DPI_SUCCESS; i++) {
+            memcpy(&errors[numErrors], &batchErrors[i],
+                    sizeof(dpiErrorBuffer));
+            status = dpiStmt__retryRow(stmt, batchErrors[i].offset,
+                    batchMode, maxRetries, &errors[numErrors],
+                    &succeeded, &error);
+            if (status == DPI_SUCCESS && !succeeded)
+                numErrors++;
+        }
+        if (batchErrors)
+            dpiUtils__freeMemory(batchErrors);
+        dpiStmt__clearBatchErrors(stmt);
+        if (status < 0)
+            break;
+        rowOffset += batchSize;
+
+        // adjust the size of the next batch toward the target time, but by no
+        // more than a factor of two in either direction
+        if (targetMs > 0) {
+            nextBatchSize = (elapsedMs == 0) ? (uint64_t) batchSize * 2 :
+                    ((uint64_t) batchSize * targetMs) / elapsedMs;
+            if (nextBatchSize > (uint64_t) batchSize * 2)
+                nextBatchSize = (uint64_t) batchSize * 2;
+            if (nextBatchSize < batchSize / 2)
+                nextBatchSize = batchSize / 2;
+            if (nextBatchSize > maxBatchSize)
+                nextBatchSize = maxBatchSize;
+            batchSize = (nextBatchSize < 1) ? 1 : (uint32_t) nextBatchSize;
+        }
+    }
+
+    // the errors collected from all batches become the batch errors of the
+    // statement and the rows affected by all batches become its row counts
+    stmt->batchErrors = errors;
+    stmt->numBatchErrors = numErrors;
+    stmt->hasTotalRowCount = 1;
+
+    // commit, if applicable
+    if (status == DPI_SUCCESS && (mode & DPI_MODE_EXEC_COMMIT_ON_SUCCESS))
+        status = dpiConn__commit(stmt->conn, &error);
+
+    return dpiGen__endPublicFn(stmt, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiStmt_fetch() [PUBLIC]
 //   Fetch a row from the database.
@@ -1420,6 +2602,66 @@ int dpiStmt_fetchRows(dpiStmt *stmt, uint32_t maxRows,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiStmt_fetchStruct() [PUBLIC]
+//   Fetch rows directly into the array of structs defined with
+// dpiStmt_defineStruct(). The rows are always placed starting with the first
+// struct in the array. Columns which are not part of the struct are fetched
+// into their variables by the same call and are processed in the same way as
+// for any other fetch.
+//-----------------------------------------------------------------------------
+int dpiStmt_fetchStruct(dpiStmt *stmt, uint32_t *numRowsFetched,
+        int *moreRows)
+{
+    dpiStructMap *map;
+    dpiError error;
+    uint32_t i;
+    dpiVar *var;
+
+    if (dpiStmt__check(stmt, __func__, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(stmt, numRowsFetched)
+    DPI_CHECK_PTR_NOT_NULL(stmt, moreRows)
+    map = stmt->structDefine;
+    if (!map) {
+        dpiError__set(&error, "check struct", DPI_ERR_STRUCT_NOT_DEFINED);
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    }
+    *numRowsFetched = 0;
+    if (stmt->hasRowsToFetch) {
+        if (dpiStmt__resetPrefetchRows(stmt, map->numRows, &error) < 0)
+            return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+        for (i = 0; i < stmt->numQueryVars; i++) {
+            var = stmt->queryVars[i];
+            if (var && dpiStmt__beforeFetchColumn(var, map->numRows,
+                    &error) < 0)
+                return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+        }
+        if (dpiOci__stmtFetch2(stmt, map->numRows, DPI_MODE_FETCH_NEXT, 0,
+                &error) < 0)
+            return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+        if (dpiOci__attrGet(stmt->handle, DPI_OCI_HTYPE_STMT, numRowsFetched,
+                0, DPI_OCI_ATTR_ROWS_FETCHED, "get rows fetched", &error) < 0)
+            return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+        dpiStructMap__fromOracle(map, *numRowsFetched);
+
+        // the rows of the columns fetched into variables are converted but
+        // are not returned by later calls to dpiStmt_fetch()
+        stmt->bufferRowCount = *numRowsFetched;
+        stmt->bufferMinRow = stmt->rowCount + 1;
+        for (i = 0; i < stmt->numQueryVars; i++) {
+            var = stmt->queryVars[i];
+            if (var && dpiStmt__postFetchColumn(stmt, var, &error) < 0)
+                return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+        }
+        stmt->bufferRowIndex = stmt->bufferRowCount;
+        stmt->rowCount += *numRowsFetched;
+    }
+    *moreRows = stmt->hasRowsToFetch;
+    return dpiGen__endPublicFn(stmt, DPI_SUCCESS, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiStmt_getBatchErrorCount() [PUBLIC]
 //   Return the number of batch errors that took place during the last
@@ -1576,7 +2818,6 @@ int dpiStmt_getHandle(dpiStmt *stmt, void **handle)
 //-----------------------------------------------------------------------------
 int dpiStmt_getImplicitResult(dpiStmt *stmt, dpiStmt **implicitResult)
 {
-    dpiStmt *tempStmt;
     dpiError error;
     void *handle;
 
@@ -1586,21 +2827,84 @@ int dpiStmt_getImplicitResult(dpiStmt *stmt, dpiStmt **implicitResult)
     if (dpiUtils__checkClientVersion(stmt->env->versionInfo, 12, 1,
             &error) < 0)
         return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
-    if (dpiOci__stmtGetNextResult(stmt, &handle, &error) < 0)
+
+    // if the implicit results have already been collected, return the next
+    // one that has not yet been returned; otherwise, get it from OCI
+    if (stmt->implicitResultsCollected) {
+        handle = NULL;
+        if (stmt->implicitResultIndex < stmt->numImplicitResults)
+            handle = stmt->implicitResults[stmt->implicitResultIndex++];
+    } else if (dpiOci__stmtGetNextResult(stmt, &handle, &error) < 0) {
         return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    }
     *implicitResult = NULL;
-    if (handle) {
-        if (dpiStmt__allocate(stmt->conn, 0, &tempStmt, &error) < 0)
-            return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
-        tempStmt->handle = handle;
-        dpiGen__setRefCount(stmt, &error, 1);
-        tempStmt->parentStmt = stmt;
-        if (dpiStmt__createQueryVars(tempStmt, &error) < 0) {
-            dpiStmt__free(tempStmt, &error);
+    if (handle && dpiStmt__createImplicitResult(stmt, handle, implicitResult,
+            &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    return dpiGen__endPublicFn(stmt, DPI_SUCCESS, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmt_getImplicitResultCount() [PUBLIC]
+//   Return the number of implicit results from the previously executed
+// statement that have not yet been returned. All of the remaining implicit
+// results are collected from OCI in order to determine this.
+//-----------------------------------------------------------------------------
+int dpiStmt_getImplicitResultCount(dpiStmt *stmt, uint32_t *count)
+{
+    dpiError error;
+
+    if (dpiStmt__check(stmt, __func__, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(stmt, count)
+    if (dpiUtils__checkClientVersion(stmt->env->versionInfo, 12, 1,
+            &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    if (dpiStmt__collectImplicitResults(stmt, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    *count = stmt->numImplicitResults - stmt->implicitResultIndex;
+    return dpiGen__endPublicFn(stmt, DPI_SUCCESS, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmt_getImplicitResults() [PUBLIC]
+//   Return all of the implicit results from the previously executed statement
+// that have not yet been returned. Each implicit result has its columns
+// described and has its own fetch buffers so they can be fetched in any
+// order. The array must be large enough to hold all of them.
+//-----------------------------------------------------------------------------
+int dpiStmt_getImplicitResults(dpiStmt *stmt, uint32_t numResults,
+        dpiStmt **results)
+{
+    uint32_t i, numRemaining;
+    dpiError error;
+
+    if (dpiStmt__check(stmt, __func__, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(stmt, results)
+    if (dpiUtils__checkClientVersion(stmt->env->versionInfo, 12, 1,
+            &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    if (dpiStmt__collectImplicitResults(stmt, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    numRemaining = stmt->numImplicitResults - stmt->implicitResultIndex;
+    if (numResults < numRemaining) {
+        dpiError__set(&error, "check num results",
+                DPI_ERR_ARRAY_SIZE_TOO_SMALL, numResults);
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    }
+    for (i = 0; i < numRemaining; i++) {
+        if (dpiStmt__createImplicitResult(stmt,
+                stmt->implicitResults[stmt->implicitResultIndex + i],
+                &results[i], &error) < 0) {
+            while (i > 0)
+                dpiGen__setRefCount(results[--i], &error, -1);
             return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
         }
-        *implicitResult = tempStmt;
     }
+    stmt->implicitResultIndex = stmt->numImplicitResults;
     return dpiGen__endPublicFn(stmt, DPI_SUCCESS, &error);
 }
 
@@ -1825,7 +3129,7 @@ int dpiStmt_getRowCount(dpiStmt *stmt, uint64_t *count)
 //-----------------------------------------------------------------------------
 // dpiStmt_getRowCounts() [PUBLIC]
 //   Return the number of rows affected by each of the iterations executed
-// using dpiStmt_executeMany().
+// using dpiStmt_executeMany() or dpiStmt_executeManyAdaptive().
 //-----------------------------------------------------------------------------
 int dpiStmt_getRowCounts(dpiStmt *stmt, uint32_t *numRowCounts,
         uint64_t **rowCounts)
@@ -1840,6 +3144,11 @@ int dpiStmt_getRowCounts(dpiStmt *stmt, uint32_t *numRowCounts,
     if (dpiUtils__checkClientVersion(stmt->env->versionInfo, 12, 1,
             &error) < 0)
         return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    if (stmt->hasTotalRowCount && stmt->totalRowCounts) {
+        *numRowCounts = stmt->numTotalRowCounts;
+        *rowCounts = stmt->totalRowCounts;
+        return dpiGen__endPublicFn(stmt, DPI_SUCCESS, &error);
+    }
     status = dpiOci__attrGet(stmt->handle, DPI_OCI_HTYPE_STMT, rowCounts,
             numRowCounts, DPI_OCI_ATTR_DML_ROW_COUNT_ARRAY, "get row counts",
             &error);
@@ -1865,6 +3174,72 @@ int dpiStmt_getSubscrQueryId(dpiStmt *stmt, uint64_t *queryId)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiStmt_materialize() [PUBLIC]
+//   Fetch all of the remaining rows of the query into a result set which does
+// not depend on the statement or its connection. Rows are copied from the
+// fetch buffers after each fetch, so the memory required by the statement
+// itself does not grow.
+//-----------------------------------------------------------------------------
+int dpiStmt_materialize(dpiStmt *stmt, uint64_t maxMemory,
+        dpiResultSet **resultSet)
+{
+    dpiResultSet *tempResultSet;
+    uint32_t numRows;
+    dpiError error;
+
+    if (dpiStmt__check(stmt, __func__, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(stmt, resultSet)
+    if (!stmt->queryVars) {
+        dpiError__set(&error, "check query vars",
+                DPI_ERR_QUERY_NOT_EXECUTED);
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    }
+    if (stmt->structDefine) {
+        dpiError__set(&error, "check struct", DPI_ERR_NOT_SUPPORTED);
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    }
+
+    // perform the first fetch, if needed, so that the query variables exist
+    // before the result set is allocated
+    if (stmt->bufferRowIndex >= stmt->bufferRowCount && stmt->hasRowsToFetch &&
+            dpiStmt__fetch(stmt, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    if (dpiResultSet__allocate(stmt, maxMemory, &tempResultSet, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+
+    // copy the rows in the buffers after each fetch
+    while (1) {
+        if (stmt->bufferRowIndex >= stmt->bufferRowCount) {
+            if (!stmt->hasRowsToFetch)
+                break;
+            if (dpiStmt__fetch(stmt, &error) < 0) {
+                dpiResultSet__free(tempResultSet, &error);
+                return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+            }
+            if (stmt->bufferRowIndex >= stmt->bufferRowCount)
+                break;
+        }
+        numRows = stmt->bufferRowCount - stmt->bufferRowIndex;
+        if (dpiResultSet__addRows(tempResultSet, stmt->queryVars,
+                stmt->bufferRowIndex, numRows, &error) < 0) {
+            dpiResultSet__free(tempResultSet, &error);
+            return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+        }
+        stmt->bufferRowIndex += numRows;
+        stmt->rowCount += numRows;
+    }
+    if (dpiResultSet__complete(tempResultSet, &error) < 0) {
+        dpiResultSet__free(tempResultSet, &error);
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    }
+
+    *resultSet = tempResultSet;
+    return dpiGen__endPublicFn(stmt, DPI_SUCCESS, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiStmt_release() [PUBLIC]
 //   Release a reference to the statement.
@@ -1885,6 +3260,7 @@ int dpiStmt_scroll(dpiStmt *stmt, dpiFetchMode mode, int32_t offset,
     uint32_t numRows, currentPosition;
     uint64_t desiredRow = 0;
     dpiError error;
+    int found;
 
     // make sure the cursor is open
     if (dpiStmt__check(stmt, __func__, &error) < 0)
@@ -1932,6 +3308,33 @@ int dpiStmt_scroll(dpiStmt *stmt, dpiFetchMode mode, int32_t offset,
         return dpiGen__endPublicFn(stmt, DPI_SUCCESS, &error);
     }
 
+    // if a scroll cache is in use, check to see if the row is found in one of
+    // the cached blocks; if not, the fetch is performed using an absolute
+    // position since the cursor position may not match the buffers; when
+    // moving backwards and read ahead is enabled, the block fetched is the one
+    // that ends with the desired row instead of the one that starts with it
+    if (stmt->scrollCache && mode != DPI_MODE_FETCH_LAST) {
+        dpiScrollCache__lookup(stmt->scrollCache, stmt, desiredRow, &found);
+        if (found) {
+            stmt->bufferRowIndex =
+                    (uint32_t) (desiredRow - stmt->bufferMinRow);
+            stmt->rowCount = desiredRow - 1;
+            if (dpiStmt__postFetch(stmt, &error) < 0)
+                return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+            return dpiGen__endPublicFn(stmt, DPI_SUCCESS, &error);
+        }
+        if (mode != DPI_MODE_FETCH_FIRST) {
+            offset = (int32_t) desiredRow;
+            if (stmt->scrollCache->readAhead &&
+                    desiredRow < stmt->rowCount + rowCountOffset) {
+                if (desiredRow > stmt->fetchArraySize)
+                    offset = (int32_t) (desiredRow - stmt->fetchArraySize + 1);
+                else offset = 1;
+            }
+            mode = DPI_MODE_FETCH_ABSOLUTE;
+        }
+    }
+
     // perform any pre-fetch activities required
     if (dpiStmt__beforeFetch(stmt, &error) < 0)
         return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
@@ -1961,15 +3364,37 @@ int dpiStmt_scroll(dpiStmt *stmt, dpiFetchMode mode, int32_t offset,
         return dpiGen__endPublicFn(stmt, DPI_SUCCESS, &error);
     }
 
-    // determine the current position of the cursor
-    if (dpiOci__attrGet(stmt->handle, DPI_OCI_HTYPE_STMT, &currentPosition, 0,
-            DPI_OCI_ATTR_CURRENT_POSITION, "get current pos", &error) < 0)
-        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    // when a scroll cache is in use, the position of the first row fetched is
+    // already known (except for the last row); the buffers are positioned at
+    // the desired row which need not be the first row when reading backwards
+    if (stmt->scrollCache && mode != DPI_MODE_FETCH_LAST) {
+        stmt->bufferMinRow = (mode == DPI_MODE_FETCH_FIRST) ? 1 :
+                (uint64_t) offset;
+        if (desiredRow >= stmt->bufferMinRow + stmt->bufferRowCount) {
+            stmt->bufferRowCount = 0;
+            dpiError__set(&error, "check result set bounds",
+                    DPI_ERR_SCROLL_OUT_OF_RS);
+            return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+        }
+        stmt->bufferRowIndex = (uint32_t) (desiredRow - stmt->bufferMinRow);
+        stmt->rowCount = desiredRow - 1;
 
-    // reset buffer row index and row count
-    stmt->rowCount = currentPosition - stmt->bufferRowCount;
-    stmt->bufferMinRow = stmt->rowCount + 1;
-    stmt->bufferRowIndex = 0;
+    // otherwise, determine the current position of the cursor and reset the
+    // buffer row index and row count
+    } else {
+        if (dpiOci__attrGet(stmt->handle, DPI_OCI_HTYPE_STMT,
+                &currentPosition, 0, DPI_OCI_ATTR_CURRENT_POSITION,
+                "get current pos", &error) < 0)
+            return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+        stmt->rowCount = currentPosition - stmt->bufferRowCount;
+        stmt->bufferMinRow = stmt->rowCount + 1;
+        stmt->bufferRowIndex = 0;
+    }
+
+    // retain a copy of the rows in the scroll cache, if applicable
+    if (stmt->scrollCache && dpiScrollCache__store(stmt->scrollCache, stmt,
+            &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
 
     // perform post-fetch activities required
     if (dpiStmt__postFetch(stmt, &error) < 0)
@@ -2004,6 +3429,8 @@ int dpiStmt_setFetchArraySize(dpiStmt *stmt, uint32_t arraySize)
         }
     }
     stmt->fetchArraySize = arraySize;
+    if (stmt->scrollCache)
+        dpiScrollCache__clear(stmt->scrollCache);
     return dpiGen__endPublicFn(stmt, DPI_SUCCESS, &error);
 }
 
@@ -2044,6 +3471,33 @@ int dpiStmt_setPrefetchRows(dpiStmt *stmt, uint32_t numRows)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiStmt_setScrollCache() [PUBLIC]
+//   Set the number of blocks of fetched rows that are retained by a scrollable
+// statement, and whether rows are read ahead in the direction of travel. A
+// value of zero for the number of blocks disables the cache.
+//-----------------------------------------------------------------------------
+int dpiStmt_setScrollCache(dpiStmt *stmt, uint32_t numBlocks, int readAhead)
+{
+    dpiScrollCache *cache = NULL;
+    dpiError error;
+
+    if (dpiStmt__check(stmt, __func__, &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    if (!stmt->scrollable) {
+        dpiError__set(&error, "check scrollable", DPI_ERR_NOT_SUPPORTED);
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    }
+    if (numBlocks > 0 && dpiScrollCache__create(&cache, numBlocks, readAhead,
+            &error) < 0)
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    if (stmt->scrollCache)
+        dpiScrollCache__free(stmt->scrollCache);
+    stmt->scrollCache = cache;
+    return dpiGen__endPublicFn(stmt, DPI_SUCCESS, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiStmt_deleteFromCache() [PUBLIC]
 //   Excludes the associated SQL statement from the statement cache. If the SQL
@@ -0,0 +1,523 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// dpiStmtBatch.c
+//   Implementation of batches of statements. The statements in a batch are
+// combined into a single anonymous PL/SQL block which is executed with one
+// round trip. The placeholders of each statement are renamed so that the
+// variables bound to the original statements can be bound to the block; the
+// row counts of DML statements are returned in additional variables and
+// queries are opened as REF CURSORs.
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+
+
+//-----------------------------------------------------------------------------
+// dpiStmtBatch__append() [INTERNAL]
+//   Append the value to the PL/SQL block being built. If the block is NULL,
+// only the length is calculated.
+//-----------------------------------------------------------------------------
+static void dpiStmtBatch__append(dpiStmtBatch *batch, const char *value,
+        uint32_t valueLength)
+{
+    if (batch->sql)
+        memcpy(batch->sql + batch->sqlLength, value, valueLength);
+    batch->sqlLength += valueLength;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmtBatch__appendName() [INTERNAL]
+//   Append a placeholder name made up of the prefix and number to the PL/SQL
+// block being built.
+//-----------------------------------------------------------------------------
+static void dpiStmtBatch__appendName(dpiStmtBatch *batch, const char *prefix,
+        uint32_t num)
+{
+    char buffer[20];
+    int length;
+
+    length = sprintf(buffer, "%s%u", prefix, num);
+    dpiStmtBatch__append(batch, buffer, (uint32_t) length);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmtBatch__namesMatch() [INTERNAL]
+//   Return whether the two placeholder names refer to the same placeholder.
+// A leading colon is ignored. Names are compared without regard to case
+// unless either of them is quoted.
+//-----------------------------------------------------------------------------
+static int dpiStmtBatch__namesMatch(const char *name1, uint32_t name1Length,
+        const char *name2, uint32_t name2Length)
+{
+    int isQuoted = 0;
+    uint32_t i;
+
+    if (name1Length > 0 && name1[0] == ':') {
+        name1++;
+        name1Length--;
+    }
+    if (name1Length > 1 && name1[0] == '"' && name1[name1Length - 1] == '"') {
+        name1++;
+        name1Length -= 2;
+        isQuoted = 1;
+    }
+    if (name2Length > 1 && name2[0] == '"' && name2[name2Length - 1] == '"') {
+        name2++;
+        name2Length -= 2;
+        isQuoted = 1;
+    }
+    if (name1Length != name2Length)
+        return 0;
+    for (i = 0; i < name1Length; i++) {
+        if (isQuoted && name1[i] != name2[i])
+            return 0;
+        if (!isQuoted && toupper((unsigned char) name1[i]) !=
+                toupper((unsigned char) name2[i]))
+            return 0;
+    }
+    return 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmtBatch__copyVar() [INTERNAL]
+//   Create a copy of the variable at the specified index. Binding a variable
+// that uses dynamic bytes to a PL/SQL block converts it to use LOBs, so a copy
+// is bound in its place in order to leave the caller's variable unchanged.
+// Values cannot be streamed in that case.
+//-----------------------------------------------------------------------------
+static int dpiStmtBatch__copyVar(dpiStmtBatch *batch, uint32_t varIndex,
+        dpiConn *conn, dpiError *error)
+{
+    dpiVar *var = batch->vars[varIndex], *copy;
+    dpiData *data;
+    uint32_t i;
+
+    if (var->stream)
+        return dpiError__set(error, "check stream",
+                DPI_ERR_STREAM_NOT_SUPPORTED, DPI_MAX_BASIC_BUFFER_SIZE);
+    if (dpiVar__allocate(conn, var->type->oracleTypeNum, var->nativeTypeNum,
+            var->buffer.maxArraySize, DPI_MAX_BASIC_BUFFER_SIZE + 1, 1,
+            var->isArray, NULL, &batch->varCopies[varIndex], &data,
+            error) < 0)
+        return DPI_FAILURE;
+    copy = batch->varCopies[varIndex];
+    copy->buffer.actualArraySize = var->buffer.actualArraySize;
+    for (i = 0; i < var->buffer.maxArraySize; i++) {
+        if (dpiVar__copyData(copy, i, &var->buffer.externalData[i],
+                error) < 0)
+            return DPI_FAILURE;
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmtBatch__copyVarsBack() [INTERNAL]
+//   Copy the values of the copies bound in place of dynamic variables back to
+// the caller's variables after the PL/SQL block has been executed, since any
+// of them may have been used for OUT binds.
+//-----------------------------------------------------------------------------
+static int dpiStmtBatch__copyVarsBack(dpiStmtBatch *batch, dpiError *error)
+{
+    dpiVar *var, *copy;
+    uint32_t i, j;
+
+    for (i = 0; i < batch->numVars; i++) {
+        copy = batch->varCopies[i];
+        if (!copy)
+            continue;
+        var = batch->vars[i];
+        var->buffer.actualArraySize = copy->buffer.actualArraySize;
+        for (j = 0; j < var->buffer.maxArraySize; j++) {
+            if (dpiVar__copyData(var, j, &copy->buffer.externalData[j],
+                    error) < 0)
+                return DPI_FAILURE;
+        }
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmtBatch__findVar() [INTERNAL]
+//   Return the variable bound to the statement for the placeholder, or NULL
+// if no variable has been bound to it.
+//-----------------------------------------------------------------------------
+static dpiVar *dpiStmtBatch__findVar(dpiStmt *stmt,
+        dpiStmtBatchPlaceholder *placeholder)
+{
+    dpiBindVar *bindVar;
+    uint32_t i;
+
+    for (i = 0; i < stmt->numBindVars; i++) {
+        bindVar = &stmt->bindVars[i];
+        if (bindVar->nameLength > 0) {
+            if (dpiStmtBatch__namesMatch(bindVar->name, bindVar->nameLength,
+                    placeholder->name, placeholder->nameLength))
+                return bindVar->var;
+        } else if (bindVar->pos == placeholder->pos) {
+            return bindVar->var;
+        }
+    }
+    return NULL;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmtBatch__findPlaceholders() [INTERNAL]
+//   Find the placeholders in the statement at the specified index and the
+// variables bound to each of them. As with OCI, the bind position of a
+// placeholder in SQL is the position of its occurrence in the statement; in
+// PL/SQL, each distinct name has a single bind position.
+//-----------------------------------------------------------------------------
+static int dpiStmtBatch__findPlaceholders(dpiStmtBatch *batch,
+        uint32_t stmtIndex, dpiError *error)
+{
+    dpiStmtBatchPlaceholder *placeholder, *otherPlaceholder;
+    uint32_t i, firstIndex, numPositions = 0;
+    dpiStmt *stmt = batch->stmts[stmtIndex];
+    dpiSqlLexer lexer;
+    int isPlsql;
+
+    isPlsql = (stmt->statementType == DPI_STMT_TYPE_BEGIN ||
+            stmt->statementType == DPI_STMT_TYPE_DECLARE);
+    firstIndex = batch->numPlaceholders;
+    dpiSqlLexer__init(&lexer, batch->sqls[stmtIndex],
+            batch->sqlLengths[stmtIndex]);
+    while (dpiSqlLexer__next(&lexer)) {
+        if (lexer.tokenType != DPI_SQL_TOKEN_BIND)
+            continue;
+
+        // determine the name and bind position of the placeholder
+        placeholder = &batch->placeholders[batch->numPlaceholders++];
+        placeholder->name = lexer.sql + lexer.tokenPos + 1;
+        placeholder->nameLength = lexer.tokenLength - 1;
+        placeholder->pos = 0;
+        if (isPlsql) {
+            for (i = firstIndex; i < batch->numPlaceholders - 1; i++) {
+                otherPlaceholder = &batch->placeholders[i];
+                if (dpiStmtBatch__namesMatch(otherPlaceholder->name,
+                        otherPlaceholder->nameLength, placeholder->name,
+                        placeholder->nameLength)) {
+                    placeholder->pos = otherPlaceholder->pos;
+                    break;
+                }
+            }
+        }
+        if (placeholder->pos == 0)
+            placeholder->pos = ++numPositions;
+
+        // determine the variable bound to the placeholder
+        placeholder->var = dpiStmtBatch__findVar(stmt, placeholder);
+        if (!placeholder->var)
+            return dpiError__set(error, "find bind variable",
+                    DPI_ERR_BATCH_BIND_MISSING, placeholder->nameLength,
+                    placeholder->name, stmtIndex);
+
+        // add the variable to the list of distinct variables, if needed
+        for (i = 0; i < batch->numVars; i++) {
+            if (batch->vars[i] == placeholder->var)
+                break;
+        }
+        if (i == batch->numVars)
+            batch->vars[batch->numVars++] = placeholder->var;
+
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmtBatch__buildSql() [INTERNAL]
+//   Build the text of the PL/SQL block that executes all of the statements in
+// the batch. If the block is NULL, only the length is calculated. The text of
+// each statement is placed on its own lines so that a trailing single line
+// comment cannot affect the code that follows it.
+//-----------------------------------------------------------------------------
+static void dpiStmtBatch__buildSql(dpiStmtBatch *batch)
+{
+    uint32_t i, j, placeholderIndex = 0;
+    dpiStmtBatchPlaceholder *placeholder;
+    dpiSqlLexer lexer;
+    dpiStmt *stmt;
+
+    batch->sqlLength = 0;
+    dpiStmtBatch__append(batch, "begin\n", 6);
+    for (i = 0; i < batch->numStmts; i++) {
+        stmt = batch->stmts[i];
+        if (stmt->statementType == DPI_STMT_TYPE_SELECT) {
+            dpiStmtBatch__appendName(batch, "open :C", i + 1);
+            dpiStmtBatch__append(batch, " for\n", 5);
+        }
+        dpiSqlLexer__init(&lexer, batch->sqls[i], batch->sqlLengths[i]);
+        while (dpiSqlLexer__next(&lexer)) {
+            if (lexer.tokenType != DPI_SQL_TOKEN_BIND) {
+                dpiStmtBatch__append(batch, lexer.sql + lexer.tokenPos,
+                        lexer.tokenLength);
+                continue;
+            }
+            placeholder = &batch->placeholders[placeholderIndex++];
+            for (j = 0; j < batch->numVars; j++) {
+                if (batch->vars[j] == placeholder->var)
+                    break;
+            }
+            dpiStmtBatch__appendName(batch, ":B", j + 1);
+        }
+        dpiStmtBatch__append(batch, "\n", 1);
+        if (stmt->statementType == DPI_STMT_TYPE_BEGIN ||
+                stmt->statementType == DPI_STMT_TYPE_DECLARE)
+            continue;
+        dpiStmtBatch__append(batch, ";\n", 2);
+        if (stmt->statementType != DPI_STMT_TYPE_SELECT) {
+            dpiStmtBatch__appendName(batch, ":R", i + 1);
+            dpiStmtBatch__append(batch, " := sql%rowcount;\n", 18);
+        }
+    }
+    dpiStmtBatch__append(batch, "end;", 4);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmtBatch__free() [INTERNAL]
+//   Free the resources held by the batch. The statement for the PL/SQL block
+// is freed first since it holds references to the variables.
+//-----------------------------------------------------------------------------
+static void dpiStmtBatch__free(dpiStmtBatch *batch, dpiError *error)
+{
+    uint32_t i;
+
+    if (batch->stmt) {
+        dpiStmt__free(batch->stmt, error);
+        batch->stmt = NULL;
+    }
+    if (batch->resultVars) {
+        for (i = 0; i < batch->numStmts; i++) {
+            if (batch->resultVars[i])
+                dpiGen__setRefCount(batch->resultVars[i], error, -1);
+        }
+        dpiUtils__freeMemory(batch->resultVars);
+        batch->resultVars = NULL;
+    }
+    if (batch->resultData) {
+        dpiUtils__freeMemory(batch->resultData);
+        batch->resultData = NULL;
+    }
+    if (batch->sql) {
+        dpiUtils__freeMemory(batch->sql);
+        batch->sql = NULL;
+    }
+    if (batch->varCopies) {
+        for (i = 0; i < batch->numVars; i++) {
+            if (batch->varCopies[i])
+                dpiGen__setRefCount(batch->varCopies[i], error, -1);
+        }
+        dpiUtils__freeMemory(batch->varCopies);
+        batch->varCopies = NULL;
+    }
+    if (batch->vars) {
+        dpiUtils__freeMemory(batch->vars);
+        batch->vars = NULL;
+    }
+    if (batch->placeholders) {
+        dpiUtils__freeMemory(batch->placeholders);
+        batch->placeholders = NULL;
+    }
+    if (batch->sqlLengths) {
+        dpiUtils__freeMemory(batch->sqlLengths);
+        batch->sqlLengths = NULL;
+    }
+    if (batch->sqls) {
+        dpiUtils__freeMemory((void*) batch->sqls);
+        batch->sqls = NULL;
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmtBatch__prepare() [INTERNAL]
+//   Build and prepare the PL/SQL block for the batch and bind the variables
+// of the original statements to it, along with the variables used to return
+// row counts and cursors.
+//-----------------------------------------------------------------------------
+static int dpiStmtBatch__prepare(dpiStmtBatch *batch, dpiConn *conn,
+        dpiError *error)
+{
+    uint32_t i, numPlaceholders = 0, nameLength;
+    dpiSqlLexer lexer;
+    char name[20];
+    dpiStmt *stmt;
+    dpiVar *var;
+
+    // acquire the SQL text of each statement and count the placeholders
+    if (dpiUtils__allocateMemory(batch->numStmts, sizeof(const char*), 1,
+            "allocate batch SQL", (void**) &batch->sqls, error) < 0)
+        return DPI_FAILURE;
+    if (dpiUtils__allocateMemory(batch->numStmts, sizeof(uint32_t), 1,
+            "allocate batch SQL lengths", (void**) &batch->sqlLengths,
+            error) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < batch->numStmts; i++) {
+        if (dpiOci__attrGet(batch->stmts[i]->handle, DPI_OCI_HTYPE_STMT,
+                (void*) &batch->sqls[i], &batch->sqlLengths[i],
+                DPI_OCI_ATTR_STATEMENT, "get statement", error) < 0)
+            return DPI_FAILURE;
+        dpiSqlLexer__init(&lexer, batch->sqls[i], batch->sqlLengths[i]);
+        while (dpiSqlLexer__next(&lexer)) {
+            if (lexer.tokenType == DPI_SQL_TOKEN_BIND)
+                numPlaceholders++;
+        }
+    }
+
+    // find the variables bound to each placeholder
+    if (numPlaceholders > 0) {
+        if (dpiUtils__allocateMemory(numPlaceholders,
+                sizeof(dpiStmtBatchPlaceholder), 1,
+                "allocate batch placeholders", (void**) &batch->placeholders,
+                error) < 0)
+            return DPI_FAILURE;
+        if (dpiUtils__allocateMemory(numPlaceholders, sizeof(dpiVar*), 1,
+                "allocate batch variables", (void**) &batch->vars, error) < 0)
+            return DPI_FAILURE;
+        for (i = 0; i < batch->numStmts; i++) {
+            if (dpiStmtBatch__findPlaceholders(batch, i, error) < 0)
+                return DPI_FAILURE;
+        }
+    }
+
+    // build the PL/SQL block and prepare it
+    dpiStmtBatch__buildSql(batch);
+    if (dpiUtils__allocateMemory(1, batch->sqlLength, 0,
+            "allocate batch PL/SQL block", (void**) &batch->sql, error) < 0)
+        return DPI_FAILURE;
+    dpiStmtBatch__buildSql(batch);
+    if (dpiStmt__allocate(conn, 0, 0, &batch->stmt, error) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt__prepare(batch->stmt, batch->sql, batch->sqlLength, NULL, 0,
+            error) < 0)
+        return DPI_FAILURE;
+
+    // bind the variables of the original statements; variables using dynamic
+    // bytes are copied first
+    if (batch->numVars > 0 && dpiUtils__allocateMemory(batch->numVars,
+            sizeof(dpiVar*), 1, "allocate batch variable copies",
+            (void**) &batch->varCopies, error) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < batch->numVars; i++) {
+        var = batch->vars[i];
+        if (var->isDynamic) {
+            if (dpiStmtBatch__copyVar(batch, i, conn, error) < 0)
+                return DPI_FAILURE;
+            var = batch->varCopies[i];
+        }
+        nameLength = (uint32_t) sprintf(name, "B%u", i + 1);
+        if (dpiStmt__bind(batch->stmt, var, 0, name, nameLength, error) < 0)
+            return DPI_FAILURE;
+    }
+
+    // create and bind the variables for row counts and cursors
+    if (dpiUtils__allocateMemory(batch->numStmts, sizeof(dpiVar*), 1,
+            "allocate batch result variables", (void**) &batch->resultVars,
+            error) < 0)
+        return DPI_FAILURE;
+    if (dpiUtils__allocateMemory(batch->numStmts, sizeof(dpiData*), 1,
+            "allocate batch result data", (void**) &batch->resultData,
+            error) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < batch->numStmts; i++) {
+        stmt = batch->stmts[i];
+        if (stmt->statementType == DPI_STMT_TYPE_SELECT) {
+            if (dpiVar__allocate(conn, DPI_ORACLE_TYPE_STMT,
+                    DPI_NATIVE_TYPE_STMT, 1, 0, 0, 0, NULL,
+                    &batch->resultVars[i], &batch->resultData[i], error) < 0)
+                return DPI_FAILURE;
+            nameLength = (uint32_t) sprintf(name, "C%u", i + 1);
+        } else if (stmt->statementType != DPI_STMT_TYPE_BEGIN &&
+                stmt->statementType != DPI_STMT_TYPE_DECLARE) {
+            if (dpiVar__allocate(conn, DPI_ORACLE_TYPE_NUMBER,
+                    DPI_NATIVE_TYPE_UINT64, 1, 0, 0, 0, NULL,
+                    &batch->resultVars[i], &batch->resultData[i], error) < 0)
+                return DPI_FAILURE;
+            nameLength = (uint32_t) sprintf(name, "R%u", i + 1);
+        } else {
+            continue;
+        }
+        if (dpiStmt__bind(batch->stmt, batch->resultVars[i], 0, name,
+                nameLength, error) < 0)
+            return DPI_FAILURE;
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStmtBatch__execute() [INTERNAL]
+//   Execute the statements as a single anonymous PL/SQL block. The statements
+// are expected to have been validated already. The row count of each DML
+// statement is returned in the rowCounts array (if not NULL) and a REF CURSOR
+// for each query is returned in the queryResults array (if not NULL); the
+// caller is responsible for releasing the cursors.
+//-----------------------------------------------------------------------------
+int dpiStmtBatch__execute(dpiConn *conn, uint32_t numStmts, dpiStmt **stmts,
+        uint32_t mode, uint64_t *rowCounts, dpiStmt **queryResults,
+        dpiError *error)
+{
+    dpiStmtBatch batch;
+    dpiStmt *cursor;
+    uint32_t i;
+
+    memset(&batch, 0, sizeof(batch));
+    batch.numStmts = numStmts;
+    batch.stmts = stmts;
+    if (dpiStmtBatch__prepare(&batch, conn, error) < 0 ||
+            dpiStmt__execute(batch.stmt, 1, mode, 0, error) < 0 ||
+            dpiStmtBatch__copyVarsBack(&batch, error) < 0) {
+        dpiStmtBatch__free(&batch, error);
+        return DPI_FAILURE;
+    }
+    for (i = 0; i < numStmts; i++) {
+        if (rowCounts)
+            rowCounts[i] = 0;
+        if (queryResults)
+            queryResults[i] = NULL;
+        if (!batch.resultVars[i])
+            continue;
+        if (stmts[i]->statementType != DPI_STMT_TYPE_SELECT) {
+            if (rowCounts)
+                rowCounts[i] = batch.resultData[i]->value.asUint64;
+        } else if (queryResults) {
+            cursor = batch.resultData[i]->value.asStmt;
+            dpiGen__setRefCount(cursor, error, 1);
+            queryResults[i] = cursor;
+        }
+    }
+    dpiStmtBatch__free(&batch, error);
+    return DPI_SUCCESS;
+}
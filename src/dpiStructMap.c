@@ -0,0 +1,306 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// dpiStructMap.c
+//   Implementation of caller-owned arrays of structs that are bound to or
+// defined for a statement. Fields of fixed width types are transferred by OCI
+// directly into or out of the structs using array of struct skip values;
+// timestamps are transferred through an intermediate buffer of OCI dates which
+// is converted after each fetch or before each execution.
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+
+
+//-----------------------------------------------------------------------------
+// dpiStructMap__checkOffset() [INTERNAL]
+//   Check that a member of the given size at the given offset fits within the
+// struct.
+//-----------------------------------------------------------------------------
+static int dpiStructMap__checkOffset(const dpiStructLayout *layout,
+        uint32_t fieldNum, uint64_t offset, uint32_t size, dpiError *error)
+{
+    if (offset + size > layout->structSize)
+        return dpiError__set(error, "check struct field",
+                DPI_ERR_STRUCT_FIELD_OUT_OF_BOUNDS, fieldNum,
+                layout->structSize);
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStructMap__initField() [INTERNAL]
+//   Initialize the information for one field of the struct from the layout
+// supplied by the caller, allocating an intermediate buffer if needed.
+//-----------------------------------------------------------------------------
+static int dpiStructMap__initField(dpiStructMap *map,
+        const dpiStructLayout *layout, uint32_t fieldNum, char *rows,
+        dpiError *error)
+{
+    const dpiStructField *info = &layout->fields[fieldNum];
+    dpiStructMapField *field = &map->fields[fieldNum];
+    uint32_t valueSize;
+
+    // determine the OCI type to use and the size of the value in the struct
+    field->pos = info->pos;
+    field->nativeTypeNum = info->nativeTypeNum;
+    switch (info->nativeTypeNum) {
+        case DPI_NATIVE_TYPE_INT64:
+            field->oracleType = DPI_SQLT_INT;
+            valueSize = sizeof(int64_t);
+            break;
+        case DPI_NATIVE_TYPE_UINT64:
+            field->oracleType = DPI_SQLT_UIN;
+            valueSize = sizeof(uint64_t);
+            break;
+        case DPI_NATIVE_TYPE_FLOAT:
+            field->oracleType = DPI_SQLT_BFLOAT;
+            valueSize = sizeof(float);
+            break;
+        case DPI_NATIVE_TYPE_DOUBLE:
+            field->oracleType = DPI_SQLT_BDOUBLE;
+            valueSize = sizeof(double);
+            break;
+        case DPI_NATIVE_TYPE_BYTES:
+            if (info->lengthOffset < 0)
+                return dpiError__set(error, "check struct field",
+                        DPI_ERR_STRUCT_FIELD_NO_LENGTH, fieldNum);
+            field->oracleType = DPI_SQLT_CHR;
+            valueSize = info->valueSize;
+            break;
+        case DPI_NATIVE_TYPE_TIMESTAMP:
+            field->oracleType = DPI_SQLT_ODT;
+            valueSize = sizeof(dpiTimestamp);
+            break;
+        default:
+            return dpiError__set(error, "check struct field",
+                    DPI_ERR_STRUCT_FIELD_TYPE_NOT_SUPPORTED,
+                    info->nativeTypeNum, fieldNum);
+    }
+
+    // verify that all of the members of the field fit within the struct
+    if (dpiStructMap__checkOffset(layout, fieldNum, info->valueOffset,
+            valueSize, error) < 0)
+        return DPI_FAILURE;
+    if (info->indicatorOffset >= 0) {
+        if (dpiStructMap__checkOffset(layout, fieldNum,
+                (uint64_t) info->indicatorOffset, sizeof(int16_t), error) < 0)
+            return DPI_FAILURE;
+        field->indicator = (int16_t*) (rows + info->indicatorOffset);
+    }
+    if (info->lengthOffset >= 0) {
+        if (dpiStructMap__checkOffset(layout, fieldNum,
+                (uint64_t) info->lengthOffset, sizeof(uint32_t), error) < 0)
+            return DPI_FAILURE;
+        field->length = (uint32_t*) (rows + info->lengthOffset);
+    }
+
+    // timestamps are transferred through an intermediate buffer; all other
+    // types are transferred directly
+    if (info->nativeTypeNum == DPI_NATIVE_TYPE_TIMESTAMP) {
+        field->structValue = rows + info->valueOffset;
+        field->valueSize = sizeof(dpiOciDate);
+        field->valueSkip = sizeof(dpiOciDate);
+        return dpiUtils__allocateMemory(map->numRows, sizeof(dpiOciDate), 1,
+                "allocate struct field buffer", (void**) &field->value,
+                error);
+    }
+    field->value = rows + info->valueOffset;
+    field->valueSize = valueSize;
+    field->valueSkip = map->structSize;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStructMap__bind() [INTERNAL]
+//   Bind each of the fields of the struct to the statement.
+//-----------------------------------------------------------------------------
+int dpiStructMap__bind(dpiStructMap *map, dpiStmt *stmt, dpiError *error)
+{
+    dpiStructMapField *field;
+    uint32_t i;
+
+    for (i = 0; i < map->numFields; i++) {
+        field = &map->fields[i];
+        if (dpiOci__bindStructField(stmt, field, error) < 0)
+            return DPI_FAILURE;
+        if (dpiOci__bindArrayOfStruct(stmt, field, map->structSize,
+                error) < 0)
+            return DPI_FAILURE;
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStructMap__create() [INTERNAL]
+//   Create a new struct map from the layout supplied by the caller. The
+// layout is validated but the positions are not; that is left to the caller.
+//-----------------------------------------------------------------------------
+int dpiStructMap__create(const dpiStructLayout *layout, void *rows,
+        uint32_t numRows, dpiStructMap **map, dpiError *error)
+{
+    dpiStructMap *tempMap;
+    uint32_t i;
+
+    if (dpiUtils__allocateMemory(1, sizeof(dpiStructMap), 1,
+            "allocate struct map", (void**) &tempMap, error) < 0)
+        return DPI_FAILURE;
+    tempMap->structSize = layout->structSize;
+    tempMap->numRows = numRows;
+    if (dpiUtils__allocateMemory(layout->numFields,
+            sizeof(dpiStructMapField), 1, "allocate struct map fields",
+            (void**) &tempMap->fields, error) < 0) {
+        dpiStructMap__free(tempMap);
+        return DPI_FAILURE;
+    }
+    tempMap->numFields = layout->numFields;
+    for (i = 0; i < layout->numFields; i++) {
+        if (dpiStructMap__initField(tempMap, layout, i, (char*) rows,
+                error) < 0) {
+            dpiStructMap__free(tempMap);
+            return DPI_FAILURE;
+        }
+    }
+
+    *map = tempMap;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStructMap__define() [INTERNAL]
+//   Define each of the fields of the struct for the statement.
+//-----------------------------------------------------------------------------
+int dpiStructMap__define(dpiStructMap *map, dpiStmt *stmt, dpiError *error)
+{
+    dpiStructMapField *field;
+    uint32_t i;
+
+    for (i = 0; i < map->numFields; i++) {
+        field = &map->fields[i];
+        if (dpiOci__defineStructField(stmt, field, error) < 0)
+            return DPI_FAILURE;
+        if (dpiOci__defineArrayOfStruct(stmt, field, map->structSize,
+                error) < 0)
+            return DPI_FAILURE;
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStructMap__free() [INTERNAL]
+//   Free the memory associated with the struct map. The OCI bind and define
+// handles belong to the statement handle and are not freed here.
+//-----------------------------------------------------------------------------
+void dpiStructMap__free(dpiStructMap *map)
+{
+    uint32_t i;
+
+    if (map->fields) {
+        for (i = 0; i < map->numFields; i++) {
+            if (map->fields[i].structValue && map->fields[i].value)
+                dpiUtils__freeMemory(map->fields[i].value);
+        }
+        dpiUtils__freeMemory(map->fields);
+        map->fields = NULL;
+    }
+    dpiUtils__freeMemory(map);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStructMap__fromOracle() [INTERNAL]
+//   Transfer the values of fields that use an intermediate buffer into the
+// structs after a fetch has been performed.
+//-----------------------------------------------------------------------------
+void dpiStructMap__fromOracle(dpiStructMap *map, uint32_t numRows)
+{
+    dpiStructMapField *field;
+    dpiTimestamp *timestamp;
+    int16_t *indicator;
+    dpiOciDate *date;
+    uint32_t i, j;
+
+    for (i = 0; i < map->numFields; i++) {
+        field = &map->fields[i];
+        if (!field->structValue)
+            continue;
+        for (j = 0; j < numRows; j++) {
+            indicator = (field->indicator) ? (int16_t*)
+                    ((char*) field->indicator + j * map->structSize) : NULL;
+            if (indicator && *indicator == DPI_OCI_IND_NULL)
+                continue;
+            timestamp = (dpiTimestamp*)
+                    (field->structValue + j * map->structSize);
+            date = (dpiOciDate*) field->value + j;
+            timestamp->year = date->year;
+            timestamp->month = date->month;
+            timestamp->day = date->day;
+            timestamp->hour = date->hour;
+            timestamp->minute = date->minute;
+            timestamp->second = date->second;
+            timestamp->fsecond = 0;
+            timestamp->tzHourOffset = 0;
+            timestamp->tzMinuteOffset = 0;
+        }
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiStructMap__toOracle() [INTERNAL]
+//   Transfer the values of fields that use an intermediate buffer from the
+// structs before an execution is performed.
+//-----------------------------------------------------------------------------
+void dpiStructMap__toOracle(dpiStructMap *map, uint32_t numRows)
+{
+    dpiStructMapField *field;
+    dpiTimestamp *timestamp;
+    dpiOciDate *date;
+    uint32_t i, j;
+
+    if (numRows > map->numRows)
+        numRows = map->numRows;
+    for (i = 0; i < map->numFields; i++) {
+        field = &map->fields[i];
+        if (!field->structValue)
+            continue;
+        for (j = 0; j < numRows; j++) {
+            timestamp = (dpiTimestamp*)
+                    (field->structValue + j * map->structSize);
+            date = (dpiOciDate*) field->value + j;
+            date->year = timestamp->year;
+            date->month = timestamp->month;
+            date->day = timestamp->day;
+            date->hour = timestamp->hour;
+            date->minute = timestamp->minute;
+            date->second = timestamp->second;
+        }
+    }
+}
@@ -298,7 +298,7 @@ void dpiSubscr__free(dpiSubscr *subscr, dpiError *error)
     }
     dpiMutex__release(subscr->mutex);
     dpiMutex__destroy(subscr->mutex);
-    dpiUtils__freeMemory(subscr);
+    dpiGen__free(subscr);
 }
 
 
@@ -716,7 +716,7 @@ int dpiSubscr_prepareStmt(dpiSubscr *subscr, const char *sql,
         return dpiGen__endPublicFn(subscr, DPI_FAILURE, &error);
     DPI_CHECK_PTR_NOT_NULL(subscr, sql)
     DPI_CHECK_PTR_NOT_NULL(subscr, stmt)
-    if (dpiStmt__allocate(subscr->conn, 0, &tempStmt, &error) < 0)
+    if (dpiStmt__allocate(subscr->conn, 0, 0, &tempStmt, &error) < 0)
         return dpiGen__endPublicFn(subscr, DPI_FAILURE, &error);
     if (dpiSubscr__prepareStmt(subscr, tempStmt, sql, sqlLength,
             &error) < 0) {
@@ -188,6 +188,30 @@ int dpiUtils__getAttrStringWithDup(const char *action, const void *ociHandle,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiUtils__getTimeNs() [INTERNAL]
+//   Return the value of a monotonic clock in nanoseconds.
+//-----------------------------------------------------------------------------
+uint64_t dpiUtils__getTimeNs(void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+
+    if (frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (uint64_t) ((double) counter.QuadPart * 1e9 /
+            (double) frequency.QuadPart);
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+#endif
+}
+
+
 #ifdef _WIN32
 //-----------------------------------------------------------------------------
 // dpiUtils__getWindowsError() [INTERNAL]
@@ -601,6 +625,10 @@ int dpiUtils__getTransactionHandle(dpiConn *conn, void **transactionHandle,
 {
     void *currentTransactionHandle;
 
+    // transactions managed with transaction handles (two-phase commit and
+    // sessionless transactions) are not tracked by the client
+    conn->transactionState = DPI_TXN_STATE_UNKNOWN;
+
     // check if a transaction handle is already associated with the connection
     if (dpiOci__attrGet(conn->handle, DPI_OCI_HTYPE_SVCCTX,
             &currentTransactionHandle, NULL, DPI_OCI_ATTR_TRANS,
@@ -30,14 +30,20 @@
 #include "dpiImpl.h"
 
 // forward declarations of internal functions only used in this file
-static int dpiVar__initBuffer(dpiVar *var, dpiVarBuffer *buffer,
-        dpiError *error);
+static void dpiVar__freeDynamicBytes(dpiDynamicBytes **dynamicBytes,
+        uint32_t numElements);
+static int32_t dpiVar__inBindStream(dpiVar *var, uint32_t iter, void **bufpp,
+        uint32_t *alenp, uint8_t *piecep);
+static int dpiVar__readStreamPiece(dpiVar *var, uint32_t iter,
+        uint32_t piece);
 static int dpiVar__setBytesFromDynamicBytes(dpiBytes *bytes,
         dpiDynamicBytes *dynBytes, dpiError *error);
 static int dpiVar__setBytesFromLob(dpiBytes *bytes, dpiDynamicBytes *dynBytes,
         dpiLob *lob, dpiError *error);
 static int dpiVar__setFromBytes(dpiVar *var, uint32_t pos, const char *value,
         uint32_t valueLength, dpiError *error);
+static int dpiVar__setFromCallback(dpiVar *var, uint32_t pos,
+        dpiReadCallback callback, void *context, dpiError *error);
 static int dpiVar__setFromJson(dpiVar *var, uint32_t pos, dpiJson *json,
         dpiError *error);
 static int dpiVar__setFromLob(dpiVar *var, uint32_t pos, dpiLob *lob,
@@ -50,8 +56,11 @@ static int dpiVar__setFromStmt(dpiVar *var, uint32_t pos, dpiStmt *stmt,
         dpiError *error);
 static int dpiVar__setFromVector(dpiVar *var, uint32_t pos, dpiVector *vector,
         dpiError *error);
+static void dpiVar__updateConverters(dpiVar *var);
 static int dpiVar__validateTypes(const dpiOracleType *oracleType,
         dpiNativeTypeNum nativeTypeNum, dpiError *error);
+static int dpiVar__writeLobValues(dpiVar *var, dpiDynamicBytes *values,
+        int lobsAreEmpty, dpiError *error);
 
 
 //-----------------------------------------------------------------------------
@@ -135,6 +144,9 @@ int dpiVar__allocate(dpiConn *conn, dpiOracleTypeNum oracleTypeNum,
         return DPI_FAILURE;
     }
 
+    // resolve the converters used for transferring values
+    dpiVar__updateConverters(tempVar);
+
     *var = tempVar;
     *data = tempVar->buffer.externalData;
     return DPI_SUCCESS;
@@ -269,10 +281,6 @@ static int dpiVar__checkArraySize(dpiVar *var, uint32_t pos,
 //-----------------------------------------------------------------------------
 int dpiVar__convertToLob(dpiVar *var, dpiError *error)
 {
-    dpiDynamicBytes *dynBytes;
-    dpiLob *lob;
-    uint32_t i;
-
     // change type based on the original Oracle type
     if (var->type->oracleTypeNum == DPI_ORACLE_TYPE_RAW ||
             var->type->oracleTypeNum == DPI_ORACLE_TYPE_LONG_RAW)
@@ -289,19 +297,11 @@ int dpiVar__convertToLob(dpiVar *var, dpiError *error)
     var->isDynamic = 0;
     if (dpiVar__initBuffer(var, &var->buffer, error) < 0)
         return DPI_FAILURE;
+    dpiVar__updateConverters(var);
 
-    // copy any values already set
-    for (i = 0; i < var->buffer.maxArraySize; i++) {
-        dynBytes = &var->buffer.dynamicBytes[i];
-        lob = var->buffer.references[i].asLOB;
-        if (dynBytes->numChunks == 0)
-            continue;
-        if (dpiLob__setFromBytes(lob, dynBytes->chunks->ptr,
-                dynBytes->chunks->length, error) < 0)
-            return DPI_FAILURE;
-    }
-
-    return DPI_SUCCESS;
+    // copy any values already set; the temporary LOBs were just created so
+    // they are known to be empty
+    return dpiVar__writeLobValues(var, var->buffer.dynamicBytes, 1, error);
 }
 
 
@@ -315,6 +315,12 @@ int dpiVar__copyData(dpiVar *var, uint32_t pos, dpiData *sourceData,
 {
     dpiData *targetData = &var->buffer.externalData[pos];
 
+    // any callback previously set is replaced by the value copied
+    if (var->stream) {
+        var->stream->callbacks[pos] = NULL;
+        var->stream->contexts[pos] = NULL;
+    }
+
     // handle null case
     targetData->isNull = sourceData->isNull;
     if (sourceData->isNull)
@@ -425,7 +431,7 @@ int dpiVar__extendedPreFetch(dpiVar *var, dpiVarBuffer *buffer,
                 }
                 buffer->data.asStmt[i] = NULL;
                 data->value.asStmt = NULL;
-                if (dpiStmt__allocate(var->conn, 0, &stmt, error) < 0)
+                if (dpiStmt__allocate(var->conn, 0, 0, &stmt, error) < 0)
                     return DPI_FAILURE;
                 if (dpiOci__handleAlloc(var->env->handle, &stmt->handle,
                         DPI_OCI_HTYPE_STMT, "allocate statement", error) < 0) {
@@ -544,11 +550,10 @@ int dpiVar__extendedPreFetch(dpiVar *var, dpiVarBuffer *buffer,
 // dpiVar__finalizeBuffer() [INTERNAL]
 //   Finalize buffer used for passing data to/from Oracle.
 //-----------------------------------------------------------------------------
-static void dpiVar__finalizeBuffer(dpiVar *var, dpiVarBuffer *buffer,
+void dpiVar__finalizeBuffer(dpiVar *var, dpiVarBuffer *buffer,
         dpiError *error)
 {
-    dpiDynamicBytes *dynBytes;
-    uint32_t i, j;
+    uint32_t i;
 
     // free any descriptors that were created
     switch (var->type->oracleTypeNum) {
@@ -589,24 +594,9 @@ static void dpiVar__finalizeBuffer(dpiVar *var, dpiVarBuffer *buffer,
     }
 
     // free any dynamic buffers
-    if (buffer->dynamicBytes) {
-        for (i = 0; i < buffer->maxArraySize; i++) {
-            dynBytes = &buffer->dynamicBytes[i];
-            if (dynBytes->allocatedChunks > 0) {
-                for (j = 0; j < dynBytes->allocatedChunks; j++) {
-                    if (dynBytes->chunks[j].ptr) {
-                        dpiUtils__freeMemory(dynBytes->chunks[j].ptr);
-                        dynBytes->chunks[j].ptr = NULL;
-                    }
-                }
-                dpiUtils__freeMemory(dynBytes->chunks);
-                dynBytes->allocatedChunks = 0;
-                dynBytes->chunks = NULL;
-            }
-        }
-        dpiUtils__freeMemory(buffer->dynamicBytes);
-        buffer->dynamicBytes = NULL;
-    }
+    dpiVar__freeDynamicBytes(&buffer->dynamicBytes, buffer->maxArraySize);
+    dpiVar__freeDynamicBytes(&buffer->pendingLobValues, buffer->maxArraySize);
+    buffer->numPendingLobValues = 0;
 
     // free other memory allocated
     if (buffer->indicator) {
@@ -655,6 +645,13 @@ void dpiVar__free(dpiVar *var, dpiError *error)
         dpiUtils__freeMemory(var->dynBindBuffers);
         var->dynBindBuffers = NULL;
     }
+    if (var->stream) {
+        dpiUtils__freeMemory(var->stream->callbacks);
+        dpiUtils__freeMemory(var->stream->contexts);
+        dpiUtils__freeMemory(var->stream->pieces[0]);
+        dpiUtils__freeMemory(var->stream);
+        var->stream = NULL;
+    }
     if (var->objectType) {
         dpiGen__setRefCount(var->objectType, error, -1);
         var->objectType = NULL;
@@ -663,19 +660,268 @@ void dpiVar__free(dpiVar *var, dpiError *error)
         dpiGen__setRefCount(var->conn, error, -1);
         var->conn = NULL;
     }
-    dpiUtils__freeMemory(var);
+    dpiGen__free(var);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__freeDynamicBytes() [INTERNAL]
+//   Free the chunks of an array of dynamic bytes structures and the array
+// itself, if one was allocated.
+//-----------------------------------------------------------------------------
+static void dpiVar__freeDynamicBytes(dpiDynamicBytes **dynamicBytes,
+        uint32_t numElements)
+{
+    dpiDynamicBytes *dynBytes;
+    uint32_t i, j;
+
+    if (!*dynamicBytes)
+        return;
+    for (i = 0; i < numElements; i++) {
+        dynBytes = &(*dynamicBytes)[i];
+        if (dynBytes->allocatedChunks > 0) {
+            for (j = 0; j < dynBytes->allocatedChunks; j++) {
+                if (dynBytes->chunks[j].ptr) {
+                    dpiUtils__freeMemory(dynBytes->chunks[j].ptr);
+                    dynBytes->chunks[j].ptr = NULL;
+                }
+            }
+            dpiUtils__freeMemory(dynBytes->chunks);
+            dynBytes->allocatedChunks = 0;
+            dynBytes->chunks = NULL;
+        }
+    }
+    dpiUtils__freeMemory(*dynamicBytes);
+    *dynamicBytes = NULL;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getColumnBoolean() [INTERNAL]
+//   Transfers a slice of a fetched column of booleans. The value is copied
+// for null rows as well so that the loop does not need to branch.
+//-----------------------------------------------------------------------------
+static int dpiVar__getColumnBoolean(dpiVar *var, uint32_t numRows,
+        UNUSED dpiError *error)
+{
+    dpiVarBuffer *buffer = &var->buffer;
+    dpiData *data = buffer->externalData;
+    uint32_t i;
+
+    for (i = 0; i < numRows; i++) {
+        data[i].isNull = (buffer->indicator[i] == DPI_OCI_IND_NULL);
+        data[i].value.asBoolean = buffer->data.asBoolean[i];
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getColumnBytes() [INTERNAL]
+//   Transfers a slice of a fetched column of strings or raw data which are
+// not dynamically defined. The external data already points to the Oracle
+// buffer so only the length needs to be transferred.
+//-----------------------------------------------------------------------------
+static int dpiVar__getColumnBytes(dpiVar *var, uint32_t numRows,
+        dpiError *error)
+{
+    dpiVarBuffer *buffer = &var->buffer;
+    dpiData *data = buffer->externalData;
+    uint32_t i;
+
+    for (i = 0; i < numRows; i++) {
+        data[i].isNull = (buffer->indicator[i] == DPI_OCI_IND_NULL);
+        if (data[i].isNull)
+            continue;
+        if (buffer->returnCode && buffer->returnCode[i] != 0) {
+            dpiError__set(error, "check return code", DPI_ERR_COLUMN_FETCH,
+                    i, buffer->returnCode[i]);
+            error->buffer->code = buffer->returnCode[i];
+            return DPI_FAILURE;
+        }
+        data[i].value.asBytes.length = buffer->actualLength[i];
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getColumnFloat() [INTERNAL]
+//   Transfers a slice of a fetched column of native floats. The value is
+// copied for null rows as well so that the loop does not need to branch.
+//-----------------------------------------------------------------------------
+static int dpiVar__getColumnFloat(dpiVar *var, uint32_t numRows,
+        UNUSED dpiError *error)
+{
+    dpiVarBuffer *buffer = &var->buffer;
+    dpiData *data = buffer->externalData;
+    uint32_t i;
+
+    for (i = 0; i < numRows; i++) {
+        data[i].isNull = (buffer->indicator[i] == DPI_OCI_IND_NULL);
+        data[i].value.asFloat = buffer->data.asFloat[i];
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getColumnGeneric() [INTERNAL]
+//   Transfers a slice of a fetched column by transferring each value in turn.
+// This is used for objects and any other variables which need the additional
+// checks performed by dpiVar__getValue().
+//-----------------------------------------------------------------------------
+static int dpiVar__getColumnGeneric(dpiVar *var, uint32_t numRows,
+        dpiError *error)
+{
+    uint32_t i;
+
+    for (i = 0; i < numRows; i++) {
+        if (dpiVar__getValue(var, &var->buffer, i, 1, error) < 0)
+            return DPI_FAILURE;
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getColumnNativeDouble() [INTERNAL]
+//   Transfers a slice of a fetched column of native doubles. The value is
+// copied for null rows as well so that the loop does not need to branch.
+//-----------------------------------------------------------------------------
+static int dpiVar__getColumnNativeDouble(dpiVar *var, uint32_t numRows,
+        UNUSED dpiError *error)
+{
+    dpiVarBuffer *buffer = &var->buffer;
+    dpiData *data = buffer->externalData;
+    uint32_t i;
+
+    for (i = 0; i < numRows; i++) {
+        data[i].isNull = (buffer->indicator[i] == DPI_OCI_IND_NULL);
+        data[i].value.asDouble = buffer->data.asDouble[i];
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getColumnNativeInt() [INTERNAL]
+//   Transfers a slice of a fetched column of native integers (signed or
+// unsigned, which share the same storage). The value is copied for null rows
+// as well so that the loop does not need to branch.
+//-----------------------------------------------------------------------------
+static int dpiVar__getColumnNativeInt(dpiVar *var, uint32_t numRows,
+        UNUSED dpiError *error)
+{
+    dpiVarBuffer *buffer = &var->buffer;
+    dpiData *data = buffer->externalData;
+    uint32_t i;
+
+    for (i = 0; i < numRows; i++) {
+        data[i].isNull = (buffer->indicator[i] == DPI_OCI_IND_NULL);
+        data[i].value.asInt64 = buffer->data.asInt64[i];
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getColumnNumberAsDouble() [INTERNAL]
+//   Transfers a slice of a fetched column of Oracle numbers as doubles.
+//-----------------------------------------------------------------------------
+static int dpiVar__getColumnNumberAsDouble(dpiVar *var, uint32_t numRows,
+        dpiError *error)
+{
+    dpiVarBuffer *buffer = &var->buffer;
+    dpiData *data = buffer->externalData;
+    uint32_t i;
+
+    for (i = 0; i < numRows; i++) {
+        data[i].isNull = (buffer->indicator[i] == DPI_OCI_IND_NULL);
+        if (data[i].isNull)
+            continue;
+        if (dpiDataBuffer__fromOracleNumberAsDouble(&data[i].value, error,
+                &buffer->data.asNumber[i]) < 0)
+            return DPI_FAILURE;
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getColumnNumberAsInt64() [INTERNAL]
+//   Transfers a slice of a fetched column of Oracle numbers as integers.
+//-----------------------------------------------------------------------------
+static int dpiVar__getColumnNumberAsInt64(dpiVar *var, uint32_t numRows,
+        dpiError *error)
+{
+    dpiVarBuffer *buffer = &var->buffer;
+    dpiData *data = buffer->externalData;
+    uint32_t i;
+
+    for (i = 0; i < numRows; i++) {
+        data[i].isNull = (buffer->indicator[i] == DPI_OCI_IND_NULL);
+        if (data[i].isNull)
+            continue;
+        if (dpiDataBuffer__fromOracleNumberAsInteger(&data[i].value, error,
+                &buffer->data.asNumber[i]) < 0)
+            return DPI_FAILURE;
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getColumnScalar() [INTERNAL]
+//   Transfers a slice of a fetched column of any type that does not use
+// object indicators by calling the value converter for each non-null row.
+//-----------------------------------------------------------------------------
+static int dpiVar__getColumnScalar(dpiVar *var, uint32_t numRows,
+        dpiError *error)
+{
+    dpiVarGetValueProc getValueProc = var->getValueProc;
+    dpiVarBuffer *buffer = &var->buffer;
+    dpiData *data = buffer->externalData;
+    uint32_t i;
+
+    for (i = 0; i < numRows; i++) {
+        data[i].isNull = (buffer->indicator[i] == DPI_OCI_IND_NULL);
+        if (data[i].isNull)
+            continue;
+        if (buffer->returnCode && buffer->returnCode[i] != 0) {
+            dpiError__set(error, "check return code", DPI_ERR_COLUMN_FETCH,
+                    i, buffer->returnCode[i]);
+            error->buffer->code = buffer->returnCode[i];
+            return DPI_FAILURE;
+        }
+        if ((*getValueProc)(var, buffer, i, 1, &data[i], error) < 0)
+            return DPI_FAILURE;
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getColumnValues() [INTERNAL]
+//   Transfers the first rows of the main buffer of a variable after a fetch
+// has been performed, using the column converter that was resolved when the
+// variable was allocated.
+//-----------------------------------------------------------------------------
+int dpiVar__getColumnValues(dpiVar *var, uint32_t numRows, dpiError *error)
+{
+    return (*var->getColumnProc)(var, numRows, error);
 }
 
 
 //-----------------------------------------------------------------------------
 // dpiVar__getValue() [PRIVATE]
 //   Returns the contents of the variable in the type specified, if possible.
+// The conversion itself is performed by the converter that was resolved when
+// the variable was allocated.
 //-----------------------------------------------------------------------------
 int dpiVar__getValue(dpiVar *var, dpiVarBuffer *buffer, uint32_t pos,
         int inFetch, dpiError *error)
 {
-    dpiOracleTypeNum oracleTypeNum;
-    dpiBytes *bytes;
     dpiData *data;
     uint32_t i;
 
@@ -719,182 +965,411 @@ int dpiVar__getValue(dpiVar *var, dpiVarBuffer *buffer, uint32_t pos,
         }
     }
 
-    // transform the various types
-    oracleTypeNum = var->type->oracleTypeNum;
-    switch (var->nativeTypeNum) {
-        case DPI_NATIVE_TYPE_INT64:
-        case DPI_NATIVE_TYPE_UINT64:
-            switch (oracleTypeNum) {
-                case DPI_ORACLE_TYPE_NATIVE_INT:
-                    data->value.asInt64 = buffer->data.asInt64[pos];
-                    return DPI_SUCCESS;
-                case DPI_ORACLE_TYPE_NATIVE_UINT:
-                    data->value.asUint64 = buffer->data.asUint64[pos];
-                    return DPI_SUCCESS;
-                case DPI_ORACLE_TYPE_NUMBER:
-                    if (var->nativeTypeNum == DPI_NATIVE_TYPE_INT64)
-                        return dpiDataBuffer__fromOracleNumberAsInteger(
-                                &data->value, error,
-                                &buffer->data.asNumber[pos]);
-                    return dpiDataBuffer__fromOracleNumberAsUnsignedInteger(
-                            &data->value, error, &buffer->data.asNumber[pos]);
-                default:
-                    break;
-            }
-            break;
-        case DPI_NATIVE_TYPE_DOUBLE:
-            switch (oracleTypeNum) {
-                case DPI_ORACLE_TYPE_NUMBER:
-                    return dpiDataBuffer__fromOracleNumberAsDouble(
-                            &data->value, error, &buffer->data.asNumber[pos]);
-                case DPI_ORACLE_TYPE_NATIVE_DOUBLE:
-                    data->value.asDouble = buffer->data.asDouble[pos];
-                    return DPI_SUCCESS;
-                case DPI_ORACLE_TYPE_DATE:
-                    return dpiDataBuffer__fromOracleDateAsDouble(&data->value,
-                            var->env, error, &buffer->data.asDate[pos]);
-                case DPI_ORACLE_TYPE_TIMESTAMP:
-                case DPI_ORACLE_TYPE_TIMESTAMP_TZ:
-                case DPI_ORACLE_TYPE_TIMESTAMP_LTZ:
-                    return dpiDataBuffer__fromOracleTimestampAsDouble(
-                            &data->value, oracleTypeNum, var->env, error,
-                            buffer->data.asTimestamp[pos]);
-                default:
-                    break;
-            }
-            break;
-        case DPI_NATIVE_TYPE_BYTES:
-            bytes = &data->value.asBytes;
-            switch (oracleTypeNum) {
-                case DPI_ORACLE_TYPE_VARCHAR:
-                case DPI_ORACLE_TYPE_NVARCHAR:
-                case DPI_ORACLE_TYPE_CHAR:
-                case DPI_ORACLE_TYPE_NCHAR:
-                case DPI_ORACLE_TYPE_ROWID:
-                case DPI_ORACLE_TYPE_RAW:
-                case DPI_ORACLE_TYPE_LONG_VARCHAR:
-                case DPI_ORACLE_TYPE_LONG_NVARCHAR:
-                case DPI_ORACLE_TYPE_LONG_RAW:
-                case DPI_ORACLE_TYPE_XMLTYPE:
-                    if (buffer->dynamicBytes)
-                        return dpiVar__setBytesFromDynamicBytes(bytes,
-                                &buffer->dynamicBytes[pos], error);
-                    bytes->length = buffer->actualLength[pos];
-                    return DPI_SUCCESS;
-                case DPI_ORACLE_TYPE_CLOB:
-                case DPI_ORACLE_TYPE_NCLOB:
-                case DPI_ORACLE_TYPE_BLOB:
-                case DPI_ORACLE_TYPE_BFILE:
-                    return dpiVar__setBytesFromLob(bytes,
-                            &buffer->dynamicBytes[pos],
-                            buffer->references[pos].asLOB, error);
-                case DPI_ORACLE_TYPE_NUMBER:
-                    bytes->length = DPI_NUMBER_AS_TEXT_CHARS;
-                    if (var->env->charsetId == DPI_CHARSET_ID_UTF16)
-                        bytes->length *= 2;
-                    return dpiDataBuffer__fromOracleNumberAsText(&data->value,
-                            var->env, error, &buffer->data.asNumber[pos]);
-                default:
-                    break;
-            }
-            break;
-        case DPI_NATIVE_TYPE_FLOAT:
-            data->value.asFloat = buffer->data.asFloat[pos];
-            break;
-        case DPI_NATIVE_TYPE_TIMESTAMP:
-            if (oracleTypeNum == DPI_ORACLE_TYPE_DATE)
-                return dpiDataBuffer__fromOracleDate(&data->value,
-                        &buffer->data.asDate[pos]);
-            return dpiDataBuffer__fromOracleTimestamp(&data->value, var->env,
-                    error, buffer->data.asTimestamp[pos],
-                    oracleTypeNum != DPI_ORACLE_TYPE_TIMESTAMP);
-            break;
-        case DPI_NATIVE_TYPE_INTERVAL_DS:
-            return dpiDataBuffer__fromOracleIntervalDS(&data->value, var->env,
-                    error, buffer->data.asInterval[pos]);
-        case DPI_NATIVE_TYPE_INTERVAL_YM:
-            return dpiDataBuffer__fromOracleIntervalYM(&data->value, var->env,
-                    error, buffer->data.asInterval[pos]);
-        case DPI_NATIVE_TYPE_OBJECT:
-            data->value.asObject = NULL;
-            if (!buffer->references[pos].asObject) {
-                if (dpiObject__allocate(var->objectType,
-                        buffer->data.asObject[pos],
-                        buffer->objectIndicator[pos], NULL,
-                        &buffer->references[pos].asObject, error) < 0)
-                    return DPI_FAILURE;
-                if (inFetch && var->objectType->isCollection)
-                    buffer->references[pos].asObject->freeIndicator = 1;
-            }
-            data->value.asObject = buffer->references[pos].asObject;
-            break;
-        case DPI_NATIVE_TYPE_STMT:
-            data->value.asStmt = buffer->references[pos].asStmt;
-            break;
-        case DPI_NATIVE_TYPE_BOOLEAN:
-            data->value.asBoolean = buffer->data.asBoolean[pos];
-            break;
-        default:
-            break;
-    }
-    return DPI_SUCCESS;
+    // transform the value
+    return (*var->getValueProc)(var, buffer, pos, inFetch, data, error);
 }
 
 
 //-----------------------------------------------------------------------------
-// dpiVar__inBindCallback() [INTERNAL]
-//   Callback which runs during OCI statement execution and provides buffers to
-// OCI for binding data IN. This is not used with DML returning so this method
-// does nothing useful except satisfy OCI requirements.
+// dpiVar__getValueBoolean() [INTERNAL]
+//   Transfers a boolean value.
 //-----------------------------------------------------------------------------
-int32_t dpiVar__inBindCallback(dpiVar *var, UNUSED void *bindp,
-        UNUSED uint32_t iter, UNUSED uint32_t index, void **bufpp,
-        uint32_t *alenp, uint8_t *piecep, void **indpp)
+static int dpiVar__getValueBoolean(UNUSED dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, UNUSED int inFetch, dpiData *data,
+        UNUSED dpiError *error)
 {
-    dpiDynamicBytes *dynBytes;
-
-    if (var->isDynamic) {
-        dynBytes = &var->buffer.dynamicBytes[iter];
-        if (dynBytes->allocatedChunks == 0) {
-            *bufpp = NULL;
-            *alenp = 0;
-        } else {
-            *bufpp = dynBytes->chunks->ptr;
-            *alenp = dynBytes->chunks->length;
-        }
-    } else {
-        dpiVar__assignCallbackBuffer(var, &var->buffer, iter, bufpp);
-        if (var->buffer.actualLength)
-            *alenp = var->buffer.actualLength[iter];
-        else *alenp = var->type->sizeInBytes;
-    }
-    *piecep = DPI_OCI_ONE_PIECE;
-    if (var->buffer.objectIndicator)
-        *indpp = var->buffer.objectIndicator[iter];
-    else *indpp = &var->buffer.indicator[iter];
-    return DPI_OCI_CONTINUE;
+    data->value.asBoolean = buffer->data.asBoolean[pos];
+    return DPI_SUCCESS;
 }
 
 
 //-----------------------------------------------------------------------------
-// dpiVar__initBuffer() [INTERNAL]
-//   Initialize buffers necessary for passing data to/from Oracle.
+// dpiVar__getValueBytes() [INTERNAL]
+//   Transfers a string or raw value that is not dynamically bound or defined.
+// The external data already points to the Oracle buffer so only the length
+// needs to be transferred.
 //-----------------------------------------------------------------------------
-static int dpiVar__initBuffer(dpiVar *var, dpiVarBuffer *buffer,
-        dpiError *error)
+static int dpiVar__getValueBytes(UNUSED dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, UNUSED int inFetch, dpiData *data,
+        UNUSED dpiError *error)
 {
-    uint32_t i, tempBufferSize = 0;
-    unsigned long long dataLength;
-    dpiBytes *bytes;
+    data->value.asBytes.length = buffer->actualLength[pos];
+    return DPI_SUCCESS;
+}
 
-    // initialize dynamic buffers for dynamic variables
-    if (var->isDynamic) {
-        if (dpiUtils__allocateMemory(buffer->maxArraySize,
-                sizeof(dpiDynamicBytes), 1, "allocate dynamic bytes",
-                (void**) &buffer->dynamicBytes, error) < 0)
-            return DPI_FAILURE;
 
-    // for all other variables, validate length and allocate buffers
+//-----------------------------------------------------------------------------
+// dpiVar__getValueDate() [INTERNAL]
+//   Transfers an Oracle date as a timestamp.
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueDate(UNUSED dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, UNUSED int inFetch, dpiData *data,
+        UNUSED dpiError *error)
+{
+    return dpiDataBuffer__fromOracleDate(&data->value,
+            &buffer->data.asDate[pos]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueDateAsDouble() [INTERNAL]
+//   Transfers an Oracle date as a double (milliseconds since the epoch).
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueDateAsDouble(dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, UNUSED int inFetch, dpiData *data, dpiError *error)
+{
+    return dpiDataBuffer__fromOracleDateAsDouble(&data->value, var->env,
+            error, &buffer->data.asDate[pos]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueDynamicBytes() [INTERNAL]
+//   Transfers a string or raw value that is dynamically bound or defined.
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueDynamicBytes(UNUSED dpiVar *var,
+        dpiVarBuffer *buffer, uint32_t pos, UNUSED int inFetch, dpiData *data,
+        dpiError *error)
+{
+    return dpiVar__setBytesFromDynamicBytes(&data->value.asBytes,
+            &buffer->dynamicBytes[pos], error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueFloat() [INTERNAL]
+//   Transfers a native float value.
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueFloat(UNUSED dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, UNUSED int inFetch, dpiData *data,
+        UNUSED dpiError *error)
+{
+    data->value.asFloat = buffer->data.asFloat[pos];
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueIntervalDS() [INTERNAL]
+//   Transfers a day to second interval value.
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueIntervalDS(dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, UNUSED int inFetch, dpiData *data, dpiError *error)
+{
+    return dpiDataBuffer__fromOracleIntervalDS(&data->value, var->env, error,
+            buffer->data.asInterval[pos]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueIntervalYM() [INTERNAL]
+//   Transfers a year to month interval value.
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueIntervalYM(dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, UNUSED int inFetch, dpiData *data, dpiError *error)
+{
+    return dpiDataBuffer__fromOracleIntervalYM(&data->value, var->env, error,
+            buffer->data.asInterval[pos]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueLobAsBytes() [INTERNAL]
+//   Transfers the contents of a LOB as bytes.
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueLobAsBytes(UNUSED dpiVar *var,
+        dpiVarBuffer *buffer, uint32_t pos, UNUSED int inFetch, dpiData *data,
+        dpiError *error)
+{
+    return dpiVar__setBytesFromLob(&data->value.asBytes,
+            &buffer->dynamicBytes[pos], buffer->references[pos].asLOB, error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueNativeDouble() [INTERNAL]
+//   Transfers a native double value.
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueNativeDouble(UNUSED dpiVar *var,
+        dpiVarBuffer *buffer, uint32_t pos, UNUSED int inFetch, dpiData *data,
+        UNUSED dpiError *error)
+{
+    data->value.asDouble = buffer->data.asDouble[pos];
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueNativeInt() [INTERNAL]
+//   Transfers a native signed integer value.
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueNativeInt(UNUSED dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, UNUSED int inFetch, dpiData *data,
+        UNUSED dpiError *error)
+{
+    data->value.asInt64 = buffer->data.asInt64[pos];
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueNativeUint() [INTERNAL]
+//   Transfers a native unsigned integer value.
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueNativeUint(UNUSED dpiVar *var,
+        dpiVarBuffer *buffer, uint32_t pos, UNUSED int inFetch, dpiData *data,
+        UNUSED dpiError *error)
+{
+    data->value.asUint64 = buffer->data.asUint64[pos];
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueNone() [INTERNAL]
+//   Used for variables where no transformation is required (or where the
+// transformation takes place elsewhere, such as for LOBs and rowids).
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueNone(UNUSED dpiVar *var,
+        UNUSED dpiVarBuffer *buffer, UNUSED uint32_t pos, UNUSED int inFetch,
+        UNUSED dpiData *data, UNUSED dpiError *error)
+{
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueNumberAsBytes() [INTERNAL]
+//   Transfers an Oracle number as text.
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueNumberAsBytes(dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, UNUSED int inFetch, dpiData *data, dpiError *error)
+{
+    data->value.asBytes.length = DPI_NUMBER_AS_TEXT_CHARS;
+    if (var->env->charsetId == DPI_CHARSET_ID_UTF16)
+        data->value.asBytes.length *= 2;
+    return dpiDataBuffer__fromOracleNumberAsText(&data->value, var->env,
+            error, &buffer->data.asNumber[pos]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueNumberAsDouble() [INTERNAL]
+//   Transfers an Oracle number as a double.
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueNumberAsDouble(UNUSED dpiVar *var,
+        dpiVarBuffer *buffer, uint32_t pos, UNUSED int inFetch, dpiData *data,
+        dpiError *error)
+{
+    return dpiDataBuffer__fromOracleNumberAsDouble(&data->value, error,
+            &buffer->data.asNumber[pos]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueNumberAsInt64() [INTERNAL]
+//   Transfers an Oracle number as a signed integer.
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueNumberAsInt64(UNUSED dpiVar *var,
+        dpiVarBuffer *buffer, uint32_t pos, UNUSED int inFetch, dpiData *data,
+        dpiError *error)
+{
+    return dpiDataBuffer__fromOracleNumberAsInteger(&data->value, error,
+            &buffer->data.asNumber[pos]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueNumberAsUint64() [INTERNAL]
+//   Transfers an Oracle number as an unsigned integer.
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueNumberAsUint64(UNUSED dpiVar *var,
+        dpiVarBuffer *buffer, uint32_t pos, UNUSED int inFetch, dpiData *data,
+        dpiError *error)
+{
+    return dpiDataBuffer__fromOracleNumberAsUnsignedInteger(&data->value,
+            error, &buffer->data.asNumber[pos]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueObject() [INTERNAL]
+//   Transfers an object value, creating the object handle if needed.
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueObject(dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, int inFetch, dpiData *data, dpiError *error)
+{
+    data->value.asObject = NULL;
+    if (!buffer->references[pos].asObject) {
+        if (dpiObject__allocate(var->objectType, buffer->data.asObject[pos],
+                buffer->objectIndicator[pos], NULL,
+                &buffer->references[pos].asObject, error) < 0)
+            return DPI_FAILURE;
+        if (inFetch && var->objectType->isCollection)
+            buffer->references[pos].asObject->freeIndicator = 1;
+    }
+    data->value.asObject = buffer->references[pos].asObject;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueStmt() [INTERNAL]
+//   Transfers a statement (REF cursor) value.
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueStmt(UNUSED dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, UNUSED int inFetch, dpiData *data,
+        UNUSED dpiError *error)
+{
+    data->value.asStmt = buffer->references[pos].asStmt;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueTimestamp() [INTERNAL]
+//   Transfers an Oracle timestamp without time zone as a timestamp.
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueTimestamp(dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, UNUSED int inFetch, dpiData *data, dpiError *error)
+{
+    return dpiDataBuffer__fromOracleTimestamp(&data->value, var->env, error,
+            buffer->data.asTimestamp[pos], 0);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueTimestampAsDouble() [INTERNAL]
+//   Transfers an Oracle timestamp as a double (milliseconds since the epoch).
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueTimestampAsDouble(dpiVar *var,
+        dpiVarBuffer *buffer, uint32_t pos, UNUSED int inFetch, dpiData *data,
+        dpiError *error)
+{
+    return dpiDataBuffer__fromOracleTimestampAsDouble(&data->value,
+            var->type->oracleTypeNum, var->env, error,
+            buffer->data.asTimestamp[pos]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__getValueTimestampTZ() [INTERNAL]
+//   Transfers an Oracle timestamp with (local) time zone as a timestamp.
+//-----------------------------------------------------------------------------
+static int dpiVar__getValueTimestampTZ(dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, UNUSED int inFetch, dpiData *data, dpiError *error)
+{
+    return dpiDataBuffer__fromOracleTimestamp(&data->value, var->env, error,
+            buffer->data.asTimestamp[pos], 1);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__inBindCallback() [INTERNAL]
+//   Callback which runs during OCI statement execution and provides buffers to
+// OCI for binding data IN. Values that are streamed from a callback supplied
+// by the caller are handed to OCI in multiple pieces; all other values are
+// handed to OCI in a single piece.
+//-----------------------------------------------------------------------------
+int32_t dpiVar__inBindCallback(dpiVar *var, UNUSED void *bindp,
+        uint32_t iter, UNUSED uint32_t index, void **bufpp,
+        uint32_t *alenp, uint8_t *piecep, void **indpp)
+{
+    dpiDynamicBytes *dynBytes;
+
+    if (var->stream && var->stream->callbacks[iter] &&
+            var->buffer.indicator[iter] != DPI_OCI_IND_NULL) {
+        *indpp = &var->buffer.indicator[iter];
+        return dpiVar__inBindStream(var, iter, bufpp, alenp, piecep);
+    }
+    if (var->isDynamic) {
+        dynBytes = &var->buffer.dynamicBytes[iter];
+        if (dynBytes->allocatedChunks == 0) {
+            *bufpp = NULL;
+            *alenp = 0;
+        } else {
+            *bufpp = dynBytes->chunks->ptr;
+            *alenp = dynBytes->chunks->length;
+        }
+    } else {
+        dpiVar__assignCallbackBuffer(var, &var->buffer, iter, bufpp);
+        if (var->buffer.actualLength)
+            *alenp = var->buffer.actualLength[iter];
+        else *alenp = var->type->sizeInBytes;
+    }
+    *piecep = DPI_OCI_ONE_PIECE;
+    if (var->buffer.objectIndicator)
+        *indpp = var->buffer.objectIndicator[iter];
+    else *indpp = &var->buffer.indicator[iter];
+    return DPI_OCI_CONTINUE;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__inBindStream() [INTERNAL]
+//   Hand the next piece of a value streamed from a callback to OCI. The piece
+// following it is read ahead so that OCI can be told whether or not the piece
+// is the last one; a callback that reads no bytes marks the end of the value.
+// Once the value is complete the callback is cleared.
+//-----------------------------------------------------------------------------
+static int32_t dpiVar__inBindStream(dpiVar *var, uint32_t iter, void **bufpp,
+        uint32_t *alenp, uint8_t *piecep)
+{
+    dpiVarStream *stream = var->stream;
+    uint32_t currentPiece, nextPiece;
+    int isFirst;
+
+    // the first piece is read when OCI first asks for the value
+    isFirst = !stream->isActive;
+    if (isFirst) {
+        stream->currentPiece = 0;
+        if (dpiVar__readStreamPiece(var, iter, 0) < 0)
+            return DPI_OCI_ERROR;
+        stream->isActive = 1;
+    }
+
+    // read ahead the following piece, unless the end has been reached
+    currentPiece = stream->currentPiece;
+    nextPiece = 1 - currentPiece;
+    if (stream->pieceLengths[currentPiece] == 0)
+        stream->pieceLengths[nextPiece] = 0;
+    else if (dpiVar__readStreamPiece(var, iter, nextPiece) < 0)
+        return DPI_OCI_ERROR;
+
+    // hand the current piece to OCI
+    *bufpp = stream->pieces[currentPiece];
+    *alenp = stream->pieceLengths[currentPiece];
+    if (stream->pieceLengths[nextPiece] > 0) {
+        *piecep = (isFirst) ? DPI_OCI_FIRST_PIECE : DPI_OCI_NEXT_PIECE;
+        stream->currentPiece = nextPiece;
+    } else {
+        *piecep = (isFirst) ? DPI_OCI_ONE_PIECE : DPI_OCI_LAST_PIECE;
+        stream->isActive = 0;
+        stream->callbacks[iter] = NULL;
+        stream->contexts[iter] = NULL;
+    }
+    return DPI_OCI_CONTINUE;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__initBuffer() [INTERNAL]
+//   Initialize buffers necessary for passing data to/from Oracle.
+//-----------------------------------------------------------------------------
+int dpiVar__initBuffer(dpiVar *var, dpiVarBuffer *buffer, dpiError *error)
+{
+    uint32_t i, tempBufferSize = 0;
+    unsigned long long dataLength;
+    dpiBytes *bytes;
+
+    // initialize dynamic buffers for dynamic variables
+    if (var->isDynamic) {
+        if (dpiUtils__allocateMemory(buffer->maxArraySize,
+                sizeof(dpiDynamicBytes), 1, "allocate dynamic bytes",
+                (void**) &buffer->dynamicBytes, error) < 0)
+            return DPI_FAILURE;
+
+    // for all other variables, validate length and allocate buffers
     } else {
         dataLength = (unsigned long long) buffer->maxArraySize *
                 (unsigned long long) var->sizeInBytes;
@@ -1131,6 +1606,54 @@ int32_t dpiVar__outBindCallback(dpiVar *var, void *bindp, UNUSED uint32_t iter,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar__readStreamPiece() [INTERNAL]
+//   Read a piece of a streamed value from the callback supplied by the caller.
+// If the callback fails, the error is retained in the stream since OCI will
+// replace the error with its own when the callback returns.
+//-----------------------------------------------------------------------------
+static int dpiVar__readStreamPiece(dpiVar *var, uint32_t iter,
+        uint32_t piece)
+{
+    dpiVarStream *stream = var->stream;
+    uint32_t bytesRead = 0;
+
+    if ((*stream->callbacks[iter])(stream->contexts[iter],
+            stream->pieces[piece], DPI_DYNAMIC_BYTES_CHUNK_SIZE,
+            &bytesRead) < 0) {
+        dpiError__set(var->error, "read stream piece",
+                DPI_ERR_STREAM_CALLBACK_FAILED, iter);
+        memcpy(&stream->errorBuffer, var->error->buffer,
+                sizeof(dpiErrorBuffer));
+        stream->failed = 1;
+        stream->isActive = 0;
+        return DPI_FAILURE;
+    }
+    if (bytesRead > DPI_DYNAMIC_BYTES_CHUNK_SIZE)
+        bytesRead = DPI_DYNAMIC_BYTES_CHUNK_SIZE;
+    stream->pieceLengths[piece] = bytesRead;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__resetStream() [INTERNAL]
+//   Clear all of the callbacks retained by the variable. This is called when
+// an execute fails since the callbacks may have been partially consumed and
+// must not be invoked again by a subsequent execute.
+//-----------------------------------------------------------------------------
+void dpiVar__resetStream(dpiVar *var)
+{
+    dpiVarStream *stream = var->stream;
+
+    stream->isActive = 0;
+    stream->failed = 0;
+    memset(stream->callbacks, 0,
+            var->buffer.maxArraySize * sizeof(dpiReadCallback));
+    memset(stream->contexts, 0, var->buffer.maxArraySize * sizeof(void*));
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar__setBytesFromDynamicBytes() [PRIVATE]
 //   Set the pointer and length in the dpiBytes structure to the values
@@ -1233,11 +1756,38 @@ static int dpiVar__setFromBytes(dpiVar *var, uint32_t pos, const char *value,
     dpiDynamicBytes *dynBytes;
     dpiBytes *bytes;
 
-    // for internally used LOBs, write the data directly
+    // any callback previously set is replaced by this value
+    if (var->stream) {
+        var->stream->callbacks[pos] = NULL;
+        var->stream->contexts[pos] = NULL;
+    }
+
+    // for internally used LOBs, retain a copy of the value so that all of
+    // the values can be written in a single round trip before the statement is
+    // executed; LOBs exposed to the caller are written directly
     if (var->buffer.references) {
         data->isNull = 0;
-        return dpiLob__setFromBytes(var->buffer.references[pos].asLOB, value,
-                valueLength, error);
+        if (var->nativeTypeNum != DPI_NATIVE_TYPE_BYTES)
+            return dpiLob__setFromBytes(var->buffer.references[pos].asLOB,
+                    value, valueLength, error);
+        if (!var->buffer.pendingLobValues &&
+                dpiUtils__allocateMemory(var->buffer.maxArraySize,
+                        sizeof(dpiDynamicBytes), 1,
+                        "allocate pending LOB values",
+                        (void**) &var->buffer.pendingLobValues, error) < 0)
+            return DPI_FAILURE;
+        dynBytes = &var->buffer.pendingLobValues[pos];
+        if (dynBytes->numChunks == 0)
+            var->buffer.numPendingLobValues++;
+        if (dpiVar__allocateDynamicBytes(dynBytes, valueLength, error) < 0) {
+            var->buffer.numPendingLobValues--;
+            return DPI_FAILURE;
+        }
+        if (valueLength > 0)
+            memcpy(dynBytes->chunks->ptr, value, valueLength);
+        dynBytes->numChunks = 1;
+        dynBytes->chunks->length = valueLength;
+        return DPI_SUCCESS;
     }
 
     // validate the target can accept the input
@@ -1283,6 +1833,59 @@ static int dpiVar__setFromBytes(dpiVar *var, uint32_t pos, const char *value,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar__setFromCallback() [PRIVATE]
+//   Set the value of the variable at the given array position to be streamed
+// from the callback when the statement is executed. The memory used for
+// streaming is allocated the first time a callback is set and is bounded by
+// two pieces regardless of the size of the values. A NULL callback clears any
+// callback previously set and makes the value null.
+//-----------------------------------------------------------------------------
+static int dpiVar__setFromCallback(dpiVar *var, uint32_t pos,
+        dpiReadCallback callback, void *context, dpiError *error)
+{
+    dpiData *data = &var->buffer.externalData[pos];
+    dpiDynamicBytes *dynBytes;
+    dpiVarStream *stream;
+
+    // allocate memory for streaming, if needed
+    if (callback && !var->stream) {
+        if (dpiUtils__allocateMemory(1, sizeof(dpiVarStream), 1,
+                "allocate stream", (void**) &stream, error) < 0)
+            return DPI_FAILURE;
+        if (dpiUtils__allocateMemory(var->buffer.maxArraySize,
+                sizeof(dpiReadCallback), 1, "allocate stream callbacks",
+                (void**) &stream->callbacks, error) < 0 ||
+                dpiUtils__allocateMemory(var->buffer.maxArraySize,
+                sizeof(void*), 1, "allocate stream contexts",
+                (void**) &stream->contexts, error) < 0 ||
+                dpiUtils__allocateMemory(2, DPI_DYNAMIC_BYTES_CHUNK_SIZE, 0,
+                "allocate stream pieces", (void**) &stream->pieces[0],
+                error) < 0) {
+            dpiUtils__freeMemory(stream->callbacks);
+            dpiUtils__freeMemory(stream->contexts);
+            dpiUtils__freeMemory(stream);
+            return DPI_FAILURE;
+        }
+        stream->pieces[1] = stream->pieces[0] + DPI_DYNAMIC_BYTES_CHUNK_SIZE;
+        var->stream = stream;
+    }
+
+    // retain the callback; the value itself is empty until it is streamed
+    if (var->stream) {
+        var->stream->callbacks[pos] = callback;
+        var->stream->contexts[pos] = context;
+    }
+    dynBytes = &var->buffer.dynamicBytes[pos];
+    if (dynBytes->allocatedChunks > 0)
+        dynBytes->chunks->length = 0;
+    dynBytes->numChunks = 0;
+    data->value.asBytes.length = 0;
+    data->isNull = (callback) ? 0 : 1;
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar__setFromJson() [PRIVATE]
 //   Set the value of the variable at the given array position from a JSON
@@ -1524,11 +2127,12 @@ static int dpiVar__setFromVector(dpiVar *var, uint32_t pos, dpiVector *vector,
 //-----------------------------------------------------------------------------
 // dpiVar__setValue() [PRIVATE]
 //   Sets the contents of the variable using the type specified, if possible.
+// The conversion itself is performed by the converter that was resolved when
+// the variable was allocated.
 //-----------------------------------------------------------------------------
 int dpiVar__setValue(dpiVar *var, dpiVarBuffer *buffer, uint32_t pos,
         dpiData *data, dpiError *error)
 {
-    dpiOracleTypeNum oracleTypeNum;
     dpiObject *obj;
 
     // if value is null, no need to proceed further
@@ -1550,95 +2154,400 @@ int dpiVar__setValue(dpiVar *var, dpiVarBuffer *buffer, uint32_t pos,
         return DPI_SUCCESS;
     }
 
-    // transform the various types
+    // transform the value
     buffer->indicator[pos] = DPI_OCI_IND_NOTNULL;
-    oracleTypeNum = var->type->oracleTypeNum;
+    return (*var->setValueProc)(var, buffer, pos, data, error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueBoolean() [INTERNAL]
+//   Transfers a boolean value.
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueBoolean(UNUSED dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, dpiData *data, UNUSED dpiError *error)
+{
+    buffer->data.asBoolean[pos] = data->value.asBoolean;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueBytes() [INTERNAL]
+//   Transfers the length of a string or raw value; the value itself has
+// already been placed in the Oracle buffer.
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueBytes(UNUSED dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, dpiData *data, UNUSED dpiError *error)
+{
+    if (buffer->actualLength)
+        buffer->actualLength[pos] = data->value.asBytes.length;
+    if (buffer->returnCode)
+        buffer->returnCode[pos] = 0;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueDate() [INTERNAL]
+//   Transfers a timestamp to an Oracle date.
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueDate(UNUSED dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, dpiData *data, UNUSED dpiError *error)
+{
+    return dpiDataBuffer__toOracleDate(&data->value,
+            &buffer->data.asDate[pos]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueDateFromDouble() [INTERNAL]
+//   Transfers a double (milliseconds since the epoch) to an Oracle date.
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueDateFromDouble(dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, dpiData *data, dpiError *error)
+{
+    return dpiDataBuffer__toOracleDateFromDouble(&data->value, var->env,
+            error, &buffer->data.asDate[pos]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueFloat() [INTERNAL]
+//   Transfers a native float value.
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueFloat(UNUSED dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, dpiData *data, UNUSED dpiError *error)
+{
+    buffer->data.asFloat[pos] = data->value.asFloat;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueIntervalDS() [INTERNAL]
+//   Transfers a day to second interval value.
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueIntervalDS(dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, dpiData *data, dpiError *error)
+{
+    return dpiDataBuffer__toOracleIntervalDS(&data->value, var->env, error,
+            buffer->data.asInterval[pos]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueIntervalYM() [INTERNAL]
+//   Transfers a year to month interval value.
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueIntervalYM(dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, dpiData *data, dpiError *error)
+{
+    return dpiDataBuffer__toOracleIntervalYM(&data->value, var->env, error,
+            buffer->data.asInterval[pos]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueNativeDouble() [INTERNAL]
+//   Transfers a native double value.
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueNativeDouble(UNUSED dpiVar *var,
+        dpiVarBuffer *buffer, uint32_t pos, dpiData *data,
+        UNUSED dpiError *error)
+{
+    buffer->data.asDouble[pos] = data->value.asDouble;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueNativeInt() [INTERNAL]
+//   Transfers a native signed integer value.
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueNativeInt(UNUSED dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, dpiData *data, UNUSED dpiError *error)
+{
+    buffer->data.asInt64[pos] = data->value.asInt64;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueNativeUint() [INTERNAL]
+//   Transfers a native unsigned integer value.
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueNativeUint(UNUSED dpiVar *var,
+        dpiVarBuffer *buffer, uint32_t pos, dpiData *data,
+        UNUSED dpiError *error)
+{
+    buffer->data.asUint64[pos] = data->value.asUint64;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueNone() [INTERNAL]
+//   Used for variables where no transformation is required (or where the
+// transformation takes place elsewhere, such as for LOBs and objects).
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueNone(UNUSED dpiVar *var,
+        UNUSED dpiVarBuffer *buffer, UNUSED uint32_t pos,
+        UNUSED dpiData *data, UNUSED dpiError *error)
+{
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueNumberFromBytes() [INTERNAL]
+//   Transfers text to an Oracle number.
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueNumberFromBytes(dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, dpiData *data, dpiError *error)
+{
+    return dpiDataBuffer__toOracleNumberFromText(&data->value, var->env,
+            error, &buffer->data.asNumber[pos]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueNumberFromDouble() [INTERNAL]
+//   Transfers a double to an Oracle number.
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueNumberFromDouble(UNUSED dpiVar *var,
+        dpiVarBuffer *buffer, uint32_t pos, dpiData *data, dpiError *error)
+{
+    return dpiDataBuffer__toOracleNumberFromDouble(&data->value, error,
+            &buffer->data.asNumber[pos]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueNumberFromInt64() [INTERNAL]
+//   Transfers a signed integer to an Oracle number.
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueNumberFromInt64(UNUSED dpiVar *var,
+        dpiVarBuffer *buffer, uint32_t pos, dpiData *data, dpiError *error)
+{
+    return dpiDataBuffer__toOracleNumberFromInteger(&data->value, error,
+            &buffer->data.asNumber[pos]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueNumberFromUint64() [INTERNAL]
+//   Transfers an unsigned integer to an Oracle number.
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueNumberFromUint64(UNUSED dpiVar *var,
+        dpiVarBuffer *buffer, uint32_t pos, dpiData *data, dpiError *error)
+{
+    return dpiDataBuffer__toOracleNumberFromUnsignedInteger(&data->value,
+            error, &buffer->data.asNumber[pos]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueStmt() [INTERNAL]
+//   Transfers a statement (REF cursor) value by setting the number of rows to
+// prefetch on the statement handle.
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueStmt(UNUSED dpiVar *var,
+        UNUSED dpiVarBuffer *buffer, UNUSED uint32_t pos, dpiData *data,
+        dpiError *error)
+{
+    return dpiOci__attrSet(data->value.asStmt->handle, DPI_OCI_HTYPE_STMT,
+            &data->value.asStmt->prefetchRows,
+            sizeof(data->value.asStmt->prefetchRows),
+            DPI_OCI_ATTR_PREFETCH_ROWS, "set prefetch rows for REF cursor",
+            error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueTimestamp() [INTERNAL]
+//   Transfers a timestamp to an Oracle timestamp without time zone.
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueTimestamp(dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, dpiData *data, dpiError *error)
+{
+    return dpiDataBuffer__toOracleTimestamp(&data->value, var->env, error,
+            buffer->data.asTimestamp[pos], 0);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueTimestampFromDouble() [INTERNAL]
+//   Transfers a double (milliseconds since the epoch) to an Oracle timestamp.
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueTimestampFromDouble(dpiVar *var,
+        dpiVarBuffer *buffer, uint32_t pos, dpiData *data, dpiError *error)
+{
+    return dpiDataBuffer__toOracleTimestampFromDouble(&data->value,
+            var->type->oracleTypeNum, var->env, error,
+            buffer->data.asTimestamp[pos]);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__setValueTimestampTZ() [INTERNAL]
+//   Transfers a timestamp to an Oracle timestamp with (local) time zone.
+//-----------------------------------------------------------------------------
+static int dpiVar__setValueTimestampTZ(dpiVar *var, dpiVarBuffer *buffer,
+        uint32_t pos, dpiData *data, dpiError *error)
+{
+    return dpiDataBuffer__toOracleTimestamp(&data->value, var->env, error,
+            buffer->data.asTimestamp[pos], 1);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__updateConverters() [INTERNAL]
+//   Resolves the converters used to transfer values between the Oracle
+// buffers and the external data buffers based on the Oracle type and native
+// type of the variable. This is done once when the variable is allocated (and
+// again if the Oracle type of the variable is changed) so that no decisions
+// based on the types need to be made for each value that is transferred.
+//-----------------------------------------------------------------------------
+static void dpiVar__updateConverters(dpiVar *var)
+{
+    dpiOracleTypeNum oracleTypeNum = var->type->oracleTypeNum;
+
+    var->getValueProc = dpiVar__getValueNone;
+    var->setValueProc = dpiVar__setValueNone;
+    var->getColumnProc = NULL;
     switch (var->nativeTypeNum) {
         case DPI_NATIVE_TYPE_INT64:
         case DPI_NATIVE_TYPE_UINT64:
-            switch (oracleTypeNum) {
-                case DPI_ORACLE_TYPE_NATIVE_INT:
-                    buffer->data.asInt64[pos] = data->value.asInt64;
-                    return DPI_SUCCESS;
-                case DPI_ORACLE_TYPE_NATIVE_UINT:
-                    buffer->data.asUint64[pos] = data->value.asUint64;
-                    return DPI_SUCCESS;
-                case DPI_ORACLE_TYPE_NUMBER:
-                    if (var->nativeTypeNum == DPI_NATIVE_TYPE_INT64)
-                        return dpiDataBuffer__toOracleNumberFromInteger(
-                                &data->value, error,
-                                &buffer->data.asNumber[pos]);
-                    return dpiDataBuffer__toOracleNumberFromUnsignedInteger(
-                            &data->value, error, &buffer->data.asNumber[pos]);
-                default:
-                    break;
+            if (oracleTypeNum == DPI_ORACLE_TYPE_NATIVE_INT) {
+                var->getValueProc = dpiVar__getValueNativeInt;
+                var->setValueProc = dpiVar__setValueNativeInt;
+                var->getColumnProc = dpiVar__getColumnNativeInt;
+            } else if (oracleTypeNum == DPI_ORACLE_TYPE_NATIVE_UINT) {
+                var->getValueProc = dpiVar__getValueNativeUint;
+                var->setValueProc = dpiVar__setValueNativeUint;
+                var->getColumnProc = dpiVar__getColumnNativeInt;
+            } else if (oracleTypeNum == DPI_ORACLE_TYPE_NUMBER &&
+                    var->nativeTypeNum == DPI_NATIVE_TYPE_INT64) {
+                var->getValueProc = dpiVar__getValueNumberAsInt64;
+                var->setValueProc = dpiVar__setValueNumberFromInt64;
+                var->getColumnProc = dpiVar__getColumnNumberAsInt64;
+            } else if (oracleTypeNum == DPI_ORACLE_TYPE_NUMBER) {
+                var->getValueProc = dpiVar__getValueNumberAsUint64;
+                var->setValueProc = dpiVar__setValueNumberFromUint64;
             }
             break;
-        case DPI_NATIVE_TYPE_FLOAT:
-            buffer->data.asFloat[pos] = data->value.asFloat;
-            return DPI_SUCCESS;
         case DPI_NATIVE_TYPE_DOUBLE:
             switch (oracleTypeNum) {
-                case DPI_ORACLE_TYPE_NATIVE_DOUBLE:
-                    buffer->data.asDouble[pos] = data->value.asDouble;
-                    return DPI_SUCCESS;
                 case DPI_ORACLE_TYPE_NUMBER:
-                    return dpiDataBuffer__toOracleNumberFromDouble(
-                            &data->value, error, &buffer->data.asNumber[pos]);
+                    var->getValueProc = dpiVar__getValueNumberAsDouble;
+                    var->setValueProc = dpiVar__setValueNumberFromDouble;
+                    var->getColumnProc = dpiVar__getColumnNumberAsDouble;
+                    break;
+                case DPI_ORACLE_TYPE_NATIVE_DOUBLE:
+                    var->getValueProc = dpiVar__getValueNativeDouble;
+                    var->setValueProc = dpiVar__setValueNativeDouble;
+                    var->getColumnProc = dpiVar__getColumnNativeDouble;
+                    break;
                 case DPI_ORACLE_TYPE_DATE:
-                    return dpiDataBuffer__toOracleDateFromDouble(
-                            &data->value, var->env, error,
-                            &buffer->data.asDate[pos]);
+                    var->getValueProc = dpiVar__getValueDateAsDouble;
+                    var->setValueProc = dpiVar__setValueDateFromDouble;
+                    break;
                 case DPI_ORACLE_TYPE_TIMESTAMP:
                 case DPI_ORACLE_TYPE_TIMESTAMP_TZ:
                 case DPI_ORACLE_TYPE_TIMESTAMP_LTZ:
-                    return dpiDataBuffer__toOracleTimestampFromDouble(
-                            &data->value, oracleTypeNum, var->env, error,
-                            buffer->data.asTimestamp[pos]);
+                    var->getValueProc = dpiVar__getValueTimestampAsDouble;
+                    var->setValueProc = dpiVar__setValueTimestampFromDouble;
+                    break;
                 default:
                     break;
             }
             break;
         case DPI_NATIVE_TYPE_BYTES:
-            if (oracleTypeNum == DPI_ORACLE_TYPE_NUMBER)
-                return dpiDataBuffer__toOracleNumberFromText(&data->value,
-                        var->env, error, &buffer->data.asNumber[pos]);
-            if (buffer->actualLength)
-                buffer->actualLength[pos] = data->value.asBytes.length;
-            if (buffer->returnCode)
-                buffer->returnCode[pos] = 0;
+            switch (oracleTypeNum) {
+                case DPI_ORACLE_TYPE_VARCHAR:
+                case DPI_ORACLE_TYPE_NVARCHAR:
+                case DPI_ORACLE_TYPE_CHAR:
+                case DPI_ORACLE_TYPE_NCHAR:
+                case DPI_ORACLE_TYPE_ROWID:
+                case DPI_ORACLE_TYPE_RAW:
+                case DPI_ORACLE_TYPE_LONG_VARCHAR:
+                case DPI_ORACLE_TYPE_LONG_NVARCHAR:
+                case DPI_ORACLE_TYPE_LONG_RAW:
+                case DPI_ORACLE_TYPE_XMLTYPE:
+                    if (var->isDynamic) {
+                        var->getValueProc = dpiVar__getValueDynamicBytes;
+                    } else {
+                        var->getValueProc = dpiVar__getValueBytes;
+                        var->getColumnProc = dpiVar__getColumnBytes;
+                    }
+                    var->setValueProc = dpiVar__setValueBytes;
+                    break;
+                case DPI_ORACLE_TYPE_CLOB:
+                case DPI_ORACLE_TYPE_NCLOB:
+                case DPI_ORACLE_TYPE_BLOB:
+                case DPI_ORACLE_TYPE_BFILE:
+                    var->getValueProc = dpiVar__getValueLobAsBytes;
+                    var->setValueProc = dpiVar__setValueBytes;
+                    break;
+                case DPI_ORACLE_TYPE_NUMBER:
+                    var->getValueProc = dpiVar__getValueNumberAsBytes;
+                    var->setValueProc = dpiVar__setValueNumberFromBytes;
+                    break;
+                default:
+                    var->setValueProc = dpiVar__setValueBytes;
+                    break;
+            }
+            break;
+        case DPI_NATIVE_TYPE_FLOAT:
+            var->getValueProc = dpiVar__getValueFloat;
+            var->setValueProc = dpiVar__setValueFloat;
+            var->getColumnProc = dpiVar__getColumnFloat;
             break;
         case DPI_NATIVE_TYPE_TIMESTAMP:
-            if (oracleTypeNum == DPI_ORACLE_TYPE_DATE)
-                return dpiDataBuffer__toOracleDate(&data->value,
-                        &buffer->data.asDate[pos]);
-            else if (oracleTypeNum == DPI_ORACLE_TYPE_TIMESTAMP)
-                return dpiDataBuffer__toOracleTimestamp(&data->value,
-                        var->env, error, buffer->data.asTimestamp[pos], 0);
-            else if (oracleTypeNum == DPI_ORACLE_TYPE_TIMESTAMP_TZ ||
-                    oracleTypeNum == DPI_ORACLE_TYPE_TIMESTAMP_LTZ)
-                return dpiDataBuffer__toOracleTimestamp(&data->value,
-                        var->env, error, buffer->data.asTimestamp[pos], 1);
+            if (oracleTypeNum == DPI_ORACLE_TYPE_DATE) {
+                var->getValueProc = dpiVar__getValueDate;
+                var->setValueProc = dpiVar__setValueDate;
+            } else if (oracleTypeNum == DPI_ORACLE_TYPE_TIMESTAMP) {
+                var->getValueProc = dpiVar__getValueTimestamp;
+                var->setValueProc = dpiVar__setValueTimestamp;
+            } else {
+                var->getValueProc = dpiVar__getValueTimestampTZ;
+                if (oracleTypeNum == DPI_ORACLE_TYPE_TIMESTAMP_TZ ||
+                        oracleTypeNum == DPI_ORACLE_TYPE_TIMESTAMP_LTZ)
+                    var->setValueProc = dpiVar__setValueTimestampTZ;
+            }
             break;
         case DPI_NATIVE_TYPE_INTERVAL_DS:
-            return dpiDataBuffer__toOracleIntervalDS(&data->value, var->env,
-                    error, buffer->data.asInterval[pos]);
+            var->getValueProc = dpiVar__getValueIntervalDS;
+            var->setValueProc = dpiVar__setValueIntervalDS;
+            break;
         case DPI_NATIVE_TYPE_INTERVAL_YM:
-            return dpiDataBuffer__toOracleIntervalYM(&data->value, var->env,
-                    error, buffer->data.asInterval[pos]);
-        case DPI_NATIVE_TYPE_BOOLEAN:
-            buffer->data.asBoolean[pos] = data->value.asBoolean;
-            return DPI_SUCCESS;
+            var->getValueProc = dpiVar__getValueIntervalYM;
+            var->setValueProc = dpiVar__setValueIntervalYM;
+            break;
+        case DPI_NATIVE_TYPE_OBJECT:
+            var->getValueProc = dpiVar__getValueObject;
+            var->getColumnProc = dpiVar__getColumnGeneric;
+            break;
         case DPI_NATIVE_TYPE_STMT:
-            return dpiOci__attrSet(data->value.asStmt->handle,
-                    DPI_OCI_HTYPE_STMT, &data->value.asStmt->prefetchRows,
-                    sizeof(data->value.asStmt->prefetchRows),
-                    DPI_OCI_ATTR_PREFETCH_ROWS,
-                    "set prefetch rows for REF cursor", error);
+            var->getValueProc = dpiVar__getValueStmt;
+            var->setValueProc = dpiVar__setValueStmt;
+            break;
+        case DPI_NATIVE_TYPE_BOOLEAN:
+            var->getValueProc = dpiVar__getValueBoolean;
+            var->setValueProc = dpiVar__setValueBoolean;
+            var->getColumnProc = dpiVar__getColumnBoolean;
+            break;
         default:
             break;
     }
-    return DPI_SUCCESS;
+
+    // all other columns are transferred by calling the value converter for
+    // each row; object indicators require the full checks
+    if (!var->getColumnProc)
+        var->getColumnProc = (var->objectType) ? dpiVar__getColumnGeneric :
+                dpiVar__getColumnScalar;
 }
 
 
@@ -1672,6 +2581,90 @@ static int dpiVar__validateTypes(const dpiOracleType *oracleType,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar__writeLobValues() [INTERNAL]
+//   Write the values found in the array of dynamic bytes structures to the
+// LOBs at the same positions in the variable in a single round trip. Unless
+// the LOBs are known to be empty, each of them is first trimmed (which creates
+// a temporary LOB, if needed). Once written, the values are discarded.
+//-----------------------------------------------------------------------------
+static int dpiVar__writeLobValues(dpiVar *var, dpiDynamicBytes *values,
+        int lobsAreEmpty, dpiError *error)
+{
+    uint32_t i, numLobs = 0;
+    dpiDynamicBytes *dynBytes;
+    uint64_t *valueLengths;
+    const char **ptrs;
+    dpiLob **lobs;
+    int status;
+
+    // clear the LOBs, if needed, and determine how many have values to write
+    for (i = 0; i < var->buffer.maxArraySize; i++) {
+        dynBytes = &values[i];
+        if (dynBytes->numChunks == 0)
+            continue;
+        if (!lobsAreEmpty && dpiOci__lobTrim2(var->buffer.references[i].asLOB,
+                0, error) < 0)
+            return DPI_FAILURE;
+        if (dynBytes->chunks->length > 0)
+            numLobs++;
+    }
+
+    // write the values to the LOBs
+    if (numLobs > 0) {
+        if (dpiUtils__allocateMemory(2 * (size_t) numLobs, sizeof(void*), 0,
+                "allocate LOB values", (void**) &lobs, error) < 0)
+            return DPI_FAILURE;
+        if (dpiUtils__allocateMemory(numLobs, sizeof(uint64_t), 0,
+                "allocate LOB value lengths", (void**) &valueLengths,
+                error) < 0) {
+            dpiUtils__freeMemory(lobs);
+            return DPI_FAILURE;
+        }
+        ptrs = (const char**) (lobs + numLobs);
+        numLobs = 0;
+        for (i = 0; i < var->buffer.maxArraySize; i++) {
+            dynBytes = &values[i];
+            if (dynBytes->numChunks == 0 || dynBytes->chunks->length == 0)
+                continue;
+            lobs[numLobs] = var->buffer.references[i].asLOB;
+            ptrs[numLobs] = dynBytes->chunks->ptr;
+            valueLengths[numLobs++] = dynBytes->chunks->length;
+        }
+        status = dpiLob__writeArray(var->conn, numLobs, lobs, NULL, ptrs,
+                valueLengths, NULL, error);
+        dpiUtils__freeMemory(valueLengths);
+        dpiUtils__freeMemory(lobs);
+        if (status < 0)
+            return DPI_FAILURE;
+    }
+
+    // discard the values that were written
+    for (i = 0; i < var->buffer.maxArraySize; i++)
+        values[i].numChunks = 0;
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__writePendingLobValues() [INTERNAL]
+//   Write any values set on the variable that have not yet been written to the
+// LOBs used internally by the variable. This is called before the statement
+// to which the variable is bound is executed.
+//-----------------------------------------------------------------------------
+int dpiVar__writePendingLobValues(dpiVar *var, dpiError *error)
+{
+    if (var->buffer.numPendingLobValues == 0)
+        return DPI_SUCCESS;
+    if (dpiVar__writeLobValues(var, var->buffer.pendingLobValues, 0,
+            error) < 0)
+        return DPI_FAILURE;
+    var->buffer.numPendingLobValues = 0;
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar_addRef() [PUBLIC]
 //   Add a reference to the variable.
@@ -1823,6 +2816,32 @@ int dpiVar_setFromBytes(dpiVar *var, uint32_t pos, const char *value,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar_setFromCallback() [PUBLIC]
+//   Set the value of the variable at the given array position to be streamed
+// from the callback when the statement is executed, without the value ever
+// being held in memory in its entirety. Only variables that are bound
+// dynamically can stream values.
+//-----------------------------------------------------------------------------
+int dpiVar_setFromCallback(dpiVar *var, uint32_t pos,
+        dpiReadCallback callback, void *context)
+{
+    dpiError error;
+    int status;
+
+    if (dpiVar__checkArraySize(var, pos, __func__, &error) < 0)
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+    if (var->nativeTypeNum != DPI_NATIVE_TYPE_BYTES || !var->isDynamic ||
+            var->isArray) {
+        dpiError__set(&error, "check variable", DPI_ERR_STREAM_NOT_SUPPORTED,
+                DPI_MAX_BASIC_BUFFER_SIZE);
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+    }
+    status = dpiVar__setFromCallback(var, pos, callback, context, &error);
+    return dpiGen__endPublicFn(var, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar_setFromJson() [PUBLIC]
 //  Set the value of the variable at the given position from a JSON value.
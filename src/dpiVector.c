@@ -86,7 +86,7 @@ void dpiVector__free(dpiVector *vector, dpiError *error)
         vector->conn = NULL;
     }
     dpiVector__clearDimensions(vector);
-    dpiUtils__freeMemory(vector);
+    dpiGen__free(vector);
 }
 
 
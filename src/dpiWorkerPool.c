@@ -0,0 +1,263 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// dpiWorkerPool.c
+//   Implementation of a small pool of threads used to split independent
+// pieces of work (such as the conversion of the columns of a fetched batch of
+// rows) across multiple processors. The calling thread also performs tasks and
+// does not return until all of them are complete. Only one job may be in
+// progress at a time; if the pool is busy, the tasks are simply performed by
+// the calling thread.
+//-----------------------------------------------------------------------------
+
+#include "dpiImpl.h"
+
+
+//-----------------------------------------------------------------------------
+// dpiWorkerPool__work() [INTERNAL]
+//   Perform tasks from the current job until none remain or one of them
+// fails. The first failure is recorded in the pool so that it can be returned
+// to the caller.
+//-----------------------------------------------------------------------------
+static void dpiWorkerPool__work(dpiWorkerPool *pool, dpiError *error)
+{
+    uint32_t taskNum;
+
+    while (1) {
+        dpiMutex__acquire(pool->mutex);
+        if (pool->status < 0 || pool->nextTask >= pool->numTasks) {
+            dpiMutex__release(pool->mutex);
+            break;
+        }
+        taskNum = pool->nextTask++;
+        dpiMutex__release(pool->mutex);
+        if ((*pool->taskProc)(pool->taskContext, taskNum, error) < 0) {
+            dpiMutex__acquire(pool->mutex);
+            if (pool->status == DPI_SUCCESS) {
+                pool->status = DPI_FAILURE;
+                memcpy(&pool->errorBuffer, error->buffer,
+                        sizeof(dpiErrorBuffer));
+            }
+            dpiMutex__release(pool->mutex);
+            break;
+        }
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiWorkerPool__threadMain() [INTERNAL]
+//   Main routine for each thread in the pool. The thread waits for a job to
+// be started, performs tasks from it and then waits for the next job. Each
+// thread uses its own error buffer and OCI error handle; the handle is
+// acquired only if a task needs it and is returned when the job is complete.
+//-----------------------------------------------------------------------------
+#ifdef _WIN32
+static DWORD WINAPI dpiWorkerPool__threadMain(LPVOID arg)
+#else
+static void *dpiWorkerPool__threadMain(void *arg)
+#endif
+{
+    dpiWorkerPool *pool = (dpiWorkerPool*) arg;
+    dpiErrorBuffer errorBuffer;
+    uint64_t lastJobNum = 0;
+    dpiError error;
+
+    error.buffer = &errorBuffer;
+    dpiMutex__acquire(pool->mutex);
+    while (1) {
+        while (!pool->shutdown && pool->jobNum == lastJobNum)
+            dpiCond__wait(pool->workAvailable, pool->mutex);
+        if (pool->shutdown)
+            break;
+        lastJobNum = pool->jobNum;
+        error.env = pool->env;
+        error.handle = NULL;
+        dpiMutex__release(pool->mutex);
+        dpiWorkerPool__work(pool, &error);
+        if (error.handle)
+            dpiHandlePool__release(error.env->errorHandles, &error.handle);
+        dpiMutex__acquire(pool->mutex);
+        if (--pool->numWorking == 0)
+            dpiCond__broadcast(pool->workCompleted);
+    }
+    dpiMutex__release(pool->mutex);
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiWorkerPool__stop() [INTERNAL]
+//   Signal the first numThreads threads in the pool to stop and wait for them
+// to terminate.
+//-----------------------------------------------------------------------------
+static void dpiWorkerPool__stop(dpiWorkerPool *pool, uint32_t numThreads)
+{
+    uint32_t i;
+
+    dpiMutex__acquire(pool->mutex);
+    pool->shutdown = 1;
+    dpiCond__broadcast(pool->workAvailable);
+    dpiMutex__release(pool->mutex);
+    for (i = 0; i < numThreads; i++) {
+#ifdef _WIN32
+        WaitForSingleObject(pool->threads[i], INFINITE);
+        CloseHandle(pool->threads[i]);
+#else
+        pthread_join(pool->threads[i], NULL);
+#endif
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiWorkerPool__create() [INTERNAL]
+//   Create a new worker pool with the specified number of threads.
+//-----------------------------------------------------------------------------
+int dpiWorkerPool__create(dpiWorkerPool **pool, uint32_t numThreads,
+        dpiError *error)
+{
+    dpiWorkerPool *tempPool;
+    uint32_t i;
+
+    // allocate memory for the pool and its threads
+    if (dpiUtils__allocateMemory(1, sizeof(dpiWorkerPool), 1,
+            "allocate worker pool", (void**) &tempPool, error) < 0)
+        return DPI_FAILURE;
+    if (dpiUtils__allocateMemory(numThreads, sizeof(dpiThreadType), 1,
+            "allocate worker pool threads", (void**) &tempPool->threads,
+            error) < 0) {
+        dpiUtils__freeMemory(tempPool);
+        return DPI_FAILURE;
+    }
+    dpiMutex__initialize(tempPool->mutex);
+    dpiCond__initialize(tempPool->workAvailable);
+    dpiCond__initialize(tempPool->workCompleted);
+
+    // start the threads; if any of them cannot be started, stop the ones that
+    // were started and raise an error
+    for (i = 0; i < numThreads; i++) {
+#ifdef _WIN32
+        tempPool->threads[i] = CreateThread(NULL, 0,
+                dpiWorkerPool__threadMain, tempPool, 0, NULL);
+        if (!tempPool->threads[i])
+            break;
+#else
+        if (pthread_create(&tempPool->threads[i], NULL,
+                dpiWorkerPool__threadMain, tempPool) != 0)
+            break;
+#endif
+    }
+    if (i < numThreads) {
+        dpiWorkerPool__stop(tempPool, i);
+        tempPool->numThreads = 0;
+        dpiWorkerPool__free(tempPool);
+        return dpiError__set(error, "start worker pool threads",
+                DPI_ERR_OS, "unable to start thread");
+    }
+
+    tempPool->numThreads = numThreads;
+    *pool = tempPool;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiWorkerPool__free() [INTERNAL]
+//   Stop the threads in the pool and free the memory associated with it.
+//-----------------------------------------------------------------------------
+void dpiWorkerPool__free(dpiWorkerPool *pool)
+{
+    if (pool->numThreads > 0)
+        dpiWorkerPool__stop(pool, pool->numThreads);
+    dpiCond__destroy(pool->workAvailable);
+    dpiCond__destroy(pool->workCompleted);
+    dpiMutex__destroy(pool->mutex);
+    dpiUtils__freeMemory(pool->threads);
+    dpiUtils__freeMemory(pool);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiWorkerPool__run() [INTERNAL]
+//   Perform the specified number of tasks using the threads in the pool and
+// the calling thread, and wait for all of them to complete. If another job is
+// already in progress, all of the tasks are performed by the calling thread.
+// If any task fails, the error raised by the first failing task is returned
+// and tasks that have not yet started are skipped.
+//-----------------------------------------------------------------------------
+int dpiWorkerPool__run(dpiWorkerPool *pool, dpiEnv *env, uint32_t numTasks,
+        dpiWorkerPoolTaskProc taskProc, void *taskContext, dpiError *error)
+{
+    dpiErrorBuffer localErrorBuffer;
+    dpiError localError;
+    uint32_t i;
+    int status;
+
+    // if the pool is busy, perform the tasks directly
+    dpiMutex__acquire(pool->mutex);
+    if (pool->busy) {
+        dpiMutex__release(pool->mutex);
+        for (i = 0; i < numTasks; i++) {
+            if ((*taskProc)(taskContext, i, error) < 0)
+                return DPI_FAILURE;
+        }
+        return DPI_SUCCESS;
+    }
+
+    // start the job and wake up the threads
+    pool->busy = 1;
+    pool->jobNum++;
+    pool->numWorking = pool->numThreads;
+    pool->taskProc = taskProc;
+    pool->taskContext = taskContext;
+    pool->numTasks = numTasks;
+    pool->nextTask = 0;
+    pool->env = env;
+    pool->status = DPI_SUCCESS;
+    dpiCond__broadcast(pool->workAvailable);
+    dpiMutex__release(pool->mutex);
+
+    // perform tasks on this thread as well; a separate error buffer is used
+    // so that the error of the first failing task is the one returned
+    localError.buffer = &localErrorBuffer;
+    localError.handle = error->handle;
+    localError.env = error->env;
+    dpiWorkerPool__work(pool, &localError);
+    error->handle = localError.handle;
+
+    // wait for the threads to complete the job
+    dpiMutex__acquire(pool->mutex);
+    while (pool->numWorking > 0)
+        dpiCond__wait(pool->workCompleted, pool->mutex);
+    status = pool->status;
+    if (status < 0)
+        memcpy(error->buffer, &pool->errorBuffer, sizeof(dpiErrorBuffer));
+    pool->busy = 0;
+    dpiMutex__release(pool->mutex);
+
+    return status;
+}
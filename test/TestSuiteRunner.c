@@ -39,7 +39,7 @@
 extern char **environ;
 #endif
 
-#define NUM_EXECUTABLES                 36
+#define NUM_EXECUTABLES                 38
 
 static const char *dpiTestNames[NUM_EXECUTABLES] = {
     "test_1000_context",
@@ -77,7 +77,9 @@ static const char *dpiTestNames[NUM_EXECUTABLES] = {
     "test_4200_rowids",
     "test_4300_json",
     "test_4400_vector",
-    "test_4500_sessionless_txn"
+    "test_4500_sessionless_txn",
+    "test_4600_oci_attr_cache",
+    "test_4700_sql_normalizer"
 };
 
 
@@ -82,6 +82,8 @@ grant select on v_$session to &main_user;
 
 grant select on v_$sql_monitor to &main_user;
 
+grant execute on dbms_flashback to &main_user;
+
 begin
 
     for r in
@@ -202,6 +202,481 @@ int dpiTest_1007(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_1008()
+//   Verify that dpiContext_getMutexStats() either returns error DPI-1089 when
+// the library was not built with DPI_MUTEX_STATS defined or returns
+// consistent statistics for each site.
+//-----------------------------------------------------------------------------
+int dpiTest_1008(dpiTestCase *testCase, dpiTestParams *params)
+{
+    uint32_t numStats, numStatsAvailable, i;
+    dpiMutexStats *stats;
+    dpiErrorInfo errorInfo;
+    dpiContext *context;
+
+    // create context
+    if (dpiContext_createWithParams(DPI_MAJOR_VERSION, DPI_MINOR_VERSION,
+            NULL, &context, &errorInfo) < 0)
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+
+    // if statistics are not enabled, the expected error is raised
+    if (dpiContext_getMutexStats(context, NULL, &numStats) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        dpiContext_destroy(context);
+        return dpiTestCase_expectErrorInfo(testCase, &errorInfo, "DPI-1089:");
+    }
+
+    // otherwise, verify the statistics are consistent
+    if (dpiContext_resetMutexStats(context) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        dpiContext_destroy(context);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+    numStatsAvailable = numStats;
+    stats = calloc(numStatsAvailable + 1, sizeof(dpiMutexStats));
+    if (!stats) {
+        dpiContext_destroy(context);
+        return dpiTestCase_setFailed(testCase, "Out of memory!");
+    }
+    if (dpiContext_getMutexStats(context, stats, &numStats) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        free(stats);
+        dpiContext_destroy(context);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+    if (numStats > numStatsAvailable)
+        numStats = numStatsAvailable;
+    for (i = 0; i < numStats; i++) {
+        if (!stats[i].fileName || !stats[i].mutexName) {
+            free(stats);
+            dpiContext_destroy(context);
+            return dpiTestCase_setFailed(testCase, "missing site name");
+        }
+        if (stats[i].numContended > stats[i].numAcquisitions ||
+                stats[i].p50WaitNs > stats[i].maxWaitNs ||
+                stats[i].p99WaitNs > stats[i].maxWaitNs) {
+            free(stats);
+            dpiContext_destroy(context);
+            return dpiTestCase_setFailed(testCase, "inconsistent statistics");
+        }
+    }
+    free(stats);
+
+    // cleanup
+    if (dpiContext_destroy(context) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1009()
+//   Create a context with all OCI symbols resolved eagerly and verify that
+// dpiContext_getMissingSymbols() returns a list of non-empty names.
+//-----------------------------------------------------------------------------
+int dpiTest_1009(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiContextCreateParams createParams;
+    dpiErrorInfo errorInfo;
+    dpiContext *context;
+    dpiStringList list;
+    uint32_t i;
+
+    // create context
+    memset(&createParams, 0, sizeof(createParams));
+    createParams.loadAllSymbols = 1;
+    if (dpiContext_createWithParams(DPI_MAJOR_VERSION, DPI_MINOR_VERSION,
+            &createParams, &context, &errorInfo) < 0)
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+
+    // verify the list of missing symbols
+    if (dpiContext_getMissingSymbols(context, &list) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        dpiContext_destroy(context);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+    for (i = 0; i < list.numStrings; i++) {
+        if (list.stringLengths[i] == 0) {
+            dpiContext_freeStringList(context, &list);
+            dpiContext_destroy(context);
+            return dpiTestCase_setFailed(testCase, "empty symbol name");
+        }
+    }
+    if (dpiContext_freeStringList(context, &list) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        dpiContext_destroy(context);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+
+    // cleanup
+    if (dpiContext_destroy(context) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1010()
+//   Call dpiContext_getSqlProfile() on a context created without the SQL
+// profiler enabled (error DPI-1090).
+//-----------------------------------------------------------------------------
+int dpiTest_1010(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiErrorInfo errorInfo;
+    dpiContext *context;
+    uint32_t numInfo;
+
+    if (dpiContext_createWithParams(DPI_MAJOR_VERSION, DPI_MINOR_VERSION,
+            NULL, &context, &errorInfo) < 0)
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    dpiContext_getSqlProfile(context, NULL, &numInfo);
+    dpiContext_getError(context, &errorInfo);
+    dpiContext_destroy(context);
+    return dpiTestCase_expectErrorInfo(testCase, &errorInfo, "DPI-1090:");
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1011()
+//   Create a context with the SQL profiler enabled, execute the same query
+// twice with differing whitespace and verify that a single entry is returned
+// by dpiContext_getSqlProfile() with the expected statistics (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_1011(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql[2] = {
+        "select 1 from dual union all select 2 from dual",
+        "select 1  from dual\n union all select 2 from dual"
+    };
+    uint32_t numQueryColumns, bufferRowIndex, numInfo, i;
+    dpiContextCreateParams createParams;
+    dpiSqlProfileInfo info;
+    dpiErrorInfo errorInfo;
+    dpiContext *context;
+    dpiStmt *stmt;
+    dpiConn *conn;
+    int found;
+
+    // create context with SQL profiler enabled
+    memset(&createParams, 0, sizeof(createParams));
+    createParams.enableSqlProfiler = 1;
+    if (dpiContext_createWithParams(DPI_MAJOR_VERSION, DPI_MINOR_VERSION,
+            &createParams, &context, &errorInfo) < 0)
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    if (dpiConn_create(context, params->mainUserName,
+            params->mainUserNameLength, params->mainPassword,
+            params->mainPasswordLength, params->connectString,
+            params->connectStringLength, NULL, NULL, &conn) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        dpiContext_destroy(context);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+
+    // execute each variant of the query and fetch all of the rows
+    for (i = 0; i < 2; i++) {
+        if (dpiConn_prepareStmt(conn, 0, sql[i], (uint32_t) strlen(sql[i]),
+                NULL, 0, &stmt) < 0)
+            break;
+        if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT,
+                &numQueryColumns) < 0) {
+            dpiStmt_release(stmt);
+            break;
+        }
+        found = 1;
+        while (found) {
+            if (dpiStmt_fetch(stmt, &found, &bufferRowIndex) < 0)
+                break;
+        }
+        dpiStmt_release(stmt);
+        if (found)
+            break;
+    }
+    if (i < 2) {
+        dpiContext_getError(context, &errorInfo);
+        dpiConn_release(conn);
+        dpiContext_destroy(context);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+
+    // verify the statistics
+    numInfo = 1;
+    if (dpiContext_getSqlProfile(context, &info, &numInfo) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        dpiConn_release(conn);
+        dpiContext_destroy(context);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+    if (dpiTestCase_expectUintEqual(testCase, numInfo, 1) < 0 ||
+            dpiTestCase_expectStringEqual(testCase, info.sql, info.sqlLength,
+                    sql[0], strlen(sql[0])) < 0 ||
+            dpiTestCase_expectUintEqual(testCase, info.numPrepares, 2) < 0 ||
+            dpiTestCase_expectUintEqual(testCase, info.numExecutions, 2) < 0 ||
+            dpiTestCase_expectUintEqual(testCase, info.numRows, 4) < 0) {
+        dpiConn_release(conn);
+        dpiContext_destroy(context);
+        return DPI_FAILURE;
+    }
+
+    // verify the statistics are reset
+    if (dpiContext_resetSqlProfile(context) < 0 ||
+            dpiContext_getSqlProfile(context, &info, &numInfo) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        dpiConn_release(conn);
+        dpiContext_destroy(context);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+    if (dpiTestCase_expectUintEqual(testCase, info.numExecutions, 0) < 0) {
+        dpiConn_release(conn);
+        dpiContext_destroy(context);
+        return DPI_FAILURE;
+    }
+
+    // cleanup
+    dpiConn_release(conn);
+    if (dpiContext_destroy(context) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1012()
+//   Create a context with handle tracking enabled, prepare a statement and
+// verify that it is reported by dpiContext_getHandleCounts() and
+// dpiContext_getLiveHandles() until it is released (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_1012(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql = "select 1 from dual";
+    dpiContextCreateParams createParams;
+    dpiHandleTypeCount counts[32];
+    uint32_t numCounts, numInfo, i;
+    uint64_t numLiveBefore = 0;
+    dpiLiveHandleInfo info[64];
+    dpiErrorInfo errorInfo;
+    dpiContext *context;
+    dpiStmt *stmt;
+    dpiConn *conn;
+
+    // create context with handle tracking enabled and a connection
+    memset(&createParams, 0, sizeof(createParams));
+    createParams.enableHandleTracking = 1;
+    if (dpiContext_createWithParams(DPI_MAJOR_VERSION, DPI_MINOR_VERSION,
+            &createParams, &context, &errorInfo) < 0)
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    if (dpiConn_create(context, params->mainUserName,
+            params->mainUserNameLength, params->mainPassword,
+            params->mainPasswordLength, params->connectString,
+            params->connectStringLength, NULL, NULL, &conn) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        dpiContext_destroy(context);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+
+    // prepare a statement and verify it is tracked
+    if (dpiConn_prepareStmt(conn, 0, sql, (uint32_t) strlen(sql), NULL, 0,
+            &stmt) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        dpiConn_release(conn);
+        dpiContext_destroy(context);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+    numInfo = 64;
+    if (dpiContext_getLiveHandles(context, info, &numInfo) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        dpiStmt_release(stmt);
+        dpiConn_release(conn);
+        dpiContext_destroy(context);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+    for (i = 0; i < numInfo && i < 64; i++) {
+        if (info[i].handle == stmt)
+            break;
+    }
+    if (i == numInfo || i == 64) {
+        dpiStmt_release(stmt);
+        dpiConn_release(conn);
+        dpiContext_destroy(context);
+        return dpiTestCase_setFailed(testCase, "statement not tracked");
+    }
+    if (dpiTestCase_expectStringEqual(testCase, info[i].fnName,
+            (uint32_t) strlen(info[i].fnName), "dpiConn_prepareStmt",
+            19) < 0) {
+        dpiStmt_release(stmt);
+        dpiConn_release(conn);
+        dpiContext_destroy(context);
+        return DPI_FAILURE;
+    }
+    numCounts = 32;
+    if (dpiContext_getHandleCounts(context, counts, &numCounts) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        dpiStmt_release(stmt);
+        dpiConn_release(conn);
+        dpiContext_destroy(context);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+    for (i = 0; i < numCounts && i < 32; i++) {
+        if (strcmp(counts[i].typeName, "dpiStmt") == 0)
+            numLiveBefore = counts[i].numLive;
+    }
+
+    // release the statement and verify the count of live statements drops
+    dpiStmt_release(stmt);
+    numCounts = 32;
+    if (dpiContext_getHandleCounts(context, counts, &numCounts) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        dpiConn_release(conn);
+        dpiContext_destroy(context);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+    for (i = 0; i < numCounts && i < 32; i++) {
+        if (strcmp(counts[i].typeName, "dpiStmt") == 0 &&
+                dpiTestCase_expectUintEqual(testCase, counts[i].numLive,
+                        numLiveBefore - 1) < 0) {
+            dpiConn_release(conn);
+            dpiContext_destroy(context);
+            return DPI_FAILURE;
+        }
+    }
+
+    // cleanup
+    dpiConn_release(conn);
+    if (dpiContext_destroy(context) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1013()
+//   Call dpiContext_getSqlNormalizerInfo() on a context created without the
+// SQL normalizer enabled (error DPI-1104).
+//-----------------------------------------------------------------------------
+int dpiTest_1013(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiSqlNormalizerInfo info;
+    dpiErrorInfo errorInfo;
+    dpiContext *context;
+
+    if (dpiContext_createWithParams(DPI_MAJOR_VERSION, DPI_MINOR_VERSION,
+            NULL, &context, &errorInfo) < 0)
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    dpiContext_getSqlNormalizerInfo(context, &info);
+    dpiContext_getError(context, &errorInfo);
+    dpiContext_destroy(context);
+    return dpiTestCase_expectErrorInfo(testCase, &errorInfo, "DPI-1104:");
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1014()
+//   Create a context with the SQL normalizer enabled, execute two queries
+// which differ only in their literals and verify that the correct values are
+// fetched and that the second query is found in the statement cache (no
+// error).
+//-----------------------------------------------------------------------------
+int dpiTest_1014(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql[2] = {
+        "select IntCol from TestNumbers where IntCol = 7 and 'a' = 'a'",
+        "select IntCol from TestNumbers where IntCol = 8 and 'bc' = 'bc'"
+    };
+    uint32_t numQueryColumns, bufferRowIndex, i;
+    dpiContextCreateParams createParams;
+    dpiNativeTypeNum nativeTypeNum;
+    dpiSqlNormalizerInfo info;
+    dpiErrorInfo errorInfo;
+    dpiContext *context;
+    dpiData *data;
+    dpiStmt *stmt;
+    dpiConn *conn;
+    int found;
+
+    // create context with SQL normalizer enabled
+    memset(&createParams, 0, sizeof(createParams));
+    createParams.enableSqlNormalizer = 1;
+    if (dpiContext_createWithParams(DPI_MAJOR_VERSION, DPI_MINOR_VERSION,
+            &createParams, &context, &errorInfo) < 0)
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    if (dpiConn_create(context, params->mainUserName,
+            params->mainUserNameLength, params->mainPassword,
+            params->mainPasswordLength, params->connectString,
+            params->connectStringLength, NULL, NULL, &conn) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        dpiContext_destroy(context);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+
+    // execute each query and verify the value fetched
+    for (i = 0; i < 2; i++) {
+        if (dpiConn_prepareStmt(conn, 0, sql[i], (uint32_t) strlen(sql[i]),
+                NULL, 0, &stmt) < 0)
+            break;
+        if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT,
+                &numQueryColumns) < 0 ||
+                dpiStmt_fetch(stmt, &found, &bufferRowIndex) < 0 ||
+                dpiStmt_getQueryValue(stmt, 1, &nativeTypeNum, &data) < 0) {
+            dpiStmt_release(stmt);
+            break;
+        }
+        dpiStmt_release(stmt);
+        if (dpiTestCase_expectIntEqual(testCase, found, 1) < 0 ||
+                dpiTestCase_expectDoubleEqual(testCase,
+                        data->value.asDouble, 7 + i) < 0) {
+            dpiConn_release(conn);
+            dpiContext_destroy(context);
+            return DPI_FAILURE;
+        }
+    }
+    if (i < 2) {
+        dpiContext_getError(context, &errorInfo);
+        dpiConn_release(conn);
+        dpiContext_destroy(context);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+
+    // verify the statistics
+    if (dpiContext_getSqlNormalizerInfo(context, &info) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        dpiConn_release(conn);
+        dpiContext_destroy(context);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+    if (dpiTestCase_expectUintEqual(testCase, info.numPrepares, 2) < 0 ||
+            dpiTestCase_expectUintEqual(testCase, info.numNormalized, 2) < 0 ||
+            dpiTestCase_expectUintEqual(testCase, info.numLiterals, 6) < 0 ||
+            dpiTestCase_expectUintEqual(testCase, info.numCacheHits, 1) < 0 ||
+            dpiTestCase_expectUintEqual(testCase, info.numCacheMisses,
+                    1) < 0) {
+        dpiConn_release(conn);
+        dpiContext_destroy(context);
+        return DPI_FAILURE;
+    }
+
+    // cleanup
+    dpiConn_release(conn);
+    if (dpiContext_destroy(context) < 0) {
+        dpiContext_getError(context, &errorInfo);
+        return dpiTestCase_setFailedFromErrorInfo(testCase, &errorInfo);
+    }
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -224,5 +699,19 @@ int main(int argc, char **argv)
             "dpiContext_createWithParams() with creation parameters");
     dpiTestSuite_addCase(dpiTest_1007,
             "dpiContext_createWithParams() twice");
+    dpiTestSuite_addCase(dpiTest_1008,
+            "dpiContext_getMutexStats() returns consistent statistics");
+    dpiTestSuite_addCase(dpiTest_1009,
+            "create context with all OCI symbols resolved eagerly");
+    dpiTestSuite_addCase(dpiTest_1010,
+            "dpiContext_getSqlProfile() without SQL profiler enabled");
+    dpiTestSuite_addCase(dpiTest_1011,
+            "dpiContext_getSqlProfile() aggregates by normalized SQL");
+    dpiTestSuite_addCase(dpiTest_1012,
+            "dpiContext_getLiveHandles() reports prepared statement");
+    dpiTestSuite_addCase(dpiTest_1013,
+            "dpiContext_getSqlNormalizerInfo() without normalizer enabled");
+    dpiTestSuite_addCase(dpiTest_1014,
+            "queries differing only in literals share a cached statement");
     return dpiTestSuite_run();
 }
@@ -164,6 +164,95 @@ static int dpiTest__acquireAndVerifySession(dpiTestCase *testCase,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest__scan() [INTERNAL]
+//   Create a threaded pool and perform a parallel scan with the specified
+// parameters, fetching the column IntCol of the table TestNumbers unless a
+// different table is specified.
+// Verify that the expected number of rows is returned, that the sum of the
+// values matches and, for an ordered scan, that the blocks are returned in the
+// order of the chunks and that all of the values of each chunk are greater
+// than those of the chunks before it.
+//-----------------------------------------------------------------------------
+int dpiTest__scan(dpiTestCase *testCase, dpiTestParams *params,
+        dpiScanCreateParams *scanParams, uint32_t expectedNumRows,
+        int64_t expectedSum)
+{
+    int64_t sum = 0, prevMaxValue = 0, maxValue = 0, value;
+    uint32_t i, numRows, totalNumRows = 0, chunkNum, prevChunkNum = 0;
+    dpiCommonCreateParams commonParams;
+    dpiNativeTypeNum nativeTypeNum;
+    dpiContext *context;
+    dpiRowBlock *block;
+    dpiData *data;
+    dpiScan *scan;
+    dpiPool *pool;
+
+    // create a threaded pool and the scan
+    dpiTestSuite_getContext(&context);
+    if (dpiContext_initCommonCreateParams(context, &commonParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    commonParams.createMode = DPI_MODE_CREATE_THREADED;
+    if (dpiPool_create(context, params->mainUserName,
+            params->mainUserNameLength, params->mainPassword,
+            params->mainPasswordLength, params->connectString,
+            params->connectStringLength, &commonParams, NULL, &pool) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (!scanParams->tableName)
+        scanParams->tableName = "TESTNUMBERS";
+    scanParams->tableNameLength = (uint32_t) strlen(scanParams->tableName);
+    scanParams->columns = "IntCol";
+    scanParams->columnsLength = (uint32_t) strlen(scanParams->columns);
+    if (dpiPool_createScan(pool, scanParams, &scan) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // fetch all of the blocks produced by the scan
+    while (1) {
+        if (dpiScan_getNext(scan, &block, &chunkNum) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (!block)
+            break;
+        if (dpiRowBlock_getNumRows(block, &numRows) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiRowBlock_getColumnData(block, 1, &nativeTypeNum, &data) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (scanParams->ordered && chunkNum != prevChunkNum) {
+            if (chunkNum < prevChunkNum)
+                return dpiTestCase_setFailed(testCase,
+                        "chunks returned out of order");
+            prevMaxValue = maxValue;
+            prevChunkNum = chunkNum;
+        }
+        for (i = 0; i < numRows; i++) {
+            value = data[i].value.asInt64;
+            if (scanParams->ordered && totalNumRows > 0 &&
+                    value <= prevMaxValue)
+                return dpiTestCase_setFailed(testCase,
+                        "values returned out of order");
+            if (value > maxValue)
+                maxValue = value;
+            sum += value;
+            totalNumRows++;
+        }
+        if (dpiRowBlock_release(block) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiTestCase_expectUintEqual(testCase, totalNumRows,
+            expectedNumRows) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectIntEqual(testCase, sum, expectedSum) < 0)
+        return DPI_FAILURE;
+
+    // cleanup
+    if (dpiScan_release(scan) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiPool_release(pool) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiTest_1400()
 //   Verify that dpiPool_create() succeeds when valid credentials are passed
@@ -972,6 +1061,487 @@ int dpiTest_1423(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest__verifySessionState() [INTERNAL]
+//   Verify that the module, client identifier and date format of the session
+// are the expected values.
+//-----------------------------------------------------------------------------
+static int dpiTest__verifySessionState(dpiTestCase *testCase, dpiConn *conn,
+        const char *expectedModule, const char *expectedClientIdentifier,
+        const char *expectedDate)
+{
+    const char *sql =
+            "select sys_context('userenv', 'module'), "
+            "sys_context('userenv', 'client_identifier'), "
+            "to_char(date '2026-01-02') from dual";
+    const char *expectedValues[3];
+    dpiNativeTypeNum nativeTypeNum;
+    uint32_t bufferRowIndex, i;
+    dpiData *value;
+    dpiStmt *stmt;
+    int found;
+
+    expectedValues[0] = expectedModule;
+    expectedValues[1] = expectedClientIdentifier;
+    expectedValues[2] = expectedDate;
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_fetch(stmt, &found, &bufferRowIndex) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < 3; i++) {
+        if (dpiStmt_getQueryValue(stmt, i + 1, &nativeTypeNum, &value) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiTestCase_expectStringEqual(testCase, value->value.asBytes.ptr,
+                value->value.asBytes.length, expectedValues[i],
+                strlen(expectedValues[i])) < 0)
+            return DPI_FAILURE;
+    }
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1424()
+//   Acquire a connection from a pool with a single session specifying a
+// desired session state and verify it has been applied; release it and
+// acquire it again with a state in which only some values differ and verify
+// that the combined state is in effect (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_1424(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiCommonCreateParams commonParams;
+    dpiPoolCreateParams createParams;
+    dpiConnCreateParams connParams;
+    dpiSessionState sessionState;
+    dpiSessionParam sessionParam;
+    dpiContext *context;
+    dpiPool *pool;
+    dpiConn *conn;
+
+    // create a pool with a single session
+    dpiTestSuite_getContext(&context);
+    if (dpiContext_initCommonCreateParams(context, &commonParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiContext_initPoolCreateParams(context, &createParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    createParams.minSessions = 1;
+    createParams.maxSessions = 1;
+    createParams.sessionIncrement = 0;
+    if (dpiPool_create(context, params->mainUserName,
+            params->mainUserNameLength, params->mainPassword,
+            params->mainPasswordLength, params->connectString,
+            params->connectStringLength, &commonParams, &createParams,
+            &pool) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // acquire a connection with the initial state
+    if (dpiContext_initConnCreateParams(context, &connParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    memset(&sessionState, 0, sizeof(sessionState));
+    sessionState.module = "TEST_MODULE";
+    sessionState.moduleLength = (uint32_t) strlen(sessionState.module);
+    sessionState.clientIdentifier = "TEST_CLIENT_1";
+    sessionState.clientIdentifierLength =
+            (uint32_t) strlen(sessionState.clientIdentifier);
+    sessionParam.name = "NLS_DATE_FORMAT";
+    sessionParam.nameLength = (uint32_t) strlen(sessionParam.name);
+    sessionParam.value = "YYYY-MM-DD";
+    sessionParam.valueLength = (uint32_t) strlen(sessionParam.value);
+    sessionState.params = &sessionParam;
+    sessionState.numParams = 1;
+    connParams.sessionState = &sessionState;
+    if (dpiPool_acquireConnection(pool, NULL, 0, NULL, 0, &connParams,
+            &conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTest__verifySessionState(testCase, conn, "TEST_MODULE",
+            "TEST_CLIENT_1", "2026-01-02") < 0)
+        return DPI_FAILURE;
+    if (dpiConn_release(conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // acquire the same session with only the client identifier changed
+    sessionState.clientIdentifier = "TEST_CLIENT_2";
+    if (dpiPool_acquireConnection(pool, NULL, 0, NULL, 0, &connParams,
+            &conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTest__verifySessionState(testCase, conn, "TEST_MODULE",
+            "TEST_CLIENT_2", "2026-01-02") < 0)
+        return DPI_FAILURE;
+    if (dpiConn_release(conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    if (dpiPool_release(pool) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1425()
+//   Acquire a connection from a pool specifying a desired session state with
+// an invalid session parameter name (error DPI-1098).
+//-----------------------------------------------------------------------------
+int dpiTest_1425(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiConnCreateParams connParams;
+    dpiSessionState sessionState;
+    dpiSessionParam sessionParam;
+    dpiContext *context;
+    dpiPool *pool;
+    dpiConn *conn;
+
+    if (dpiTestCase_getPool(testCase, &pool) < 0)
+        return DPI_FAILURE;
+    dpiTestSuite_getContext(&context);
+    if (dpiContext_initConnCreateParams(context, &connParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    memset(&sessionState, 0, sizeof(sessionState));
+    sessionParam.name = "NLS_DATE_FORMAT = 'YYYY' --";
+    sessionParam.nameLength = (uint32_t) strlen(sessionParam.name);
+    sessionParam.value = "YYYY";
+    sessionParam.valueLength = (uint32_t) strlen(sessionParam.value);
+    sessionState.params = &sessionParam;
+    sessionState.numParams = 1;
+    connParams.sessionState = &sessionState;
+    dpiPool_acquireConnection(pool, NULL, 0, NULL, 0, &connParams, &conn);
+    if (dpiTestCase_expectError(testCase, "DPI-1098:") < 0)
+        return DPI_FAILURE;
+    if (dpiPool_release(pool) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1426()
+//   Call dpiPool_createScan() with an invalid split mode (error DPI-1106).
+//-----------------------------------------------------------------------------
+int dpiTest_1426(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiScanCreateParams scanParams;
+    dpiContext *context;
+    dpiPool *pool;
+    dpiScan *scan;
+
+    if (dpiTestCase_getPool(testCase, &pool) < 0)
+        return DPI_FAILURE;
+    dpiTestSuite_getContext(&context);
+    if (dpiContext_initScanCreateParams(context, &scanParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    scanParams.tableName = "TESTNUMBERS";
+    scanParams.tableNameLength = (uint32_t) strlen(scanParams.tableName);
+    scanParams.splitMode = 99;
+    dpiPool_createScan(pool, &scanParams, &scan);
+    if (dpiTestCase_expectError(testCase, "DPI-1106:") < 0)
+        return DPI_FAILURE;
+    if (dpiPool_release(pool) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1427()
+//   Call dpiPool_createScan() with a pool that was not created in threaded
+// mode (error DPI-1105).
+//-----------------------------------------------------------------------------
+int dpiTest_1427(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiScanCreateParams scanParams;
+    dpiContext *context;
+    dpiPool *pool;
+    dpiScan *scan;
+
+    if (dpiTestCase_getPool(testCase, &pool) < 0)
+        return DPI_FAILURE;
+    dpiTestSuite_getContext(&context);
+    if (dpiContext_initScanCreateParams(context, &scanParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    scanParams.tableName = "TESTNUMBERS";
+    scanParams.tableNameLength = (uint32_t) strlen(scanParams.tableName);
+    dpiPool_createScan(pool, &scanParams, &scan);
+    if (dpiTestCase_expectError(testCase, "DPI-1105:") < 0)
+        return DPI_FAILURE;
+    if (dpiPool_release(pool) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1428()
+//   Call dpiPool_executeUnitOfWork() to insert a row and verify that the row
+// is visible from a standalone connection, which shows that it was committed
+// (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_1428(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *truncateSql = "truncate table TestTempTable";
+    const char *insertSql = "insert into TestTempTable values (:1, :2)";
+    const char *querySql = "select count(*) from TestTempTable";
+    dpiNativeTypeNum nativeTypeNum;
+    dpiUnitOfWorkBind binds[2];
+    uint32_t bufferRowIndex;
+    uint64_t rowCount;
+    dpiUnitOfWork unit;
+    dpiData *data;
+    dpiStmt *stmt;
+    dpiConn *conn;
+    dpiPool *pool;
+    int found;
+
+    // truncate the table
+    if (dpiTestCase_getPool(testCase, &pool) < 0)
+        return DPI_FAILURE;
+    memset(&unit, 0, sizeof(unit));
+    unit.sql = truncateSql;
+    unit.sqlLength = (uint32_t) strlen(truncateSql);
+    if (dpiPool_executeUnitOfWork(pool, &unit, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // insert a row
+    binds[0].nativeTypeNum = DPI_NATIVE_TYPE_INT64;
+    dpiData_setInt64(&binds[0].value, 1);
+    binds[1].nativeTypeNum = DPI_NATIVE_TYPE_BYTES;
+    dpiData_setBytes(&binds[1].value, "String 1", 8);
+    unit.sql = insertSql;
+    unit.sqlLength = (uint32_t) strlen(insertSql);
+    unit.binds = binds;
+    unit.numBinds = 2;
+    if (dpiPool_executeUnitOfWork(pool, &unit, &rowCount) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, rowCount, 1) < 0)
+        return DPI_FAILURE;
+
+    // verify the row was committed
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, querySql, strlen(querySql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_fetch(stmt, &found, &bufferRowIndex) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_getQueryValue(stmt, 1, &nativeTypeNum, &data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectDoubleEqual(testCase, data->value.asDouble, 1) < 0)
+        return DPI_FAILURE;
+
+    // cleanup
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiPool_release(pool) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1429()
+//   Call dpiPool_executeUnitOfWork() with a query (error DPI-1109).
+//-----------------------------------------------------------------------------
+int dpiTest_1429(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql = "select * from TestTempTable";
+    dpiUnitOfWork unit;
+    dpiPool *pool;
+
+    if (dpiTestCase_getPool(testCase, &pool) < 0)
+        return DPI_FAILURE;
+    memset(&unit, 0, sizeof(unit));
+    unit.sql = sql;
+    unit.sqlLength = (uint32_t) strlen(sql);
+    dpiPool_executeUnitOfWork(pool, &unit, NULL);
+    if (dpiTestCase_expectError(testCase, "DPI-1109:") < 0)
+        return DPI_FAILURE;
+    if (dpiPool_release(pool) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1430()
+//   Perform a parallel scan split by rowid and verify that all rows are
+// returned exactly once (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_1430(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiScanCreateParams scanParams;
+    dpiContext *context;
+
+    dpiTestSuite_getContext(&context);
+    if (dpiContext_initScanCreateParams(context, &scanParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    scanParams.splitMode = DPI_SCAN_SPLIT_ROWID;
+    return dpiTest__scan(testCase, params, &scanParams, 10, 55);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1431()
+//   Perform a parallel scan split by partition of a table that is not
+// partitioned and verify that all rows are returned exactly once (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_1431(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiScanCreateParams scanParams;
+    dpiContext *context;
+
+    dpiTestSuite_getContext(&context);
+    if (dpiContext_initScanCreateParams(context, &scanParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    scanParams.splitMode = DPI_SCAN_SPLIT_PARTITION;
+    return dpiTest__scan(testCase, params, &scanParams, 10, 55);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1432()
+//   Perform a parallel scan split by key range using a key column with
+// fractional values and verify that all rows are returned exactly once,
+// including those with the lowest and highest keys (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_1432(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiScanCreateParams scanParams;
+    dpiContext *context;
+
+    dpiTestSuite_getContext(&context);
+    if (dpiContext_initScanCreateParams(context, &scanParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    scanParams.splitMode = DPI_SCAN_SPLIT_KEY_RANGE;
+    scanParams.keyColumn = "NUMBERCOL";
+    scanParams.keyColumnLength = (uint32_t) strlen(scanParams.keyColumn);
+    scanParams.numChunks = 3;
+    return dpiTest__scan(testCase, params, &scanParams, 10, 55);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1433()
+//   Perform a parallel scan split by key range using a key column containing
+// null values and verify that the rows with null keys are also returned (no
+// error).
+//-----------------------------------------------------------------------------
+int dpiTest_1433(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiScanCreateParams scanParams;
+    dpiContext *context;
+
+    dpiTestSuite_getContext(&context);
+    if (dpiContext_initScanCreateParams(context, &scanParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    scanParams.splitMode = DPI_SCAN_SPLIT_KEY_RANGE;
+    scanParams.keyColumn = "NULLABLECOL";
+    scanParams.keyColumnLength = (uint32_t) strlen(scanParams.keyColumn);
+    scanParams.whereClause = "IntCol <= 5";
+    scanParams.whereClauseLength = (uint32_t) strlen(scanParams.whereClause);
+    scanParams.numChunks = 2;
+    return dpiTest__scan(testCase, params, &scanParams, 5, 15);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1434()
+//   Perform an ordered parallel scan split by key range and verify that the
+// blocks are returned in the order of the key ranges of their chunks (no
+// error).
+//-----------------------------------------------------------------------------
+int dpiTest_1434(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiScanCreateParams scanParams;
+    dpiContext *context;
+
+    dpiTestSuite_getContext(&context);
+    if (dpiContext_initScanCreateParams(context, &scanParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    scanParams.splitMode = DPI_SCAN_SPLIT_KEY_RANGE;
+    scanParams.keyColumn = "INTCOL";
+    scanParams.keyColumnLength = (uint32_t) strlen(scanParams.keyColumn);
+    scanParams.numChunks = 4;
+    scanParams.fetchArraySize = 2;
+    scanParams.ordered = 1;
+    return dpiTest__scan(testCase, params, &scanParams, 10, 55);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1435()
+//   Perform a parallel scan split by rowid of an index-organized table, which
+// has no extents of its own, and verify that all rows are returned exactly
+// once (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_1435(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiScanCreateParams scanParams;
+    dpiContext *context;
+
+    dpiTestSuite_getContext(&context);
+    if (dpiContext_initScanCreateParams(context, &scanParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    scanParams.splitMode = DPI_SCAN_SPLIT_ROWID;
+    scanParams.tableName = "TESTORGINDEX";
+    return dpiTest__scan(testCase, params, &scanParams, 30, 465);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1436()
+//   Perform a parallel scan split by rowid of a table whose name is not given
+// in the case in which it is stored in the data dictionary and verify that
+// the error is returned instead of an empty result (error ORA-00942).
+//-----------------------------------------------------------------------------
+int dpiTest_1436(dpiTestCase *testCase, dpiTestParams *params)
+{
+    dpiCommonCreateParams commonParams;
+    dpiScanCreateParams scanParams;
+    dpiContext *context;
+    dpiRowBlock *block;
+    uint32_t chunkNum;
+    dpiScan *scan;
+    dpiPool *pool;
+
+    dpiTestSuite_getContext(&context);
+    if (dpiContext_initCommonCreateParams(context, &commonParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    commonParams.createMode = DPI_MODE_CREATE_THREADED;
+    if (dpiPool_create(context, params->mainUserName,
+            params->mainUserNameLength, params->mainPassword,
+            params->mainPasswordLength, params->connectString,
+            params->connectStringLength, &commonParams, NULL, &pool) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiContext_initScanCreateParams(context, &scanParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    scanParams.splitMode = DPI_SCAN_SPLIT_ROWID;
+    scanParams.tableName = "TestNumbers";
+    scanParams.tableNameLength = (uint32_t) strlen(scanParams.tableName);
+    if (dpiPool_createScan(pool, &scanParams, &scan) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiScan_getNext(scan, &block, &chunkNum);
+    if (dpiTestCase_expectError(testCase, "ORA-00942:") < 0)
+        return DPI_FAILURE;
+    if (dpiScan_release(scan) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiPool_release(pool) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -1026,5 +1596,31 @@ int main(int argc, char **argv)
             "dpiPool_getPingInterval() and dpiPool_setPingInterval()");
     dpiTestSuite_addCase(dpiTest_1423,
             "dpiPool_reconfigure() adjusting max sessions");
+    dpiTestSuite_addCase(dpiTest_1424,
+            "dpiPool_acquireConnection() with desired session state");
+    dpiTestSuite_addCase(dpiTest_1425,
+            "dpiPool_acquireConnection() with invalid session parameter");
+    dpiTestSuite_addCase(dpiTest_1426,
+            "dpiPool_createScan() with invalid split mode");
+    dpiTestSuite_addCase(dpiTest_1427,
+            "dpiPool_createScan() with pool not in threaded mode");
+    dpiTestSuite_addCase(dpiTest_1428,
+            "dpiPool_executeUnitOfWork() with DML and bind values");
+    dpiTestSuite_addCase(dpiTest_1429,
+            "dpiPool_executeUnitOfWork() with a query");
+    dpiTestSuite_addCase(dpiTest_1430,
+            "dpiPool_createScan() split by rowid");
+    dpiTestSuite_addCase(dpiTest_1431,
+            "dpiPool_createScan() split by partition");
+    dpiTestSuite_addCase(dpiTest_1432,
+            "dpiPool_createScan() split by key range with fractional keys");
+    dpiTestSuite_addCase(dpiTest_1433,
+            "dpiPool_createScan() split by key range with null keys");
+    dpiTestSuite_addCase(dpiTest_1434,
+            "dpiPool_createScan() split by key range in order");
+    dpiTestSuite_addCase(dpiTest_1435,
+            "dpiPool_createScan() split by rowid of index-organized table");
+    dpiTestSuite_addCase(dpiTest_1436,
+            "dpiPool_createScan() split by rowid with wrong case table name");
     return dpiTestSuite_run();
 }
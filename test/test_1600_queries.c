@@ -28,6 +28,15 @@
 //-----------------------------------------------------------------------------
 
 #include "TestLib.h"
+#include <stddef.h>
+
+// struct used for fetching rows from TestNumbers directly
+typedef struct {
+    int64_t intValue;
+    double numberValue;
+    double nullableValue;
+    int16_t nullableIndicator;
+} dpiTestNumberRow;
 
 //-----------------------------------------------------------------------------
 // dpiTest__execStatement() [INTERNAL]
@@ -609,6 +618,480 @@ int dpiTest_1612(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_1613()
+//   Define an array of structs for a query and fetch all of the rows with
+// dpiStmt_fetchStruct() using an array smaller than the number of rows;
+// verify the values, the null indicators and the row count (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_1613(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql = "select IntCol, NumberCol, NullableCol from TestNumbers "
+            "order by IntCol";
+    dpiStructField fields[3] = {
+        { 1, DPI_NATIVE_TYPE_INT64, offsetof(dpiTestNumberRow, intValue), 0,
+                -1, -1 },
+        { 2, DPI_NATIVE_TYPE_DOUBLE,
+                offsetof(dpiTestNumberRow, numberValue), 0, -1, -1 },
+        { 3, DPI_NATIVE_TYPE_DOUBLE,
+                offsetof(dpiTestNumberRow, nullableValue), 0,
+                offsetof(dpiTestNumberRow, nullableIndicator), -1 }
+    };
+    uint32_t numRowsFetched, totalRows = 0, i;
+    dpiTestNumberRow rows[3];
+    dpiStructLayout layout;
+    uint64_t rowCount;
+    dpiConn *conn;
+    dpiStmt *stmt;
+    int moreRows;
+
+    layout.structSize = sizeof(dpiTestNumberRow);
+    layout.numFields = 3;
+    layout.fields = fields;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_defineStruct(stmt, &layout, rows, 3) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    do {
+        if (dpiStmt_fetchStruct(stmt, &numRowsFetched, &moreRows) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        for (i = 0; i < numRowsFetched; i++) {
+            totalRows++;
+            if (dpiTestCase_expectIntEqual(testCase, rows[i].intValue,
+                    totalRows) < 0)
+                return DPI_FAILURE;
+            if (dpiTestCase_expectDoubleEqual(testCase, rows[i].numberValue,
+                    totalRows + totalRows * 0.25) < 0)
+                return DPI_FAILURE;
+            if (dpiTestCase_expectIntEqual(testCase,
+                    rows[i].nullableIndicator,
+                    (totalRows % 2 == 0) ? -1 : 0) < 0)
+                return DPI_FAILURE;
+        }
+    } while (moreRows);
+    if (dpiTestCase_expectUintEqual(testCase, totalRows, 10) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_getRowCount(stmt, &rowCount) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, rowCount, 10) < 0)
+        return DPI_FAILURE;
+    dpiStmt_release(stmt);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1614()
+//   Call dpiStmt_fetchStruct() without defining an array of structs (error
+// DPI-1095) and call dpiStmt_defineStruct() with an unsupported native type
+// (error DPI-1092), with a field outside of the struct (error DPI-1093), with
+// a bytes field without a length (error DPI-1094) and with an invalid
+// position (error DPI-1028).
+//-----------------------------------------------------------------------------
+int dpiTest_1614(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql = "select IntCol, NumberCol from TestNumbers";
+    dpiStructField field = { 1, DPI_NATIVE_TYPE_INT64, 0, 0, -1, -1 };
+    uint32_t numRowsFetched;
+    dpiStructLayout layout;
+    char rows[64];
+    dpiConn *conn;
+    dpiStmt *stmt;
+    int moreRows;
+
+    layout.structSize = 16;
+    layout.numFields = 1;
+    layout.fields = &field;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiStmt_fetchStruct(stmt, &numRowsFetched, &moreRows);
+    if (dpiTestCase_expectError(testCase, "DPI-1095:") < 0)
+        return DPI_FAILURE;
+    field.nativeTypeNum = DPI_NATIVE_TYPE_LOB;
+    dpiStmt_defineStruct(stmt, &layout, rows, 4);
+    if (dpiTestCase_expectError(testCase, "DPI-1092:") < 0)
+        return DPI_FAILURE;
+    field.nativeTypeNum = DPI_NATIVE_TYPE_INT64;
+    field.valueOffset = 12;
+    dpiStmt_defineStruct(stmt, &layout, rows, 4);
+    if (dpiTestCase_expectError(testCase, "DPI-1093:") < 0)
+        return DPI_FAILURE;
+    field.nativeTypeNum = DPI_NATIVE_TYPE_BYTES;
+    field.valueOffset = 0;
+    field.valueSize = 8;
+    dpiStmt_defineStruct(stmt, &layout, rows, 4);
+    if (dpiTestCase_expectError(testCase, "DPI-1094:") < 0)
+        return DPI_FAILURE;
+    field.nativeTypeNum = DPI_NATIVE_TYPE_INT64;
+    field.pos = 3;
+    dpiStmt_defineStruct(stmt, &layout, rows, 4);
+    if (dpiTestCase_expectError(testCase, "DPI-1028:") < 0)
+        return DPI_FAILURE;
+    dpiStmt_release(stmt);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest__verifyRowBlock() [INTERNAL]
+//   Verify that the row block contains the expected rows of the TestStrings
+// table.
+//-----------------------------------------------------------------------------
+int dpiTest__verifyRowBlock(dpiTestCase *testCase, dpiRowBlock *block,
+        uint32_t firstIntValue, uint32_t expectedNumRows)
+{
+    dpiNativeTypeNum nativeTypeNum;
+    dpiData *intData, *strData;
+    uint32_t i, numRows;
+    char expected[20];
+
+    if (dpiRowBlock_getNumRows(block, &numRows) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, numRows, expectedNumRows) < 0)
+        return DPI_FAILURE;
+    if (dpiRowBlock_getColumnData(block, 1, &nativeTypeNum, &intData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiRowBlock_getColumnData(block, 2, &nativeTypeNum, &strData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < numRows; i++) {
+        if (dpiTestCase_expectIntEqual(testCase, intData[i].value.asInt64,
+                firstIntValue + i) < 0)
+            return DPI_FAILURE;
+        sprintf(expected, "String %u", firstIntValue + i);
+        if (dpiTestCase_expectStringEqual(testCase,
+                strData[i].value.asBytes.ptr,
+                strData[i].value.asBytes.length, expected,
+                strlen(expected)) < 0)
+            return DPI_FAILURE;
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1615()
+//   Fetch rows and detach them as row blocks; verify that the rows in each
+// block remain intact while further rows are fetched and that the buffers of
+// released blocks are reused (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_1615(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql =
+            "select IntCol, StringCol from TestStrings order by IntCol";
+    uint32_t bufferRowIndex, numRowsFetched, i;
+    dpiRowBlock *blocks[4];
+    dpiConn *conn;
+    dpiStmt *stmt;
+    int moreRows;
+
+    // prepare and execute the query
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_setFetchArraySize(stmt, 3) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // fetch all of the rows, detaching each batch; the first block is
+    // released early so that its buffers are reused for the last block
+    for (i = 0; i < 4; i++) {
+        if (dpiStmt_fetchRows(stmt, 3, &bufferRowIndex, &numRowsFetched,
+                &moreRows) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiStmt_detachRowBlock(stmt, &blocks[i]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiTest__verifyRowBlock(testCase, blocks[i], i * 3 + 1,
+                numRowsFetched) < 0)
+            return DPI_FAILURE;
+        if (i == 1) {
+            if (dpiTest__verifyRowBlock(testCase, blocks[0], 1, 3) < 0)
+                return DPI_FAILURE;
+            if (dpiRowBlock_release(blocks[0]) < 0)
+                return dpiTestCase_setFailedFromError(testCase);
+            blocks[0] = NULL;
+        }
+    }
+    if (dpiTestCase_expectUintEqual(testCase, numRowsFetched, 1) < 0)
+        return DPI_FAILURE;
+
+    // verify the blocks are still intact after the statement is released
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 1; i < 4; i++) {
+        if (dpiTest__verifyRowBlock(testCase, blocks[i], i * 3 + 1,
+                (i < 3) ? 3 : 1) < 0)
+            return DPI_FAILURE;
+        if (dpiRowBlock_release(blocks[i]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1616()
+//   Call dpiStmt_detachRowBlock() before a query is executed and on a
+// scrollable statement (error DPI-1007 and DPI-1100).
+//-----------------------------------------------------------------------------
+int dpiTest_1616(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql = "select IntCol from TestStrings";
+    dpiRowBlock *block;
+    dpiConn *conn;
+    dpiStmt *stmt;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 1, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiStmt_detachRowBlock(stmt, &block);
+    if (dpiTestCase_expectError(testCase, "DPI-1007:") < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiStmt_detachRowBlock(stmt, &block);
+    if (dpiTestCase_expectError(testCase, "DPI-1100:") < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1617()
+//   Materialize the rows of a query entirely in memory and entirely in the
+// temporary file; verify that the rows can be accessed in any order after the
+// statement has been released and that a row beyond the end of the result
+// set cannot be accessed (error DPI-1108).
+//-----------------------------------------------------------------------------
+int dpiTest_1617(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql =
+            "select IntCol, StringCol from TestStrings order by IntCol";
+    uint64_t maxMemory[2] = { 1024 * 1024, 0 }, numRows, row;
+    dpiNativeTypeNum nativeTypeNum;
+    dpiResultSet *resultSet;
+    dpiData intData, strData;
+    char expected[20];
+    dpiConn *conn;
+    dpiStmt *stmt;
+    uint32_t i;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < 2; i++) {
+
+        // materialize all of the rows of the query
+        if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0,
+                &stmt) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiStmt_setFetchArraySize(stmt, 3) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiStmt_execute(stmt, 0, NULL) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiStmt_materialize(stmt, maxMemory[i], &resultSet) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiStmt_release(stmt) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+
+        // verify the rows in reverse order
+        if (dpiResultSet_getNumRows(resultSet, &numRows) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiTestCase_expectUintEqual(testCase, numRows, 10) < 0)
+            return DPI_FAILURE;
+        for (row = numRows; row > 0; row--) {
+            if (dpiResultSet_getValue(resultSet, row - 1, 1, &nativeTypeNum,
+                    &intData) < 0)
+                return dpiTestCase_setFailedFromError(testCase);
+            if (dpiTestCase_expectIntEqual(testCase, intData.value.asInt64,
+                    (int64_t) row) < 0)
+                return DPI_FAILURE;
+            if (dpiResultSet_getValue(resultSet, row - 1, 2, &nativeTypeNum,
+                    &strData) < 0)
+                return dpiTestCase_setFailedFromError(testCase);
+            sprintf(expected, "String %u", (uint32_t) row);
+            if (dpiTestCase_expectStringEqual(testCase,
+                    strData.value.asBytes.ptr, strData.value.asBytes.length,
+                    expected, strlen(expected)) < 0)
+                return DPI_FAILURE;
+        }
+        dpiResultSet_getValue(resultSet, numRows, 1, &nativeTypeNum,
+                &intData);
+        if (dpiTestCase_expectError(testCase, "DPI-1108:") < 0)
+            return DPI_FAILURE;
+        if (dpiResultSet_release(resultSet) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1618()
+//   Call dpiStmt_materialize() with a query that fetches a LOB (error
+// DPI-1107).
+//-----------------------------------------------------------------------------
+int dpiTest_1618(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql = "select to_clob('Test') from dual";
+    dpiResultSet *resultSet;
+    dpiConn *conn;
+    dpiStmt *stmt;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiStmt_materialize(stmt, 0, &resultSet);
+    if (dpiTestCase_expectError(testCase, "DPI-1107:") < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1619()
+//   Fetch a row with dpiStmt_fetch() using a small fetch array size so that
+// variables are defined for all columns, then define an array of structs for
+// only the first column which is larger than the fetch array size and fetch
+// the remaining rows with dpiStmt_fetchStruct(); verify the values (no
+// error).
+//-----------------------------------------------------------------------------
+int dpiTest_1619(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql = "select IntCol, NumberCol, NullableCol from TestNumbers "
+            "order by IntCol";
+    dpiStructField fields[1] = {
+        { 1, DPI_NATIVE_TYPE_INT64, offsetof(dpiTestNumberRow, intValue), 0,
+                -1, -1 }
+    };
+    uint32_t numRowsFetched, bufferRowIndex, totalRows = 1, i;
+    dpiTestNumberRow rows[10];
+    dpiStructLayout layout;
+    dpiConn *conn;
+    dpiStmt *stmt;
+    int found, moreRows;
+
+    layout.structSize = sizeof(dpiTestNumberRow);
+    layout.numFields = 1;
+    layout.fields = fields;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_setFetchArraySize(stmt, 1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_fetch(stmt, &found, &bufferRowIndex) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectIntEqual(testCase, found, 1) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_defineStruct(stmt, &layout, rows, 10) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    do {
+        if (dpiStmt_fetchStruct(stmt, &numRowsFetched, &moreRows) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        for (i = 0; i < numRowsFetched; i++) {
+            totalRows++;
+            if (dpiTestCase_expectIntEqual(testCase, rows[i].intValue,
+                    totalRows) < 0)
+                return DPI_FAILURE;
+        }
+    } while (moreRows);
+    if (dpiTestCase_expectUintEqual(testCase, totalRows, 10) < 0)
+        return DPI_FAILURE;
+    dpiStmt_release(stmt);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1620()
+//   Define a variable for the second column and an array of structs for the
+// first column, then fetch the rows with dpiStmt_fetchStruct() using an array
+// smaller than the number of rows; verify that the values of both the struct
+// and the variable are correct after each fetch (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_1620(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql = "select IntCol, NumberCol from TestNumbers "
+            "order by IntCol";
+    dpiStructField fields[1] = {
+        { 1, DPI_NATIVE_TYPE_INT64, offsetof(dpiTestNumberRow, intValue), 0,
+                -1, -1 }
+    };
+    uint32_t numRowsFetched, totalRows = 0, i;
+    dpiTestNumberRow rows[4];
+    dpiStructLayout layout;
+    dpiData *numberValues;
+    dpiVar *numberVar;
+    dpiConn *conn;
+    dpiStmt *stmt;
+    int moreRows;
+
+    layout.structSize = sizeof(dpiTestNumberRow);
+    layout.numFields = 1;
+    layout.fields = fields;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_NUMBER, DPI_NATIVE_TYPE_DOUBLE,
+            4, 0, 0, 0, NULL, &numberVar, &numberValues) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_define(stmt, 2, numberVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_defineStruct(stmt, &layout, rows, 4) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    do {
+        if (dpiStmt_fetchStruct(stmt, &numRowsFetched, &moreRows) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        for (i = 0; i < numRowsFetched; i++) {
+            totalRows++;
+            if (dpiTestCase_expectIntEqual(testCase, rows[i].intValue,
+                    totalRows) < 0)
+                return DPI_FAILURE;
+            if (dpiTestCase_expectDoubleEqual(testCase,
+                    numberValues[i].value.asDouble, totalRows * 1.25) < 0)
+                return DPI_FAILURE;
+        }
+    } while (moreRows);
+    if (dpiTestCase_expectUintEqual(testCase, totalRows, 10) < 0)
+        return DPI_FAILURE;
+    dpiStmt_release(stmt);
+    dpiVar_release(numberVar);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -641,5 +1124,21 @@ int main(int argc, char **argv)
             "dpiStmt_fetchRows() increments rowcount");
     dpiTestSuite_addCase(dpiTest_1612,
             "fetch data to a string variable which is smaller and verify");
+    dpiTestSuite_addCase(dpiTest_1613,
+            "fetch rows directly into an array of structs");
+    dpiTestSuite_addCase(dpiTest_1614,
+            "dpiStmt_defineStruct() and dpiStmt_fetchStruct() errors");
+    dpiTestSuite_addCase(dpiTest_1615,
+            "dpiStmt_detachRowBlock() keeps rows while fetching continues");
+    dpiTestSuite_addCase(dpiTest_1616,
+            "dpiStmt_detachRowBlock() without query or when scrollable");
+    dpiTestSuite_addCase(dpiTest_1617,
+            "dpiStmt_materialize() in memory and spilled to disk");
+    dpiTestSuite_addCase(dpiTest_1618,
+            "dpiStmt_materialize() with unsupported native type");
+    dpiTestSuite_addCase(dpiTest_1619,
+            "dpiStmt_defineStruct() after fetch with smaller array size");
+    dpiTestSuite_addCase(dpiTest_1620,
+            "dpiStmt_fetchStruct() with struct and variable columns");
     return dpiTestSuite_run();
 }
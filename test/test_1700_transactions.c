@@ -135,6 +135,42 @@ int dpiTest__verifyData(dpiTestCase *testCase, int64_t expectedNumRows)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest__verifyDataOnConn() [INTERNAL]
+//   Verify that the table contains the expected number of rows when queried
+// using the specified connection.
+//-----------------------------------------------------------------------------
+int dpiTest__verifyDataOnConn(dpiTestCase *testCase, dpiConn *conn,
+        int64_t expectedNumRows)
+{
+    const char *sql = "select count(*) from TestTempTable";
+    dpiNativeTypeNum nativeTypeNum;
+    uint32_t bufferRowIndex;
+    dpiData *data;
+    dpiStmt *stmt;
+    int found;
+
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_defineValue(stmt, 1, DPI_ORACLE_TYPE_NUMBER,
+            DPI_NATIVE_TYPE_INT64, 0, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_fetch(stmt, &found, &bufferRowIndex) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_getQueryValue(stmt, 1, &nativeTypeNum, &data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectIntEqual(testCase, dpiData_getInt64(data),
+            expectedNumRows) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiTest_1700()
 //   Call dpiConn_tpcBegin() with parameters globalTransactionIdLength and
@@ -384,6 +420,188 @@ int dpiTest_1708(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_1709()
+//   Verify that commits and rollbacks are only sent to the database when a
+// transaction may be in progress (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_1709(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql = "select count(*) from TestTempTable";
+    uint32_t bufferRowIndex;
+    dpiConn *conn;
+    dpiStmt *stmt;
+    int found;
+
+    // setup for tests
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__truncateTable(testCase, conn) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_setupRoundTripChecker(testCase, params) < 0)
+        return DPI_FAILURE;
+
+    // no transaction is in progress after DDL
+    if (dpiConn_commit(conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_rollback(conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectRoundTripsEqual(testCase, 0) < 0)
+        return DPI_FAILURE;
+
+    // a query which does not lock rows or access a remote database does not
+    // start a transaction, so the commit after it is not sent
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_fetch(stmt, &found, &bufferRowIndex) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectRoundTripsEqual(testCase, 1) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_commit(conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectRoundTripsEqual(testCase, 0) < 0)
+        return DPI_FAILURE;
+
+    // DML starts a transaction which requires a commit; a second commit
+    // does not
+    if (dpiTest__insertRowsInTable(testCase, conn) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectRoundTripsEqual(testCase, 1) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_commit(conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectRoundTripsEqual(testCase, 1) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_commit(conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_rollback(conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectRoundTripsEqual(testCase, 0) < 0)
+        return DPI_FAILURE;
+
+    return dpiTest__verifyData(testCase, 1);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1710()
+//   Verify that a query with a FOR UPDATE clause and PL/SQL blocks result in
+// commits and rollbacks being sent to the database (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_1710(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *plsql = "begin delete from TestTempTable; end;";
+    const char *sql = "select * from TestTempTable for update";
+    dpiConn *conn;
+    dpiStmt *stmt;
+
+    // setup for tests
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__truncateTable(testCase, conn) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__insertRowsInTable(testCase, conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_commit(conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_setupRoundTripChecker(testCase, params) < 0)
+        return DPI_FAILURE;
+
+    // a query that locks rows requires a rollback
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_rollback(conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectRoundTripsEqual(testCase, 2) < 0)
+        return DPI_FAILURE;
+
+    // PL/SQL which performs DML starts a transaction, as reported by the
+    // server, so a rollback must be sent to the database
+    if (dpiConn_prepareStmt(conn, 0, plsql, strlen(plsql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_rollback(conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectRoundTripsEqual(testCase, 2) < 0)
+        return DPI_FAILURE;
+
+    return dpiTest__verifyData(testCase, 1);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1711()
+//   Capture a snapshot on one pooled connection, commit another row and then
+// set the snapshot on a second pooled connection; verify that the second
+// connection only sees the rows committed before the snapshot was captured
+// until the snapshot is cleared.
+//-----------------------------------------------------------------------------
+int dpiTest_1711(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql = "insert into TestTempTable values (2, 'String 2')";
+    dpiConn *conn1, *conn2;
+    dpiSnapshot snapshot;
+    dpiStmt *stmt;
+    dpiPool *pool;
+
+    // populate the table with one row and capture a snapshot
+    if (dpiTestCase_getPool(testCase, &pool) < 0)
+        return DPI_FAILURE;
+    if (dpiPool_acquireConnection(pool, NULL, 0, NULL, 0, NULL, &conn1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTest__truncateTable(testCase, conn1) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__insertRowsInTable(testCase, conn1) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_commit(conn1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_getSnapshot(conn1, &snapshot) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // add a second row after the snapshot was captured
+    if (dpiConn_prepareStmt(conn1, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_COMMIT_ON_SUCCESS, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // the second connection sees only the first row while the snapshot is set
+    if (dpiPool_acquireConnection(pool, NULL, 0, NULL, 0, NULL, &conn2) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_setSnapshot(conn2, &snapshot) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTest__verifyDataOnConn(testCase, conn2, 1) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_setSnapshot(conn2, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTest__verifyDataOnConn(testCase, conn2, 2) < 0)
+        return DPI_FAILURE;
+
+    // cleanup
+    if (dpiConn_release(conn1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_release(conn2) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiPool_release(pool) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -408,5 +626,11 @@ int main(int argc, char **argv)
             "verify tpc functions with NULL connection");
     dpiTestSuite_addCase(dpiTest_1708,
             "verify tpc functions with NULL XID");
+    dpiTestSuite_addCase(dpiTest_1709,
+            "commit and rollback skipped when no transaction in progress");
+    dpiTestSuite_addCase(dpiTest_1710,
+            "commit and rollback performed after FOR UPDATE and PL/SQL");
+    dpiTestSuite_addCase(dpiTest_1711,
+            "dpiConn_getSnapshot() and dpiConn_setSnapshot() across a pool");
     return dpiTestSuite_run();
 }
@@ -868,6 +868,200 @@ int dpiTest_1929(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest__streamValue() [INTERNAL]
+//   Read callback used for streaming values; produces the remaining number of
+// bytes in pieces smaller than the buffer or fails, if requested.
+//-----------------------------------------------------------------------------
+typedef struct {
+    uint32_t remaining;
+    int fail;
+} dpiTestStreamContext;
+
+int dpiTest__streamValue(void *context, char *buffer, uint32_t bufferLength,
+        uint32_t *bytesRead)
+{
+    dpiTestStreamContext *streamContext = (dpiTestStreamContext*) context;
+
+    if (streamContext->fail)
+        return -1;
+    *bytesRead = streamContext->remaining;
+    if (*bytesRead > bufferLength / 3)
+        *bytesRead = bufferLength / 3;
+    memset(buffer, 'S', *bytesRead);
+    streamContext->remaining -= *bytesRead;
+    return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1930()
+//   Create a LONG variable and call dpiVar_setFromCallback() to stream a value
+// much larger than a single piece into table TestLongs; fetch the value and
+// verify its length (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_1930(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *insertSql = "insert into TestLongs values (1, :1)";
+    const char *selectSql = "select LongCol from TestLongs";
+    const char *deleteSql = "delete from TestLongs";
+    uint32_t valueLength = 500000, bufferRowIndex;
+    dpiTestStreamContext context;
+    dpiNativeTypeNum nativeTypeNum;
+    dpiData *varData, *data;
+    dpiConn *conn;
+    dpiStmt *stmt;
+    dpiVar *var;
+    int found;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, deleteSql, strlen(deleteSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiStmt_release(stmt);
+
+    // stream the value into the table
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_LONG_VARCHAR,
+            DPI_NATIVE_TYPE_BYTES, 1, 0, 0, 0, NULL, &var, &varData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_prepareStmt(conn, 0, insertSql, strlen(insertSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 1, var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    context.remaining = valueLength;
+    context.fail = 0;
+    if (dpiVar_setFromCallback(var, 0, dpiTest__streamValue, &context) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_COMMIT_ON_SUCCESS, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiStmt_release(stmt);
+    dpiVar_release(var);
+
+    // fetch the value and verify its length
+    if (dpiConn_prepareStmt(conn, 0, selectSql, strlen(selectSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_fetch(stmt, &found, &bufferRowIndex) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_getQueryValue(stmt, 1, &nativeTypeNum, &data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, data->value.asBytes.length,
+            valueLength) < 0)
+        return DPI_FAILURE;
+    dpiStmt_release(stmt);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1931()
+//   Call dpiVar_setFromCallback() with a variable that is not bound
+// dynamically (error DPI-1097); stream a value from a callback that fails
+// during execution (error DPI-1096).
+//-----------------------------------------------------------------------------
+int dpiTest_1931(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *insertSql = "insert into TestLongs values (2, :1)";
+    dpiTestStreamContext context;
+    dpiData *varData;
+    dpiConn *conn;
+    dpiStmt *stmt;
+    dpiVar *var;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_VARCHAR, DPI_NATIVE_TYPE_BYTES,
+            1, 100, 1, 0, NULL, &var, &varData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiVar_setFromCallback(var, 0, dpiTest__streamValue, &context);
+    if (dpiTestCase_expectError(testCase, "DPI-1097:") < 0)
+        return DPI_FAILURE;
+    dpiVar_release(var);
+
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_LONG_RAW, DPI_NATIVE_TYPE_BYTES,
+            1, 0, 0, 0, NULL, &var, &varData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_prepareStmt(conn, 0, insertSql, strlen(insertSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 1, var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    context.remaining = 1000;
+    context.fail = 1;
+    if (dpiVar_setFromCallback(var, 0, dpiTest__streamValue, &context) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, NULL);
+    if (dpiTestCase_expectError(testCase, "DPI-1096:") < 0)
+        return DPI_FAILURE;
+    dpiStmt_release(stmt);
+    dpiVar_release(var);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_1932()
+//   Stream a value from a callback that fails during execution (error
+// DPI-1096) and verify that executing again does not call the callback again;
+// set a callback that fails and then replace it with dpiVar_setFromBytes()
+// and verify that the callback is not called (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_1932(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *insertSql = "insert into TestLongsAlter values (1, :1)";
+    const char *value = "Not streamed";
+    dpiTestStreamContext context;
+    dpiData *varData;
+    dpiConn *conn;
+    dpiStmt *stmt;
+    dpiVar *var;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_LONG_VARCHAR,
+            DPI_NATIVE_TYPE_BYTES, 1, 0, 0, 0, NULL, &var, &varData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_prepareStmt(conn, 0, insertSql, strlen(insertSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 1, var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // the callback is cleared when the execution fails
+    context.remaining = 1000;
+    context.fail = 1;
+    if (dpiVar_setFromCallback(var, 0, dpiTest__streamValue, &context) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, NULL);
+    if (dpiTestCase_expectError(testCase, "DPI-1096:") < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // the callback is cleared when another value is set
+    if (dpiVar_setFromCallback(var, 0, dpiTest__streamValue, &context) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_setFromBytes(var, 0, value, strlen(value)) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_rollback(conn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiStmt_release(stmt);
+    dpiVar_release(var);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -936,5 +1130,12 @@ int main(int argc, char **argv)
             "dpiVar_setFromJson() with valid arguments");
     dpiTestSuite_addCase(dpiTest_1929,
             "verify dpiVar_setFromJson() with NULL");
+    dpiTestSuite_addCase(dpiTest_1930,
+            "dpiVar_setFromCallback() streaming a large LONG value");
+    dpiTestSuite_addCase(dpiTest_1931,
+            "dpiVar_setFromCallback() with unsupported variable and failing "
+            "callback");
+    dpiTestSuite_addCase(dpiTest_1932,
+            "dpiVar_setFromCallback() cleared by failure and other setters");
     return dpiTestSuite_run();
 }
@@ -1889,6 +1889,279 @@ int dpiTest_2036(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_2037()
+//   Prepare an insert, an update, a query and a PL/SQL block and bind
+// variables to them; call dpiConn_executeBatch() and verify that a single
+// round trip is made and that the row counts, the out value of the PL/SQL
+// block and the rows of the query match expectations (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_2037(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sqls[4] = {
+        "insert into TestTempTable values (:1, 'Batch')",
+        "update TestTempTable set StringCol = :value where IntCol = :id",
+        "select StringCol from TestTempTable where IntCol = :1",
+        "begin :outValue := :inValue * 2; end;"
+    };
+    const char *truncateSql = "truncate table TestTempTable";
+    dpiData *intData, *strData, *outData, *queryData;
+    dpiStmt *stmts[4], *queryResults[4], *stmt;
+    dpiVar *intVar, *strVar, *outVar;
+    uint32_t bufferRowIndex, i;
+    dpiNativeTypeNum nativeTypeNum;
+    uint64_t rowCounts[4];
+    dpiConn *conn;
+    int found;
+
+    // truncate table
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, truncateSql, strlen(truncateSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // prepare statements and create variables
+    for (i = 0; i < 4; i++) {
+        if (dpiConn_prepareStmt(conn, 0, sqls[i], strlen(sqls[i]), NULL, 0,
+                &stmts[i]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_NUMBER, DPI_NATIVE_TYPE_INT64, 1,
+            0, 0, 0, NULL, &intVar, &intData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_VARCHAR, DPI_NATIVE_TYPE_BYTES, 1,
+            100, 1, 0, NULL, &strVar, &strData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_NUMBER, DPI_NATIVE_TYPE_INT64, 1,
+            0, 0, 0, NULL, &outVar, &outData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    intData->isNull = 0;
+    intData->value.asInt64 = 7;
+    if (dpiVar_setFromBytes(strVar, 0, "Updated", 7) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // bind variables
+    if (dpiStmt_bindByPos(stmts[0], 1, intVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByName(stmts[1], "value", 5, strVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByName(stmts[1], "id", 2, intVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmts[2], 1, intVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByName(stmts[3], "outValue", 8, outVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByName(stmts[3], "inValue", 7, intVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // execute batch and verify only one round trip was made
+    if (dpiTestCase_setupRoundTripChecker(testCase, params) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_executeBatch(conn, 4, stmts, DPI_MODE_EXEC_DEFAULT, rowCounts,
+            queryResults) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectRoundTripsEqual(testCase, 1) < 0)
+        return DPI_FAILURE;
+
+    // verify results
+    if (dpiTestCase_expectUintEqual(testCase, rowCounts[0], 1) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectUintEqual(testCase, rowCounts[1], 1) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectUintEqual(testCase, rowCounts[3], 0) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectIntEqual(testCase, outData->value.asInt64, 14) < 0)
+        return DPI_FAILURE;
+    if (queryResults[0] || queryResults[1] || queryResults[3])
+        return dpiTestCase_setFailed(testCase,
+                "unexpected query result for non-query");
+    if (dpiStmt_fetch(queryResults[2], &found, &bufferRowIndex) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (!found)
+        return dpiTestCase_setFailed(testCase, "row not found");
+    if (dpiStmt_getQueryValue(queryResults[2], 1, &nativeTypeNum,
+            &queryData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectStringEqual(testCase, queryData->value.asBytes.ptr,
+            queryData->value.asBytes.length, "Updated", 7) < 0)
+        return DPI_FAILURE;
+
+    // cleanup
+    if (dpiStmt_release(queryResults[2]) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < 4; i++) {
+        if (dpiStmt_release(stmts[i]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiVar_release(intVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_release(strVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiVar_release(outVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_2038()
+//   Call dpiConn_executeBatch() with a DDL statement, a statement with a
+// placeholder that has not been bound and a statement prepared by another
+// connection and with an unsupported mode and verify that appropriate errors
+// are raised.
+//-----------------------------------------------------------------------------
+int dpiTest_2038(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *truncateSql = "truncate table TestTempTable";
+    const char *querySql = "select :1 from dual";
+    dpiConn *conn, *otherConn;
+    dpiStmt *stmts[2];
+
+    // DDL statements are not supported
+    if (dpiTestCase_getConnection(testCase, &otherConn) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, truncateSql, strlen(truncateSql), NULL, 0,
+            &stmts[0]) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiConn_executeBatch(conn, 1, stmts, DPI_MODE_EXEC_DEFAULT, NULL, NULL);
+    if (dpiTestCase_expectError(testCase, "DPI-1101:") < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_release(stmts[0]) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // placeholders must be bound
+    if (dpiConn_prepareStmt(conn, 0, querySql, strlen(querySql), NULL, 0,
+            &stmts[0]) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiConn_executeBatch(conn, 1, stmts, DPI_MODE_EXEC_DEFAULT, NULL, NULL);
+    if (dpiTestCase_expectError(testCase, "DPI-1103:") < 0)
+        return DPI_FAILURE;
+
+    // statements must be prepared by the same connection
+    if (dpiConn_prepareStmt(otherConn, 0, querySql, strlen(querySql), NULL, 0,
+            &stmts[1]) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiConn_executeBatch(conn, 2, stmts, DPI_MODE_EXEC_DEFAULT, NULL, NULL);
+    if (dpiTestCase_expectError(testCase, "DPI-1102:") < 0)
+        return DPI_FAILURE;
+
+    // batch errors and array DML row counts are not supported
+    dpiConn_executeBatch(conn, 1, stmts, DPI_MODE_EXEC_BATCH_ERRORS, NULL,
+            NULL);
+    if (dpiTestCase_expectError(testCase, "DPI-1013:") < 0)
+        return DPI_FAILURE;
+    dpiConn_executeBatch(conn, 1, stmts, DPI_MODE_EXEC_ARRAY_DML_ROWCOUNTS,
+            NULL, NULL);
+    if (dpiTestCase_expectError(testCase, "DPI-1013:") < 0)
+        return DPI_FAILURE;
+
+    // cleanup
+    if (dpiStmt_release(stmts[0]) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmts[1]) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_release(otherConn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_2039()
+//   Bind a variable with a size greater than 32K to an insert statement and
+// call dpiConn_executeBatch(); verify that the value is inserted and that the
+// variable still uses dynamic bytes afterwards (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_2039(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sqls[3] = {
+        "delete from TestCLOBs",
+        "insert into TestCLOBs values (1, :1)",
+        "select dbms_lob.getlength(CLOBCol) from TestCLOBs"
+    };
+    const uint32_t valueLength = 40000;
+    dpiStmt *stmts[3], *queryResults[3];
+    uint32_t bufferRowIndex, sizeInBytes, i;
+    dpiNativeTypeNum nativeTypeNum;
+    dpiData *data, *queryData;
+    uint64_t rowCounts[3];
+    dpiConn *conn;
+    char *value;
+    dpiVar *var;
+    int found;
+
+    // prepare statements and create variable
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < 3; i++) {
+        if (dpiConn_prepareStmt(conn, 0, sqls[i], strlen(sqls[i]), NULL, 0,
+                &stmts[i]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_VARCHAR, DPI_NATIVE_TYPE_BYTES, 1,
+            valueLength, 1, 0, NULL, &var, &data) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    value = malloc(valueLength);
+    if (!value)
+        return dpiTestCase_setFailed(testCase, "Out of memory!");
+    memset(value, 'X', valueLength);
+    if (dpiVar_setFromBytes(var, 0, value, valueLength) < 0) {
+        free(value);
+        return dpiTestCase_setFailedFromError(testCase);
+    }
+    free(value);
+    if (dpiStmt_bindByPos(stmts[1], 1, var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // execute batch and verify results
+    if (dpiConn_executeBatch(conn, 3, stmts, DPI_MODE_EXEC_DEFAULT, rowCounts,
+            queryResults) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, rowCounts[1], 1) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_fetch(queryResults[2], &found, &bufferRowIndex) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (!found)
+        return dpiTestCase_setFailed(testCase, "row not found");
+    if (dpiStmt_getQueryValue(queryResults[2], 1, &nativeTypeNum,
+            &queryData) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectDoubleEqual(testCase, queryData->value.asDouble,
+            valueLength) < 0)
+        return DPI_FAILURE;
+
+    // verify the variable was not converted to use a LOB
+    if (dpiVar_getSizeInBytes(var, &sizeInBytes) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, sizeInBytes, 0) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectUintEqual(testCase, data->value.asBytes.length,
+            valueLength) < 0)
+        return DPI_FAILURE;
+
+    // cleanup
+    if (dpiStmt_release(queryResults[2]) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < 3; i++) {
+        if (dpiStmt_release(stmts[i]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiVar_release(var) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -1969,5 +2242,11 @@ int main(int argc, char **argv)
             "dpiStmt_executeMany() with PL/SQL statement row count");
     dpiTestSuite_addCase(dpiTest_2036,
             "verify round trips for prefetch values");
+    dpiTestSuite_addCase(dpiTest_2037,
+            "dpiConn_executeBatch() with DML, query and PL/SQL");
+    dpiTestSuite_addCase(dpiTest_2038,
+            "dpiConn_executeBatch() with unsupported statements");
+    dpiTestSuite_addCase(dpiTest_2039,
+            "dpiConn_executeBatch() with variable larger than 32K");
     return dpiTestSuite_run();
 }
@@ -1156,6 +1156,99 @@ int dpiTest_2828(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_2829()
+//   Create multiple temporary CLOBs, call dpiConn_writeLobs() to populate all
+// of them and verify that a single round-trip is required and that each LOB
+// contains the expected value (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_2829(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *values[3] = { "first value", "second", "the third value" };
+    uint64_t valueLengths[3], bytesWritten[3], bufferLength;
+    char buffer[MAX_CHARS];
+    dpiLob *lobs[3];
+    dpiConn *conn;
+    uint32_t i;
+
+    // create the LOBs
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < 3; i++) {
+        valueLengths[i] = strlen(values[i]);
+        if (dpiConn_newTempLob(conn, DPI_ORACLE_TYPE_CLOB, &lobs[i]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+
+    // write all of them at once
+    if (dpiTestCase_setupRoundTripChecker(testCase, params) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_writeLobs(conn, 3, lobs, NULL, values, valueLengths,
+            bytesWritten) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectRoundTripsEqual(testCase, 1) < 0)
+        return DPI_FAILURE;
+
+    // verify the contents of each LOB
+    for (i = 0; i < 3; i++) {
+        if (dpiTestCase_expectUintEqual(testCase, bytesWritten[i],
+                valueLengths[i]) < 0)
+            return DPI_FAILURE;
+        bufferLength = sizeof(buffer);
+        if (dpiLob_readBytes(lobs[i], 1, sizeof(buffer), buffer,
+                &bufferLength) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiTestCase_expectStringEqual(testCase, buffer, bufferLength,
+                values[i], valueLengths[i]) < 0)
+            return DPI_FAILURE;
+        if (dpiLob_release(lobs[i]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_2830()
+//   Call dpiConn_writeLobs() with a LOB created by a different connection
+// (error DPI-1099).
+//-----------------------------------------------------------------------------
+int dpiTest_2830(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *values[2] = { DEFAULT_CHARS, DEFAULT_CHARS };
+    uint64_t valueLengths[2];
+    dpiConn *conn, *otherConn;
+    dpiLob *lobs[2];
+
+    // create one LOB with each connection
+    if (dpiTestCase_getConnection(testCase, &otherConn) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_newTempLob(conn, DPI_ORACLE_TYPE_CLOB, &lobs[0]) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newTempLob(otherConn, DPI_ORACLE_TYPE_CLOB, &lobs[1]) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    // attempt to write both of them using the first connection
+    valueLengths[0] = valueLengths[1] = strlen(DEFAULT_CHARS);
+    dpiConn_writeLobs(conn, 2, lobs, NULL, values, valueLengths, NULL);
+    if (dpiTestCase_expectError(testCase, "DPI-1099:") < 0)
+        return DPI_FAILURE;
+
+    // cleanup
+    if (dpiLob_release(lobs[0]) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiLob_release(lobs[1]) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_release(otherConn) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -1221,5 +1314,9 @@ int main(int argc, char **argv)
     dpiTestSuite_addCase(dpiTest_2828,
             "dpiLob_setFromBytes() with value not NULL and valueLength "
             "non-zero");
+    dpiTestSuite_addCase(dpiTest_2829,
+            "dpiConn_writeLobs() writes multiple LOBs in one round-trip");
+    dpiTestSuite_addCase(dpiTest_2830,
+            "dpiConn_writeLobs() with LOB from a different connection");
     return dpiTestSuite_run();
 }
@@ -139,6 +139,101 @@ int dpiTest_2901(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_2902()
+//   Prepare and execute statement that returns two implicit results; call
+// dpiStmt_getImplicitResultCount() and confirm the count is correct; call
+// dpiStmt_getImplicitResults() and fetch from the second implicit result
+// before the first, using a different fetch array size for each, and confirm
+// results are as expected (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_2902(dpiTestCase *testCase, dpiTestParams *params)
+{
+    uint32_t numQueryColumns, bufferRowIndex, count;
+    double result[4] = {3.75, 5, 8.75, 10};
+    dpiNativeTypeNum nativeTypeNum;
+    dpiStmt *stmt, *impResults[2];
+    dpiData *doubleValue;
+    dpiConn *conn;
+    int found, i, j;
+
+    if (dpiTestCase_setSkippedIfVersionTooOld(testCase, 0, 12, 1) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, SQL_IMP_RES, strlen(SQL_IMP_RES), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, &numQueryColumns) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_getImplicitResultCount(stmt, &count) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, count, 2) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_getImplicitResults(stmt, 2, impResults) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 1; i >= 0; i--) {
+        if (dpiStmt_setFetchArraySize(impResults[i], i + 1) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        for (j = 0; ; j++) {
+            if (dpiStmt_fetch(impResults[i], &found, &bufferRowIndex) < 0)
+                return dpiTestCase_setFailedFromError(testCase);
+            if (!found)
+                break;
+            if (dpiStmt_getQueryValue(impResults[i], 1, &nativeTypeNum,
+                    &doubleValue) < 0)
+                return dpiTestCase_setFailedFromError(testCase);
+            if (dpiTestCase_expectDoubleEqual(testCase,
+                    doubleValue->value.asDouble, result[i * 2 + j]) < 0)
+                return DPI_FAILURE;
+        }
+        if (dpiTestCase_expectIntEqual(testCase, j, 2) < 0)
+            return DPI_FAILURE;
+        if (dpiStmt_release(impResults[i]) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+    }
+    if (dpiStmt_getImplicitResultCount(stmt, &count) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, count, 0) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_2903()
+//   Prepare and execute statement that returns two implicit results; call
+// dpiStmt_getImplicitResults() with an array that is too small (error
+// DPI-1018).
+//-----------------------------------------------------------------------------
+int dpiTest_2903(dpiTestCase *testCase, dpiTestParams *params)
+{
+    uint32_t numQueryColumns;
+    dpiStmt *stmt, *impResult;
+    dpiConn *conn;
+
+    if (dpiTestCase_setSkippedIfVersionTooOld(testCase, 0, 12, 1) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, SQL_IMP_RES, strlen(SQL_IMP_RES), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, &numQueryColumns) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiStmt_getImplicitResults(stmt, 1, &impResult);
+    if (dpiTestCase_expectError(testCase, "DPI-1018:") < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -149,5 +244,9 @@ int main(int argc, char **argv)
             "dpiStmt_getImplicitResult() without implicit results");
     dpiTestSuite_addCase(dpiTest_2901,
             "dpiStmt_getImplicitResult() returns expected results");
+    dpiTestSuite_addCase(dpiTest_2902,
+            "dpiStmt_getImplicitResults() fetched in any order");
+    dpiTestSuite_addCase(dpiTest_2903,
+            "dpiStmt_getImplicitResults() with array too small");
     return dpiTestSuite_run();
 }
@@ -384,6 +384,94 @@ int dpiTest_3007(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_3008()
+//   Prepare and execute scrollable query with a scroll cache and read ahead
+// enabled; scroll to the last row, then backwards and back and forth through
+// the result set, verifying that rows satisfied by the cache and rows fetched
+// from the database provide the correct results (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_3008(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql = "select IntCol from TestTempTable order by IntCol";
+    uint32_t numQueryColumns, bufferRowIndex;
+    int32_t row;
+    dpiStmt *stmt;
+    dpiConn *conn;
+    int found;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__populateTable(testCase, conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 1, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_setFetchArraySize(stmt, 5) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_setScrollCache(stmt, 4, 1) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, DPI_MODE_EXEC_DEFAULT, &numQueryColumns) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_scroll(stmt, DPI_MODE_FETCH_LAST, 0, 0) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTest__verifyFetchedRow(testCase, stmt, 30) < 0)
+        return DPI_FAILURE;
+    for (row = 29; row > 18; row--) {
+        if (dpiStmt_scroll(stmt, DPI_MODE_FETCH_PRIOR, 0, 0) < 0)
+            return dpiTestCase_setFailedFromError(testCase);
+        if (dpiTest__verifyFetchedRow(testCase, stmt, row) < 0)
+            return DPI_FAILURE;
+    }
+    if (dpiStmt_scroll(stmt, DPI_MODE_FETCH_ABSOLUTE, 27, 0) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTest__verifyFetchedRow(testCase, stmt, 27) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_scroll(stmt, DPI_MODE_FETCH_ABSOLUTE, 3, 0) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTest__verifyFetchedRow(testCase, stmt, 3) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_scroll(stmt, DPI_MODE_FETCH_RELATIVE, 18, 0) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (row = 21; row <= 30; row++) {
+        if (dpiTest__verifyFetchedRow(testCase, stmt, row) < 0)
+            return DPI_FAILURE;
+    }
+    if (dpiStmt_fetch(stmt, &found, &bufferRowIndex) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, found, 0) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_3009()
+//   Prepare a non scrollable query and call dpiStmt_setScrollCache() (error
+// DPI-1013).
+//-----------------------------------------------------------------------------
+int dpiTest_3009(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql = "select IntCol from TestTempTable";
+    dpiStmt *stmt;
+    dpiConn *conn;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiStmt_setScrollCache(stmt, 4, 1);
+    if (dpiTestCase_expectError(testCase, "DPI-1013:") < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -406,5 +494,9 @@ int main(int argc, char **argv)
             "dpiStmt_scroll() with all possible modes");
     dpiTestSuite_addCase(dpiTest_3007,
             "dpiStmt_scroll() with previous mode at first row");
+    dpiTestSuite_addCase(dpiTest_3008,
+            "dpiStmt_scroll() with scroll cache and read ahead");
+    dpiTestSuite_addCase(dpiTest_3009,
+            "dpiStmt_setScrollCache() on non scrollable statement");
     return dpiTestSuite_run();
 }
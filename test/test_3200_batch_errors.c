@@ -193,6 +193,154 @@ int dpiTest_3202(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_3203()
+//   Prepare array of data to insert that will result in errors. Call
+// dpiStmt_executeManyAdaptive() with a batch size of one row so that each
+// error occurs in a different batch; call dpiStmt_getBatchErrors() and
+// confirm that the errors from all batches are returned with the row offsets
+// of the failing rows; confirm that the row counts cover all batches (no
+// error).
+//-----------------------------------------------------------------------------
+int dpiTest_3203(dpiTestCase *testCase, dpiTestParams *params)
+{
+    uint32_t count, numRowCounts, expectedRowCounts[NUM_ROWS] = { 1, 0, 0 };
+    dpiErrorInfo errorInfo[NUM_ERR];
+    dpiAdaptiveExecParams execParams;
+    uint64_t rowCount, *rowCounts;
+    dpiStmt *stmt;
+    dpiConn *conn;
+    uint32_t i;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__truncateTable(testCase, conn) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__prepareInsertWithErrors(testCase, conn, &stmt) < 0)
+        return DPI_FAILURE;
+    memset(&execParams, 0, sizeof(execParams));
+    execParams.initialBatchSize = 1;
+    execParams.maxBatchSize = 1;
+    if (dpiStmt_executeManyAdaptive(stmt, DPI_MODE_EXEC_ARRAY_DML_ROWCOUNTS,
+            NUM_ROWS, &execParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_getBatchErrorCount(stmt, &count) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, count, NUM_ERR) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_getBatchErrors(stmt, NUM_ERR, errorInfo) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectErrorInfo(testCase, &errorInfo[0], "ORA-00001:") < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectUintEqual(testCase, errorInfo[0].offset, 1) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectErrorInfo(testCase, &errorInfo[1], "ORA-01438:") < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectUintEqual(testCase, errorInfo[1].offset, 2) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_getRowCount(stmt, &rowCount) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, rowCount, 1) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_getRowCounts(stmt, &numRowCounts, &rowCounts) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, numRowCounts, NUM_ROWS) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < NUM_ROWS; i++) {
+        if (dpiTestCase_expectUintEqual(testCase, rowCounts[i],
+                expectedRowCounts[i]) < 0)
+            return DPI_FAILURE;
+    }
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_3204()
+//   Prepare a query and call dpiStmt_executeManyAdaptive() (error DPI-1063).
+//-----------------------------------------------------------------------------
+int dpiTest_3204(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql = "select IntCol from TestTempTable";
+    dpiStmt *stmt;
+    dpiConn *conn;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiStmt_executeManyAdaptive(stmt, DPI_MODE_EXEC_DEFAULT, 1, NULL);
+    if (dpiTestCase_expectError(testCase, "DPI-1063:") < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_3205()
+//   Prepare an insert of rows without errors and call
+// dpiStmt_executeManyAdaptive() with a maximum batch size smaller than the
+// number of rows; confirm that dpiStmt_getRowCount() and
+// dpiStmt_getRowCounts() return the rows affected by all of the batches and
+// not just the last one (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_3205(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *sql = "insert into TestTempTable (IntCol) values (:1)";
+    dpiAdaptiveExecParams execParams;
+    uint64_t rowCount, *rowCounts;
+    uint32_t numRowCounts, i;
+    dpiData *intColValue;
+    dpiVar *intColVar;
+    dpiStmt *stmt;
+    dpiConn *conn;
+
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__truncateTable(testCase, conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, sql, strlen(sql), NULL, 0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiConn_newVar(conn, DPI_ORACLE_TYPE_NUMBER, DPI_NATIVE_TYPE_INT64,
+            NUM_ROWS, 0, 0, 0, NULL, &intColVar, &intColValue) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindByPos(stmt, 1, intColVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    for (i = 0; i < NUM_ROWS; i++)
+        dpiData_setInt64(&intColValue[i], i + 1);
+    memset(&execParams, 0, sizeof(execParams));
+    execParams.initialBatchSize = 2;
+    execParams.maxBatchSize = 2;
+    if (dpiStmt_executeManyAdaptive(stmt, DPI_MODE_EXEC_ARRAY_DML_ROWCOUNTS,
+            NUM_ROWS, &execParams) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_getRowCount(stmt, &rowCount) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, rowCount, NUM_ROWS) < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_getRowCounts(stmt, &numRowCounts, &rowCounts) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, numRowCounts, NUM_ROWS) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < NUM_ROWS; i++) {
+        if (dpiTestCase_expectUintEqual(testCase, rowCounts[i], 1) < 0)
+            return DPI_FAILURE;
+    }
+    if (dpiVar_release(intColVar) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_release(stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -205,5 +353,11 @@ int main(int argc, char **argv)
             "dpiStmt_getBatchErrors() returns expected results");
     dpiTestSuite_addCase(dpiTest_3202,
             "dpiStmt_getBatchErrors() with numErrors less than required");
+    dpiTestSuite_addCase(dpiTest_3203,
+            "dpiStmt_executeManyAdaptive() collects errors across batches");
+    dpiTestSuite_addCase(dpiTest_3204,
+            "dpiStmt_executeManyAdaptive() with a query");
+    dpiTestSuite_addCase(dpiTest_3205,
+            "dpiStmt_executeManyAdaptive() row counts cover all batches");
     return dpiTestSuite_run();
 }
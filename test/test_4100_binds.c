@@ -28,6 +28,15 @@
 //-----------------------------------------------------------------------------
 
 #include "TestLib.h"
+#include <stddef.h>
+
+// struct used for binding and fetching rows of TestTempTable directly
+typedef struct {
+    int64_t intValue;
+    char stringValue[20];
+    uint32_t stringLength;
+    int16_t stringIndicator;
+} dpiTestTempRow;
 
 //-----------------------------------------------------------------------------
 // dpiTest__bindLobIn() [INTERNAL]
@@ -2605,6 +2614,99 @@ int dpiTest_4132(dpiTestCase *testCase, dpiTestParams *params)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiTest_4133()
+//   Bind an array of structs and insert its rows with dpiStmt_executeMany(),
+// including a null value; fetch the rows back into another array of structs
+// and verify the values (no error).
+//-----------------------------------------------------------------------------
+int dpiTest_4133(dpiTestCase *testCase, dpiTestParams *params)
+{
+    const char *insertSql = "insert into TestTempTable values (:1, :2)";
+    const char *selectSql = "select IntCol, StringCol from TestTempTable "
+            "order by IntCol";
+    const char *truncateSql = "truncate table TestTempTable";
+    dpiStructField fields[2] = {
+        { 1, DPI_NATIVE_TYPE_INT64, offsetof(dpiTestTempRow, intValue), 0,
+                -1, -1 },
+        { 2, DPI_NATIVE_TYPE_BYTES, offsetof(dpiTestTempRow, stringValue),
+                sizeof(((dpiTestTempRow*) 0)->stringValue),
+                offsetof(dpiTestTempRow, stringIndicator),
+                offsetof(dpiTestTempRow, stringLength) }
+    };
+    dpiTestTempRow inRows[3], outRows[5];
+    dpiStructLayout layout;
+    uint32_t numRows, i;
+    dpiConn *conn;
+    dpiStmt *stmt;
+    int moreRows;
+
+    // populate the rows to insert
+    layout.structSize = sizeof(dpiTestTempRow);
+    layout.numFields = 2;
+    layout.fields = fields;
+    memset(inRows, 0, sizeof(inRows));
+    for (i = 0; i < 3; i++) {
+        inRows[i].intValue = i + 1;
+        inRows[i].stringLength = (uint32_t) sprintf(inRows[i].stringValue,
+                "String %u", i + 1);
+        inRows[i].stringIndicator = (i == 1) ? -1 : 0;
+    }
+
+    // truncate table and insert the rows
+    if (dpiTestCase_getConnection(testCase, &conn) < 0)
+        return DPI_FAILURE;
+    if (dpiConn_prepareStmt(conn, 0, truncateSql, strlen(truncateSql), NULL,
+            0, &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiStmt_release(stmt);
+    if (dpiConn_prepareStmt(conn, 0, insertSql, strlen(insertSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_bindStruct(stmt, &layout, inRows, 3) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiStmt_executeMany(stmt, DPI_MODE_EXEC_DEFAULT, 4);
+    if (dpiTestCase_expectError(testCase, "DPI-1018:") < 0)
+        return DPI_FAILURE;
+    if (dpiStmt_executeMany(stmt, DPI_MODE_EXEC_DEFAULT, 3) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    dpiStmt_release(stmt);
+
+    // fetch the rows back and verify them
+    if (dpiConn_prepareStmt(conn, 0, selectSql, strlen(selectSql), NULL, 0,
+            &stmt) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_execute(stmt, 0, NULL) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_defineStruct(stmt, &layout, outRows, 5) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiStmt_fetchStruct(stmt, &numRows, &moreRows) < 0)
+        return dpiTestCase_setFailedFromError(testCase);
+    if (dpiTestCase_expectUintEqual(testCase, numRows, 3) < 0)
+        return DPI_FAILURE;
+    if (dpiTestCase_expectIntEqual(testCase, moreRows, 0) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < numRows; i++) {
+        if (dpiTestCase_expectIntEqual(testCase, outRows[i].intValue,
+                inRows[i].intValue) < 0)
+            return DPI_FAILURE;
+        if (dpiTestCase_expectIntEqual(testCase, outRows[i].stringIndicator,
+                inRows[i].stringIndicator) < 0)
+            return DPI_FAILURE;
+        if (inRows[i].stringIndicator == 0 &&
+                dpiTestCase_expectStringEqual(testCase,
+                        outRows[i].stringValue, outRows[i].stringLength,
+                        inRows[i].stringValue, inRows[i].stringLength) < 0)
+            return DPI_FAILURE;
+    }
+    dpiStmt_release(stmt);
+
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // main()
 //-----------------------------------------------------------------------------
@@ -2677,5 +2779,7 @@ int main(int argc, char **argv)
             "test PL/SQL bind of BLOBs (IN/OUT)");
     dpiTestSuite_addCase(dpiTest_4132,
             "test PL/SQL bind of BLOBs (OUT)");
+    dpiTestSuite_addCase(dpiTest_4133,
+            "test binding and fetching an array of structs");
     return dpiTestSuite_run();
 }
@@ -0,0 +1,397 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// test_4600_oci_attr_cache.c
+//   Test suite for the elimination of redundant OCI attribute calls when a
+// statement is executed repeatedly. Unlike the other test suites, this one
+// does not require an Oracle Client library or database: the library is
+// compiled directly into the executable and the OCI functions that are used
+// are replaced with stand-ins that count the number of times they are called.
+//-----------------------------------------------------------------------------
+
+#include "../embed/dpi.c"
+
+#include <stdio.h>
+
+// counts of calls made to the OCI stand-ins
+typedef struct {
+    uint32_t numPrefetchRowsSet;
+    uint32_t lastPrefetchRows;
+    uint32_t numSqlIdGet;
+    uint32_t numExecute;
+    uint32_t numFetch;
+} dpiTestOciCounts;
+
+// test case function signature
+typedef int (*dpiTestFunction)(const char **failure);
+
+static dpiTestOciCounts gCounts;
+static char gSqlId[] = "0abcdefghjkmn";
+static int gDummyHandle;
+
+
+//-----------------------------------------------------------------------------
+// dpiTestOci__attrGet()
+//   Stand-in for OCIAttrGet().
+//-----------------------------------------------------------------------------
+static int dpiTestOci__attrGet(UNUSED const void *handle,
+        UNUSED uint32_t handleType, void *ptr, uint32_t *size,
+        uint32_t attribute, UNUSED void *errorHandle)
+{
+    switch (attribute) {
+        case DPI_OCI_ATTR_SQL_ID:
+            gCounts.numSqlIdGet++;
+            *(char**) ptr = gSqlId;
+            *size = (uint32_t) strlen(gSqlId);
+            break;
+        case DPI_OCI_ATTR_STMT_TYPE:
+            *(uint16_t*) ptr = DPI_STMT_TYPE_SELECT;
+            break;
+        case DPI_OCI_ATTR_PARAM_COUNT:
+        case DPI_OCI_ATTR_ROWS_FETCHED:
+            *(uint32_t*) ptr = 0;
+            break;
+    }
+    return DPI_OCI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTestOci__attrSet()
+//   Stand-in for OCIAttrSet().
+//-----------------------------------------------------------------------------
+static int dpiTestOci__attrSet(UNUSED void *handle, UNUSED uint32_t handleType,
+        void *ptr, UNUSED uint32_t size, uint32_t attribute,
+        UNUSED void *errorHandle)
+{
+    if (attribute == DPI_OCI_ATTR_PREFETCH_ROWS) {
+        gCounts.numPrefetchRowsSet++;
+        gCounts.lastPrefetchRows = *(uint32_t*) ptr;
+    }
+    return DPI_OCI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTestOci__stmtExecute()
+//   Stand-in for OCIStmtExecute().
+//-----------------------------------------------------------------------------
+static int dpiTestOci__stmtExecute(UNUSED void *svchp, UNUSED void *stmtp,
+        UNUSED void *errhp, UNUSED uint32_t iters, UNUSED uint32_t rowoff,
+        UNUSED const void *snap_in, UNUSED void *snap_out,
+        UNUSED uint32_t mode)
+{
+    gCounts.numExecute++;
+    return DPI_OCI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTestOci__stmtFetch2()
+//   Stand-in for OCIStmtFetch2().
+//-----------------------------------------------------------------------------
+static int dpiTestOci__stmtFetch2(UNUSED void *stmtp, UNUSED void *errhp,
+        UNUSED uint32_t nrows, UNUSED uint16_t orientation,
+        UNUSED int32_t scrollOffset, UNUSED uint32_t mode)
+{
+    gCounts.numFetch++;
+    return DPI_OCI_NO_DATA;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest__initialize()
+//   Install the OCI stand-ins, reset the counts and prepare a statement
+// structure that appears to be a freshly prepared query. The context has none
+// of its optional features (conversion pool, SQL profiler, etc.) enabled.
+//-----------------------------------------------------------------------------
+static void dpiTest__initialize(dpiStmt *stmt, dpiConn *conn, dpiEnv *env,
+        dpiContext *context, dpiVersionInfo *versionInfo, dpiError *error,
+        dpiErrorBuffer *errorBuffer)
+{
+    dpiOciSymbols.fnAttrGet = dpiTestOci__attrGet;
+    dpiOciSymbols.fnAttrSet = dpiTestOci__attrSet;
+    dpiOciSymbols.fnStmtExecute = dpiTestOci__stmtExecute;
+    dpiOciSymbols.fnStmtFetch2 = dpiTestOci__stmtFetch2;
+    memset(&gCounts, 0, sizeof(gCounts));
+    memset(versionInfo, 0, sizeof(dpiVersionInfo));
+    versionInfo->versionNum = 23;
+    memset(context, 0, sizeof(dpiContext));
+    context->dpiMinorVersion = DPI_MINOR_VERSION;
+    memset(env, 0, sizeof(dpiEnv));
+    env->context = context;
+    env->versionInfo = versionInfo;
+    memset(conn, 0, sizeof(dpiConn));
+    conn->env = env;
+    conn->handle = &gDummyHandle;
+    memset(stmt, 0, sizeof(dpiStmt));
+    stmt->env = env;
+    stmt->conn = conn;
+    stmt->handle = &gDummyHandle;
+    stmt->fetchArraySize = DPI_DEFAULT_FETCH_ARRAY_SIZE;
+    stmt->prefetchRows = DPI_DEFAULT_PREFETCH_ROWS;
+    memset(errorBuffer, 0, sizeof(dpiErrorBuffer));
+    error->buffer = errorBuffer;
+    error->handle = &gDummyHandle;
+    error->env = env;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest__cycle()
+//   Execute the statement and, if requested, fetch from it.
+//-----------------------------------------------------------------------------
+static int dpiTest__cycle(dpiStmt *stmt, int fetch, dpiError *error)
+{
+    if (dpiStmt__execute(stmt, 1, DPI_MODE_EXEC_DEFAULT, 0, error) < 0)
+        return DPI_FAILURE;
+    if (fetch && dpiStmt__fetch(stmt, error) < 0)
+        return DPI_FAILURE;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4600()
+//   Initialize a query statement and execute it repeatedly without fetching;
+// verify that the prefetch rows attribute is set and the SQL_ID is acquired
+// only once.
+//-----------------------------------------------------------------------------
+static int dpiTest_4600(const char **failure)
+{
+    dpiVersionInfo versionInfo;
+    dpiErrorBuffer errorBuffer;
+    dpiError error;
+    dpiStmt stmt;
+    dpiConn conn;
+    dpiContext context;
+    dpiEnv env;
+    int i;
+
+    dpiTest__initialize(&stmt, &conn, &env, &context, &versionInfo, &error,
+            &errorBuffer);
+    if (dpiStmt__init(&stmt, &error) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < 100; i++) {
+        if (dpiTest__cycle(&stmt, 0, &error) < 0)
+            return DPI_FAILURE;
+    }
+    if (gCounts.numExecute != 100)
+        *failure = "expected 100 calls to OCIStmtExecute()";
+    else if (gCounts.numPrefetchRowsSet != 1)
+        *failure = "expected 1 call to set prefetch rows";
+    else if (gCounts.lastPrefetchRows != DPI_DEFAULT_PREFETCH_ROWS)
+        *failure = "prefetch rows not set to the default value";
+    else if (gCounts.numSqlIdGet != 1)
+        *failure = "expected 1 call to get SQL_ID";
+    else if (stmt.sqlIdLength != strlen(gSqlId) ||
+            strncmp(stmt.sqlId, gSqlId, stmt.sqlIdLength) != 0)
+        *failure = "SQL_ID not retained";
+    return (*failure) ? DPI_FAILURE : DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4601()
+//   Initialize a query statement and execute and fetch from it repeatedly;
+// verify that prefetch rows, which is smaller than the fetch array size, is
+// set only once and is not reset before each first fetch, and that the SQL_ID
+// is acquired only once.
+//-----------------------------------------------------------------------------
+static int dpiTest_4601(const char **failure)
+{
+    dpiVersionInfo versionInfo;
+    dpiErrorBuffer errorBuffer;
+    dpiError error;
+    dpiStmt stmt;
+    dpiConn conn;
+    dpiContext context;
+    dpiEnv env;
+    int i;
+
+    dpiTest__initialize(&stmt, &conn, &env, &context, &versionInfo, &error,
+            &errorBuffer);
+    if (dpiStmt__init(&stmt, &error) < 0)
+        return DPI_FAILURE;
+    for (i = 0; i < 100; i++) {
+        if (dpiTest__cycle(&stmt, 1, &error) < 0)
+            return DPI_FAILURE;
+    }
+    if (gCounts.numExecute != 100 || gCounts.numFetch != 100)
+        *failure = "expected 100 calls to execute and fetch";
+    else if (gCounts.numPrefetchRowsSet != 1)
+        *failure = "expected 1 call to set prefetch rows";
+    else if (gCounts.lastPrefetchRows != DPI_DEFAULT_PREFETCH_ROWS)
+        *failure = "prefetch rows reset before fetch";
+    else if (gCounts.numSqlIdGet != 1)
+        *failure = "expected 1 call to get SQL_ID";
+    return (*failure) ? DPI_FAILURE : DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4602()
+//   Initialize a query statement with prefetch disabled and execute and fetch
+// from it repeatedly; verify that prefetch rows is set only once.
+//-----------------------------------------------------------------------------
+static int dpiTest_4602(const char **failure)
+{
+    dpiVersionInfo versionInfo;
+    dpiErrorBuffer errorBuffer;
+    dpiError error;
+    dpiStmt stmt;
+    dpiConn conn;
+    dpiContext context;
+    dpiEnv env;
+    int i;
+
+    dpiTest__initialize(&stmt, &conn, &env, &context, &versionInfo, &error,
+            &errorBuffer);
+    if (dpiStmt__init(&stmt, &error) < 0)
+        return DPI_FAILURE;
+    stmt.prefetchRows = 0;
+    for (i = 0; i < 100; i++) {
+        if (dpiTest__cycle(&stmt, 1, &error) < 0)
+            return DPI_FAILURE;
+    }
+    if (gCounts.numPrefetchRowsSet != 1)
+        *failure = "expected 1 call to set prefetch rows";
+    else if (gCounts.lastPrefetchRows != 0)
+        *failure = "prefetch rows not set to zero";
+    return (*failure) ? DPI_FAILURE : DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4603()
+//   Initialize a query statement and execute it, then change the number of
+// rows to prefetch and execute it again; verify that the new value is set.
+// Then initialize the statement again (as happens when it is prepared) and
+// execute it; verify that the attribute is set and the SQL_ID is acquired
+// again.
+//-----------------------------------------------------------------------------
+static int dpiTest_4603(const char **failure)
+{
+    dpiVersionInfo versionInfo;
+    dpiErrorBuffer errorBuffer;
+    dpiError error;
+    dpiStmt stmt;
+    dpiConn conn;
+    dpiContext context;
+    dpiEnv env;
+
+    dpiTest__initialize(&stmt, &conn, &env, &context, &versionInfo, &error,
+            &errorBuffer);
+    if (dpiStmt__init(&stmt, &error) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__cycle(&stmt, 0, &error) < 0)
+        return DPI_FAILURE;
+    stmt.prefetchRows = 50;
+    if (dpiTest__cycle(&stmt, 0, &error) < 0)
+        return DPI_FAILURE;
+    if (gCounts.numPrefetchRowsSet != 2 || gCounts.lastPrefetchRows != 50) {
+        *failure = "changed prefetch rows not set";
+        return DPI_FAILURE;
+    }
+    if (dpiStmt__init(&stmt, &error) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__cycle(&stmt, 0, &error) < 0)
+        return DPI_FAILURE;
+    if (gCounts.numPrefetchRowsSet != 3)
+        *failure = "prefetch rows not set after statement initialized";
+    else if (gCounts.numSqlIdGet != 2)
+        *failure = "SQL_ID not acquired after statement initialized";
+    return (*failure) ? DPI_FAILURE : DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4604()
+//   Execute and fetch from a query repeatedly with a prefetch value larger than
+// the fetch array size and verify that prefetch is disabled before each fetch
+// and set again before each execute.
+//-----------------------------------------------------------------------------
+static int dpiTest_4604(const char **failure)
+{
+    dpiVersionInfo versionInfo;
+    dpiErrorBuffer errorBuffer;
+    dpiError error;
+    dpiStmt stmt;
+    dpiConn conn;
+    dpiContext context;
+    dpiEnv env;
+    int i;
+
+    dpiTest__initialize(&stmt, &conn, &env, &context, &versionInfo, &error,
+            &errorBuffer);
+    if (dpiStmt__init(&stmt, &error) < 0)
+        return DPI_FAILURE;
+    stmt.prefetchRows = 500;
+    for (i = 0; i < 100; i++) {
+        if (dpiTest__cycle(&stmt, 1, &error) < 0)
+            return DPI_FAILURE;
+    }
+    if (gCounts.numPrefetchRowsSet != 200)
+        *failure = "expected 200 calls to set prefetch rows";
+    else if (gCounts.lastPrefetchRows != 0)
+        *failure = "prefetch rows not reset before fetch";
+    return (*failure) ? DPI_FAILURE : DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// main()
+//-----------------------------------------------------------------------------
+int main(int argc, char **argv)
+{
+    static const dpiTestFunction funcs[] = {
+        dpiTest_4600, dpiTest_4601, dpiTest_4602, dpiTest_4603,
+        dpiTest_4604
+    };
+    static const char *descriptions[] = {
+        "repeated execute sets prefetch rows and gets SQL_ID once",
+        "repeated execute and fetch gets SQL_ID once",
+        "repeated execute and fetch with prefetch disabled sets attr once",
+        "changed prefetch rows and new statement handle are honored",
+        "prefetch larger than fetch array size is reset before each fetch"
+    };
+    uint32_t i, numTests, numPassed = 0;
+    const char *failure;
+
+    numTests = sizeof(funcs) / sizeof(funcs[0]);
+    for (i = 0; i < numTests; i++) {
+        fprintf(stderr, "%d. %s", 4600 + i, descriptions[i]);
+        failure = NULL;
+        if ((*funcs[i])(&failure) == DPI_SUCCESS) {
+            numPassed++;
+            fprintf(stderr, " [OK]\n");
+        } else {
+            fprintf(stderr, " [FAILED]\n    %s\n",
+                    (failure) ? failure : "unexpected error");
+        }
+    }
+    fprintf(stderr, "%d / %d tests passed\n", numPassed, numTests);
+    return numTests - numPassed;
+}
@@ -0,0 +1,276 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2026, Oracle and/or its affiliates.
+//
+// This software is dual-licensed to you under the Universal Permissive License
+// (UPL) 1.0 as shown at https://oss.oracle.com/licenses/upl and Apache License
+// 2.0 as shown at http://www.apache.org/licenses/LICENSE-2.0. You may choose
+// either license.
+//
+// If you elect to accept the software under the Apache License, Version 2.0,
+// the following applies:
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// test_4700_sql_normalizer.c
+//   Test suite for the SQL normalizer. Unlike most of the other test suites,
+// this one does not require an Oracle Client library or database: the library
+// is compiled directly into the executable and the normalized SQL text is
+// compared with the expected text without preparing it.
+//-----------------------------------------------------------------------------
+
+#include "../embed/dpi.c"
+
+#include <stdio.h>
+
+// test case function signature
+typedef int (*dpiTestFunction)(const char **failure);
+
+// failure message buffer
+static char gFailure[512];
+
+
+//-----------------------------------------------------------------------------
+// dpiTest__check()
+//   Normalize the SQL text and verify that the result matches the expected
+// SQL text; if the expected SQL text is NULL, the statement is expected to be
+// left untouched.
+//-----------------------------------------------------------------------------
+static int dpiTest__check(const char *sql, const char *expectedSql,
+        const char **failure)
+{
+    dpiSqlNormalized normalized;
+    dpiErrorBuffer errorBuffer;
+    dpiError error;
+    int matches;
+
+    memset(&errorBuffer, 0, sizeof(errorBuffer));
+    error.buffer = &errorBuffer;
+    error.env = NULL;
+    error.handle = NULL;
+    if (dpiSqlNormalizer__normalize(sql, (uint32_t) strlen(sql), &normalized,
+            &error) < 0) {
+        *failure = "unable to normalize SQL";
+        return DPI_FAILURE;
+    }
+    if (!expectedSql) {
+        matches = (!normalized.sql && normalized.numLiterals == 0);
+    } else {
+        matches = (normalized.sql &&
+                normalized.sqlLength == strlen(expectedSql) &&
+                strncmp(normalized.sql, expectedSql,
+                        normalized.sqlLength) == 0);
+    }
+    if (!matches) {
+        snprintf(gFailure, sizeof(gFailure),
+                "SQL: %s\n    expected: %s\n    actual: %.*s", sql,
+                (expectedSql) ? expectedSql : "(untouched)",
+                (normalized.sql) ? (int) normalized.sqlLength : 11,
+                (normalized.sql) ? normalized.sql : "(untouched)");
+        *failure = gFailure;
+    }
+    dpiSqlNormalizer__freeNormalized(&normalized);
+    return (matches) ? DPI_SUCCESS : DPI_FAILURE;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4700()
+//   Verify that numeric and string literals in WHERE clauses and DML
+// statements are replaced and that the values of the literals are correct.
+//-----------------------------------------------------------------------------
+static int dpiTest_4700(const char **failure)
+{
+    const char *sql = "update t set a = 5, b = 'x' where c = 'it''s'";
+    dpiSqlNormalized normalized;
+    dpiErrorBuffer errorBuffer;
+    dpiSqlLiteral *literal;
+    dpiError error;
+
+    if (dpiTest__check(sql, "update t set a = :1, b = :2 where c = :3",
+            failure) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__check("delete from t where a = 1.5e3 and b = q'[x'y]'",
+            "delete from t where a = :1 and b = :2", failure) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__check("insert into t values (1, 'a', n'b', 2.5f)",
+            "insert into t values (:1, :2, n'b', 2.5f)", failure) < 0)
+        return DPI_FAILURE;
+    memset(&errorBuffer, 0, sizeof(errorBuffer));
+    error.buffer = &errorBuffer;
+    error.env = NULL;
+    error.handle = NULL;
+    if (dpiSqlNormalizer__normalize(sql, (uint32_t) strlen(sql), &normalized,
+            &error) < 0) {
+        *failure = "unable to normalize SQL";
+        return DPI_FAILURE;
+    }
+    literal = &normalized.literals[2];
+    if (normalized.numLiterals != 3 || literal->isNumber ||
+            literal->valueLength != 4 ||
+            strncmp(literal->value, "it's", 4) != 0)
+        *failure = "literal values do not match";
+    dpiSqlNormalizer__freeNormalized(&normalized);
+    return (*failure) ? DPI_FAILURE : DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4701()
+//   Verify that literals in select lists (including those of subqueries) are
+// left untouched while those in the rest of the query are replaced.
+//-----------------------------------------------------------------------------
+static int dpiTest_4701(const char **failure)
+{
+    if (dpiTest__check("select 1, 'a' from dual where x = 2",
+            "select 1, 'a' from dual where x = :1", failure) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__check(
+            "select (select 3 from dual where y = 4) from t where z = 5",
+            "select (select 3 from dual where y = 4) from t where z = :1",
+            failure) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__check(
+            "select a from t where b in (select 6 from s where c = 7) "
+            "union select 8 from u where d = 9",
+            "select a from t where b in (select 6 from s where c = :1) "
+            "union select 8 from u where d = :2", failure) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__check("select 1 from dual order by 1", NULL, failure) < 0)
+        return DPI_FAILURE;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4702()
+//   Verify that literals within the arguments of SQL/JSON and SQL/XML
+// functions are left untouched, including those nested in further
+// parentheses, and that type sizes and precisions are left untouched.
+//-----------------------------------------------------------------------------
+static int dpiTest_4702(const char **failure)
+{
+    if (dpiTest__check(
+            "select * from t, json_table(t.doc, '$' columns (a number "
+            "path '$.a', nested path '$.b[*]' columns (c varchar2(10) "
+            "path '$.c'))) j where t.id = 1",
+            "select * from t, json_table(t.doc, '$' columns (a number "
+            "path '$.a', nested path '$.b[*]' columns (c varchar2(10) "
+            "path '$.c'))) j where t.id = :1", failure) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__check(
+            "select * from t where json_exists(doc, '$?(@.a == 1)') "
+            "and cast(b as number(5, 2)) = 3.25",
+            "select * from t where json_exists(doc, '$?(@.a == 1)') "
+            "and cast(b as number(5, 2)) = :1", failure) < 0)
+        return DPI_FAILURE;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4703()
+//   Verify that the literals required by the SAMPLE, REJECT LIMIT, CYCLE and
+// FOR UPDATE WAIT clauses and typed literals are left untouched.
+//-----------------------------------------------------------------------------
+static int dpiTest_4703(const char **failure)
+{
+    if (dpiTest__check(
+            "select * from t sample block (10) seed (5) where a = 1",
+            "select * from t sample block (10) seed (5) where a = :1",
+            failure) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__check(
+            "insert into t select * from s where a = 1 "
+            "log errors reject limit 10",
+            "insert into t select * from s where a = :1 "
+            "log errors reject limit 10", failure) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__check(
+            "with r (n) as (select 1 from dual union all select n + 1 "
+            "from r where n < 5) cycle n set c to 'Y' default 'N' "
+            "select n from r where n > 2",
+            "with r (n) as (select 1 from dual union all select n + 1 "
+            "from r where n < :1) cycle n set c to 'Y' default 'N' "
+            "select n from r where n > :2", failure) < 0)
+        return DPI_FAILURE;
+    if (dpiTest__check("select * from t where a = date '2026-01-01' "
+            "for update wait 5", NULL, failure) < 0)
+        return DPI_FAILURE;
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiTest_4704()
+//   Verify that statements which cannot be normalized are left untouched.
+//-----------------------------------------------------------------------------
+static int dpiTest_4704(const char **failure)
+{
+    static const char *sqls[] = {
+        "select * from t pivot (sum(a) for b in ('X', 'Y')) where c = 1",
+        "select * from t unpivot (v for k in (a as 'A', b as 'B')) "
+                "where c = 1",
+        "select a, count(*) from t where b = 1 group by a",
+        "select * from t where a = :1 and b = 2",
+        "begin p(1); end;",
+        "create table t (a number(5) default 1)",
+        "with function f return number is begin return 1; end; "
+                "select f from dual where a = 1",
+        NULL
+    };
+    const char **sql;
+
+    for (sql = sqls; *sql; sql++) {
+        if (dpiTest__check(*sql, NULL, failure) < 0)
+            return DPI_FAILURE;
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// main()
+//-----------------------------------------------------------------------------
+int main(int argc, char **argv)
+{
+    static const dpiTestFunction funcs[] = {
+        dpiTest_4700, dpiTest_4701, dpiTest_4702, dpiTest_4703, dpiTest_4704
+    };
+    static const char *descriptions[] = {
+        "literals in WHERE clauses and DML statements are replaced",
+        "literals in select lists are left untouched",
+        "literals in SQL/JSON functions and type sizes are left untouched",
+        "literals required by SAMPLE, REJECT LIMIT, CYCLE and WAIT untouched",
+        "statements which cannot be normalized are left untouched"
+    };
+    uint32_t i, numTests, numPassed = 0;
+    const char *failure;
+
+    numTests = sizeof(funcs) / sizeof(funcs[0]);
+    for (i = 0; i < numTests; i++) {
+        fprintf(stderr, "%d. %s", 4700 + i, descriptions[i]);
+        failure = NULL;
+        if ((*funcs[i])(&failure) == DPI_SUCCESS) {
+            numPassed++;
+            fprintf(stderr, " [OK]\n");
+        } else {
+            fprintf(stderr, " [FAILED]\n    %s\n",
+                    (failure) ? failure : "unexpected error");
+        }
+    }
+    fprintf(stderr, "%d / %d tests passed\n", numPassed, numTests);
+    return numTests - numPassed;
+}